@@ -42,6 +42,27 @@ describe('ptensor-ts', () => {
     expect(Array.from(t.data as Uint8Array)).toEqual([10, 20, 30]);
   });
 
+  it('keeps the preview, stats and tile fields', () => {
+    const raw = JSON.stringify({
+      ...JSON.parse(makeJson('uint8', [2, 3], new Uint8Array(6))),
+      preview: { source_shape: [4, 6], step: [2, 2], channel_axis: -1 },
+      stats: [{ min: 0, max: 23, non_finite: 1, histogram: [12, 11] }],
+    });
+    const json = parseTensorJson(raw);
+    expect(json.preview).toEqual({ source_shape: [4, 6], step: [2, 2], channel_axis: -1 });
+    expect(json.stats).toEqual([{ min: 0, max: 23, non_finite: 1, histogram: [12, 11] }]);
+    expect(json.tile).toBeUndefined();
+
+    const tile = parseTensorJson(
+      JSON.stringify({
+        ...JSON.parse(makeJson('uint8', [1, 2], new Uint8Array(2))),
+        tile: { row: 1, col: 4, rows: 1, cols: 2 },
+      }),
+    );
+    expect(tile.tile).toEqual({ row: 1, col: 4, rows: 1, cols: 2 });
+    expect(tile.preview).toBeUndefined();
+  });
+
   it('helpers compute strides and sizes', () => {
     expect(contiguousStride([2, 3, 4])).toEqual([12, 4, 1]);
     expect(numElements([2, 3, 4])).toBe(24);
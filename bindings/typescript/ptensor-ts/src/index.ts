@@ -11,7 +11,13 @@ export {
   viewNumericArray,
 } from './numericArray';
 export { base64ToBytes, bytesToBase64 } from './base64';
-export { parseTensorJson, type TensorJson } from './tensorJson';
+export {
+  type ChannelStatsJson,
+  parseTensorJson,
+  type TensorJson,
+  type TensorPreviewJson,
+  type TensorTileJson,
+} from './tensorJson';
 export {
   contiguousStride,
   numElements,
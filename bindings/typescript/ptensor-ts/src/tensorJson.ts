@@ -1,15 +1,88 @@
+/**
+ * Present on `p10::to_json_preview_debug` output: the blob holds a downsampled
+ * copy of a `source_shape` tensor, keeping every `step`-th element per axis.
+ */
+export type TensorPreviewJson = {
+  source_shape: number[];
+  step: number[];
+  /** Axis kept at full resolution as channels, or -1. */
+  channel_axis: number;
+};
+
+/** Per-channel statistics of the full-resolution tensor behind a preview. */
+export type ChannelStatsJson = {
+  /** null when the channel has no finite value. */
+  min: number | null;
+  max: number | null;
+  non_finite: number;
+  histogram: number[];
+};
+
+/** Present on `p10::to_json_tile_debug` output: the image-plane region sent. */
+export type TensorTileJson = {
+  row: number;
+  col: number;
+  rows: number;
+  cols: number;
+};
+
 /**
  * The wire format emitted by `p10::to_json_debug` and by binaries that print a
  * tensor to stdout: `{dtype, shape, stride, blob}` where `blob` is the raw
- * little-endian element bytes, base64-encoded.
+ * little-endian element bytes, base64-encoded. The preview and tile encoders
+ * add the optional fields below.
  */
 export type TensorJson = {
   dtype: string;
   shape: number[];
   stride: number[];
   blob: string;
+  preview?: TensorPreviewJson;
+  stats?: ChannelStatsJson[];
+  tile?: TensorTileJson;
 };
 
+const toNumbers = (values: unknown[]): number[] => values.map((n) => Number(n));
+const isObject = (value: unknown): value is Record<string, unknown> =>
+  !!value && typeof value === 'object' && !Array.isArray(value);
+const toNullableNumber = (value: unknown): number | null =>
+  value === null || value === undefined ? null : Number(value);
+
+function parsePreview(value: unknown): TensorPreviewJson | undefined {
+  if (!isObject(value) || !Array.isArray(value.source_shape) || !Array.isArray(value.step)) {
+    return undefined;
+  }
+  return {
+    source_shape: toNumbers(value.source_shape as unknown[]),
+    step: toNumbers(value.step as unknown[]),
+    channel_axis: Number(value.channel_axis ?? -1),
+  };
+}
+
+function parseStats(value: unknown): ChannelStatsJson[] | undefined {
+  if (!Array.isArray(value)) {
+    return undefined;
+  }
+  return value.filter(isObject).map((channel) => ({
+    min: toNullableNumber(channel.min),
+    max: toNullableNumber(channel.max),
+    non_finite: Number(channel.non_finite ?? 0),
+    histogram: Array.isArray(channel.histogram) ? toNumbers(channel.histogram as unknown[]) : [],
+  }));
+}
+
+function parseTile(value: unknown): TensorTileJson | undefined {
+  if (!isObject(value)) {
+    return undefined;
+  }
+  return {
+    row: Number(value.row),
+    col: Number(value.col),
+    rows: Number(value.rows),
+    cols: Number(value.cols),
+  };
+}
+
 /**
  * Extracts and parses a `TensorJson` from a raw debugger / stdout string. The
  * input may be wrapped (e.g. an LLDB summary `(const char *) $0 = 0x.. "{...}"`),
@@ -47,10 +120,23 @@ export function parseTensorJson(rawResult: string): TensorJson {
   ) {
     throw new Error('Tensor JSON is missing expected fields.');
   }
-  return {
+  const json: TensorJson = {
     dtype: o.dtype,
-    shape: (o.shape as unknown[]).map((n) => Number(n)),
-    stride: (o.stride as unknown[]).map((n) => Number(n)),
+    shape: toNumbers(o.shape as unknown[]),
+    stride: toNumbers(o.stride as unknown[]),
     blob: o.blob,
   };
+  const preview = parsePreview(o.preview);
+  const stats = parseStats(o.stats);
+  const tile = parseTile(o.tile);
+  if (preview) {
+    json.preview = preview;
+  }
+  if (stats) {
+    json.stats = stats;
+  }
+  if (tile) {
+    json.tile = tile;
+  }
+  return json;
 }
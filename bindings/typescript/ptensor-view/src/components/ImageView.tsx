@@ -1,4 +1,4 @@
-import { useEffect, useRef, useState } from 'react';
+import { type MouseEvent, useEffect, useRef, useState } from 'react';
 import type { ImagePlane } from '../resolveView';
 import { imageMapping, planeToRgba } from '../imageData';
 import type { TensorStats } from '../stats';
@@ -9,10 +9,12 @@ interface Props {
     plane: ImagePlane;
     batch: number;
     stats: TensorStats;
+    /** Called with the clicked pixel, in plane coordinates. */
+    onPick?: (x: number, y: number) => void;
 }
 
 /** Renders one or more image planes; batched tensors get a tab per image. */
-export function ImageView({ tensor, plane, batch, stats }: Props) {
+export function ImageView({ tensor, plane, batch, stats, onPick }: Props) {
     const [active, setActive] = useState(0);
     return (
         <div>
@@ -30,7 +32,13 @@ export function ImageView({ tensor, plane, batch, stats }: Props) {
                     ))}
                 </div>
             )}
-            <ImageCanvas tensor={tensor} plane={plane} index={active} stats={stats} />
+            <ImageCanvas
+                tensor={tensor}
+                plane={plane}
+                index={active}
+                stats={stats}
+                onPick={onPick}
+            />
         </div>
     );
 }
@@ -40,11 +48,13 @@ function ImageCanvas({
     plane,
     index,
     stats,
+    onPick,
 }: {
     tensor: TensorView;
     plane: ImagePlane;
     index: number;
     stats: TensorStats;
+    onPick?: (x: number, y: number) => void;
 }) {
     const ref = useRef<HTMLCanvasElement>(null);
 
@@ -69,5 +79,22 @@ function ImageCanvas({
         ctx.putImageData(img, 0, 0);
     }, [tensor, plane, index, stats]);
 
-    return <canvas className="ptv-canvas" width={plane.width} height={plane.height} ref={ref} />;
+    // The canvas may be scaled by CSS; map the click back to plane pixels.
+    const pick = (event: MouseEvent<HTMLCanvasElement>) => {
+        const rect = event.currentTarget.getBoundingClientRect();
+        const x = Math.floor(((event.clientX - rect.left) * plane.width) / rect.width);
+        const y = Math.floor(((event.clientY - rect.top) * plane.height) / rect.height);
+        const clamp = (v: number, size: number) => Math.min(Math.max(v, 0), size - 1);
+        onPick?.(clamp(x, plane.width), clamp(y, plane.height));
+    };
+
+    return (
+        <canvas
+            className={onPick ? 'ptv-canvas ptv-canvas-zoomable' : 'ptv-canvas'}
+            width={plane.width}
+            height={plane.height}
+            ref={ref}
+            onClick={onPick ? pick : undefined}
+        />
+    );
 }
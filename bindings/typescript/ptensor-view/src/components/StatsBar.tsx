@@ -1,13 +1,41 @@
 import { formatNumber } from '../format';
 import type { TensorStats } from '../stats';
+import type { ChannelStats } from '../types';
 
-export function StatsBar({ stats }: { stats: TensorStats }) {
+export function StatsBar({
+    stats,
+    channels,
+    downsampled = false,
+}: {
+    stats: TensorStats;
+    /** Full-resolution per-channel stats sent with a preview. */
+    channels?: ChannelStats[];
+    /** True when the mean is taken over a downsampled preview. */
+    downsampled?: boolean;
+}) {
     return (
         <div className="ptv-stats">
             <Stat label="min" value={formatNumber(stats.min)} />
             <Stat label="max" value={formatNumber(stats.max)} />
-            <Stat label="mean" value={formatNumber(stats.mean)} />
+            <Stat
+                label={downsampled ? 'mean (preview)' : 'mean'}
+                value={formatNumber(stats.mean)}
+            />
             <Stat label="count" value={String(stats.count)} />
+            {!!stats.nonFinite && <Stat label="non-finite" value={String(stats.nonFinite)} />}
+            {channels?.map((channel, i) => {
+                const multi = channels.length > 1;
+                if (!multi && channel.histogram.length === 0) {
+                    return null;
+                }
+                return (
+                    <div className="ptv-stat" key={i}>
+                        <div className="ptv-stat-label">{multi ? `ch${i}` : 'histogram'}</div>
+                        {multi && `${formatNumber(channel.min)} … ${formatNumber(channel.max)}`}
+                        <Histogram bins={channel.histogram} />
+                    </div>
+                );
+            })}
         </div>
     );
 }
@@ -20,3 +48,22 @@ function Stat({ label, value }: { label: string; value: string }) {
         </div>
     );
 }
+
+/** Bar chart of one channel's histogram, scaled to its fullest bin. */
+function Histogram({ bins }: { bins: number[] }) {
+    const peak = Math.max(0, ...bins);
+    if (peak === 0) {
+        return null;
+    }
+    return (
+        <div className="ptv-histogram">
+            {bins.map((count, i) => (
+                <div
+                    key={i}
+                    className="ptv-histogram-bin"
+                    style={{ height: `${(100 * count) / peak}%` }}
+                />
+            ))}
+        </div>
+    );
+}
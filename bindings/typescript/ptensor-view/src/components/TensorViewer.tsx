@@ -1,7 +1,7 @@
 import { useMemo } from 'react';
-import { computeStats } from '../stats';
+import { type TensorStats, tensorStats } from '../stats';
 import { resolveView } from '../resolveView';
-import type { TensorView } from '../types';
+import type { TensorTile, TensorView } from '../types';
 import { StatsBar } from './StatsBar';
 import { ImageView } from './ImageView';
 import { LargeTablePreview, TableView } from './TableView';
@@ -12,6 +12,13 @@ export interface TensorViewerProps {
     tableThreshold?: number;
     /** When set, a refresh button is shown that re-reads the tensor from its source. */
     onRefresh?: () => void;
+    /**
+     * When set, clicking a downsampled image asks for the full-resolution
+     * region around the click; the answer comes back as `zoom`.
+     */
+    onZoom?: (region: TensorTile) => void;
+    /** Full-resolution tile of `tensor` to show below the preview. */
+    zoom?: TensorView;
 }
 
 /** Row-major (C-contiguous) layout: each stride is the product of the trailing dims. */
@@ -31,16 +38,45 @@ function isContiguous(shape: bigint[], stride: bigint[]): boolean {
 }
 
 /** Top-level panel: header + stats + the resolved table/image body. */
-export function TensorViewer({ tensor, tableThreshold = 256, onRefresh }: TensorViewerProps) {
+export function TensorViewer({
+    tensor,
+    tableThreshold = 256,
+    onRefresh,
+    onZoom,
+    zoom,
+}: TensorViewerProps) {
     const shape = useMemo(() => tensor.shape.map(Number), [tensor.shape]);
     const stride = useMemo(() => tensor.stride.map(Number), [tensor.stride]);
     const contiguous = useMemo(
         () => isContiguous(tensor.shape, tensor.stride),
         [tensor.shape, tensor.stride]
     );
-    const stats = useMemo(() => computeStats(tensor.array), [tensor.array]);
+    const stats = useMemo(() => tensorStats(tensor), [tensor]);
     const view = useMemo(() => resolveView(shape, tableThreshold), [shape, tableThreshold]);
 
+    // A preview's blob is a repacked copy: show the source shape, and the
+    // preview shape and step instead of the (always contiguous) blob stride.
+    const preview = tensor.preview;
+    const step = preview ? Math.max(1, ...preview.step) : 1;
+    let layout = `shape=[${shape.join(', ')}] stride=[${stride.join(', ')}]`;
+    if (preview) {
+        layout = `shape=[${preview.sourceShape.map(Number).join(', ')}]`;
+        if (step > 1) {
+            layout += ` preview=[${shape.join(', ')}] step=[${preview.step.join(', ')}]`;
+        }
+    }
+    const image = view.image;
+    const pick =
+        step > 1 && onZoom && image
+            ? (x: number, y: number) =>
+                  onZoom({
+                      row: Math.max(0, y * step - Math.floor(image.height / 2)),
+                      col: Math.max(0, x * step - Math.floor(image.width / 2)),
+                      rows: image.height,
+                      cols: image.width,
+                  })
+            : undefined;
+
     return (
         <div className="ptv-root">
             <div className="ptv-header">
@@ -52,25 +88,57 @@ export function TensorViewer({ tensor, tableThreshold = 256, onRefresh }: Tensor
                 )}
             </div>
             <div className="ptv-meta">
-                shape=[{shape.join(', ')}] stride=[{stride.join(', ')}] elems={stats.count}{' '}
+                {layout} elems={stats.count}{' '}
                 <span className="ptv-badge ptv-badge-dtype">{tensor.dtype}</span>{' '}
-                <span
-                    className={`ptv-badge ${contiguous ? 'ptv-badge-ok' : 'ptv-badge-warn'}`}
-                >
-                    {contiguous ? 'contiguous' : 'non-contiguous'}
-                </span>
+                {!preview && (
+                    <span
+                        className={`ptv-badge ${contiguous ? 'ptv-badge-ok' : 'ptv-badge-warn'}`}
+                    >
+                        {contiguous ? 'contiguous' : 'non-contiguous'}
+                    </span>
+                )}
+                {pick && ' · click the image for full resolution'}
             </div>
-            <StatsBar stats={stats} />
+            <StatsBar stats={stats} channels={tensor.channelStats} downsampled={step > 1} />
             {view.mode === 'table' && <TableView tensor={tensor} />}
-            {view.mode === 'image' && view.image && (
+            {view.mode === 'image' && image && (
                 <ImageView
                     tensor={tensor}
-                    plane={view.image}
+                    plane={image}
                     batch={view.batch}
                     stats={stats}
+                    onPick={pick}
                 />
             )}
             {view.mode === 'large-table' && <LargeTablePreview tensor={tensor} />}
+            {zoom?.tile && <ZoomView tile={zoom} region={zoom.tile} stats={stats} />}
+        </div>
+    );
+}
+
+/** A full-resolution tile, drawn with the source tensor's display mapping. */
+function ZoomView({
+    tile,
+    region,
+    stats,
+}: {
+    tile: TensorView;
+    region: TensorTile;
+    stats: TensorStats;
+}) {
+    const shape = useMemo(() => tile.shape.map(Number), [tile.shape]);
+    const view = useMemo(() => resolveView(shape, 0), [shape]);
+    return (
+        <div className="ptv-zoom">
+            <div className="ptv-zoom-header">
+                full resolution: rows {region.row}–{region.row + region.rows - 1}, cols{' '}
+                {region.col}–{region.col + region.cols - 1}
+            </div>
+            {view.mode === 'image' && view.image ? (
+                <ImageView tensor={tile} plane={view.image} batch={view.batch} stats={stats} />
+            ) : (
+                <LargeTablePreview tensor={tile} />
+            )}
         </div>
     );
 }
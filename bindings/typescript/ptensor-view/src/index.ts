@@ -3,7 +3,14 @@
 // FFI dependency is pulled in here, so this entry is safe to consume from a
 // VS Code webview, the Electron pilot, or a plain browser playground.
 
-export type { DTypeString, NumericArray, TensorView } from './types';
+export type {
+    ChannelStats,
+    DTypeString,
+    NumericArray,
+    TensorPreview,
+    TensorTile,
+    TensorView,
+} from './types';
 export { DTYPE_SIZES, elementAt, isFloatDtype } from './types';
 
 export { TensorViewer } from './components/TensorViewer';
@@ -11,7 +18,7 @@ export type { TensorViewerProps } from './components/TensorViewer';
 export { SampleBrowser } from './components/SampleBrowser';
 export { SAMPLES } from './samples';
 
-export { computeStats } from './stats';
+export { computeStats, tensorStats } from './stats';
 export type { TensorStats } from './stats';
 
 export { resolveView } from './resolveView';
@@ -1,10 +1,12 @@
-import { elementAt, type NumericArray } from './types';
+import { elementAt, type NumericArray, type TensorView } from './types';
 
 export interface TensorStats {
     min: number;
     max: number;
     mean: number;
     count: number;
+    /** NaN and infinities in the full-resolution tensor, when known. */
+    nonFinite?: number;
 }
 
 export function computeStats(data: NumericArray): TensorStats {
@@ -27,3 +29,23 @@ export function computeStats(data: NumericArray): TensorStats {
     }
     return { min, max, mean: sum / n, count: n };
 }
+
+/**
+ * Stats of the tensor `view` stands for. A preview carries the debuggee's
+ * full-resolution min/max and element count, which replace the ones of the
+ * downsampled array; the mean is still taken over the preview.
+ */
+export function tensorStats(view: TensorView): TensorStats {
+    const stats = computeStats(view.array);
+    if (!view.preview || !view.channelStats?.length) {
+        return stats;
+    }
+    const finite = view.channelStats.filter((channel) => channel.min <= channel.max);
+    return {
+        min: finite.length ? Math.min(...finite.map((channel) => channel.min)) : NaN,
+        max: finite.length ? Math.max(...finite.map((channel) => channel.max)) : NaN,
+        mean: stats.mean,
+        count: view.preview.sourceShape.reduce((a, b) => a * Number(b), 1),
+        nonFinite: view.channelStats.reduce((a, channel) => a + channel.nonFinite, 0),
+    };
+}
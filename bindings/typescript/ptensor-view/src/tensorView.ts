@@ -1,5 +1,10 @@
 import { asDType, base64ToBytes, type TensorJson, viewNumericArray } from 'ptensor-ts';
-import { type DTypeString, type NumericArray, type TensorView } from './types';
+import {
+    type ChannelStats,
+    type DTypeString,
+    type NumericArray,
+    type TensorView,
+} from './types';
 
 // The transport form (`TensorJson` = `{dtype, shape, stride, blob}`, identical
 // to what `p10::to_json_debug` emits) and the raw byte decode are owned by
@@ -14,13 +19,34 @@ export function fromTensorJson(json: TensorJson, name?: string): TensorView {
     if (!dtype) {
         throw new Error(`Unknown dtype '${json.dtype}' in tensor JSON.`);
     }
-    return {
+    const view: TensorView = {
         name,
         dtype,
         shape: json.shape.map(BigInt),
         stride: json.stride.map(BigInt),
         array: bytesToTyped(base64ToArrayBuffer(json.blob), dtype),
     };
+    if (json.preview) {
+        view.preview = {
+            sourceShape: json.preview.source_shape.map(BigInt),
+            step: json.preview.step,
+            channelAxis: json.preview.channel_axis,
+        };
+    }
+    if (json.stats) {
+        view.channelStats = json.stats.map(
+            (channel): ChannelStats => ({
+                min: channel.min ?? NaN,
+                max: channel.max ?? NaN,
+                nonFinite: channel.non_finite,
+                histogram: channel.histogram,
+            })
+        );
+    }
+    if (json.tile) {
+        view.tile = { ...json.tile };
+    }
+    return view;
 }
 
 /**
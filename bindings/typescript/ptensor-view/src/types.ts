@@ -24,6 +24,38 @@ export interface TensorView {
     dtype: DTypeString;
     /** Optional label for the panel header (e.g. the debugger expression). */
     name?: string;
+    /** Set when `array` is a downsampled preview of a larger tensor. */
+    preview?: TensorPreview;
+    /** Per-channel stats of the full-resolution tensor, sent with a preview. */
+    channelStats?: ChannelStats[];
+    /** Set when `array` is a full-resolution region of the image plane. */
+    tile?: TensorTile;
+}
+
+/** Where a preview came from: every `step`-th element of `sourceShape`. */
+export interface TensorPreview {
+    sourceShape: bigint[];
+    step: number[];
+    /** Axis kept at full resolution as channels, or -1. */
+    channelAxis: number;
+}
+
+export interface ChannelStats {
+    /** NaN when the channel has no finite value. */
+    min: number;
+    max: number;
+    /** NaN and infinities, which min/max and the histogram leave out. */
+    nonFinite: number;
+    /** Equal-width bins over [min, max]; empty when not requested. */
+    histogram: number[];
+}
+
+/** The image-plane region a tile covers, in full-resolution rows and columns. */
+export interface TensorTile {
+    row: number;
+    col: number;
+    rows: number;
+    cols: number;
 }
 
 /** Size in bytes of one element of each dtype (float16 measured on the wire). */
@@ -9,6 +9,7 @@ import { TensorViewer } from '../components/TensorViewer';
 import { SAMPLES } from '../samples';
 import { type TensorJson } from 'ptensor-ts';
 import { fromTensorJson } from '../tensorView';
+import type { TensorView } from '../types';
 // Inlined so the whole webview ships as a single self-contained JS bundle.
 import css from '../styles.css?inline';
 
@@ -33,6 +34,14 @@ interface TensorMessage {
     tableThreshold?: number;
     /** Whether the host can re-read this tensor (false for demo/sample tensors). */
     canRefresh?: boolean;
+    /** Whether the host can send full-resolution tiles of a preview. */
+    canZoom?: boolean;
+}
+
+/** Host reply to a zoom request: a full-resolution tile of the shown tensor. */
+interface TileMessage {
+    type: 'tile';
+    tensor: TensorJson;
 }
 
 /** Demo mode: render the built-in sample tensors, no debugger needed. */
@@ -63,28 +72,51 @@ function mount(): Root {
 const root = mount();
 const vscode = window.acquireVsCodeApi?.();
 
-function render(msg: HostMessage): void {
-    const body =
-        msg.type === 'demo' ? (
-            <SampleBrowser samples={SAMPLES} tableThreshold={msg.tableThreshold} />
-        ) : (
+// The tensor on screen, kept so a tile reply can re-render it with the zoom.
+let shown: { msg: TensorMessage; tensor: TensorView } | undefined;
+
+function renderTensor(msg: TensorMessage, tensor: TensorView, zoom?: TensorView): void {
+    shown = { msg, tensor };
+    root.render(
+        <StrictMode>
             <TensorViewer
-                tensor={fromTensorJson(msg.tensor, msg.name)}
+                tensor={tensor}
                 tableThreshold={msg.tableThreshold}
                 onRefresh={
                     msg.canRefresh && vscode
                         ? () => vscode.postMessage({ type: 'refresh' })
                         : undefined
                 }
+                onZoom={
+                    msg.canZoom && vscode
+                        ? (region) => vscode.postMessage({ type: 'tile', region })
+                        : undefined
+                }
+                zoom={zoom}
             />
-        );
-    root.render(<StrictMode>{body}</StrictMode>);
+        </StrictMode>
+    );
+}
+
+function render(msg: HostMessage): void {
+    if (msg.type === 'tensor') {
+        renderTensor(msg, fromTensorJson(msg.tensor, msg.name));
+        return;
+    }
+    shown = undefined;
+    root.render(
+        <StrictMode>
+            <SampleBrowser samples={SAMPLES} tableThreshold={msg.tableThreshold} />
+        </StrictMode>
+    );
 }
 
 window.addEventListener('message', (event: MessageEvent) => {
-    const msg = event.data as HostMessage | undefined;
+    const msg = event.data as HostMessage | TileMessage | undefined;
     if (msg?.type === 'tensor' || msg?.type === 'demo') {
         render(msg);
+    } else if (msg?.type === 'tile' && shown) {
+        renderTensor(shown.msg, shown.tensor, fromTensorJson(msg.tensor, shown.msg.name));
     }
 });
 
@@ -0,0 +1,58 @@
+#ifndef PTENSOR_CPU_H_
+#define PTENSOR_CPU_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "config.h"
+#include "ptensor_error.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// One logical CPU (hardware thread) the process may run on.
+typedef struct {
+    int32_t cpu;        ///< OS CPU number.
+    int32_t core;       ///< Physical core, dense from 0; SMT siblings share it.
+    int32_t package;    ///< Socket.
+    int32_t smt_index;  ///< 0 for the first hardware thread of the core.
+    int32_t capacity;   ///< Relative performance, 1024 for the fastest cores.
+    int32_t l2_group;   ///< CPUs sharing an L2 have the same group.
+    int32_t llc_group;  ///< CPUs sharing the last-level cache have the same group.
+    uint64_t l1_bytes;  ///< Data cache sizes, 0 when unknown.
+    uint64_t l2_bytes;
+    uint64_t llc_bytes;
+} P10CpuInfo;
+
+/// Returns the number of CPUs the process may run on.
+PTENSOR_API size_t p10_cpu_count(void);
+
+/// Fills cpus with up to capacity entries, ascending by CPU number, and sets
+/// *out_count to the number of CPUs. Returns P10_OUT_OF_RANGE when capacity is
+/// too small (the first capacity entries are still written).
+PTENSOR_API P10ErrorEnum p10_get_cpu_topology(
+    P10CpuInfo* cpus,
+    size_t capacity,
+    size_t* out_count
+);
+
+/// Fills cpus with the CPUs parallel kernels pin their workers to, in worker
+/// order, like p10_get_cpu_topology.
+PTENSOR_API P10ErrorEnum p10_get_worker_cpus(int32_t* cpus, size_t capacity, size_t* out_count);
+
+/// Pins (non-zero) or stops pinning (0) parallel kernel workers to the worker CPUs.
+PTENSOR_API void p10_set_thread_affinity(int enabled);
+
+/// Returns 1 if parallel kernel workers are pinned, 0 otherwise.
+PTENSOR_API int p10_get_thread_affinity(void);
+
+/// Returns how many threads a parallel kernel runs on. With affinity on, that
+/// is one per worker CPU plus the unpinned calling thread.
+PTENSOR_API int32_t p10_get_parallel_thread_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // PTENSOR_CPU_H_
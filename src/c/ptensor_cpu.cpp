@@ -0,0 +1,85 @@
+#include "ptensor_cpu.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <ptensor/cpu_topology.hpp>
+
+#include "update_error_state.hpp"
+
+namespace {
+template<typename T, typename Convert>
+P10ErrorEnum copy_out(
+    const std::vector<T>& values,
+    size_t capacity,
+    size_t* out_count,
+    Convert convert
+) {
+    *out_count = values.size();
+    for (size_t i = 0; i < std::min(capacity, values.size()); ++i) {
+        convert(values[i], i);
+    }
+    if (capacity < values.size()) {
+        return p10::update_error_state(
+            p10::P10Error::OutOfRange << "Buffer holds " + std::to_string(capacity)
+                + " entries, " + std::to_string(values.size()) + " needed"
+        );
+    }
+    return P10ErrorEnum::P10_OK;
+}
+}  // namespace
+
+PTENSOR_API size_t p10_cpu_count(void) {
+    return p10::get_cpu_topology().size();
+}
+
+PTENSOR_API P10ErrorEnum p10_get_cpu_topology(
+    P10CpuInfo* cpus,
+    size_t capacity,
+    size_t* out_count
+) {
+    if (out_count == nullptr || (cpus == nullptr && capacity > 0)) {
+        return p10::update_error_state(p10::P10Error::InvalidArgument << "Null output pointer");
+    }
+    return copy_out(
+        p10::get_cpu_topology(),
+        capacity,
+        out_count,
+        [cpus](const p10::CpuInfo& info, size_t i) {
+            cpus[i] = P10CpuInfo {
+                .cpu = info.cpu,
+                .core = info.core,
+                .package = info.package,
+                .smt_index = info.smt_index,
+                .capacity = info.capacity,
+                .l2_group = info.l2_group,
+                .llc_group = info.llc_group,
+                .l1_bytes = info.l1_bytes,
+                .l2_bytes = info.l2_bytes,
+                .llc_bytes = info.llc_bytes
+            };
+        }
+    );
+}
+
+PTENSOR_API P10ErrorEnum p10_get_worker_cpus(int32_t* cpus, size_t capacity, size_t* out_count) {
+    if (out_count == nullptr || (cpus == nullptr && capacity > 0)) {
+        return p10::update_error_state(p10::P10Error::InvalidArgument << "Null output pointer");
+    }
+    return copy_out(p10::get_worker_cpus(), capacity, out_count, [cpus](int cpu, size_t i) {
+        cpus[i] = cpu;
+    });
+}
+
+PTENSOR_API void p10_set_thread_affinity(int enabled) {
+    p10::set_thread_affinity(enabled != 0);
+}
+
+PTENSOR_API int p10_get_thread_affinity(void) {
+    return p10::get_thread_affinity() ? 1 : 0;
+}
+
+PTENSOR_API int32_t p10_get_parallel_thread_count(void) {
+    return p10::get_parallel_thread_count();
+}
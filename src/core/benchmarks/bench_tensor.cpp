@@ -0,0 +1,250 @@
+#include <random>
+
+#include <benchmark/benchmark.h>
+#include <ptensor/tensor.hpp>
+
+namespace p10 {
+namespace {
+
+    // A deterministic rows x cols random tensor (fixed seed for reproducibility).
+    Tensor make_input(int64_t rows, int64_t cols, Dtype dtype) {
+        std::mt19937_64 const rng(42);
+        return Tensor::from_random(make_shape(rows, cols), rng, TensorOptions().dtype(dtype))
+            .unwrap();
+    }
+
+    // Items/sec and bytes/sec for `elements` values of `dtype` touched per iteration.
+    void set_processed(benchmark::State& state, int64_t elements, Dtype dtype) {
+        state.SetItemsProcessed(state.iterations() * elements);
+        state.SetBytesProcessed(
+            state.iterations() * elements * static_cast<int64_t>(dtype.size_bytes())
+        );
+    }
+
+    // ---------------------------------------------------------------------
+    // Allocation
+    // ---------------------------------------------------------------------
+
+    void BM_Empty(benchmark::State& state) {
+        const int64_t size = state.range(0);
+        for (auto _ : state) {
+            auto tensor = Tensor::empty(make_shape(size, size)).unwrap();
+            benchmark::DoNotOptimize(tensor);
+        }
+        set_processed(state, size * size, Dtype::Float32);
+    }
+
+    void BM_Zeros(benchmark::State& state) {
+        const int64_t size = state.range(0);
+        for (auto _ : state) {
+            auto tensor = Tensor::zeros(make_shape(size, size)).unwrap();
+            benchmark::DoNotOptimize(tensor);
+            benchmark::ClobberMemory();
+        }
+        set_processed(state, size * size, Dtype::Float32);
+    }
+
+    void BM_Full(benchmark::State& state) {
+        const int64_t size = state.range(0);
+        for (auto _ : state) {
+            auto tensor = Tensor::full(make_shape(size, size), 0.5).unwrap();
+            benchmark::DoNotOptimize(tensor);
+            benchmark::ClobberMemory();
+        }
+        set_processed(state, size * size, Dtype::Float32);
+    }
+
+    // ---------------------------------------------------------------------
+    // Copies
+    // ---------------------------------------------------------------------
+
+    void BM_Clone(benchmark::State& state) {
+        const int64_t size = state.range(0);
+        Tensor const input = make_input(size, size, Dtype::Float32);
+        for (auto _ : state) {
+            auto tensor = input.clone().unwrap();
+            benchmark::DoNotOptimize(tensor);
+            benchmark::ClobberMemory();
+        }
+        set_processed(state, size * size, Dtype::Float32);
+    }
+
+    // The destination is created on the first iteration and reused after, so
+    // this measures the copy itself (compare against BM_Clone for allocation).
+    void BM_CopyFrom(benchmark::State& state) {
+        const int64_t size = state.range(0);
+        Tensor const input = make_input(size, size, Dtype::Float32);
+        Tensor output;
+        for (auto _ : state) {
+            output.copy_from(input).expect("copy_from failed");
+            benchmark::DoNotOptimize(output);
+            benchmark::ClobberMemory();
+        }
+        set_processed(state, size * size, Dtype::Float32);
+    }
+
+    // Column-major view of a size x size buffer: every element read jumps a row.
+    void BM_ToContiguous_Transposed(benchmark::State& state) {
+        const int64_t size = state.range(0);
+        Tensor input = make_input(size, size, Dtype::Float32);
+        Tensor const view = Tensor::from_data(
+            input.as_bytes().data(),
+            make_shape(size, size),
+            TensorOptions().dtype(Dtype::Float32).stride(make_stride({1, size}).unwrap())
+        );
+        for (auto _ : state) {
+            auto tensor = view.to_contiguous().unwrap();
+            benchmark::DoNotOptimize(tensor);
+            benchmark::ClobberMemory();
+        }
+        set_processed(state, size * size, Dtype::Float32);
+    }
+
+    // Left half of every row: the common region-of-interest view, rows are
+    // contiguous but padded.
+    void BM_ToContiguous_Roi(benchmark::State& state) {
+        const int64_t size = state.range(0);
+        Tensor input = make_input(size, size, Dtype::Float32);
+        Tensor const view = Tensor::from_data(
+            input.as_bytes().data(),
+            make_shape(size, size / 2),
+            TensorOptions().dtype(Dtype::Float32).stride(make_stride({size, 1}).unwrap())
+        );
+        for (auto _ : state) {
+            auto tensor = view.to_contiguous().unwrap();
+            benchmark::DoNotOptimize(tensor);
+            benchmark::ClobberMemory();
+        }
+        set_processed(state, size * (size / 2), Dtype::Float32);
+    }
+
+    // ---------------------------------------------------------------------
+    // Conversion
+    // ---------------------------------------------------------------------
+
+    // Bytes are counted on the source side.
+    template<typename SourceT, typename DestT>
+    void BM_ConvertFrom(benchmark::State& state) {
+        const int64_t size = state.range(0);
+        Tensor const input = make_input(size, size, Dtype::from<SourceT>());
+        const auto options = TensorOptions().dtype(Dtype::from<DestT>());
+        Tensor output;
+        for (auto _ : state) {
+            output.convert_from(input, options).expect("convert_from failed");
+            benchmark::DoNotOptimize(output);
+            benchmark::ClobberMemory();
+        }
+        set_processed(state, size * size, Dtype::from<SourceT>());
+    }
+
+    // ---------------------------------------------------------------------
+    // Traversal and views
+    // ---------------------------------------------------------------------
+
+    void run_iterator_sum(benchmark::State& state, const Tensor& tensor) {
+        for (auto _ : state) {
+            auto iter = tensor.iterator<float>().unwrap();
+            float sum = 0.0f;
+            while (iter.has_next()) {
+                sum += iter.next().first;
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        set_processed(state, static_cast<int64_t>(tensor.size()), Dtype::Float32);
+    }
+
+    void BM_Iterator_Contiguous(benchmark::State& state) {
+        const int64_t size = state.range(0);
+        run_iterator_sum(state, make_input(size, size, Dtype::Float32));
+    }
+
+    void BM_Iterator_Transposed(benchmark::State& state) {
+        const int64_t size = state.range(0);
+        Tensor input = make_input(size, size, Dtype::Float32);
+        run_iterator_sum(
+            state,
+            Tensor::from_data(
+                input.as_bytes().data(),
+                make_shape(size, size),
+                TensorOptions().dtype(Dtype::Float32).stride(make_stride({1, size}).unwrap())
+            )
+        );
+    }
+
+    // Per-call cost of building a view; one item is one select.
+    void BM_SelectDimension(benchmark::State& state) {
+        Tensor const input =
+            Tensor::zeros(make_shape(16, 256, 256), TensorOptions().dtype(Dtype::Uint8)).unwrap();
+        int64_t index = 0;
+        for (auto _ : state) {
+            auto plane = input.select_dimension(0, index).unwrap();
+            benchmark::DoNotOptimize(plane);
+            index = (index + 1) % 16;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // ---------------------------------------------------------------------
+    // P10Result overhead
+    // ---------------------------------------------------------------------
+
+    Tensor make_view(const Tensor& tensor) {
+        return tensor.as_view();
+    }
+
+    P10Result<Tensor> make_view_result(const Tensor& tensor) {
+        return Ok(tensor.as_view());
+    }
+
+    // Baseline for BM_P10Result_Move: the same view returned by value.
+    void BM_TensorReturn(benchmark::State& state) {
+        Tensor const input = Tensor::zeros(make_shape(8, 8)).unwrap();
+        for (auto _ : state) {
+            Tensor view = make_view(input);
+            benchmark::DoNotOptimize(view);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // Wrapping in P10Result and unwrapping (two Tensor moves through the variant).
+    void BM_P10Result_Move(benchmark::State& state) {
+        Tensor const input = Tensor::zeros(make_shape(8, 8)).unwrap();
+        for (auto _ : state) {
+            Tensor view = make_view_result(input).unwrap();
+            benchmark::DoNotOptimize(view);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // Square sizes from L1-resident through DRAM-bound.
+    void square_sizes(benchmark::internal::Benchmark* bench) {
+        bench->Arg(64)->Arg(256)->Arg(1024)->Arg(2048)->Unit(benchmark::kMicrosecond);
+    }
+
+    BENCHMARK(BM_Empty)->Apply(square_sizes);
+    BENCHMARK(BM_Zeros)->Apply(square_sizes);
+    BENCHMARK(BM_Full)->Apply(square_sizes);
+
+    BENCHMARK(BM_Clone)->Apply(square_sizes);
+    BENCHMARK(BM_CopyFrom)->Apply(square_sizes);
+    BENCHMARK(BM_ToContiguous_Transposed)->Apply(square_sizes);
+    BENCHMARK(BM_ToContiguous_Roi)->Apply(square_sizes);
+
+    // Image decode/normalize paths and the usual precision changes.
+    BENCHMARK_TEMPLATE2(BM_ConvertFrom, uint8_t, float)->Apply(square_sizes);
+    BENCHMARK_TEMPLATE2(BM_ConvertFrom, float, uint8_t)->Apply(square_sizes);
+    BENCHMARK_TEMPLATE2(BM_ConvertFrom, uint16_t, float)->Apply(square_sizes);
+    BENCHMARK_TEMPLATE2(BM_ConvertFrom, int32_t, float)->Apply(square_sizes);
+    BENCHMARK_TEMPLATE2(BM_ConvertFrom, float, int32_t)->Apply(square_sizes);
+    BENCHMARK_TEMPLATE2(BM_ConvertFrom, float, double)->Apply(square_sizes);
+    BENCHMARK_TEMPLATE2(BM_ConvertFrom, double, float)->Apply(square_sizes);
+
+    BENCHMARK(BM_Iterator_Contiguous)->Apply(square_sizes);
+    BENCHMARK(BM_Iterator_Transposed)->Apply(square_sizes);
+    BENCHMARK(BM_SelectDimension);
+
+    BENCHMARK(BM_TensorReturn);
+    BENCHMARK(BM_P10Result_Move);
+
+}  // namespace
+}  // namespace p10
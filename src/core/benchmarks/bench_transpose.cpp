@@ -8,6 +8,7 @@
 #include "tensor.transpose.avx2.hpp"
 #include "tensor.transpose.neon.hpp"
 #include "tensor.transpose.portable.hpp"
+#include "tensor.transpose.sse41.hpp"
 
 namespace p10 {
 namespace {
@@ -142,6 +143,12 @@ namespace {
             return make_avx2_transpose<8, int32_t>(sb, db, ss, ds);
         });
     }
+
+    void BM_Kernel_Sse41(benchmark::State& state) {
+        run_kernel_int32(state, [](auto sb, auto db, int64_t ss, int64_t ds) {
+            return make_sse41_transpose<8, int32_t>(sb, db, ss, ds);
+        });
+    }
 #endif
 
 #if PTENSOR_HAS_NEON
@@ -199,6 +206,7 @@ namespace {
         ->Unit(benchmark::kMicrosecond);
 #if PTENSOR_HAS_INTRINSICS_H
     BENCHMARK(BM_Kernel_Avx2)->Arg(256)->Arg(1024)->Arg(2048)->Unit(benchmark::kMicrosecond);
+    BENCHMARK(BM_Kernel_Sse41)->Arg(256)->Arg(1024)->Arg(2048)->Unit(benchmark::kMicrosecond);
 #endif
 #if PTENSOR_HAS_NEON
     BENCHMARK(BM_Kernel_Neon)->Arg(256)->Arg(1024)->Arg(2048)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,44 @@
+#include "cpu_topology.hpp"
+
+#include <p10_internal/simd/cpu_topology.hpp>
+
+namespace p10 {
+
+std::vector<CpuInfo> get_cpu_topology() {
+    std::vector<CpuInfo> cpus;
+    for (const auto& info : simd::cpu_topology().cpus) {
+        cpus.push_back(
+            CpuInfo {
+                .cpu = info.cpu,
+                .core = info.core,
+                .package = info.package,
+                .smt_index = info.smt_index,
+                .capacity = info.capacity,
+                .l2_group = info.l2_group,
+                .llc_group = info.llc_group,
+                .l1_bytes = info.l1_bytes,
+                .l2_bytes = info.l2_bytes,
+                .llc_bytes = info.llc_bytes
+            }
+        );
+    }
+    return cpus;
+}
+
+std::vector<int> get_worker_cpus() {
+    return simd::cpu_topology().worker_cpus;
+}
+
+void set_thread_affinity(bool enabled) {
+    simd::set_thread_affinity(enabled);
+}
+
+bool get_thread_affinity() {
+    return simd::is_thread_affinity_enabled();
+}
+
+int get_parallel_thread_count() {
+    return simd::parallel_thread_count();
+}
+
+}  // namespace p10
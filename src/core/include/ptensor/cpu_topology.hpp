@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace p10 {
+
+/// One logical CPU (hardware thread) the process may run on.
+struct CpuInfo {
+    /// OS CPU number, as used by affinity masks.
+    int cpu = 0;
+    /// Physical core index, dense from 0; SMT siblings share it.
+    int core = 0;
+    /// Socket.
+    int package = 0;
+    /// Position among the core's SMT siblings, 0 for the first hardware thread.
+    int smt_index = 0;
+    /// Relative performance, 1024 for the fastest cores (lower on efficiency
+    /// cores).
+    int capacity = 1024;
+    /// Group of CPUs sharing this CPU's L2, dense from 0.
+    int l2_group = 0;
+    /// Group of CPUs sharing this CPU's last-level cache, dense from 0.
+    int llc_group = 0;
+    /// Data cache sizes in bytes, 0 when unknown.
+    size_t l1_bytes = 0;
+    size_t l2_bytes = 0;
+    size_t llc_bytes = 0;
+};
+
+/// Returns the CPUs this process may run on, ascending. Read from sysfs on
+/// Linux; other platforms report one core per hardware thread.
+std::vector<CpuInfo> get_cpu_topology();
+
+/// Returns the CPUs parallel kernels pin their workers to, in worker order:
+/// one hardware thread per core of the fastest class, grouped by last-level
+/// cache.
+std::vector<int> get_worker_cpus();
+
+/// Pins the workers of parallel kernels (blur, transpose, ...) to
+/// `get_worker_cpus`, one per CPU, so they stay off efficiency cores and SMT
+/// siblings and neighbouring tiles share a cache. Off by default
+/// (`PTENSOR_AFFINITY=1` turns it on); without it the OpenMP runtime places
+/// its threads. Pinning is not available on macOS and WebAssembly.
+void set_thread_affinity(bool enabled);
+
+/// Whether worker pinning is on.
+bool get_thread_affinity();
+
+/// Returns how many threads a parallel kernel runs on. With affinity on, that
+/// is one per `get_worker_cpus` entry plus the unpinned calling thread.
+int get_parallel_thread_count();
+
+}  // namespace p10
@@ -1,11 +1,144 @@
 #pragma once
 
+#include <optional>
 #include <string>
+#include <string_view>
+#include <vector>
+
+#include "p10_error.hpp"
 
 namespace p10 {
 
+/// Process-wide settings applied by `initialize`. Unset fields keep their
+/// current value (or environment default).
+class InitializeOptions {
+  public:
+    /// Directory for log files.
+    const std::optional<std::string>& log_directory() const {
+        return log_directory_;
+    }
+
+    /// SIMD tier cap, see `set_simd_max`.
+    const std::optional<std::string>& simd_max() const {
+        return simd_max_;
+    }
+
+    /// Tile tuning cache file, see `load_tuning_cache`.
+    const std::optional<std::string>& tuning_cache() const {
+        return tuning_cache_;
+    }
+
+    /// Whether to autotune, see `set_autotune`.
+    std::optional<bool> autotune() const {
+        return autotune_;
+    }
+
+    /// Whether to pin parallel workers, see `set_thread_affinity`.
+    std::optional<bool> thread_affinity() const {
+        return thread_affinity_;
+    }
+
+    /// Sets the directory for log files.
+    InitializeOptions& log_directory(std::string directory) {
+        log_directory_ = std::move(directory);
+        return *this;
+    }
+
+    /// Sets the SIMD tier cap.
+    InitializeOptions& simd_max(std::string tier) {
+        simd_max_ = std::move(tier);
+        return *this;
+    }
+
+    /// Sets the tile tuning cache file to load and persist to.
+    InitializeOptions& tuning_cache(std::string path) {
+        tuning_cache_ = std::move(path);
+        return *this;
+    }
+
+    /// Enables or disables autotuning.
+    InitializeOptions& autotune(bool enabled) {
+        autotune_ = enabled;
+        return *this;
+    }
+
+    /// Enables or disables pinning parallel workers to CPUs.
+    InitializeOptions& thread_affinity(bool enabled) {
+        thread_affinity_ = enabled;
+        return *this;
+    }
+
+  private:
+    std::optional<std::string> log_directory_;
+    std::optional<std::string> simd_max_;
+    std::optional<std::string> tuning_cache_;
+    std::optional<bool> autotune_;
+    std::optional<bool> thread_affinity_;
+};
+
+/// Applies every set field of `options`. Every option is checked before any
+/// is applied, so on error the process settings are unchanged.
+///
+/// # Errors
+///
+/// * InvalidArgument: unknown `simd_max` tier.
+/// * InvalidOperation: the tuning cache exists but cannot be parsed.
+P10Error initialize(const InitializeOptions &options);
+
 void initialize(const std::string &log_directory);
 
+/// Sets the log directory and caps the SIMD tier, see `set_simd_max`.
+///
+/// # Errors
+///
+/// * InvalidArgument: `simd_max` is not a known tier name.
+P10Error initialize(const std::string &log_directory, std::string_view simd_max);
+
 std::string get_log_directory();
 
+/// Caps the instruction set every kernel dispatcher may pick, so the slower
+/// paths can be tested and benchmarked on a machine with faster ones. Tiers,
+/// lowest first: "portable", then "sse41" / "neon" / "wasm", then "avx2".
+/// "native" removes the cap.
+///
+/// Without a call, the cap comes from the `PTENSOR_SIMD_MAX` environment
+/// variable (same names), read on the first dispatch. An unknown name there
+/// is reported on stderr and leaves the dispatch uncapped.
+///
+/// # Errors
+///
+/// * InvalidArgument: `tier` is not a known tier name.
+P10Error set_simd_max(std::string_view tier);
+
+/// Returns the current cap name, "native" when uncapped.
+std::string get_simd_max();
+
+/// Returns the tiers this build and CPU can run, lowest first. Always starts
+/// with "portable".
+std::vector<std::string> get_simd_tiers();
+
+/// Loads tuned tile sizes from `path` and persists new winners there. Tiled
+/// kernels (transpose, ...) then use the stored cache block and
+/// sequential/parallel choice for their shape instead of the L1-based default.
+/// A missing file is fine: new winners are written to it together at exit, or
+/// earlier with `save_tuning_cache`. Without a call, `PTENSOR_TUNING_CACHE`
+/// names the file.
+///
+/// # Errors
+///
+/// * InvalidOperation: the file exists but cannot be parsed.
+P10Error load_tuning_cache(const std::string &path);
+
+/// Writes the tuned tile sizes to `path`.
+///
+/// # Errors
+///
+/// * IoError: the file cannot be written.
+P10Error save_tuning_cache(const std::string &path);
+
+/// Enables autotuning: the first call of a tiled kernel for a shape bucket
+/// times every candidate tile size once and stores the fastest. Off by default
+/// (`PTENSOR_AUTOTUNE=1` turns it on); stored choices are used either way.
+void set_autotune(bool enabled);
+
 }
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <string>
 
+#include "p10_result.hpp"
+
 namespace p10 {
 class Tensor;
 
@@ -38,12 +42,102 @@ std::string to_string(const Tensor& tensor, const TensorStringOptions& options =
 
 std::string to_json(const Tensor& tensor);
 
+/// How `to_json_preview` shrinks a tensor that does not fit its byte budget.
+enum class PreviewDownsample {
+    /// Keeps every `step`-th element. Cost is proportional to the preview size.
+    Stride,
+    /// Averages each `step`-sized box. Reads the whole tensor but does not
+    /// alias thin lines or noise. Float16 tensors always use `Stride`.
+    Area
+};
+
+class TensorPreviewOptions {
+  public:
+    size_t max_bytes() const {
+        return max_bytes_;
+    }
+
+    /// Sets the budget, in raw tensor bytes, of the preview blob. The base64
+    /// encoding adds a third on top of it.
+    TensorPreviewOptions& max_bytes(size_t max_bytes) {
+        max_bytes_ = max_bytes;
+        return *this;
+    }
+
+    PreviewDownsample downsample() const {
+        return downsample_;
+    }
+
+    /// Sets how oversized tensors are downsampled.
+    TensorPreviewOptions& downsample(PreviewDownsample downsample) {
+        downsample_ = downsample;
+        return *this;
+    }
+
+    size_t histogram_bins() const {
+        return histogram_bins_;
+    }
+
+    /// Sets the number of histogram bins per channel. Zero disables histograms.
+    TensorPreviewOptions& histogram_bins(size_t bins) {
+        histogram_bins_ = bins;
+        return *this;
+    }
+
+  private:
+    size_t max_bytes_ = 4 * 1024 * 1024;
+    PreviewDownsample downsample_ = PreviewDownsample::Area;
+    size_t histogram_bins_ = 64;
+};
+
+/// Encodes a preview of `tensor` whose blob fits in `options.max_bytes()`.
+///
+/// The JSON has the same `dtype`/`shape`/`stride`/`blob` fields as `to_json`,
+/// describing the (possibly downsampled) preview, plus:
+///
+/// * `preview`: `source_shape`, the per-axis `step` used to downsample and the
+///   `channel_axis` (-1 when the layout has none).
+/// * `stats`: one `{min, max, non_finite, histogram}` object per channel,
+///   computed over the full-resolution tensor.
+///
+/// Only the image plane, the row and column axes of an HW, HWC or CHW layout,
+/// is downsampled, by one shared step. The channel axis (at most 4 long) and
+/// any leading batch axes are kept whole, so images are never skipped or
+/// blended; a large batch can therefore exceed `max_bytes`. Use
+/// `to_json_tile` to fetch full-resolution regions on demand.
+std::string to_json_preview(const Tensor& tensor, const TensorPreviewOptions& options = {});
+
+/// Encodes the full-resolution region `[row, row + rows) x [col, col + cols)`
+/// of `tensor`'s image plane, keeping every other axis whole. The region is
+/// clipped to the tensor and reported back under `tile`. For 1-D tensors only
+/// `col` and `cols` are used.
+///
+/// # Errors
+///
+/// * InvalidArgument: The tensor is empty or the region does not intersect it.
+P10Result<std::string>
+to_json_tile(const Tensor& tensor, int64_t row, int64_t col, int64_t rows, int64_t cols);
+
 /// Encodes `tensor` as JSON into a per-thread static buffer and returns a
 /// pointer to its contents. The static buffer keeps the string alive past the
 /// debugger's `evaluate` call so the result string can be read directly from
 /// the response (no `readMemory` needed for typical sizes).
 const char* to_json_debug(const Tensor& tensor);
 
+/// `to_json_preview` into the same per-thread buffer as `to_json_debug`, with
+/// `max_bytes` as the budget and the default downsampling.
+const char* to_json_preview_debug(const Tensor& tensor, size_t max_bytes);
+
+/// `to_json_tile` into the per-thread debug buffer. Returns nullptr when the
+/// region is invalid.
+const char* to_json_tile_debug(
+    const Tensor& tensor,
+    int64_t row,
+    int64_t col,
+    int64_t rows,
+    int64_t cols
+);
+
 /// Returns the minimum value of `tensor` cast to double. Empty tensors return
 /// NaN. Designed as a hook for debugger visualizers (e.g. natvis intrinsics).
 double tensor_min_debug(const Tensor& tensor);
@@ -1,8 +1,23 @@
 #include "initialize.hpp"
 
+#include "cpu_topology.hpp"
+
+#include <p10_internal/simd/cpuid.hpp>
+#include <p10_internal/simd/tile_tuning.hpp>
+
 namespace p10 {
 namespace {
 std::string g_log_directory = "./ptensor-logs";
+
+constexpr std::string_view NATIVE_SIMD = "native";
+
+P10Error check_simd_max(std::string_view tier) {
+    if (tier != NATIVE_SIMD && !simd::simd_set_from_name(tier)) {
+        return P10Error::InvalidArgument << "Unknown SIMD tier '" + std::string(tier)
+            + "', expected portable, sse41, avx2, neon, wasm or native";
+    }
+    return P10Error::Ok;
+}
 }
 
 std::string get_log_directory() {
@@ -12,4 +27,76 @@ std::string get_log_directory() {
 void initialize(const std::string& log_directory) {
     g_log_directory = log_directory;
 }
+
+P10Error initialize(const InitializeOptions& options) {
+    // Everything that can fail runs before anything is applied, so an error
+    // leaves the process as it was. A failed tuning cache load keeps the
+    // previous cache.
+    if (options.simd_max()) {
+        P10_RETURN_IF_ERROR(check_simd_max(*options.simd_max()));
+    }
+    if (options.tuning_cache()) {
+        P10_RETURN_IF_ERROR(load_tuning_cache(*options.tuning_cache()));
+    }
+    if (options.simd_max()) {
+        P10_RETURN_IF_ERROR(set_simd_max(*options.simd_max()));
+    }
+    if (options.autotune()) {
+        set_autotune(*options.autotune());
+    }
+    if (options.thread_affinity()) {
+        set_thread_affinity(*options.thread_affinity());
+    }
+    if (options.log_directory()) {
+        initialize(*options.log_directory());
+    }
+    return P10Error::Ok;
+}
+
+P10Error initialize(const std::string& log_directory, std::string_view simd_max) {
+    return initialize(
+        InitializeOptions().log_directory(log_directory).simd_max(std::string(simd_max))
+    );
+}
+
+P10Error set_simd_max(std::string_view tier) {
+    P10_RETURN_IF_ERROR(check_simd_max(tier));
+    simd::set_max_simd(tier == NATIVE_SIMD ? std::nullopt : simd::simd_set_from_name(tier));
+    return P10Error::Ok;
+}
+
+std::string get_simd_max() {
+    const auto cap = simd::max_simd();
+    return cap ? simd::simd_set_name(*cap) : std::string(NATIVE_SIMD);
+}
+
+std::vector<std::string> get_simd_tiers() {
+    using simd::SimdSet;
+    std::vector<std::string> tiers;
+    for (const SimdSet set :
+         {SimdSet::NONE, SimdSet::SSE41, SimdSet::AdvSIMD, SimdSet::WASM, SimdSet::AVX2}) {
+        if (simd::is_compiler_supported(set) && simd::is_cpu_supported(set)) {
+            tiers.emplace_back(simd::simd_set_name(set));
+        }
+    }
+    return tiers;
+}
+
+P10Error load_tuning_cache(const std::string& path) {
+    if (!simd::load_tile_tuning(path)) {
+        return P10Error::InvalidOperation << "Malformed tile tuning cache '" + path + "'";
+    }
+    return P10Error::Ok;
+}
+
+P10Error save_tuning_cache(const std::string& path) {
+    if (!simd::save_tile_tuning(path)) {
+        return P10Error::IoError << "Could not write tile tuning cache '" + path + "'";
+    }
+    return P10Error::Ok;
+}
+
+void set_autotune(bool enabled) {
+    simd::set_autotune(enabled);
+}
 }  // namespace p10
@@ -9,6 +9,7 @@
 #include "tensor.transpose.avx2.hpp"
 #include "tensor.transpose.neon.hpp"
 #include "tensor.transpose.portable.hpp"
+#include "tensor.transpose.sse41.hpp"
 
 namespace p10 {
 
@@ -73,9 +74,11 @@ P10Error Tensor::transpose(Tensor& other) const {
         // otherwise the next, and the edge kernel always handles the borders.
         // The SIMD 8x8 kernels move 32-bit lanes, so they also serve float32
         // (the bit pattern is shuffled untouched); larger types fall to scalar.
-        // Transpose has no stencil halo, so the tile border is empty.
+        // Transpose has no stencil halo, so the tile border is empty. The cache
+        // tile comes from the tuning cache when one is loaded.
         if constexpr (sizeof(ScalarT) == sizeof(int32_t)) {
-            simd::tile2d<ScalarT>(
+            simd::tile2d_tuned<ScalarT>(
+                "transpose",
                 rows,
                 cols,
                 simd::TileBorder {},
@@ -86,6 +89,12 @@ P10Error Tensor::transpose(Tensor& other) const {
                     src_stride,
                     dst_stride
                 ),
+                make_sse41_transpose<SIMD_BLOCK, ScalarT>(
+                    src_block,
+                    dst_block,
+                    src_stride,
+                    dst_stride
+                ),
                 make_neon_transpose<SIMD_BLOCK, ScalarT>(
                     src_block,
                     dst_block,
@@ -96,7 +105,7 @@ P10Error Tensor::transpose(Tensor& other) const {
             );
             return P10Error::Ok;
         }
-        simd::tile2d<ScalarT>(rows, cols, simd::TileBorder {}, edge, portable);
+        simd::tile2d_tuned<ScalarT>("transpose", rows, cols, simd::TileBorder {}, edge, portable);
         return P10Error::Ok;
     });
 }
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+
+#include <p10_internal/simd/compiler.hpp>
+#include <p10_internal/simd/tile2d.hpp>
+
+#if PTENSOR_HAS_INTRINSICS_H
+    #include <immintrin.h>
+#endif
+
+namespace p10 {
+
+#if PTENSOR_HAS_INTRINSICS_H
+
+// Transpose a 4x4 block of 32-bit elements in SSE registers.
+PTENSOR_SSE41 inline void
+transpose_sse41_4x4_32(int32_t const* src, int64_t src_stride, int32_t* dst, int64_t dst_stride) {
+    __m128i row0 = _mm_loadu_si128((__m128i const*)src);
+    __m128i row1 = _mm_loadu_si128((__m128i const*)(src + src_stride));
+    __m128i row2 = _mm_loadu_si128((__m128i const*)(src + 2 * src_stride));
+    __m128i row3 = _mm_loadu_si128((__m128i const*)(src + 3 * src_stride));
+    /* Starts with
+       r0 = 00 01 02 03
+       r1 = 04 05 06 07
+       r2 = 08 09 10 11
+       r3 = 12 13 14 15
+    */
+
+    __m128i t0 = _mm_unpacklo_epi32(row0, row1);
+    __m128i t1 = _mm_unpacklo_epi32(row2, row3);
+    __m128i t2 = _mm_unpackhi_epi32(row0, row1);
+    __m128i t3 = _mm_unpackhi_epi32(row2, row3);
+    /* Transposed the 2x2 matrices
+       t0 = [00 04; 01 05]
+       t1 = [08 12; 09 13]
+       t2 = [02 06; 03 07]
+       t3 = [10 14; 11 15]
+    */
+
+    _mm_storeu_si128((__m128i*)(dst + 0 * dst_stride), _mm_unpacklo_epi64(t0, t1));
+    _mm_storeu_si128((__m128i*)(dst + 1 * dst_stride), _mm_unpackhi_epi64(t0, t1));
+    _mm_storeu_si128((__m128i*)(dst + 2 * dst_stride), _mm_unpacklo_epi64(t2, t3));
+    _mm_storeu_si128((__m128i*)(dst + 3 * dst_stride), _mm_unpackhi_epi64(t2, t3));
+}
+
+// Transpose an 8x8 block of 32-bit elements as four 4x4 register tiles; the
+// off-diagonal tiles swap places.
+PTENSOR_SSE41 inline void
+transpose_sse41_8x8_32(int32_t const* src, int64_t src_stride, int32_t* dst, int64_t dst_stride) {
+    transpose_sse41_4x4_32(src, src_stride, dst, dst_stride);
+    transpose_sse41_4x4_32(src + 4, src_stride, dst + 4 * dst_stride, dst_stride);
+    transpose_sse41_4x4_32(src + 4 * src_stride, src_stride, dst + 4, dst_stride);
+    transpose_sse41_4x4_32(
+        src + 4 * src_stride + 4,
+        src_stride,
+        dst + 4 * dst_stride + 4,
+        dst_stride
+    );
+}
+#endif  // PTENSOR_HAS_INTRINSICS_H
+
+// Build an SSE4.1 8x8 transpose kernel for 32-bit elements, the x86 tier for
+// CPUs without AVX2. Without intrinsics it returns an empty kernel that tile2d's
+// dispatch compiles out (see make_avx2_transpose).
+template<size_t SIMD_BLOCK, typename ScalarT, typename SrcBlock, typename DstBlock>
+auto make_sse41_transpose(
+    SrcBlock src_block,
+    DstBlock dst_block,
+    int64_t src_stride,
+    int64_t dst_stride
+) {
+#if PTENSOR_HAS_INTRINSICS_H
+    return simd::Sse41<SIMD_BLOCK, ScalarT>([=](const Region2D& region) {
+        transpose_sse41_8x8_32(
+            reinterpret_cast<const int32_t*>(src_block(region)),
+            src_stride,
+            reinterpret_cast<int32_t*>(dst_block(region)),
+            dst_stride
+        );
+    });
+#else
+    (void)src_block;
+    (void)dst_block;
+    (void)src_stride;
+    (void)dst_stride;
+    return simd::Sse41<SIMD_BLOCK, ScalarT>([](const Region2D&) {
+        static_assert(
+            !simd::is_compiler_supported(simd::SimdSet::SSE41),
+            "empty SSE4.1 transpose kernel instantiated on an SSE4.1-capable target"
+        );
+    });
+#endif
+}
+
+}  // namespace p10
@@ -1,11 +1,15 @@
 #include "tensor_print.hpp"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <format>
 #include <iomanip>
 #include <limits>
 #include <sstream>
+#include <vector>
 
 #include "base64.hpp"
 #include "dtype.hpp"
@@ -104,14 +108,474 @@ std::string to_json(const Tensor& tensor) {
 }
 
 namespace {
+    using Extents = std::array<int64_t, P10_MAX_SHAPE>;
+
+    /// Largest axis still treated as channels (gray, gray+alpha, RGB, RGBA).
+    constexpr int64_t MAX_PREVIEW_CHANNELS = 4;
+
+    struct PreviewAxes {
+        int64_t channel = -1;
+        int64_t row = -1;
+        int64_t col = -1;
+    };
+
+    /// Guesses the image layout of `shape`: HW, HWC or CHW, with any leading
+    /// batch axes. A 1-D tensor is a single row.
+    PreviewAxes preview_axes(std::span<const int64_t> shape) {
+        const auto dims = static_cast<int64_t>(shape.size());
+        PreviewAxes axes;
+        if (dims == 0) {
+            return axes;
+        }
+        if (dims == 1) {
+            axes.col = 0;
+            return axes;
+        }
+        if (dims >= 3 && shape[dims - 1] <= MAX_PREVIEW_CHANNELS) {
+            axes.channel = dims - 1;
+            axes.row = dims - 3;
+            axes.col = dims - 2;
+        } else if (dims >= 3 && shape[dims - 3] <= MAX_PREVIEW_CHANNELS) {
+            axes.channel = dims - 3;
+            axes.row = dims - 2;
+            axes.col = dims - 1;
+        } else {
+            axes.row = dims - 2;
+            axes.col = dims - 1;
+        }
+        return axes;
+    }
+
+    /// Calls `fn(index, offset)` for every row along the last axis of an
+    /// `extent`-shaped grid sampled at `origin + index * step`, in row-major
+    /// order. `offset` is the element offset of the row's first sample and is
+    /// carried from row to row, so callers walk each row with a running pointer.
+    template<typename Fn>
+    void for_each_row(
+        size_t dims,
+        const Extents& extent,
+        const Extents& origin,
+        const Extents& step,
+        std::span<const int64_t> stride,
+        Fn&& fn
+    ) {
+        int64_t offset = 0;
+        for (size_t axis = 0; axis < dims; axis++) {
+            if (extent[axis] <= 0) {
+                return;
+            }
+            offset += origin[axis] * stride[axis];
+        }
+        Extents index {};
+        while (true) {
+            fn(index, offset);
+            size_t axis = dims > 0 ? dims - 1 : 0;
+            while (axis > 0) {
+                const int64_t jump = step[axis - 1] * stride[axis - 1];
+                if (++index[axis - 1] < extent[axis - 1]) {
+                    offset += jump;
+                    break;
+                }
+                offset -= (extent[axis - 1] - 1) * jump;
+                index[axis - 1] = 0;
+                axis--;
+            }
+            if (axis == 0) {
+                return;
+            }
+        }
+    }
+
+    /// Samples per row for `for_each_row`; a 0-D tensor is one row of one.
+    int64_t row_length(size_t dims, const Extents& extent) {
+        return dims > 0 ? extent[dims - 1] : 1;
+    }
+
+    /// Element distance between neighbouring samples of a `for_each_row` row.
+    int64_t row_pitch(size_t dims, const Extents& step, std::span<const int64_t> stride) {
+        return dims > 0 ? step[dims - 1] * stride[dims - 1] : 0;
+    }
+
+    /// Copies the elements at `origin + index * step` for every index of
+    /// `extent` into the contiguous `dst`. Works on raw bytes, so any dtype.
+    void gather_bytes(
+        const std::byte* src,
+        size_t item_size,
+        std::span<const int64_t> stride,
+        const Extents& origin,
+        const Extents& step,
+        size_t dims,
+        const Extents& extent,
+        std::byte* dst
+    ) {
+        const auto item = static_cast<int64_t>(item_size);
+        const int64_t length = row_length(dims, extent);
+        const int64_t pitch = row_pitch(dims, step, stride) * item;
+        for_each_row(dims, extent, origin, step, stride, [&](const Extents&, int64_t offset) {
+            const std::byte* element = src + offset * item;
+            if (pitch == item) {
+                std::memcpy(dst, element, static_cast<size_t>(length * item));
+                dst += length * item;
+                return;
+            }
+            for (int64_t i = 0; i < length; i++, element += pitch) {
+                std::memcpy(dst, element, item_size);
+                dst += item_size;
+            }
+        });
+    }
+
+    /// Averages each `step`-sized box of `src` (clipped at the borders) into the
+    /// contiguous `dst`. Integer means are rounded to nearest.
+    template<typename T>
+    void area_downsample(
+        const T* src,
+        std::span<const int64_t> shape,
+        std::span<const int64_t> stride,
+        const Extents& step,
+        const Extents& extent,
+        T* dst
+    ) {
+        const size_t dims = shape.size();
+        const size_t outer = dims > 0 ? dims - 1 : 0;
+        const Extents zeros {};
+        Extents ones;
+        ones.fill(1);
+        const int64_t length = row_length(dims, extent);
+        const int64_t pitch = row_pitch(dims, step, stride);
+        const int64_t box_pitch = row_pitch(dims, ones, stride);
+        for_each_row(dims, extent, zeros, step, stride, [&](const Extents& index, int64_t row) {
+            Extents box;
+            int64_t rows_in_box = 1;
+            for (size_t axis = 0; axis < outer; axis++) {
+                box[axis] = std::min(step[axis], shape[axis] - index[axis] * step[axis]);
+                rows_in_box *= box[axis];
+            }
+            for (int64_t x = 0; x < length; x++) {
+                const int64_t width =
+                    dims > 0 ? std::min(step[outer], shape[outer] - x * step[outer]) : 1;
+                box[outer] = width;
+                const T* base = src + row + x * pitch;
+
+                double sum = 0.0;
+                for_each_row(dims, box, zeros, ones, stride, [&](const Extents&, int64_t offset) {
+                    const T* element = base + offset;
+                    for (int64_t i = 0; i < width; i++, element += box_pitch) {
+                        sum += static_cast<double>(*element);
+                    }
+                });
+                const double mean = sum / static_cast<double>(rows_in_box * width);
+                if constexpr (std::is_floating_point_v<T>) {
+                    *dst++ = static_cast<T>(mean);
+                } else {
+                    *dst++ = static_cast<T>(std::round(mean));
+                }
+            }
+        });
+    }
+
+    struct ChannelStats {
+        double min = std::numeric_limits<double>::infinity();
+        double max = -std::numeric_limits<double>::infinity();
+        int64_t non_finite = 0;
+        std::vector<int64_t> histogram;
+    };
+
+    /// Min/max and histogram of every channel over the full-resolution tensor.
+    /// NaN and infinities are only counted.
+    template<typename T>
+    std::vector<ChannelStats> channel_stats(
+        const T* src,
+        std::span<const int64_t> shape,
+        std::span<const int64_t> stride,
+        int64_t channel_axis,
+        size_t bins
+    ) {
+        const size_t dims = shape.size();
+        const int64_t channels = channel_axis >= 0 ? shape[channel_axis] : 1;
+        std::vector<ChannelStats> stats(static_cast<size_t>(channels));
+
+        Extents extent {}, origin {}, step {};
+        std::copy(shape.begin(), shape.end(), extent.begin());
+        std::fill_n(step.begin(), dims, 1);
+        const int64_t length = row_length(dims, extent);
+        const int64_t pitch = row_pitch(dims, step, stride);
+        const bool channel_is_last = dims > 0 && channel_axis == static_cast<int64_t>(dims) - 1;
+        auto for_each_value = [&](auto&& fn) {
+            auto walk_row = [&](const Extents& index, int64_t row) {
+                const T* element = src + row;
+                if (channel_is_last) {
+                    for (int64_t x = 0; x < length; x++, element += pitch) {
+                        fn(stats[static_cast<size_t>(x)], static_cast<double>(*element));
+                    }
+                    return;
+                }
+                const auto channel = channel_axis >= 0 ? index[channel_axis] : 0;
+                auto& slot = stats[static_cast<size_t>(channel)];
+                for (int64_t x = 0; x < length; x++, element += pitch) {
+                    fn(slot, static_cast<double>(*element));
+                }
+            };
+            for_each_row(dims, extent, origin, step, stride, walk_row);
+        };
+
+        for_each_value([](ChannelStats& channel, double value) {
+            if (!std::isfinite(value)) {
+                channel.non_finite++;
+                return;
+            }
+            channel.min = std::min(channel.min, value);
+            channel.max = std::max(channel.max, value);
+        });
+        if (bins == 0) {
+            return stats;
+        }
+        for (auto& channel : stats) {
+            channel.histogram.assign(bins, 0);
+        }
+        for_each_value([bins](ChannelStats& channel, double value) {
+            if (!std::isfinite(value)) {
+                return;
+            }
+            const double range = channel.max - channel.min;
+            const auto bin = range > 0.0
+                ? static_cast<size_t>((value - channel.min) / range * static_cast<double>(bins))
+                : size_t {0};
+            channel.histogram[std::min(bin, bins - 1)]++;
+        });
+        return stats;
+    }
+
+    std::string stats_to_json(const std::vector<ChannelStats>& stats) {
+        std::string json = "[";
+        for (size_t i = 0; i < stats.size(); i++) {
+            const auto& channel = stats[i];
+            const bool has_finite = channel.min <= channel.max;
+            json += std::format(
+                R"({}{{"min":{},"max":{},"non_finite":{},"histogram":[)",
+                i > 0 ? "," : "",
+                has_finite ? std::format("{}", channel.min) : "null",
+                has_finite ? std::format("{}", channel.max) : "null",
+                channel.non_finite
+            );
+            for (size_t bin = 0; bin < channel.histogram.size(); bin++) {
+                json += std::format("{}{}", bin > 0 ? "," : "", channel.histogram[bin]);
+            }
+            json += "]}";
+        }
+        return json + "]";
+    }
+
+    /// Smallest step, shared by the row and column axes, that fits the preview
+    /// in `max_bytes`. Channel and leading batch axes are kept whole, so when
+    /// they alone exceed the budget this falls back to the largest useful step.
+    int64_t preview_step(
+        std::span<const int64_t> shape,
+        const PreviewAxes& axes,
+        size_t item_size,
+        size_t max_bytes
+    ) {
+        auto is_image_axis = [&](size_t axis) {
+            const auto index = static_cast<int64_t>(axis);
+            return index == axes.row || index == axes.col;
+        };
+        auto preview_bytes = [&](int64_t step) {
+            auto bytes = static_cast<int64_t>(item_size);
+            for (size_t axis = 0; axis < shape.size(); axis++) {
+                bytes *= is_image_axis(axis) ? (shape[axis] + step - 1) / step : shape[axis];
+            }
+            return static_cast<size_t>(bytes);
+        };
+
+        int64_t low = 1;
+        int64_t high = 1;
+        for (size_t axis = 0; axis < shape.size(); axis++) {
+            if (is_image_axis(axis)) {
+                high = std::max(high, shape[axis]);
+            }
+        }
+        if (preview_bytes(low) <= max_bytes || preview_bytes(high) > max_bytes) {
+            return preview_bytes(low) <= max_bytes ? low : high;
+        }
+        // preview_bytes(high) fits and preview_bytes(low) does not.
+        while (high - low > 1) {
+            const int64_t mid = low + (high - low) / 2;
+            if (preview_bytes(mid) <= max_bytes) {
+                high = mid;
+            } else {
+                low = mid;
+            }
+        }
+        return high;
+    }
+
+    std::string extents_to_json(std::span<const int64_t> extents) {
+        return to_string(make_shape(extents).unwrap());
+    }
+
     thread_local std::string g_json_debug_buffer;
 }  // namespace
 
+std::string to_json_preview(const Tensor& tensor, const TensorPreviewOptions& options) {
+    const auto shape = tensor.shape().as_span();
+    const auto stride = tensor.stride().as_span();
+    const size_t dims = shape.size();
+    const Dtype dtype = tensor.dtype();
+    const size_t item_size = dtype.size_bytes();
+    const auto axes = preview_axes(shape);
+
+    Extents step {}, extent {}, origin {};
+    std::fill_n(step.begin(), dims, 1);
+    std::copy(shape.begin(), shape.end(), extent.begin());
+
+    std::vector<std::byte> preview;
+    std::string stats = "[]";
+    if (tensor.size() > 0) {
+        // Only the image plane is downsampled: stepping a batch axis would skip
+        // whole images, and area averaging would blend different images.
+        const int64_t axis_step = preview_step(shape, axes, item_size, options.max_bytes());
+        for (const int64_t axis : {axes.row, axes.col}) {
+            if (axis >= 0) {
+                step[axis] = axis_step;
+                extent[axis] = (shape[axis] + axis_step - 1) / axis_step;
+            }
+        }
+
+        int64_t count = 1;
+        for (size_t axis = 0; axis < dims; axis++) {
+            count *= extent[axis];
+        }
+        preview.resize(static_cast<size_t>(count) * item_size);
+
+        const std::byte* src = tensor.as_bytes().data();
+        const bool use_area = axis_step > 1 && dtype != Dtype::Float16
+            && options.downsample() == PreviewDownsample::Area;
+        if (use_area) {
+            dtype.match([&](auto type_tag) {
+                using T = typename decltype(type_tag)::type;
+                area_downsample(
+                    reinterpret_cast<const T*>(src),
+                    shape,
+                    stride,
+                    step,
+                    extent,
+                    reinterpret_cast<T*>(preview.data())
+                );
+            });
+        } else {
+            gather_bytes(src, item_size, stride, origin, step, dims, extent, preview.data());
+        }
+
+        if (dtype != Dtype::Float16) {
+            stats = dtype.match([&](auto type_tag) {
+                using T = typename decltype(type_tag)::type;
+                return stats_to_json(channel_stats(
+                    reinterpret_cast<const T*>(src),
+                    shape,
+                    stride,
+                    axes.channel,
+                    options.histogram_bins()
+                ));
+            });
+        }
+    }
+
+    const auto preview_shape = make_shape(std::span<const int64_t>(extent.data(), dims)).unwrap();
+    return std::format(
+        R"({{"dtype":"{}","shape":{},"stride":{},"blob":"{}",)"
+        R"("preview":{{"source_shape":{},"step":{},"channel_axis":{}}},"stats":{}}})",
+        to_string(dtype),
+        to_string(preview_shape),
+        to_string(Stride::from_contiguous_shape(preview_shape)),
+        to_base64(preview),
+        to_string(tensor.shape()),
+        extents_to_json(std::span<const int64_t>(step.data(), dims)),
+        axes.channel,
+        stats
+    );
+}
+
+P10Result<std::string>
+to_json_tile(const Tensor& tensor, int64_t row, int64_t col, int64_t rows, int64_t cols) {
+    if (tensor.size() == 0) {
+        return Err(P10Error::InvalidArgument, "Cannot tile an empty tensor");
+    }
+    const auto shape = tensor.shape().as_span();
+    const size_t dims = shape.size();
+    const auto axes = preview_axes(shape);
+
+    Extents origin {}, step {}, extent {};
+    std::fill_n(step.begin(), dims, 1);
+    std::copy(shape.begin(), shape.end(), extent.begin());
+    auto clip = [&](int64_t axis, int64_t start, int64_t length) {
+        if (axis < 0) {
+            return true;
+        }
+        const int64_t begin = std::max<int64_t>(start, 0);
+        const int64_t end = std::min(start + length, shape[axis]);
+        origin[axis] = begin;
+        extent[axis] = end - begin;
+        return begin < end;
+    };
+    if (!clip(axes.row, row, rows) || !clip(axes.col, col, cols)) {
+        return Err(
+            P10Error::InvalidArgument
+            << std::format("Tile ({}, {}) of {}x{} is outside the tensor", row, col, rows, cols)
+        );
+    }
+
+    int64_t count = 1;
+    for (size_t axis = 0; axis < dims; axis++) {
+        count *= extent[axis];
+    }
+    const size_t item_size = tensor.dtype().size_bytes();
+    std::vector<std::byte> tile(static_cast<size_t>(count) * item_size);
+    gather_bytes(
+        tensor.as_bytes().data(),
+        item_size,
+        tensor.stride().as_span(),
+        origin,
+        step,
+        dims,
+        extent,
+        tile.data()
+    );
+
+    const auto tile_shape = make_shape(std::span<const int64_t>(extent.data(), dims)).unwrap();
+    return Ok(std::format(
+        R"({{"dtype":"{}","shape":{},"stride":{},"blob":"{}",)"
+        R"("tile":{{"row":{},"col":{},"rows":{},"cols":{}}}}})",
+        to_string(tensor.dtype()),
+        to_string(tile_shape),
+        to_string(Stride::from_contiguous_shape(tile_shape)),
+        to_base64(tile),
+        axes.row >= 0 ? origin[axes.row] : 0,
+        origin[axes.col],
+        axes.row >= 0 ? extent[axes.row] : 1,
+        extent[axes.col]
+    ));
+}
+
 const char* to_json_debug(const Tensor& tensor) {
     g_json_debug_buffer = to_json(tensor);
     return g_json_debug_buffer.c_str();
 }
 
+const char* to_json_preview_debug(const Tensor& tensor, size_t max_bytes) {
+    g_json_debug_buffer = to_json_preview(tensor, TensorPreviewOptions().max_bytes(max_bytes));
+    return g_json_debug_buffer.c_str();
+}
+
+const char*
+to_json_tile_debug(const Tensor& tensor, int64_t row, int64_t col, int64_t rows, int64_t cols) {
+    auto json = to_json_tile(tensor, row, col, rows, cols);
+    if (json.is_error()) {
+        return nullptr;
+    }
+    g_json_debug_buffer = json.unwrap();
+    return g_json_debug_buffer.c_str();
+}
+
 namespace {
 
     template<typename Reduce>
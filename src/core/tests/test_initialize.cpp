@@ -0,0 +1,69 @@
+#include <fstream>
+
+#include <catch2/catch_test_macros.hpp>
+#include <ptensor/initialize.hpp>
+#include <ptensor/testing/catch2_assertions.hpp>
+#include <ptensor/testing/output_path.hpp>
+#include <ptensor/testing/simd_tiers.hpp>
+
+namespace p10 {
+
+TEST_CASE("core::set_simd_max caps the dispatch tier", "[initialize][simd]") {
+    const std::string previous = get_simd_max();
+
+    REQUIRE_THAT(set_simd_max("portable"), testing::is_ok());
+    REQUIRE(get_simd_max() == "portable");
+
+    REQUIRE_THAT(set_simd_max("native"), testing::is_ok());
+    REQUIRE(get_simd_max() == "native");
+
+    const auto error = set_simd_max("avx512");
+    REQUIRE(error.is_error());
+    REQUIRE(error.code() == P10Error::InvalidArgument);
+    REQUIRE(get_simd_max() == "native");
+
+    REQUIRE(initialize("./ptensor-logs", "bogus").is_error());
+
+    REQUIRE_THAT(set_simd_max(previous), testing::is_ok());
+}
+
+TEST_CASE("core::for_each_simd_tier visits every tier", "[initialize][simd]") {
+    const auto tiers = get_simd_tiers();
+    REQUIRE_FALSE(tiers.empty());
+    REQUIRE(tiers.front() == "portable");
+
+    const std::string previous = get_simd_max();
+    std::vector<std::string> visited;
+    testing::for_each_simd_tier([&](const std::string& tier) {
+        REQUIRE(get_simd_max() == tier);
+        visited.push_back(tier);
+    });
+    REQUIRE(visited == tiers);
+    REQUIRE(get_simd_max() == previous);
+}
+
+TEST_CASE("core::initialize loads the tuning cache", "[initialize][tuning]") {
+    const auto directory = testing::get_output_path("core/initialize");
+    const std::string cache = (directory / "tuning.txt").string();
+    const std::string malformed = (directory / "malformed-tuning.txt").string();
+    std::ofstream(malformed) << "transpose avx2 4 10 10 not-a-size parallel\n";
+
+    const auto error = initialize(InitializeOptions().tuning_cache(malformed));
+    REQUIRE(error.is_error());
+    REQUIRE(error.code() == P10Error::InvalidOperation);
+
+    // A bad cache fails before the SIMD cap is applied.
+    const std::string previous = get_simd_max();
+    const std::string other = previous == "portable" ? "native" : "portable";
+    REQUIRE(initialize(InitializeOptions().simd_max(other).tuning_cache(malformed)).is_error());
+    REQUIRE(get_simd_max() == previous);
+
+    REQUIRE_THAT(initialize(InitializeOptions().tuning_cache(cache)), testing::is_ok());
+    REQUIRE_THAT(save_tuning_cache(cache), testing::is_ok());
+    REQUIRE_THAT(load_tuning_cache(cache), testing::is_ok());
+
+    // Back to in-memory tuning for the rest of the run.
+    REQUIRE_THAT(load_tuning_cache(""), testing::is_ok());
+}
+
+}  // namespace p10
@@ -6,6 +6,7 @@
 #include <ptensor/tensor.hpp>
 #include <ptensor/testing/catch2_assertions.hpp>
 #include <ptensor/testing/compare_tensors.hpp>
+#include <ptensor/testing/simd_tiers.hpp>
 
 #include "catch2/matchers/catch_matchers.hpp"
 
@@ -1032,6 +1033,19 @@ TEST_CASE("core::Tensor::transpose", "[tensor][transpose]") {
         }
     }
 
+    SECTION("Every SIMD tier agrees") {
+        auto type = GENERATE(Dtype::Float32, Dtype::Int32);
+        DYNAMIC_SECTION("Testing SIMD tiers with type " << to_string(type)) {
+            auto tensor = Tensor::from_range(make_shape(517, 1030), type).unwrap();
+            REQUIRE_THAT(
+                testing::compare_simd_tiers([&](Tensor& output) {
+                    REQUIRE(tensor.transpose(output).is_ok());
+                }),
+                testing::is_ok()
+            );
+        }
+    }
+
     SECTION("Transpose into self") {
         // from_range fills row-major 0..n-1, so element (i, j) holds i*cols + j;
         // after transposing into the same tensor, (j, i) must hold that value.
@@ -77,6 +77,149 @@ TEST_CASE("Tensor::to_json emits parseable JSON", "[tensor][print][json]") {
     REQUIRE(std::string(debug_ptr) == json);
 }
 
+TEST_CASE("Tensor::to_json_preview fits the byte budget", "[tensor][print][json]") {
+    auto tensor = Tensor::from_range(make_shape(4, 6)).expect("Could not create tensor");
+
+    SECTION("Small tensors are sent whole") {
+        const std::string json = to_json_preview(tensor, TensorPreviewOptions().histogram_bins(4));
+        REQUIRE(json.starts_with(R"({"dtype":"float32","shape":[4, 6],"stride":[6, 1],"blob":")"));
+        REQUIRE(
+            json.ends_with(
+                R"("preview":{"source_shape":[4, 6],"step":[1, 1],"channel_axis":-1},)"
+                R"("stats":[{"min":0,"max":23,"non_finite":0,"histogram":[6,6,6,6]}]})"
+            )
+        );
+    }
+
+    SECTION("Area downsampling averages each box") {
+        const std::string json =
+            to_json_preview(tensor, TensorPreviewOptions().max_bytes(24).histogram_bins(2));
+        // Box means of 0..23 in 2x2 boxes: 3.5, 5.5, 7.5, 15.5, 17.5, 19.5.
+        REQUIRE(json.starts_with(
+            R"({"dtype":"float32","shape":[2, 3],"stride":[3, 1],)"
+            R"("blob":"AABgQAAAsEAAAPBAAAB4QQAAjEEAAJxB")"
+        ));
+        REQUIRE(json.find(R"("step":[2, 2])") != std::string::npos);
+        // Stats still describe the full-resolution tensor.
+        REQUIRE(
+            json.find(R"("min":0,"max":23,"non_finite":0,"histogram":[12,12])")
+            != std::string::npos
+        );
+    }
+
+    SECTION("Stride downsampling keeps every step-th element") {
+        auto bytes = Tensor::from_range(make_shape(4, 6), TensorOptions().dtype(Dtype::Uint8))
+                         .expect("Could not create tensor");
+        const std::string json = to_json_preview(
+            bytes,
+            TensorPreviewOptions().max_bytes(6).downsample(PreviewDownsample::Stride)
+        );
+        // Elements 0, 2, 4, 12, 14, 16.
+        REQUIRE(json.starts_with(
+            R"({"dtype":"uint8","shape":[2, 3],"stride":[3, 1],"blob":"AAIEDA4Q")"
+        ));
+    }
+
+    SECTION("Channels are kept and summarized separately") {
+        auto rgb = Tensor::zeros(make_shape(100, 80, 3), TensorOptions().dtype(Dtype::Uint8))
+                       .expect("Could not create tensor");
+        const std::string json =
+            to_json_preview(rgb, TensorPreviewOptions().max_bytes(3000).histogram_bins(0));
+        REQUIRE(json.starts_with(R"({"dtype":"uint8","shape":[34, 27, 3])"));
+        REQUIRE(
+            json.ends_with(
+                R"("preview":{"source_shape":[100, 80, 3],"step":[3, 3, 1],"channel_axis":2},)"
+                R"("stats":[{"min":0,"max":0,"non_finite":0,"histogram":[]},)"
+                R"({"min":0,"max":0,"non_finite":0,"histogram":[]},)"
+                R"({"min":0,"max":0,"non_finite":0,"histogram":[]}]})"
+            )
+        );
+    }
+
+    SECTION("Batch axes are kept whole") {
+        // [B, H, W, C] and [B, C, H, W] batches where image b holds only b * 10.
+        const auto shape = GENERATE(make_shape(3, 16, 12, 1), make_shape(3, 2, 16, 12));
+        CAPTURE(shape);
+        auto batch = Tensor::zeros(shape, TensorOptions().dtype(Dtype::Uint8))
+                         .expect("Could not create tensor");
+        auto values = batch.as_span1d<uint8_t>().unwrap();
+        const size_t image_size = values.size() / 3;
+        for (size_t i = 0; i < values.size(); i++) {
+            values[i] = static_cast<uint8_t>((i / image_size) * 10);
+        }
+
+        const auto mode = GENERATE(PreviewDownsample::Area, PreviewDownsample::Stride);
+        const std::string json = to_json_preview(
+            batch,
+            TensorPreviewOptions().max_bytes(3 * 2 * 8 * 6).downsample(mode).histogram_bins(0)
+        );
+        const bool channels_last = shape[3].unwrap() == 1;
+        const auto preview_shape = channels_last ? make_shape(3, 8, 6, 1) : make_shape(3, 2, 8, 6);
+        REQUIRE(
+            json.find(channels_last ? R"("step":[1, 2, 2, 1])" : R"("step":[1, 1, 2, 2])")
+            != std::string::npos
+        );
+
+        // Every preview image is still the constant of its source image.
+        auto expected = Tensor::zeros(preview_shape, TensorOptions().dtype(Dtype::Uint8))
+                            .expect("Could not create tensor");
+        auto expected_values = expected.as_span1d<uint8_t>().unwrap();
+        for (size_t i = 0; i < expected_values.size(); i++) {
+            expected_values[i] = static_cast<uint8_t>((i / (expected_values.size() / 3)) * 10);
+        }
+        std::string prefix = to_json(expected);
+        prefix.back() = ',';
+        REQUIRE(json.starts_with(prefix));
+    }
+
+    SECTION("Strided views match their contiguous copy") {
+        // Rows and columns swapped in memory: [7, 5, 3] stored as [5, 7, 3].
+        auto strided = Tensor::empty(
+                           make_shape(7, 5, 3),
+                           TensorOptions().dtype(Dtype::Uint8).stride(make_stride(3, 21, 1))
+        )
+                           .expect("Could not create tensor");
+        auto storage = strided.as_span1d<uint8_t>().unwrap();
+        for (size_t i = 0; i < storage.size(); i++) {
+            storage[i] = static_cast<uint8_t>((i * 37) % 256);
+        }
+        const auto contiguous = strided.to_contiguous().expect("Could not copy tensor");
+
+        const auto mode = GENERATE(PreviewDownsample::Area, PreviewDownsample::Stride);
+        const auto max_bytes = GENERATE(size_t {1024}, size_t {30});
+        CAPTURE(mode, max_bytes);
+        const auto options =
+            TensorPreviewOptions().max_bytes(max_bytes).downsample(mode).histogram_bins(5);
+        REQUIRE(to_json_preview(strided, options) == to_json_preview(contiguous, options));
+        REQUIRE(
+            to_json_tile(strided, 2, 1, 3, 3).unwrap()
+            == to_json_tile(contiguous, 2, 1, 3, 3).unwrap()
+        );
+    }
+
+    SECTION("Debug hook") {
+        const char* debug_ptr = to_json_preview_debug(tensor, 24);
+        REQUIRE(debug_ptr != nullptr);
+        REQUIRE(std::string(debug_ptr).starts_with(R"({"dtype":"float32","shape":[2, 3])"));
+    }
+}
+
+TEST_CASE("Tensor::to_json_tile sends full-resolution regions", "[tensor][print][json]") {
+    auto tensor = Tensor::from_range(make_shape(4, 6)).expect("Could not create tensor");
+
+    auto tile = to_json_tile(tensor, 1, 4, 2, 5);
+    REQUIRE_THAT(tile, testing::is_ok());
+    // Clipped to columns 4..5: values 10, 11, 16, 17.
+    REQUIRE(
+        tile.unwrap()
+        == R"({"dtype":"float32","shape":[2, 2],"stride":[2, 1],"blob":"AAAgQQAAMEEAAIBBAACIQQ==",)"
+           R"("tile":{"row":1,"col":4,"rows":2,"cols":2}})"
+    );
+
+    REQUIRE(to_json_tile(tensor, 5, 0, 2, 2).is_error());
+    REQUIRE(to_json_tile_debug(tensor, 5, 0, 2, 2) == nullptr);
+}
+
 TEST_CASE("Tensor stats debug helpers", "[tensor][debug][stats]") {
     auto tensor = Tensor::from_range(make_shape(2, 3)).expect("Could not create tensor");
     // Values are 0..5, so min=0, max=5, mean=2.5.
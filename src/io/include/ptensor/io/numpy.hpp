@@ -1,10 +1,101 @@
+#pragma once
+
 #include <map>
+#include <memory>
 #include <string>
+#include <string_view>
 
 #include <ptensor/tensor.hpp>
 
 namespace p10::io {
 using TensorMap = std::map<std::string, Tensor, std::less<>>;
+
+/// Array metadata parsed from a `.npy` header.
+///
+/// Complex descriptors (`c8`, `c16`) map to Float32/Float64 with a trailing
+/// size-2 (real, imag) dimension, the layout the complex tensor views expect.
+/// Booleans (`b1`) map to Uint8 and 0-d arrays to shape `[1]`.
+struct NpyHeader {
+    Shape shape;
+    Dtype dtype;
+    bool fortran_order = false;
+};
+
 P10Error save_npz(const std::string& filename, const TensorMap& tensors);
+
+/// Loads every array of an `.npz` archive.
+///
+/// Each entry is decoded straight into its tensor (see `NpzReader`), so the
+/// archive is never held in memory as a whole.
 P10Result<TensorMap> load_npz(const std::string& filename);
+
+/// Loads an `.npy` file by memory-mapping it.
+///
+/// The returned tensor points into the mapping (copy-on-write), so no bytes are
+/// read until they are touched and the file is unmapped when the last view of
+/// the tensor is dropped. Fortran-ordered arrays come back as column-major
+/// strided tensors; call `to_contiguous()` for a C-ordered copy. Big-endian
+/// arrays cannot be mapped as-is and are read and byte-swapped instead.
+///
+/// # Errors
+///
+/// * IoError: The file cannot be opened or mapped.
+/// * InvalidArgument: The file is not a valid `.npy` file.
+/// * NotImplemented: The dtype descriptor has no ptensor equivalent.
+P10Result<Tensor> load_npy(const std::string& filename);
+
+/// Streaming reader over the arrays of an `.npz` archive.
+///
+/// Only the zip central directory is read on `open`. Each call to `next()`
+/// parses one entry's `.npy` header, and `read()` decodes (or inflates, for
+/// `savez_compressed` archives) its data directly into a caller-provided
+/// tensor, reusing its storage when it is large enough. Peak memory is one
+/// array plus a small inflate buffer, regardless of the archive size.
+///
+/// Not thread-safe.
+class NpzReader {
+  public:
+    class Impl;
+
+    static P10Result<NpzReader> open(const std::string& filename);
+
+    NpzReader(NpzReader&&) noexcept;
+    NpzReader& operator=(NpzReader&&) noexcept;
+    NpzReader(const NpzReader&) = delete;
+    NpzReader& operator=(const NpzReader&) = delete;
+    ~NpzReader();
+
+    /// Number of arrays in the archive.
+    size_t size() const;
+
+    /// Advances to the next array and parses its header.
+    ///
+    /// # Returns
+    ///
+    /// * false once every array has been visited.
+    P10Result<bool> next();
+
+    /// Positions the reader at the array named `name` (without the `.npy`
+    /// suffix) and parses its header. Later `next()` calls continue from there.
+    P10Error seek(std::string_view name);
+
+    /// Name of the current array, without the `.npy` suffix.
+    const std::string& name() const;
+
+    /// Header of the current array.
+    const NpyHeader& header() const;
+
+    /// Decodes the current array into `tensor`.
+    ///
+    /// `tensor` is (re)created with the header's shape and dtype; Fortran-ordered
+    /// arrays get column-major strides so the bytes land without a transpose.
+    /// Each array can be read once; call `next()` or `seek()` to move on.
+    P10Error read(Tensor& tensor);
+
+  private:
+    explicit NpzReader(std::unique_ptr<Impl> impl);
+
+    std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace p10::io
@@ -1,15 +1,603 @@
 #include "numpy.hpp"
 
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
 #include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <span>
+#include <vector>
 
 #include <cnpy.h>
+#include <zlib.h>
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
 
 #include "ptensor/p10_error.hpp"
 #include "ptensor/p10_result.hpp"
 
 namespace p10::io {
 
+namespace {
+    constexpr std::array<uint8_t, 6> NPY_MAGIC = {0x93, 'N', 'U', 'M', 'P', 'Y'};
+
+    // Header plus the decoding facts NpyHeader does not expose.
+    struct NpyLayout {
+        NpyHeader header;
+        bool byte_swap = false;
+        bool is_complex = false;
+    };
+
+    uint16_t load_u16(const uint8_t* bytes) {
+        return static_cast<uint16_t>(bytes[0] | (bytes[1] << 8));
+    }
+
+    uint32_t load_u32(const uint8_t* bytes) {
+        return static_cast<uint32_t>(load_u16(bytes))
+            | (static_cast<uint32_t>(load_u16(bytes + 2)) << 16);
+    }
+
+    uint64_t load_u64(const uint8_t* bytes) {
+        return static_cast<uint64_t>(load_u32(bytes))
+            | (static_cast<uint64_t>(load_u32(bytes + 4)) << 32);
+    }
+
+    // Text following `'key':` in the header dict, with leading blanks skipped.
+    std::optional<std::string_view> dict_value(std::string_view dict, std::string_view key) {
+        const std::string quoted = "'" + std::string(key) + "'";
+        auto pos = dict.find(quoted);
+        if (pos == std::string_view::npos) {
+            return std::nullopt;
+        }
+        pos = dict.find(':', pos + quoted.size());
+        if (pos == std::string_view::npos) {
+            return std::nullopt;
+        }
+        pos = dict.find_first_not_of(' ', pos + 1);
+        if (pos == std::string_view::npos) {
+            return std::nullopt;
+        }
+        return dict.substr(pos);
+    }
+
+    P10Error parse_descr(std::string_view descr, NpyLayout& layout) {
+        const std::string invalid = "Invalid npy dtype descriptor: " + std::string(descr);
+        if (descr.size() < 3) {
+            return P10Error::InvalidArgument << invalid;
+        }
+        const char order = descr[0];
+        const char kind = descr[1];
+        int size = 0;
+        const auto [end, ec] = std::from_chars(descr.data() + 2, descr.data() + descr.size(), size);
+        if (ec != std::errc() || end != descr.data() + descr.size()) {
+            return P10Error::InvalidArgument << invalid;
+        }
+
+        std::optional<Dtype> dtype;
+        switch (kind) {
+            case 'f':
+                dtype = size == 2 ? std::optional<Dtype>(Dtype::Float16)
+                    : size == 4   ? std::optional<Dtype>(Dtype::Float32)
+                    : size == 8   ? std::optional<Dtype>(Dtype::Float64)
+                                  : std::nullopt;
+                break;
+            case 'i':
+                dtype = size == 1 ? std::optional<Dtype>(Dtype::Int8)
+                    : size == 2   ? std::optional<Dtype>(Dtype::Int16)
+                    : size == 4   ? std::optional<Dtype>(Dtype::Int32)
+                    : size == 8   ? std::optional<Dtype>(Dtype::Int64)
+                                  : std::nullopt;
+                break;
+            case 'u':
+                dtype = size == 1 ? std::optional<Dtype>(Dtype::Uint8)
+                    : size == 2   ? std::optional<Dtype>(Dtype::Uint16)
+                    : size == 4   ? std::optional<Dtype>(Dtype::Uint32)
+                                  : std::nullopt;
+                break;
+            case 'b':
+                dtype = size == 1 ? std::optional<Dtype>(Dtype::Uint8) : std::nullopt;
+                break;
+            case 'c':
+                layout.is_complex = true;
+                dtype = size == 8 ? std::optional<Dtype>(Dtype::Float32)
+                    : size == 16  ? std::optional<Dtype>(Dtype::Float64)
+                                  : std::nullopt;
+                break;
+            default:
+                break;
+        }
+        if (!dtype) {
+            return P10Error::NotImplemented << "Unsupported npy dtype: " + std::string(descr);
+        }
+        layout.header.dtype = *dtype;
+
+        // '|' is "not applicable" (single bytes), '=' is the writer's native order.
+        if (order != '<' && order != '>' && order != '=' && order != '|') {
+            return P10Error::InvalidArgument << invalid;
+        }
+        constexpr bool HOST_LITTLE = std::endian::native == std::endian::little;
+        const bool little = order == '<' || (order == '=' && HOST_LITTLE);
+        layout.byte_swap = order != '|' && little != HOST_LITTLE && dtype->size_bytes() > 1;
+        return P10Error::Ok;
+    }
+
+    P10Error parse_shape(std::string_view tuple, NpyLayout& layout) {
+        if (tuple.empty() || tuple.front() != '(') {
+            return P10Error::InvalidArgument << "Invalid npy shape";
+        }
+        const auto close = tuple.find(')');
+        if (close == std::string_view::npos) {
+            return P10Error::InvalidArgument << "Invalid npy shape";
+        }
+
+        std::vector<int64_t> dims;
+        const char* cursor = tuple.data() + 1;
+        const char* const end = tuple.data() + close;
+        while (cursor < end) {
+            if (*cursor == ' ' || *cursor == ',') {
+                cursor++;
+                continue;
+            }
+            int64_t dim = 0;
+            const auto [next, ec] = std::from_chars(cursor, end, dim);
+            if (ec != std::errc() || dim < 0) {
+                return P10Error::InvalidArgument << "Invalid npy shape";
+            }
+            dims.push_back(dim);
+            cursor = next;
+        }
+        if (dims.empty()) {
+            dims.push_back(1);  // 0-d array: a single element
+        }
+        if (layout.is_complex) {
+            dims.push_back(2);
+        }
+
+        auto shape = make_shape(dims);
+        if (shape.is_error()) {
+            return P10Error::InvalidArgument << "npy array has too many dimensions";
+        }
+        layout.header.shape = shape.unwrap();
+        return P10Error::Ok;
+    }
+
+    P10Result<NpyLayout> parse_npy_dict(std::string_view dict) {
+        NpyLayout layout;
+
+        const auto descr = dict_value(dict, "descr");
+        if (!descr || descr->empty() || descr->front() != '\'') {
+            return Err(P10Error::NotImplemented, "Only simple npy dtype descriptors are supported");
+        }
+        const auto descr_end = descr->find('\'', 1);
+        if (descr_end == std::string_view::npos) {
+            return Err(P10Error::InvalidArgument, "Invalid npy dtype descriptor");
+        }
+        P10_RETURN_ERR_IF_ERROR(parse_descr(descr->substr(1, descr_end - 1), layout));
+
+        const auto fortran = dict_value(dict, "fortran_order");
+        if (!fortran) {
+            return Err(P10Error::InvalidArgument, "npy header has no fortran_order");
+        }
+        layout.header.fortran_order = fortran->starts_with("True");
+
+        const auto shape = dict_value(dict, "shape");
+        if (!shape) {
+            return Err(P10Error::InvalidArgument, "npy header has no shape");
+        }
+        P10_RETURN_ERR_IF_ERROR(parse_shape(*shape, layout));
+
+        return Ok(std::move(layout));
+    }
+
+    // Reads and parses an npy preamble + header through `read_exact`, a
+    // `P10Error(std::span<std::byte>)` callable. Leaves the source at the data.
+    template<typename ReadExact>
+    P10Result<NpyLayout> read_npy_header(ReadExact&& read_exact) {
+        std::array<uint8_t, 12> preamble {};
+        P10_RETURN_ERR_IF_ERROR(read_exact(std::as_writable_bytes(std::span(preamble.data(), 10))));
+        if (!std::equal(NPY_MAGIC.begin(), NPY_MAGIC.end(), preamble.begin())) {
+            return Err(P10Error::InvalidArgument, "Not a npy file (bad magic)");
+        }
+
+        // Version 1.x stores the header length in 16 bits, 2.x/3.x in 32 bits.
+        const uint8_t major = preamble[6];
+        size_t header_len = 0;
+        if (major == 1) {
+            header_len = load_u16(&preamble[8]);
+        } else if (major == 2 || major == 3) {
+            P10_RETURN_ERR_IF_ERROR(
+                read_exact(std::as_writable_bytes(std::span(preamble.data() + 10, 2)))
+            );
+            header_len = load_u32(&preamble[8]);
+        } else {
+            return Err(P10Error::NotImplemented, "Unsupported npy format version");
+        }
+
+        std::string dict(header_len, '\0');
+        P10_RETURN_ERR_IF_ERROR(read_exact(std::as_writable_bytes(std::span(dict))));
+        return parse_npy_dict(dict);
+    }
+
+    // Column-major strides for a Fortran-ordered array. A complex tensor keeps
+    // its trailing (real, imag) pair innermost.
+    Stride fortran_stride(const Shape& shape, bool is_complex) {
+        auto stride = Stride::zeros(shape.dims()).unwrap();
+        auto out = stride.as_span();
+        const size_t dims = is_complex ? shape.dims() - 1 : shape.dims();
+        int64_t step = is_complex ? 2 : 1;
+        for (size_t i = 0; i < dims; i++) {
+            out[i] = step;
+            step *= shape[i].unwrap();
+        }
+        if (is_complex) {
+            out[dims] = 1;
+        }
+        return stride;
+    }
+
+    TensorOptions tensor_options(const NpyLayout& layout) {
+        TensorOptions options(layout.header.dtype);
+        if (layout.header.fortran_order && layout.header.shape.dims() > 1) {
+            options.stride(fortran_stride(layout.header.shape, layout.is_complex));
+        }
+        return options;
+    }
+
+    void byte_swap(std::span<std::byte> bytes, size_t word_size) {
+        for (size_t offset = 0; offset + word_size <= bytes.size(); offset += word_size) {
+            std::reverse(bytes.begin() + offset, bytes.begin() + offset + word_size);
+        }
+    }
+
+    using FilePtr = std::unique_ptr<FILE, decltype(&fclose)>;
+
+    FilePtr open_file(const std::string& filename) {
+        return {fopen(filename.c_str(), "rb"), &fclose};
+    }
+
+    int seek_file(FILE* file, int64_t offset, int origin) {
+#ifdef _WIN32
+        return _fseeki64(file, offset, origin);
+#else
+        return fseeko(file, static_cast<off_t>(offset), origin);
+#endif
+    }
+
+    int64_t tell_file(FILE* file) {
+#ifdef _WIN32
+        return _ftelli64(file);
+#else
+        return static_cast<int64_t>(ftello(file));
+#endif
+    }
+
+    P10Error read_file(FILE* file, std::span<std::byte> out) {
+        if (fread(out.data(), 1, out.size(), file) != out.size()) {
+            return P10Error::IoError << "Unexpected end of file";
+        }
+        return P10Error::Ok;
+    }
+
+    // Read-only file mapping with copy-on-write pages, so the tensor built on
+    // top of it stays writable without touching the file.
+    struct MappedFile {
+        std::byte* data = nullptr;
+        size_t size = 0;
+        std::function<void(void*)> unmap;
+    };
+
+    P10Result<MappedFile> map_file(const std::string& filename) {
+#ifdef _WIN32
+        HANDLE file = CreateFileA(
+            filename.c_str(),
+            GENERIC_READ,
+            FILE_SHARE_READ,
+            nullptr,
+            OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL,
+            nullptr
+        );
+        if (file == INVALID_HANDLE_VALUE) {
+            return Err(P10Error::IoError << "Unable to open file " + filename);
+        }
+        LARGE_INTEGER file_size {};
+        if (GetFileSizeEx(file, &file_size) == FALSE || file_size.QuadPart == 0) {
+            CloseHandle(file);
+            return Err(P10Error::InvalidArgument << "Not a npy file: " + filename);
+        }
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr) {
+            return Err(P10Error::IoError << "Unable to map file " + filename);
+        }
+        void* view = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+        CloseHandle(mapping);  // the view keeps the mapping alive
+        if (view == nullptr) {
+            return Err(P10Error::IoError << "Unable to map file " + filename);
+        }
+        return Ok(
+            MappedFile {
+                .data = static_cast<std::byte*>(view),
+                .size = static_cast<size_t>(file_size.QuadPart),
+                .unmap = [view](void*) { UnmapViewOfFile(view); },
+            }
+        );
+#else
+        const int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return Err(P10Error::IoError << "Unable to open file " + filename);
+        }
+        struct stat info {};
+        if (fstat(fd, &info) != 0 || info.st_size == 0) {
+            ::close(fd);
+            return Err(P10Error::InvalidArgument << "Not a npy file: " + filename);
+        }
+        const auto size = static_cast<size_t>(info.st_size);
+        void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        ::close(fd);  // the mapping holds its own reference to the file
+        if (base == MAP_FAILED) {
+            return Err(P10Error::OsError << "Unable to map file " + filename);
+        }
+        return Ok(
+            MappedFile {
+                .data = static_cast<std::byte*>(base),
+                .size = size,
+                .unmap = [base, size](void*) { munmap(base, size); },
+            }
+        );
+#endif
+    }
+
+    constexpr uint32_t ZIP_LOCAL_HEADER_SIG = 0x04034b50;
+    constexpr uint32_t ZIP_CENTRAL_HEADER_SIG = 0x02014b50;
+    constexpr uint32_t ZIP_END_SIG = 0x06054b50;
+    constexpr uint32_t ZIP64_END_SIG = 0x06064b50;
+    constexpr uint32_t ZIP64_LOCATOR_SIG = 0x07064b50;
+    constexpr uint16_t ZIP64_EXTRA_ID = 0x0001;
+    constexpr size_t ZIP_LOCAL_HEADER_SIZE = 30;
+    constexpr size_t ZIP_CENTRAL_HEADER_SIZE = 46;
+    constexpr size_t ZIP_END_SIZE = 22;
+    constexpr uint16_t ZIP_STORED = 0;
+    constexpr uint16_t ZIP_DEFLATED = 8;
+
+    struct ZipEntry {
+        std::string name;
+        uint16_t method = ZIP_STORED;
+        uint64_t compressed_size = 0;
+        uint64_t local_header_offset = 0;
+    };
+
+    // Locates the central directory through the end record (and its zip64
+    // twin, which numpy writes for every array) and lists the entries. Only
+    // metadata is read; the array data stays on disk until requested.
+    P10Result<std::vector<ZipEntry>> read_central_directory(FILE* file) {
+        if (seek_file(file, 0, SEEK_END) != 0) {
+            return Err(P10Error::IoError, "Unable to seek npz file");
+        }
+        const int64_t file_size = tell_file(file);
+        if (file_size < static_cast<int64_t>(ZIP_END_SIZE)) {
+            return Err(P10Error::InvalidArgument, "Not a npz file (too small)");
+        }
+
+        // The end record sits in the last 22 bytes plus an optional comment.
+        const int64_t tail_size =
+            std::min<int64_t>(file_size, ZIP_END_SIZE + std::numeric_limits<uint16_t>::max());
+        std::vector<uint8_t> tail(static_cast<size_t>(tail_size));
+        if (seek_file(file, file_size - tail_size, SEEK_SET) != 0) {
+            return Err(P10Error::IoError, "Unable to seek npz file");
+        }
+        P10_RETURN_ERR_IF_ERROR(read_file(file, std::as_writable_bytes(std::span(tail))));
+
+        std::optional<size_t> end_pos;
+        for (size_t pos = tail.size() - ZIP_END_SIZE + 1; pos-- > 0;) {
+            if (load_u32(&tail[pos]) == ZIP_END_SIG) {
+                end_pos = pos;
+                break;
+            }
+        }
+        if (!end_pos) {
+            return Err(P10Error::InvalidArgument, "Not a npz file (no zip end record)");
+        }
+
+        const uint8_t* end_record = &tail[*end_pos];
+        uint64_t entry_count = load_u16(end_record + 10);
+        uint64_t directory_size = load_u32(end_record + 12);
+        uint64_t directory_offset = load_u32(end_record + 16);
+
+        const bool is_zip64 = entry_count == 0xFFFF || directory_size == 0xFFFFFFFF
+            || directory_offset == 0xFFFFFFFF;
+        if (is_zip64) {
+            constexpr size_t LOCATOR_SIZE = 20;
+            constexpr size_t ZIP64_END_SIZE = 56;
+            if (*end_pos < LOCATOR_SIZE
+                || load_u32(&tail[*end_pos - LOCATOR_SIZE]) != ZIP64_LOCATOR_SIG) {
+                return Err(P10Error::InvalidArgument, "Corrupted npz file (no zip64 locator)");
+            }
+            const uint64_t zip64_end_offset = load_u64(&tail[*end_pos - LOCATOR_SIZE + 8]);
+            std::array<uint8_t, ZIP64_END_SIZE> zip64_end {};
+            if (seek_file(file, static_cast<int64_t>(zip64_end_offset), SEEK_SET) != 0) {
+                return Err(P10Error::IoError, "Unable to seek to the zip64 end record");
+            }
+            P10_RETURN_ERR_IF_ERROR(read_file(file, std::as_writable_bytes(std::span(zip64_end))));
+            if (load_u32(zip64_end.data()) != ZIP64_END_SIG) {
+                return Err(P10Error::InvalidArgument, "Corrupted npz file (bad zip64 end record)");
+            }
+            entry_count = load_u64(&zip64_end[32]);
+            directory_size = load_u64(&zip64_end[40]);
+            directory_offset = load_u64(&zip64_end[48]);
+        }
+
+        if (directory_offset + directory_size > static_cast<uint64_t>(file_size)) {
+            return Err(P10Error::InvalidArgument, "Corrupted npz file (bad central directory)");
+        }
+        std::vector<uint8_t> directory(directory_size);
+        if (seek_file(file, static_cast<int64_t>(directory_offset), SEEK_SET) != 0) {
+            return Err(P10Error::IoError, "Unable to seek to the npz central directory");
+        }
+        P10_RETURN_ERR_IF_ERROR(read_file(file, std::as_writable_bytes(std::span(directory))));
+
+        std::vector<ZipEntry> entries;
+        entries.reserve(entry_count);
+        size_t pos = 0;
+        for (uint64_t i = 0; i < entry_count; i++) {
+            if (pos + ZIP_CENTRAL_HEADER_SIZE > directory.size()
+                || load_u32(&directory[pos]) != ZIP_CENTRAL_HEADER_SIG) {
+                return Err(P10Error::InvalidArgument, "Corrupted npz file (bad central header)");
+            }
+            const uint8_t* header = &directory[pos];
+            const size_t name_len = load_u16(header + 28);
+            const size_t extra_len = load_u16(header + 30);
+            const size_t comment_len = load_u16(header + 32);
+            if (pos + ZIP_CENTRAL_HEADER_SIZE + name_len + extra_len > directory.size()) {
+                return Err(P10Error::InvalidArgument, "Corrupted npz file (truncated entry)");
+            }
+
+            ZipEntry entry;
+            entry.method = load_u16(header + 10);
+            entry.compressed_size = load_u32(header + 20);
+            uint64_t uncompressed_size = load_u32(header + 24);
+            entry.local_header_offset = load_u32(header + 42);
+            entry.name.assign(
+                reinterpret_cast<const char*>(header + ZIP_CENTRAL_HEADER_SIZE),
+                name_len
+            );
+
+            // Saturated 32-bit fields are stored, in this order, in the zip64 extra.
+            const uint8_t* extra = header + ZIP_CENTRAL_HEADER_SIZE + name_len;
+            for (size_t e = 0; e + 4 <= extra_len;) {
+                const uint16_t id = load_u16(extra + e);
+                const size_t len = load_u16(extra + e + 2);
+                if (id == ZIP64_EXTRA_ID) {
+                    const uint8_t* field = extra + e + 4;
+                    const uint8_t* const field_end = field + std::min(len, extra_len - e - 4);
+                    if (uncompressed_size == 0xFFFFFFFF && field + 8 <= field_end) {
+                        uncompressed_size = load_u64(field);
+                        field += 8;
+                    }
+                    if (entry.compressed_size == 0xFFFFFFFF && field + 8 <= field_end) {
+                        entry.compressed_size = load_u64(field);
+                        field += 8;
+                    }
+                    if (entry.local_header_offset == 0xFFFFFFFF && field + 8 <= field_end) {
+                        entry.local_header_offset = load_u64(field);
+                    }
+                }
+                e += 4 + len;
+            }
+
+            if (entry.name.ends_with(".npy")) {
+                entry.name.erase(entry.name.size() - 4);
+            }
+            entries.push_back(std::move(entry));
+            pos += ZIP_CENTRAL_HEADER_SIZE + name_len + extra_len + comment_len;
+        }
+
+        return Ok(std::move(entries));
+    }
+
+    // Sequential byte source over one zip entry: stored entries are read
+    // straight from the file, deflated ones are inflated through a fixed-size
+    // input buffer directly into the caller's memory.
+    class EntryStream {
+      public:
+        static constexpr size_t INPUT_CHUNK = 64 * 1024;
+
+        EntryStream(FILE* file, uint16_t method, uint64_t compressed_size) :
+            file_(file),
+            remaining_(compressed_size),
+            deflated_(method == ZIP_DEFLATED) {}
+
+        EntryStream(const EntryStream&) = delete;
+        EntryStream& operator=(const EntryStream&) = delete;
+        EntryStream(EntryStream&&) = delete;
+        EntryStream& operator=(EntryStream&&) = delete;
+
+        ~EntryStream() {
+            if (inflating_) {
+                inflateEnd(&zstream_);
+            }
+        }
+
+        P10Error read(std::span<std::byte> out) {
+            if (!deflated_) {
+                if (out.size() > remaining_) {
+                    return P10Error::InvalidArgument << "npz entry is shorter than its header";
+                }
+                remaining_ -= out.size();
+                return read_file(file_, out);
+            }
+            return inflate_into(out);
+        }
+
+      private:
+        P10Error inflate_into(std::span<std::byte> out) {
+            if (!inflating_) {
+                // Negative window bits: raw deflate data, no zlib wrapper.
+                if (inflateInit2(&zstream_, -MAX_WBITS) != Z_OK) {
+                    return P10Error::OutOfMemory << "Unable to initialize inflate";
+                }
+                inflating_ = true;
+                input_.resize(INPUT_CHUNK);
+            }
+
+            auto* next_out = reinterpret_cast<Bytef*>(out.data());
+            size_t pending = out.size();
+            while (pending > 0) {
+                if (zstream_.avail_in == 0) {
+                    if (remaining_ == 0) {
+                        return P10Error::InvalidArgument << "npz entry is shorter than its header";
+                    }
+                    const size_t chunk = std::min<uint64_t>(remaining_, input_.size());
+                    P10_RETURN_IF_ERROR(
+                        read_file(file_, std::as_writable_bytes(std::span(input_.data(), chunk)))
+                    );
+                    remaining_ -= chunk;
+                    zstream_.next_in = input_.data();
+                    zstream_.avail_in = static_cast<uInt>(chunk);
+                }
+
+                const auto step = static_cast<uInt>(
+                    std::min<size_t>(pending, std::numeric_limits<uInt>::max())
+                );
+                zstream_.next_out = next_out;
+                zstream_.avail_out = step;
+                const int status = inflate(&zstream_, Z_NO_FLUSH);
+                const size_t produced = step - zstream_.avail_out;
+                next_out += produced;
+                pending -= produced;
+
+                if (status == Z_STREAM_END && pending > 0) {
+                    return P10Error::InvalidArgument << "npz entry is shorter than its header";
+                }
+                if (status != Z_OK && status != Z_STREAM_END && status != Z_BUF_ERROR) {
+                    return P10Error::InvalidArgument << "Corrupted deflate data in npz entry";
+                }
+            }
+            return P10Error::Ok;
+        }
+
+        FILE* file_;
+        uint64_t remaining_;
+        bool deflated_;
+        bool inflating_ = false;
+        z_stream zstream_ {};
+        std::vector<Bytef> input_;
+    };
+
+}  // namespace
+
 P10Error save_npz(const std::string& filename, const TensorMap& tensors) {
     std::string mode = "w";
     for (const auto& [key_name, tensor] : tensors) {
@@ -38,46 +626,223 @@ P10Error save_npz(const std::string& filename, const TensorMap& tensors) {
 }
 
 P10Result<TensorMap> load_npz(const std::string& filename) {
-#ifdef _MSC_VER
-    #pragma warning(push)
-    #pragma warning(disable : 4267)
-#endif
-    try {
-        cnpy::npz_t npz = cnpy::npz_load(filename);
+    auto reader_res = NpzReader::open(filename);
+    if (reader_res.is_error()) {
+        return Err(reader_res);
+    }
+    auto reader = reader_res.unwrap();
 
-#ifdef _MSC_VER
-    #pragma warning(pop)
-#endif
+    TensorMap tensors;
+    while (true) {
+        auto has_next = reader.next();
+        if (has_next.is_error()) {
+            return Err(has_next);
+        }
+        if (!has_next.unwrap()) {
+            break;
+        }
 
-        TensorMap tensors;
-        for (auto& [key, array] : npz) {
-            Tensor tensor;
+        Tensor tensor;
+        P10_RETURN_ERR_IF_ERROR(reader.read(tensor));
+        tensors.try_emplace(reader.name(), std::move(tensor));
+    }
 
-            std::vector<int64_t> shape;
-            for (auto dim : array.shape) {
-                shape.push_back(static_cast<int64_t>(dim));
-            }
+    return Ok(std::move(tensors));
+}
 
-            auto p10_shape = make_shape(shape);
-            if (!p10_shape.is_ok()) {
-                return Err(p10_shape.unwrap_err());
-            }
+P10Result<Tensor> load_npy(const std::string& filename) {
+    auto mapped_res = map_file(filename);
+    if (mapped_res.is_error()) {
+        return Err(mapped_res);
+    }
+    auto mapped = mapped_res.unwrap();
+    // Owns the mapping until it is handed over to the tensor's blob.
+    std::unique_ptr<void, std::function<void(void*)>> mapping_guard(mapped.data, mapped.unmap);
 
-            if (array.word_size == 4) {
-                tensor =
-                    Tensor::from_data(array.data<float>(), p10_shape.unwrap()).clone().unwrap();
-            } else if (array.word_size == 1) {
-                tensor =
-                    Tensor::from_data(array.data<uint8_t>(), p10_shape.unwrap()).clone().unwrap();
-            } else {
-                return Err(P10Error::InvalidArgument, "Unsupported data type");
-            }
-            tensors.try_emplace(key, std::move(tensor));
+    size_t cursor = 0;
+    auto layout_res = read_npy_header([&](std::span<std::byte> out) -> P10Error {
+        if (cursor + out.size() > mapped.size) {
+            return P10Error::InvalidArgument << "Truncated npy header";
         }
+        std::copy_n(mapped.data + cursor, out.size(), out.begin());
+        cursor += out.size();
+        return P10Error::Ok;
+    });
+    if (layout_res.is_error()) {
+        return Err(layout_res);
+    }
+    const auto layout = layout_res.unwrap();
+    const auto options = tensor_options(layout);
+    const auto& header = layout.header;
 
-        return Ok(std::move(tensors));
-    } catch (const std::exception& e) {
-        return Err(P10Error::InvalidArgument, e.what());
+    const size_t data_size =
+        static_cast<size_t>(header.shape.count()) * header.dtype.size_bytes();
+    if (cursor + data_size > mapped.size) {
+        return Err(P10Error::InvalidArgument << "Truncated npy data in " + filename);
     }
+
+    if (layout.byte_swap) {
+        Tensor tensor;
+        P10_RETURN_ERR_IF_ERROR(tensor.create(header.shape, options));
+        std::copy_n(mapped.data + cursor, data_size, tensor.as_bytes().begin());
+        byte_swap(tensor.as_bytes(), header.dtype.size_bytes());
+        return Ok(std::move(tensor));
+    }
+
+    if (data_size == 0) {
+        return Tensor::empty(header.shape, options);
+    }
+
+    mapping_guard.release();
+    return Ok(Tensor::from_data(mapped.data + cursor, header.shape, options, mapped.unmap));
+}
+
+class NpzReader::Impl {
+  public:
+    Impl(FilePtr file, std::vector<ZipEntry> entries) :
+        file_(std::move(file)),
+        entries_(std::move(entries)) {}
+
+    size_t size() const {
+        return entries_.size();
+    }
+
+    P10Result<bool> next() {
+        stream_.reset();
+        if (next_index_ >= entries_.size()) {
+            current_.reset();
+            return Ok(false);
+        }
+        P10_RETURN_ERR_IF_ERROR(open_entry(next_index_));
+        next_index_++;
+        return Ok(true);
+    }
+
+    P10Error seek(std::string_view name) {
+        stream_.reset();
+        const auto found = std::find_if(entries_.begin(), entries_.end(), [&](const ZipEntry& e) {
+            return e.name == name;
+        });
+        if (found == entries_.end()) {
+            return P10Error::InvalidArgument
+                << "npz archive has no array named " + std::string(name);
+        }
+        const auto index = static_cast<size_t>(std::distance(entries_.begin(), found));
+        P10_RETURN_IF_ERROR(open_entry(index));
+        next_index_ = index + 1;
+        return P10Error::Ok;
+    }
+
+    const std::string& name() const {
+        static const std::string EMPTY;
+        return current_ ? entries_[*current_].name : EMPTY;
+    }
+
+    const NpyHeader& header() const {
+        return layout_.header;
+    }
+
+    P10Error read(Tensor& tensor) {
+        if (!stream_) {
+            return P10Error::InvalidOperation
+                << "NpzReader::read needs a current array (call next() or seek() first)";
+        }
+        auto stream = std::move(stream_);
+
+        P10_RETURN_IF_ERROR(tensor.create(layout_.header.shape, tensor_options(layout_)));
+        P10_RETURN_IF_ERROR(stream->read(tensor.as_bytes()));
+        if (layout_.byte_swap) {
+            byte_swap(tensor.as_bytes(), layout_.header.dtype.size_bytes());
+        }
+        return P10Error::Ok;
+    }
+
+  private:
+    P10Error open_entry(size_t index) {
+        current_.reset();
+        const ZipEntry& entry = entries_[index];
+        if (entry.method != ZIP_STORED && entry.method != ZIP_DEFLATED) {
+            return P10Error::NotImplemented << "Unsupported npz compression for " + entry.name;
+        }
+
+        // The local header may carry a different extra field than the central
+        // one, so its lengths decide where the data starts.
+        std::array<uint8_t, ZIP_LOCAL_HEADER_SIZE> local {};
+        if (seek_file(file_.get(), static_cast<int64_t>(entry.local_header_offset), SEEK_SET)
+            != 0) {
+            return P10Error::IoError << "Unable to seek to npz entry " + entry.name;
+        }
+        P10_RETURN_IF_ERROR(read_file(file_.get(), std::as_writable_bytes(std::span(local))));
+        if (load_u32(local.data()) != ZIP_LOCAL_HEADER_SIG) {
+            return P10Error::InvalidArgument << "Corrupted npz entry " + entry.name;
+        }
+        const int64_t skip = load_u16(&local[26]) + load_u16(&local[28]);
+        if (seek_file(file_.get(), skip, SEEK_CUR) != 0) {
+            return P10Error::IoError << "Unable to seek to npz entry data " + entry.name;
+        }
+
+        stream_ = std::make_unique<EntryStream>(file_.get(), entry.method, entry.compressed_size);
+        auto layout_res = read_npy_header([this](std::span<std::byte> out) {
+            return stream_->read(out);
+        });
+        if (layout_res.is_error()) {
+            stream_.reset();
+            return layout_res.error();
+        }
+        layout_ = layout_res.unwrap();
+        current_ = index;
+        return P10Error::Ok;
+    }
+
+    FilePtr file_;
+    std::vector<ZipEntry> entries_;
+    size_t next_index_ = 0;
+    std::optional<size_t> current_;
+    NpyLayout layout_;
+    std::unique_ptr<EntryStream> stream_;
+};
+
+P10Result<NpzReader> NpzReader::open(const std::string& filename) {
+    auto file = open_file(filename);
+    if (!file) {
+        return Err(P10Error::IoError << "Unable to open file " + filename);
+    }
+
+    auto entries = read_central_directory(file.get());
+    if (entries.is_error()) {
+        return Err(entries);
+    }
+    return Ok(NpzReader(std::make_unique<Impl>(std::move(file), entries.unwrap())));
+}
+
+NpzReader::NpzReader(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+NpzReader::NpzReader(NpzReader&&) noexcept = default;
+NpzReader& NpzReader::operator=(NpzReader&&) noexcept = default;
+NpzReader::~NpzReader() = default;
+
+size_t NpzReader::size() const {
+    return impl_->size();
+}
+
+P10Result<bool> NpzReader::next() {
+    return impl_->next();
 }
+
+P10Error NpzReader::seek(std::string_view name) {
+    return impl_->seek(name);
+}
+
+const std::string& NpzReader::name() const {
+    return impl_->name();
+}
+
+const NpyHeader& NpzReader::header() const {
+    return impl_->header();
+}
+
+P10Error NpzReader::read(Tensor& tensor) {
+    return impl_->read(tensor);
+}
+
 }  // namespace p10::io
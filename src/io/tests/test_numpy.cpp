@@ -1,5 +1,8 @@
+#include <array>
 #include <filesystem>
+#include <fstream>
 #include <map>
+#include <string>
 
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -11,6 +14,33 @@
 
 namespace p10::io {
 
+namespace {
+    // Writes a version 1.0 `.npy` file with the given header fields and raw data.
+    void write_npy(
+        const std::string& filename,
+        const std::string& descr,
+        bool fortran_order,
+        const std::string& shape,
+        const void* data,
+        size_t size_bytes
+    ) {
+        std::string dict = "{'descr': '" + descr
+            + "', 'fortran_order': " + (fortran_order ? "True" : "False") + ", 'shape': " + shape
+            + ", }";
+        const size_t preamble = 10;
+        dict.append((64 - ((preamble + dict.size() + 1) % 64)) % 64, ' ');
+        dict.push_back('\n');
+
+        std::ofstream out(filename, std::ios::binary);
+        out.write("\x93NUMPY\x01\x00", 8);
+        const auto header_len = static_cast<uint16_t>(dict.size());
+        out.put(static_cast<char>(header_len & 0xFF));
+        out.put(static_cast<char>(header_len >> 8));
+        out.write(dict.data(), static_cast<std::streamsize>(dict.size()));
+        out.write(static_cast<const char*>(data), static_cast<std::streamsize>(size_bytes));
+    }
+}  // namespace
+
 TEST_CASE("io::numpy::save_npz and load_npz with single tensor", "[io][numpy]") {
     const std::string filename = "test_single.npz";
 
@@ -177,4 +207,151 @@ TEST_CASE("io::numpy::save_npz creates valid file", "[io][numpy]") {
     std::filesystem::remove(filename);
 }
 
+TEST_CASE("io::numpy::load_npz keeps integer and 8-byte dtypes", "[io][numpy]") {
+    const std::string filename = "test_int_dtypes.npz";
+
+    TensorMap tensors_to_save;
+    tensors_to_save["int32"] =
+        Tensor::from_range(make_shape(2, 3), TensorOptions().dtype(Dtype::Int32), -3).unwrap();
+    tensors_to_save["int16"] =
+        Tensor::from_range(make_shape(4), TensorOptions().dtype(Dtype::Int16)).unwrap();
+    tensors_to_save["int64"] =
+        Tensor::full(make_shape(3), 1e12, TensorOptions().dtype(Dtype::Int64)).unwrap();
+    tensors_to_save["float64"] =
+        Tensor::full(make_shape(2, 2), 0.125, TensorOptions().dtype(Dtype::Float64)).unwrap();
+    REQUIRE_THAT(save_npz(filename, tensors_to_save), testing::is_ok());
+
+    auto loaded_result = load_npz(filename);
+    REQUIRE_THAT(loaded_result, testing::is_ok());
+    auto loaded = loaded_result.unwrap();
+
+    REQUIRE(loaded["int32"].dtype() == Dtype::Int32);
+    auto int32_data = loaded["int32"].as_span1d<int32_t>().unwrap();
+    for (size_t i = 0; i < int32_data.size(); i++) {
+        REQUIRE(int32_data[i] == static_cast<int32_t>(i) - 3);
+    }
+
+    REQUIRE(loaded["int16"].dtype() == Dtype::Int16);
+    REQUIRE(loaded["int16"].as_span1d<int16_t>().unwrap()[3] == 3);
+
+    REQUIRE(loaded["int64"].dtype() == Dtype::Int64);
+    REQUIRE(loaded["int64"].as_span1d<int64_t>().unwrap()[2] == 1000000000000);
+
+    REQUIRE(loaded["float64"].dtype() == Dtype::Float64);
+    REQUIRE(loaded["float64"].as_span1d<double>().unwrap()[0] == 0.125);
+
+    std::filesystem::remove(filename);
+}
+
+TEST_CASE("io::numpy::load_npy maps C and Fortran ordered arrays", "[io][numpy]") {
+    SECTION("C order") {
+        const std::string filename = "test_c_order.npy";
+        const std::array<float, 6> data = {0.f, 1.f, 2.f, 3.f, 4.f, 5.f};
+        write_npy(filename, "<f4", false, "(2, 3)", data.data(), sizeof(data));
+
+        auto result = load_npy(filename);
+        REQUIRE_THAT(result, testing::is_ok());
+        auto tensor = result.unwrap();
+        REQUIRE(tensor.dtype() == Dtype::Float32);
+        REQUIRE(tensor.shape() == make_shape(2, 3));
+        REQUIRE(tensor.is_contiguous());
+
+        auto values = tensor.as_span2d<float>().unwrap();
+        REQUIRE(values[1][2] == 5.f);
+
+        std::filesystem::remove(filename);
+    }
+
+    SECTION("Fortran order") {
+        const std::string filename = "test_fortran_order.npy";
+        // Column-major bytes of [[0, 1, 2], [10, 11, 12]].
+        const std::array<int32_t, 6> data = {0, 10, 1, 11, 2, 12};
+        write_npy(filename, "<i4", true, "(2, 3)", data.data(), sizeof(data));
+
+        auto result = load_npy(filename);
+        REQUIRE_THAT(result, testing::is_ok());
+        auto tensor = result.unwrap();
+        REQUIRE(tensor.dtype() == Dtype::Int32);
+        REQUIRE(tensor.shape() == make_shape(2, 3));
+        REQUIRE_FALSE(tensor.is_contiguous());
+
+        auto values = tensor.as_accessor2d<int32_t>().unwrap();
+        REQUIRE(values[0][2] == 2);
+        REQUIRE(values[1][0] == 10);
+        REQUIRE(values[1][2] == 12);
+
+        std::filesystem::remove(filename);
+    }
+
+    SECTION("big-endian descriptor is byte-swapped") {
+        const std::string filename = "test_big_endian.npy";
+        const std::array<uint8_t, 8> data = {0x00, 0x00, 0x01, 0x02, 0xFF, 0xFF, 0xFF, 0xFE};
+        write_npy(filename, ">i4", false, "(2,)", data.data(), sizeof(data));
+
+        auto result = load_npy(filename);
+        REQUIRE_THAT(result, testing::is_ok());
+        auto values = result.unwrap().as_span1d<int32_t>().unwrap();
+        REQUIRE(values[0] == 0x0102);
+        REQUIRE(values[1] == -2);
+
+        std::filesystem::remove(filename);
+    }
+}
+
+TEST_CASE("io::numpy::load_npy rejects unsupported files", "[io][numpy]") {
+    REQUIRE(load_npy("non_existent_file.npy").is_error());
+
+    const std::string filename = "test_unsupported.npy";
+    const std::array<uint64_t, 2> data = {1, 2};
+    write_npy(filename, "<u8", false, "(2,)", data.data(), sizeof(data));
+    auto result = load_npy(filename);
+    REQUIRE(result.is_error());
+    REQUIRE(result.error().code() == P10Error::NotImplemented);
+
+    std::filesystem::remove(filename);
+}
+
+TEST_CASE("io::numpy::NpzReader streams entries into a reused tensor", "[io][numpy]") {
+    const std::string filename = "test_reader.npz";
+
+    TensorMap tensors_to_save;
+    tensors_to_save["a"] =
+        Tensor::from_range(make_shape(4, 5), TensorOptions().dtype(Dtype::Float32)).unwrap();
+    tensors_to_save["b"] =
+        Tensor::from_range(make_shape(6), TensorOptions().dtype(Dtype::Uint16)).unwrap();
+    REQUIRE_THAT(save_npz(filename, tensors_to_save), testing::is_ok());
+
+    auto reader_result = NpzReader::open(filename);
+    REQUIRE_THAT(reader_result, testing::is_ok());
+    auto reader = reader_result.unwrap();
+    REQUIRE(reader.size() == 2);
+
+    Tensor tensor;
+    std::map<std::string, Shape> visited;
+    while (true) {
+        auto has_next = reader.next();
+        REQUIRE_THAT(has_next, testing::is_ok());
+        if (!has_next.unwrap()) {
+            break;
+        }
+        REQUIRE_FALSE(reader.header().fortran_order);
+        REQUIRE_THAT(reader.read(tensor), testing::is_ok());
+        REQUIRE(tensor.shape() == reader.header().shape);
+        REQUIRE(tensor.dtype() == reader.header().dtype);
+        // An array is consumed by its read.
+        REQUIRE(reader.read(tensor).is_error());
+        visited.emplace(reader.name(), tensor.shape());
+    }
+    REQUIRE(visited.size() == 2);
+    REQUIRE(visited.at("a") == make_shape(4, 5));
+    REQUIRE(visited.at("b") == make_shape(6));
+
+    REQUIRE_THAT(reader.seek("a"), testing::is_ok());
+    REQUIRE_THAT(reader.read(tensor), testing::is_ok());
+    REQUIRE(tensor.as_span1d<float>().unwrap()[19] == 19.f);
+    REQUIRE(reader.seek("missing").is_error());
+
+    std::filesystem::remove(filename);
+}
+
 }  // namespace p10::io
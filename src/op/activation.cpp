@@ -0,0 +1,272 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+#include <p10_internal/simd/parallel_for.hpp>
+#include <p10_internal/simd/vec.hpp>
+#include <p10_internal/simd/vec_math.hpp>
+#include <ptensor/op/activation.hpp>
+#include <ptensor/tensor.hpp>
+
+#include "elemwise.vec.hpp"
+
+namespace p10::op {
+
+namespace {
+    // Fewest elements a parallel softmax worker is handed; smaller tensors run
+    // on the calling thread.
+    constexpr int64_t SOFTMAX_MIN_WORKER_ELEMENTS = 32 * 1024;
+
+    // Columns a softmax over an inner axis keeps running maxima and sums for.
+    constexpr int64_t SOFTMAX_COLUMN_BLOCK = 256;
+
+    constexpr float NEG_INFINITY = -std::numeric_limits<float>::infinity();
+
+    using OneLane = simd::Vec<float, 1, simd::SimdSet::NONE>;
+
+    P10Error check_input(const Tensor& input, const char* name) {
+        if (input.dtype() != Dtype::Float32) {
+            return P10Error::InvalidArgument << (std::string(name) + " input must be FLOAT32.");
+        }
+        if (!input.is_contiguous()) {
+            return P10Error::InvalidArgument
+                << (std::string(name) + " input must be contiguous in memory.");
+        }
+        return P10Error::Ok;
+    }
+
+    template<typename Op>
+    P10Error map_elements(const Tensor& input, Tensor& output, const char* name, Op op) {
+        P10_RETURN_IF_ERROR(check_input(input, name));
+        P10_RETURN_IF_ERROR(output.create(input.shape(), Dtype::Float32));
+        unary_elemwise(
+            input.as_span1d<const float>().unwrap().data(),
+            output.as_span1d<float>().unwrap().data(),
+            static_cast<int64_t>(input.size()),
+            op
+        );
+        return P10Error::Ok;
+    }
+
+    // fn(std::type_identity<V> {}, x) over [0, count): native registers of S,
+    // then one-lane Vecs for the tail.
+    template<simd::SimdSet S, typename Fn>
+    void for_each_lanes(int64_t count, const Fn& fn) {
+        using V = simd::NativeVec<float, S>;
+        constexpr auto LANES = static_cast<int64_t>(V::LANES);
+        int64_t x = 0;
+        for (; x + LANES <= count; x += LANES) {
+            fn(std::type_identity<V> {}, x);
+        }
+        for (; x < count; ++x) {
+            fn(std::type_identity<OneLane> {}, x);
+        }
+    }
+
+    template<simd::VecType V>
+    float reduce_max(const V& value) {
+        alignas(64) float lanes[V::LANES];
+        value.store(lanes);
+        float result = lanes[0];
+        for (size_t i = 1; i < V::LANES; ++i) {
+            result = std::max(result, lanes[i]);
+        }
+        return result;
+    }
+
+    // Softmax of `count` contiguous values: the max, the sum of the shifted
+    // exponentials (stored for softmax), then the scale or log offset.
+    template<simd::SimdSet S, bool LOG>
+    void softmax_line(const float* in, float* out, int64_t count) {
+        using V = simd::NativeVec<float, S>;
+        V lane_max = V::broadcast(NEG_INFINITY);
+        V lane_sum = V::zero();
+        float max = NEG_INFINITY;
+        float sum = 0.0f;
+
+        for_each_lanes<S>(count, [&](auto type, int64_t x) {
+            using L = typename decltype(type)::type;
+            if constexpr (std::is_same_v<L, V>) {
+                lane_max = simd::max(lane_max, V::load(in + x));
+            } else {
+                max = std::max(max, in[x]);
+            }
+        });
+        max = std::max(max, reduce_max(lane_max));
+
+        for_each_lanes<S>(count, [&](auto type, int64_t x) {
+            using L = typename decltype(type)::type;
+            const L e = simd::exp(L::load(in + x) - L::broadcast(max));
+            if constexpr (!LOG) {
+                e.store(out + x);
+            }
+            if constexpr (std::is_same_v<L, V>) {
+                lane_sum = lane_sum + e;
+            } else {
+                sum += e.lanes[0];
+            }
+        });
+        sum += simd::reduce_add(lane_sum);
+
+        if constexpr (LOG) {
+            float log_sum = 0.0f;
+            simd::log(OneLane::broadcast(sum)).store(&log_sum);
+            for_each_lanes<S>(count, [&](auto type, int64_t x) {
+                using L = typename decltype(type)::type;
+                const L shifted = L::load(in + x) - L::broadcast(max);
+                (shifted - L::broadcast(log_sum)).store(out + x);
+            });
+        } else {
+            const float scale = 1.0f / sum;
+            for_each_lanes<S>(count, [&](auto type, int64_t x) {
+                using L = typename decltype(type)::type;
+                (L::load(out + x) * L::broadcast(scale)).store(out + x);
+            });
+        }
+    }
+
+    // Softmax down `width` (<= SOFTMAX_COLUMN_BLOCK) adjacent columns whose
+    // lines step by `stride`, vectorised across the columns.
+    template<simd::SimdSet S, bool LOG>
+    void softmax_columns(
+        const float* in,
+        float* out,
+        int64_t lines,
+        int64_t stride,
+        int64_t width
+    ) {
+        alignas(64) float max[SOFTMAX_COLUMN_BLOCK];
+        alignas(64) float sum[SOFTMAX_COLUMN_BLOCK];
+        std::copy_n(in, width, max);
+        std::fill_n(sum, width, 0.0f);
+
+        for (int64_t k = 1; k < lines; ++k) {
+            const float* row = in + (k * stride);
+            for_each_lanes<S>(width, [&](auto type, int64_t x) {
+                using L = typename decltype(type)::type;
+                simd::max(L::load(max + x), L::load(row + x)).store(max + x);
+            });
+        }
+        for (int64_t k = 0; k < lines; ++k) {
+            const float* row = in + (k * stride);
+            float* out_row = out + (k * stride);
+            for_each_lanes<S>(width, [&](auto type, int64_t x) {
+                using L = typename decltype(type)::type;
+                const L e = simd::exp(L::load(row + x) - L::load(max + x));
+                if constexpr (!LOG) {
+                    e.store(out_row + x);
+                }
+                (L::load(sum + x) + e).store(sum + x);
+            });
+        }
+
+        // sum becomes the log offset or the scale.
+        for_each_lanes<S>(width, [&](auto type, int64_t x) {
+            using L = typename decltype(type)::type;
+            const L total = L::load(sum + x);
+            if constexpr (LOG) {
+                simd::log(total).store(sum + x);
+            } else {
+                (L::broadcast(1.0f) / total).store(sum + x);
+            }
+        });
+        for (int64_t k = 0; k < lines; ++k) {
+            const float* row = in + (k * stride);
+            float* out_row = out + (k * stride);
+            for_each_lanes<S>(width, [&](auto type, int64_t x) {
+                using L = typename decltype(type)::type;
+                if constexpr (LOG) {
+                    const L shifted = L::load(row + x) - L::load(max + x);
+                    (shifted - L::load(sum + x)).store(out_row + x);
+                } else {
+                    (L::load(out_row + x) * L::load(sum + x)).store(out_row + x);
+                }
+            });
+        }
+    }
+
+    template<bool LOG>
+    P10Error softmax_impl(const Tensor& input, Tensor& output, int64_t axis, const char* name) {
+        P10_RETURN_IF_ERROR(check_input(input, name));
+        if (input.dims() == 0 || input.size() == 0) {
+            return P10Error::InvalidArgument << (std::string(name) + " input must not be empty.");
+        }
+        const auto dims = static_cast<int64_t>(input.dims());
+        if (axis < 0) {
+            axis += dims;
+        }
+        if (axis < 0 || axis >= dims) {
+            return P10Error::InvalidArgument << "Axis is out of range";
+        }
+
+        const auto shape = input.shape().as_span();
+        int64_t outer = 1;
+        for (int64_t i = 0; i < axis; ++i) {
+            outer *= shape[i];
+        }
+        const int64_t lines = shape[axis];
+        int64_t inner = 1;
+        for (int64_t i = axis + 1; i < dims; ++i) {
+            inner *= shape[i];
+        }
+
+        P10_RETURN_IF_ERROR(output.create(input.shape(), Dtype::Float32));
+        const float* in = input.as_span1d<const float>().unwrap().data();
+        float* out = output.as_span1d<float>().unwrap().data();
+
+        // Jobs are whole lines for the last axis and column blocks otherwise.
+        const int64_t blocks = (inner + SOFTMAX_COLUMN_BLOCK - 1) / SOFTMAX_COLUMN_BLOCK;
+        const int64_t units = inner == 1 ? outer : outer * blocks;
+        const int threads = simd::parallel_workers(
+            static_cast<int64_t>(input.size()),
+            SOFTMAX_MIN_WORKER_ELEMENTS
+        );
+        simd::parallel_for(threads, threads, [&](int64_t job) {
+            const int64_t begin = (job * units) / threads;
+            const int64_t end = ((job + 1) * units) / threads;
+            simd::call_in_best_tier([&](auto tier) {
+                constexpr auto S = decltype(tier)::value;
+                for (int64_t unit = begin; unit < end; ++unit) {
+                    if (inner == 1) {
+                        softmax_line<S, LOG>(in + (unit * lines), out + (unit * lines), lines);
+                        continue;
+                    }
+                    const int64_t column = (unit % blocks) * SOFTMAX_COLUMN_BLOCK;
+                    const int64_t offset = ((unit / blocks) * lines * inner) + column;
+                    softmax_columns<S, LOG>(
+                        in + offset,
+                        out + offset,
+                        lines,
+                        inner,
+                        std::min(SOFTMAX_COLUMN_BLOCK, inner - column)
+                    );
+                }
+            });
+        });
+        return P10Error::Ok;
+    }
+}  // namespace
+
+P10Error exp(const Tensor& input, Tensor& output) {
+    return map_elements(input, output, "exp", [](const auto& x) { return simd::exp(x); });
+}
+
+P10Error log(const Tensor& input, Tensor& output) {
+    return map_elements(input, output, "log", [](const auto& x) { return simd::log(x); });
+}
+
+P10Error sigmoid(const Tensor& input, Tensor& output) {
+    return map_elements(input, output, "sigmoid", [](const auto& x) { return simd::sigmoid(x); });
+}
+
+P10Error softmax(const Tensor& input, Tensor& output, int64_t axis) {
+    return softmax_impl<false>(input, output, axis, "softmax");
+}
+
+P10Error log_softmax(const Tensor& input, Tensor& output, int64_t axis) {
+    return softmax_impl<true>(input, output, axis, "log_softmax");
+}
+
+}  // namespace p10::op
@@ -0,0 +1,105 @@
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <CLI/CLI.hpp>
+#include <ptensor/initialize.hpp>
+#include <ptensor/tensor.hpp>
+
+namespace {
+
+struct TuneCli {
+    std::string cache = "ptensor-tuning.txt";
+    std::vector<int64_t> sizes {256, 512, 1024, 2048, 4096};
+    std::string simd_max = "native";
+};
+
+TuneCli parse_args(int argc, char** argv);
+
+// First calls of every tuned kernel, at each size: with autotuning on, each
+// one times the candidate tilings and records the winner in the cache.
+p10::P10Error tune_transpose(int64_t size, p10::Dtype dtype) {
+    std::mt19937_64 rng(size);
+    auto input =
+        p10::Tensor::from_random(p10::make_shape(size, size), rng, p10::TensorOptions(dtype));
+    if (input.is_error()) {
+        return input.error();
+    }
+    p10::Tensor output;
+    return input.unwrap().transpose(output);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const TuneCli cli = parse_args(argc, argv);
+
+    auto err = p10::initialize(
+        p10::InitializeOptions().simd_max(cli.simd_max).tuning_cache(cli.cache).autotune(true)
+    );
+
+    for (const int64_t size : cli.sizes) {
+        if (err.is_error()) {
+            break;
+        }
+        std::cout << "Tuning " << size << "x" << size << '\n';
+        for (const auto dtype : {p10::Dtype::Float32, p10::Dtype::Uint8, p10::Dtype::Float64}) {
+            err = tune_transpose(size, dtype);
+            if (err.is_error()) {
+                break;
+            }
+        }
+    }
+    if (err.is_ok()) {
+        err = p10::save_tuning_cache(cli.cache);
+    }
+
+    if (err.is_error()) {
+        std::cerr << err.to_string() << '\n';
+        return 1;
+    }
+    std::cout << "Saved tile tuning to " << cli.cache << '\n';
+    return 0;
+}
+
+namespace {
+
+TuneCli parse_args(int argc, char** argv) {
+    CLI::App app {
+        "Pre-tune tile sizes for this host\n\n"
+        "Runs the tiled kernels (transpose) over a range of shapes "
+        "with autotuning on and writes the fastest tilings to a cache file. Load it "
+        "with p10::initialize (InitializeOptions::tuning_cache) or the "
+        "PTENSOR_TUNING_CACHE environment variable."
+    };
+    argv = app.ensure_utf8(argv);
+
+    TuneCli cli;
+
+    app.add_option("-o,--output", cli.cache, "Tuning cache file (existing entries are kept)")
+        ->capture_default_str();
+    app.add_option("-s,--sizes", cli.sizes, "Square image sizes to tune")->capture_default_str();
+    app.add_option(
+           "--simd-max",
+           cli.simd_max,
+           "Cap the SIMD tier (portable, sse41, avx2, neon, native)"
+    )
+        ->capture_default_str();
+
+    app.footer(
+        "Examples:\n"
+        "  ptensor_tune\n"
+        "  ptensor_tune -o ~/.cache/ptensor-tuning.txt --sizes 640 1280 1920"
+    );
+
+    try {
+        app.parse(argc, argv);
+    } catch (const CLI::ParseError& e) {
+        std::exit(app.exit(e));
+    }
+    return cli;
+}
+
+}  // namespace
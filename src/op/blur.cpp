@@ -1,6 +1,5 @@
 #include "blur.hpp"
 
-#include <array>
 #include <cmath>
 #include <numbers>
 
@@ -10,11 +9,9 @@
 
 #include <type_traits>
 
-#include "blur.hblur.avx2.hpp"
-#include "blur.hblur.hpp"
-#include "blur.hblur.neon.hpp"
-#include "p10_internal/simd/tile2d.hpp"
-#include "ptensor/region2d.hpp"
+#include "blur.lines.hpp"
+#include "blur.lines.vec.hpp"
+#include "p10_internal/simd/cpuid.hpp"
 
 namespace p10::op {
 
@@ -24,66 +21,66 @@ concept Scalar = std::is_arithmetic_v<T>;
 namespace {
     void create_gaussian_kernel(std::span<float> kernel, float sigma);
 
-    // Input shape with its last two (plane) dims swapped: the layout a single
-    // transposing hblur_pass produces.
-    Shape plane_transposed(const Shape& shape) {
-        const size_t dims = shape.dims();
-        std::array<size_t, P10_MAX_SHAPE> perm {};
-        for (size_t i = 0; i < dims; ++i) {
-            perm[i] = i;
-        }
-        std::swap(perm[dims - 1], perm[dims - 2]);
-        return shape.permute(std::span<const size_t>(perm.data(), dims)).unwrap();
-    }
-
-    // Interior pass for a fixed half-width KHALF: the tap loop unrolls because
-    // KHALF is a compile-time constant. tile2d runs the first kernel the target
-    // supports on the halo-inset interior and hands the clamped frame to
-    // scalar_kernel. The AVX2/NEON specs are tagged float, so tile2d drops them
-    // for other dtypes, which fall through to the portable interior.
-    template<Scalar scalar_t, size_t KHALF>
-    void hblur_pass_impl(
+    // Fused blur with the fastest line kernels the CPU supports: the float
+    // Vec kernels for float, the fixed-point ones (Vec or portable) for uint8
+    // and uint16, and the float-accumulating portable ones for every other
+    // dtype.
+    template<Scalar scalar_t, int64_t KHALF>
+    void blur_planes(
         Span3D<const scalar_t> src,
         Span3D<scalar_t> dst,
-        std::span<const float> kernel,
-        auto scalar_kernel
+        std::span<const float> kernel
     ) {
-        const simd::TileBorder border {.horizontal = KHALF, .vertical = 0};
-
-        simd::tile2d<scalar_t, simd::TileExecution::PARALLEL>(
-            src.rows(),
-            src.cols(),
-            border,
-            scalar_kernel,
-            make_avx2_hblur<scalar_t, KHALF>(src, dst, kernel.data()),
-            make_neon_hblur<scalar_t, KHALF>(src, dst, kernel.data()),
-            make_portable_hblur<scalar_t, KHALF>(src, dst, kernel.data())
-        );
+        using simd::SimdSet;
+        if constexpr (std::is_same_v<scalar_t, float>) {
+            if (simd::is_supported(SimdSet::AVX2)) {
+                fused_blur<VecBlurLines<SimdSet::AVX2, KHALF>>(src, dst, kernel);
+                return;
+            }
+            if (simd::is_supported(SimdSet::SSE41)) {
+                fused_blur<VecBlurLines<SimdSet::SSE41, KHALF>>(src, dst, kernel);
+                return;
+            }
+            if (simd::is_supported(SimdSet::AdvSIMD)) {
+                fused_blur<VecBlurLines<SimdSet::AdvSIMD, KHALF>>(src, dst, kernel);
+                return;
+            }
+        } else if constexpr (FixedPointPixel<scalar_t>) {
+            if (simd::is_supported(SimdSet::AVX2)) {
+                fused_blur<VecFixedBlurLines<SimdSet::AVX2, scalar_t, KHALF>>(src, dst, kernel);
+                return;
+            }
+            if (simd::is_supported(SimdSet::SSE41)) {
+                fused_blur<VecFixedBlurLines<SimdSet::SSE41, scalar_t, KHALF>>(src, dst, kernel);
+                return;
+            }
+            if (simd::is_supported(SimdSet::AdvSIMD)) {
+                fused_blur<VecFixedBlurLines<SimdSet::AdvSIMD, scalar_t, KHALF>>(src, dst, kernel);
+                return;
+            }
+            fused_blur<FixedBlurLines<scalar_t, KHALF>>(src, dst, kernel);
+            return;
+        }
+        fused_blur<PortableBlurLines<scalar_t, KHALF>>(src, dst, kernel);
     }
 
-    // One horizontal blur pass over every channel plane, runtime kernel size.
-    // tile2d carries the +/-half apron as a runtime border: the interior runs
-    // the unrolled kernel without edge checks while the scalar sweep clamps the
-    // frame. Half-widths past the unrolled cases fall back to a scalar-only
-    // tiling.
+    // Runtime kernel size to line kernels: half-widths 1 to 3 get a
+    // compile-time KHALF so the tap loops unroll; larger kernels, up to
+    // MAX_KERNEL_SIZE, run the same kernels over the runtime half (KHALF 0).
     template<Scalar scalar_t>
-    void
-    hblur_pass(Span3D<const scalar_t> src, Span3D<scalar_t> dst, std::span<const float> kernel) {
-        const int half = static_cast<int>(kernel.size()) / 2;
-        const auto scalar_edge = make_scalar_hblur<scalar_t>(src, dst, kernel.data(), half);
-
-        switch (half) {
+    void blur(Span3D<const scalar_t> src, Span3D<scalar_t> dst, std::span<const float> kernel) {
+        switch (kernel.size() / 2) {
             case 1:
-                hblur_pass_impl<scalar_t, 1>(src, dst, kernel, scalar_edge);
+                blur_planes<scalar_t, 1>(src, dst, kernel);
                 break;
             case 2:
-                hblur_pass_impl<scalar_t, 2>(src, dst, kernel, scalar_edge);
+                blur_planes<scalar_t, 2>(src, dst, kernel);
                 break;
             case 3:
-                hblur_pass_impl<scalar_t, 3>(src, dst, kernel, scalar_edge);
+                blur_planes<scalar_t, 3>(src, dst, kernel);
                 break;
             default:
-                simd::tile2d<scalar_t>(src.rows(), src.cols(), simd::TileBorder {}, scalar_edge);
+                blur_planes<scalar_t, 0>(src, dst, kernel);
         }
     }
 }  // namespace
@@ -108,10 +105,12 @@ P10Error GaussianBlur::transform(const Tensor& input, Tensor& output) {
         return P10Error::InvalidArgument << "Input tensor must have at least 2 dimensions.";
     }
 
-    // Each hblur_pass writes its result transposed, so the intermediate holds a
-    // plane-transposed image; the second pass transposes it back to the input
-    // layout. Size scratch with the plane dims swapped accordingly.
-    P10_RETURN_IF_ERROR(scratch_.create(plane_transposed(input.shape()), dtype));
+    const Tensor* source = &input;
+    if (input.as_bytes().data() == output.as_bytes().data()) {
+        P10_RETURN_IF_ERROR(scratch_.create(input.shape(), dtype));
+        P10_RETURN_IF_ERROR(scratch_.copy_from(input));
+        source = &scratch_;
+    }
     P10_RETURN_IF_ERROR(output.create(input.shape(), dtype));
 
     return dtype.match([&](auto type_tag) -> P10Error {
@@ -120,12 +119,10 @@ P10Error GaussianBlur::transform(const Tensor& input, Tensor& output) {
         if constexpr (std::is_arithmetic_v<scalar_t>) {
             const auto kernel = kernel_.get();
 
-            const auto in = input.as_span3d<const scalar_t, RankFit::Flexible>().unwrap();
-            auto scratch = scratch_.as_span3d<scalar_t, RankFit::Flexible>().unwrap();
+            const auto in = source->as_span3d<const scalar_t, RankFit::Flexible>().unwrap();
             auto out = output.as_span3d<scalar_t, RankFit::Flexible>().unwrap();
 
-            hblur_pass<scalar_t>(in, scratch, kernel);
-            hblur_pass<scalar_t>(scratch.as_const(), out, kernel);
+            blur<scalar_t>(in, out, kernel);
             return P10Error::Ok;
         } else {
             return P10Error::InvalidArgument << "Unsupported data type for this operation.";
@@ -0,0 +1,445 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include <p10_internal/simd/parallel_for.hpp>
+#include <p10_internal/simd/vec.hpp>
+#include <ptensor/span2d.hpp>
+#include <ptensor/span3d.hpp>
+
+#include <type_traits>
+
+namespace p10::op {
+
+// Most taps a blur kernel has (GaussianBlur::MAX_KERNEL_SIZE).
+inline constexpr int64_t BLUR_MAX_TAPS = 25;
+
+// Fewest pixels a parallel blur worker is handed; smaller images run on the
+// calling thread.
+inline constexpr int64_t BLUR_MIN_WORKER_PIXELS = 32 * 1024;
+
+// Kernel weights in the form a set of line kernels takes them: the float taps
+// themselves, or their fixed-point quantization.
+template<typename weight_t>
+using BlurWeights = std::array<weight_t, BLUR_MAX_TAPS>;
+
+inline BlurWeights<float> float_blur_weights(std::span<const float> kernel) {
+    BlurWeights<float> weights {};
+    std::copy(kernel.begin(), kernel.end(), weights.begin());
+    return weights;
+}
+
+// Weighted-sum accumulator for the convolution tap loop. Accumulates in a type
+// wide enough for scalar_t (float for small ints, double for >=32-bit ints, the
+// float type itself for floats), then on store rounds + saturates back to
+// scalar_t for integers and passes floats through unchanged (so the float fast
+// path stays bit-identical).
+template<typename scalar_t>
+struct Accumulator {
+    using accum_t = std::conditional_t<
+        std::is_floating_point_v<scalar_t>,
+        scalar_t,
+        std::conditional_t<(sizeof(scalar_t) >= 4), double, float>>;
+
+    accum_t sum = 0;
+
+    void add(scalar_t value, float weight) {
+        sum += static_cast<accum_t>(value) * static_cast<accum_t>(weight);
+    }
+
+    scalar_t store() const {
+        if constexpr (std::is_floating_point_v<scalar_t>) {
+            return static_cast<scalar_t>(sum);
+        } else {
+            using limits = std::numeric_limits<scalar_t>;
+            return static_cast<scalar_t>(std::clamp(
+                std::round(sum),
+                static_cast<accum_t>(limits::min()),
+                static_cast<accum_t>(limits::max())
+            ));
+        }
+    }
+};
+
+// Kernel half-width of a line kernel: KHALF when it is a compile-time constant
+// (the tap loops unroll), the runtime `half` when KHALF is 0.
+template<int64_t KHALF>
+constexpr int64_t blur_half(int64_t half) {
+    return KHALF > 0 ? KHALF : half;
+}
+
+// Horizontal tap over columns [col, cols) of one padded source row:
+// out[c] = sum_k padded[c + k] * kernel[k]. `padded` holds the row with `half`
+// replicated edge samples on either side, so every tap is in bounds and the
+// edges need no clamp.
+template<typename scalar_t, int64_t KHALF>
+inline void hblur_line(
+    const scalar_t* padded,
+    scalar_t* out,
+    int64_t col,
+    int64_t cols,
+    const float* kernel,
+    int64_t half
+) {
+    const int64_t taps = (2 * blur_half<KHALF>(half)) + 1;
+    for (; col < cols; ++col) {
+        Accumulator<scalar_t> acc;
+        for (int64_t k = 0; k < taps; ++k) {
+            acc.add(padded[col + k], kernel[k]);
+        }
+        out[col] = acc.store();
+    }
+}
+
+// Vertical tap over columns [col, cols): out[c] = sum_k lines[k][c] * kernel[k],
+// where `lines` are the 2*half+1 horizontally filtered rows around the output
+// row, top to bottom.
+template<typename scalar_t, int64_t KHALF>
+inline void vblur_line(
+    const scalar_t* const* lines,
+    scalar_t* out,
+    int64_t col,
+    int64_t cols,
+    const float* kernel,
+    int64_t half
+) {
+    const int64_t taps = (2 * blur_half<KHALF>(half)) + 1;
+    for (; col < cols; ++col) {
+        Accumulator<scalar_t> acc;
+        for (int64_t k = 0; k < taps; ++k) {
+            acc.add(lines[k][col], kernel[k]);
+        }
+        out[col] = acc.store();
+    }
+}
+
+// Line kernels for every dtype and target: the scalar tap loops above.
+template<typename scalar_t, int64_t KHALF>
+struct PortableBlurLines {
+    static constexpr simd::SimdSet INSTRUCTIONS = simd::SimdSet::NONE;
+    using weight_t = float;
+
+    static BlurWeights<float> weights(std::span<const float> kernel) {
+        return float_blur_weights(kernel);
+    }
+
+    static void horizontal(
+        const scalar_t* padded,
+        scalar_t* out,
+        int64_t cols,
+        const float* kernel,
+        int64_t half
+    ) {
+        hblur_line<scalar_t, KHALF>(padded, out, 0, cols, kernel, half);
+    }
+
+    static void vertical(
+        const scalar_t* const* lines,
+        scalar_t* out,
+        int64_t cols,
+        const float* kernel,
+        int64_t half
+    ) {
+        vblur_line<scalar_t, KHALF>(lines, out, 0, cols, kernel, half);
+    }
+};
+
+// Quantizes a symmetric `kernel` to integer weights that sum to exactly `one`,
+// so a constant image stays constant. The rounding error of the outer taps
+// goes to the center tap, the largest, which is capped at `max_weight`.
+template<typename weight_t>
+BlurWeights<weight_t>
+quantize_blur_weights(std::span<const float> kernel, int64_t one, int64_t max_weight) {
+    BlurWeights<weight_t> weights {};
+    const size_t center = kernel.size() / 2;
+    int64_t sum = 0;
+    for (size_t k = 0; k < kernel.size(); ++k) {
+        if (k != center) {
+            const int64_t weight = std::llround(static_cast<double>(kernel[k]) * one);
+            weights[k] = static_cast<weight_t>(weight);
+            sum += weight;
+        }
+    }
+    weights[center] = static_cast<weight_t>(std::clamp<int64_t>(one - sum, 0, max_weight));
+    return weights;
+}
+
+// Fixed-point arithmetic of the integer blur, one specialization per pixel
+// type: the lane type products accumulate in, the weight quantization, and
+// tap/narrow in a scalar and a Vec spelling that give identical bits. A tap
+// takes the sum of the one or two pixels sharing a weight (the kernel is
+// symmetric, so x[c - k] and x[c + k] are added before the multiply).
+template<typename pixel_t>
+struct FixedPoint;
+
+// uint8 in 16-bit lanes. Pixels enter the products as Q7 (a folded pair,
+// at most 510, still fits: 510 << 7 < 2^16), weights are Q16, and mul_high
+// keeps the top half of each product, so every partial sum is a Q7 pixel
+// value no larger than 255 << 7.
+template<>
+struct FixedPoint<uint8_t> {
+    using lane_t = uint16_t;
+    using weight_t = uint16_t;
+    static constexpr int PIXEL_BITS = 7;
+
+    static BlurWeights<weight_t> weights(std::span<const float> kernel) {
+        return quantize_blur_weights<weight_t>(kernel, 1 << 16, 0xFFFF);
+    }
+
+    static lane_t tap(lane_t pixels, weight_t weight) {
+        const auto scaled = static_cast<uint32_t>(static_cast<lane_t>(pixels << PIXEL_BITS));
+        return static_cast<lane_t>((scaled * weight) >> 16);
+    }
+
+    static uint8_t narrow(lane_t sum) {
+        const int rounded = (sum + (1 << (PIXEL_BITS - 1))) >> PIXEL_BITS;
+        return static_cast<uint8_t>(std::min(rounded, 255));
+    }
+
+    template<simd::VecType V>
+    static V load(const uint8_t* src) {
+        return V::load_u8(src);
+    }
+
+    template<simd::VecType V>
+    static V tap(const V& pixels, const V& weight) {
+        return simd::mul_high(pixels.template shift_left<PIXEL_BITS>(), weight);
+    }
+
+    template<simd::VecType V>
+    static void narrow(const V& sum, uint8_t* dst) {
+        const V rounded = sum + V::broadcast(1 << (PIXEL_BITS - 1));
+        rounded.template shift_right<PIXEL_BITS>().store_u8(dst);
+    }
+};
+
+// uint16 in 32-bit lanes with Q15 weights. The weights sum to exactly 1 << 15,
+// so each outer weight is at most 1 << 14 and every product and partial sum
+// of 16-bit pixels stays below 2^31.
+template<>
+struct FixedPoint<uint16_t> {
+    using lane_t = int32_t;
+    using weight_t = int32_t;
+    static constexpr int WEIGHT_BITS = 15;
+
+    static BlurWeights<weight_t> weights(std::span<const float> kernel) {
+        return quantize_blur_weights<weight_t>(kernel, 1 << WEIGHT_BITS, 1 << WEIGHT_BITS);
+    }
+
+    static lane_t tap(lane_t pixels, weight_t weight) {
+        return pixels * weight;
+    }
+
+    static uint16_t narrow(lane_t sum) {
+        const lane_t rounded = (sum + (1 << (WEIGHT_BITS - 1))) >> WEIGHT_BITS;
+        return static_cast<uint16_t>(std::min(rounded, 65535));
+    }
+
+    template<simd::VecType V>
+    static V load(const uint16_t* src) {
+        return V::load_u16(src);
+    }
+
+    template<simd::VecType V>
+    static V tap(const V& pixels, const V& weight) {
+        return pixels * weight;
+    }
+
+    template<simd::VecType V>
+    static void narrow(const V& sum, uint16_t* dst) {
+        const V rounded = sum + V::broadcast(1 << (WEIGHT_BITS - 1));
+        rounded.template shift_right<WEIGHT_BITS>().store_u16(dst);
+    }
+};
+
+template<typename pixel_t>
+concept FixedPointPixel = std::is_same_v<pixel_t, uint8_t> || std::is_same_v<pixel_t, uint16_t>;
+
+// Fixed-point horizontal tap over columns [col, cols) of a padded row, the
+// scalar spelling of FixedPoint (see hblur_line for the layout).
+template<FixedPointPixel pixel_t, int64_t KHALF>
+inline void fixed_hblur_line(
+    const pixel_t* padded,
+    pixel_t* out,
+    int64_t col,
+    int64_t cols,
+    const typename FixedPoint<pixel_t>::weight_t* weights,
+    int64_t half
+) {
+    using FP = FixedPoint<pixel_t>;
+    using lane_t = typename FP::lane_t;
+    const int64_t radius = blur_half<KHALF>(half);
+    for (; col < cols; ++col) {
+        const pixel_t* center = padded + col + radius;
+        lane_t sum = FP::tap(center[0], weights[radius]);
+        for (int64_t k = 1; k <= radius; ++k) {
+            const auto pair = static_cast<lane_t>(center[-k] + center[k]);
+            sum = static_cast<lane_t>(sum + FP::tap(pair, weights[radius - k]));
+        }
+        out[col] = FP::narrow(sum);
+    }
+}
+
+// Fixed-point vertical tap over columns [col, cols) (see vblur_line).
+template<FixedPointPixel pixel_t, int64_t KHALF>
+inline void fixed_vblur_line(
+    const pixel_t* const* lines,
+    pixel_t* out,
+    int64_t col,
+    int64_t cols,
+    const typename FixedPoint<pixel_t>::weight_t* weights,
+    int64_t half
+) {
+    using FP = FixedPoint<pixel_t>;
+    using lane_t = typename FP::lane_t;
+    const int64_t radius = blur_half<KHALF>(half);
+    const pixel_t* const* center = lines + radius;
+    for (; col < cols; ++col) {
+        lane_t sum = FP::tap(center[0][col], weights[radius]);
+        for (int64_t k = 1; k <= radius; ++k) {
+            const auto pair = static_cast<lane_t>(center[-k][col] + center[k][col]);
+            sum = static_cast<lane_t>(sum + FP::tap(pair, weights[radius - k]));
+        }
+        out[col] = FP::narrow(sum);
+    }
+}
+
+// Fixed-point line kernels for uint8 and uint16 on every target. Both passes
+// round to the pixel type, like the float-accumulated integer blur.
+template<FixedPointPixel pixel_t, int64_t KHALF>
+struct FixedBlurLines {
+    static constexpr simd::SimdSet INSTRUCTIONS = simd::SimdSet::NONE;
+    using weight_t = typename FixedPoint<pixel_t>::weight_t;
+
+    static BlurWeights<weight_t> weights(std::span<const float> kernel) {
+        return FixedPoint<pixel_t>::weights(kernel);
+    }
+
+    static void horizontal(
+        const pixel_t* padded,
+        pixel_t* out,
+        int64_t cols,
+        const weight_t* weights,
+        int64_t half
+    ) {
+        fixed_hblur_line<pixel_t, KHALF>(padded, out, 0, cols, weights, half);
+    }
+
+    static void vertical(
+        const pixel_t* const* lines,
+        pixel_t* out,
+        int64_t cols,
+        const weight_t* weights,
+        int64_t half
+    ) {
+        fixed_vblur_line<pixel_t, KHALF>(lines, out, 0, cols, weights, half);
+    }
+};
+
+// Per-worker line storage of blur_band: one padded source row and a ring of
+// 2*half+1 horizontally filtered rows. A few image rows in all, so they stay in
+// L1/L2 while a band streams through.
+template<typename scalar_t>
+struct BlurLineBuffer {
+    std::vector<scalar_t> padded;
+    std::vector<scalar_t> ring;
+
+    BlurLineBuffer(int64_t cols, int64_t half) :
+        padded(static_cast<size_t>(cols + (2 * half))),
+        ring(static_cast<size_t>(((2 * half) + 1) * cols)) {}
+};
+
+// Separable blur of output rows [row_begin, row_end) of one plane. Each source
+// row is filtered horizontally once, into ring slot `row % taps`, as soon as
+// the band first needs it; each output row is then the vertical tap over the
+// ring. The rows of any window are consecutive, so their slots never collide,
+// and the row a new one evicts is above the window. Rows past the plane edges
+// clamp to the first/last row, the same replicated border as the columns.
+template<typename Lines, typename scalar_t>
+void blur_band(
+    Span2D<const scalar_t> src,
+    Span2D<scalar_t> dst,
+    int64_t row_begin,
+    int64_t row_end,
+    const typename Lines::weight_t* weights,
+    int64_t half,
+    BlurLineBuffer<scalar_t>& buffer
+) {
+    const int64_t rows = src.rows();
+    const int64_t cols = src.cols();
+    const int64_t taps = (2 * half) + 1;
+    scalar_t* padded = buffer.padded.data();
+    const auto line = [&](int64_t row) {
+        return buffer.ring.data() + ((row % taps) * cols);
+    };
+
+    std::array<const scalar_t*, BLUR_MAX_TAPS> window {};
+    int64_t next_row = std::max<int64_t>(row_begin - half, 0);
+    for (int64_t row = row_begin; row < row_end; ++row) {
+        for (const int64_t last = std::min(row + half, rows - 1); next_row <= last; ++next_row) {
+            const auto in = src[next_row];
+            std::fill_n(padded, half, in.front());
+            std::copy(in.begin(), in.end(), padded + half);
+            std::fill_n(padded + half + cols, half, in.back());
+            Lines::horizontal(padded, line(next_row), cols, weights, half);
+        }
+        for (int64_t k = -half; k <= half; ++k) {
+            window[k + half] = line(std::clamp<int64_t>(row + k, 0, rows - 1));
+        }
+        Lines::vertical(window.data(), dst[row].data(), cols, weights, half);
+    }
+}
+
+// Fused separable blur of every plane of `src` into `dst` with the line
+// kernels of `Lines`. Planes are split into horizontal bands, and the
+// (plane, band) jobs run on the pinned parallel workers, one line buffer each.
+// Every output row is written once and every input row read about once (band
+// seams refilter 2*half rows), with no intermediate image.
+template<typename Lines, typename scalar_t>
+void fused_blur(Span3D<const scalar_t> src, Span3D<scalar_t> dst, std::span<const float> kernel) {
+    const int64_t half = static_cast<int64_t>(kernel.size()) / 2;
+    const int64_t taps = (2 * half) + 1;
+    const int64_t channels = src.channels();
+    const int64_t rows = src.rows();
+    const int64_t cols = src.cols();
+    if (channels == 0 || rows == 0 || cols == 0) {
+        return;
+    }
+
+    const int threads = simd::parallel_workers(channels * rows * cols, BLUR_MIN_WORKER_PIXELS);
+    // Enough bands for every worker to get a job, but at least a few windows
+    // tall so the refiltered seam rows stay a small share of each band.
+    const int64_t bands = std::clamp<int64_t>(
+        (threads + channels - 1) / channels,
+        1,
+        std::max<int64_t>(rows / (4 * taps), 1)
+    );
+    const int64_t band_rows = (rows + bands - 1) / bands;
+    const auto weights = Lines::weights(kernel);
+
+    simd::parallel_for(channels * bands, threads, [&](int64_t job) {
+        const int64_t channel = job / bands;
+        const int64_t row_begin = (job % bands) * band_rows;
+        const int64_t row_end = std::min(row_begin + band_rows, rows);
+        BlurLineBuffer<scalar_t> buffer(cols, half);
+        simd::call_in_tier<Lines::INSTRUCTIONS>([&]() {
+            blur_band<Lines>(
+                src[channel],
+                dst[channel],
+                row_begin,
+                row_end,
+                weights.data(),
+                half,
+                buffer
+            );
+        });
+    });
+}
+
+}  // namespace p10::op
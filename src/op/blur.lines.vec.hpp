@@ -0,0 +1,134 @@
+#pragma once
+
+#include <p10_internal/simd/vec.hpp>
+
+#include "blur.lines.hpp"
+
+namespace p10::op {
+
+// Float line kernels for tier S, one native register of S per step. Both the
+// padded source row and the ring rows are unit-stride, so every tap is a plain
+// unaligned load and every output a full-register store. KHALF 0 runs the
+// runtime `half`, so one instantiation covers every kernel size.
+//
+// Gaussian kernels are symmetric (kernel[half - k] == kernel[half + k]), so the
+// two taps sharing a weight are added first and multiplied once: half + 1
+// multiplies per output instead of 2 * half + 1. That changes the rounding
+// order against PortableBlurLines by a few ulp. The columns past the last
+// whole register go through the portable loops.
+template<simd::SimdSet S, int64_t KHALF>
+struct VecBlurLines {
+    static constexpr simd::SimdSet INSTRUCTIONS = S;
+    using weight_t = float;
+    using V = simd::NativeVec<float, S>;
+    static constexpr auto LANES = static_cast<int64_t>(V::LANES);
+
+    static BlurWeights<float> weights(std::span<const float> kernel) {
+        return float_blur_weights(kernel);
+    }
+
+    static void horizontal(
+        const float* padded,
+        float* out,
+        int64_t cols,
+        const float* kernel,
+        int64_t half
+    ) {
+        const int64_t radius = blur_half<KHALF>(half);
+        int64_t col = 0;
+        for (; col + LANES <= cols; col += LANES) {
+            const float* center = padded + col + radius;
+            V acc = V::load(center) * V::broadcast(kernel[radius]);
+            for (int64_t k = 1; k <= radius; ++k) {
+                const V pair = V::load(center - k) + V::load(center + k);
+                acc = simd::fma(pair, V::broadcast(kernel[radius - k]), acc);
+            }
+            acc.store(out + col);
+        }
+        hblur_line<float, KHALF>(padded, out, col, cols, kernel, half);
+    }
+
+    static void vertical(
+        const float* const* lines,
+        float* out,
+        int64_t cols,
+        const float* kernel,
+        int64_t half
+    ) {
+        const int64_t radius = blur_half<KHALF>(half);
+        const float* const* center = lines + radius;
+        int64_t col = 0;
+        for (; col + LANES <= cols; col += LANES) {
+            V acc = V::load(center[0] + col) * V::broadcast(kernel[radius]);
+            for (int64_t k = 1; k <= radius; ++k) {
+                const V pair = V::load(center[-k] + col) + V::load(center[k] + col);
+                acc = simd::fma(pair, V::broadcast(kernel[radius - k]), acc);
+            }
+            acc.store(out + col);
+        }
+        vblur_line<float, KHALF>(lines, out, col, cols, kernel, half);
+    }
+};
+
+// Fixed-point uint8/uint16 line kernels for tier S, the Vec spelling of
+// FixedBlurLines with identical results: uint8 runs 16-bit lanes (16 pixels
+// per AVX2 register, 8 on SSE4.1 and NEON), uint16 runs 32-bit lanes. The
+// widening pixel loads and saturating narrowing stores are single
+// instructions on every tier.
+template<simd::SimdSet S, FixedPointPixel pixel_t, int64_t KHALF>
+struct VecFixedBlurLines {
+    static constexpr simd::SimdSet INSTRUCTIONS = S;
+    using FP = FixedPoint<pixel_t>;
+    using weight_t = typename FP::weight_t;
+    using V = simd::NativeVec<typename FP::lane_t, S>;
+    static constexpr auto LANES = static_cast<int64_t>(V::LANES);
+
+    static BlurWeights<weight_t> weights(std::span<const float> kernel) {
+        return FP::weights(kernel);
+    }
+
+    static void horizontal(
+        const pixel_t* padded,
+        pixel_t* out,
+        int64_t cols,
+        const weight_t* weights,
+        int64_t half
+    ) {
+        const int64_t radius = blur_half<KHALF>(half);
+        int64_t col = 0;
+        for (; col + LANES <= cols; col += LANES) {
+            const pixel_t* center = padded + col + radius;
+            V sum = FP::tap(FP::template load<V>(center), V::broadcast(weights[radius]));
+            for (int64_t k = 1; k <= radius; ++k) {
+                const V pair = FP::template load<V>(center - k) + FP::template load<V>(center + k);
+                sum = sum + FP::tap(pair, V::broadcast(weights[radius - k]));
+            }
+            FP::narrow(sum, out + col);
+        }
+        fixed_hblur_line<pixel_t, KHALF>(padded, out, col, cols, weights, half);
+    }
+
+    static void vertical(
+        const pixel_t* const* lines,
+        pixel_t* out,
+        int64_t cols,
+        const weight_t* weights,
+        int64_t half
+    ) {
+        const int64_t radius = blur_half<KHALF>(half);
+        const pixel_t* const* center = lines + radius;
+        int64_t col = 0;
+        for (; col + LANES <= cols; col += LANES) {
+            V sum = FP::tap(FP::template load<V>(center[0] + col), V::broadcast(weights[radius]));
+            for (int64_t k = 1; k <= radius; ++k) {
+                const V pair =
+                    FP::template load<V>(center[-k] + col) + FP::template load<V>(center[k] + col);
+                sum = sum + FP::tap(pair, V::broadcast(weights[radius - k]));
+            }
+            FP::narrow(sum, out + col);
+        }
+        fixed_vblur_line<pixel_t, KHALF>(lines, out, col, cols, weights, half);
+    }
+};
+
+}  // namespace p10::op
@@ -0,0 +1,425 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <p10_internal/simd/parallel_for.hpp>
+#include <p10_internal/simd/vec.hpp>
+#include <ptensor/op/color.hpp>
+#include <ptensor/tensor.hpp>
+
+#include "image_layout.lines.hpp"
+
+namespace p10::op {
+
+namespace {
+    // Fewest pixels a parallel conversion worker is handed; smaller images
+    // run on the calling thread.
+    constexpr int64_t COLOR_MIN_WORKER_PIXELS = 32 * 1024;
+
+    // Fractional bits of the uint8 gray weights, which add up to exactly
+    // 1 << GRAY_WEIGHT_BITS so white stays 255.
+    constexpr int GRAY_WEIGHT_BITS = 14;
+
+    struct GrayWeights {
+        std::array<float, 3> real;
+        std::array<int32_t, 3> fixed;
+    };
+
+    GrayWeights gray_weights(LumaWeights luma) {
+        std::array<float, 3> real = {0.299f, 0.587f, 0.114f};
+        if (luma == LumaWeights::BT709) {
+            real = {0.2126f, 0.7152f, 0.0722f};
+        } else if (luma == LumaWeights::Luminosity) {
+            real = {0.21f, 0.72f, 0.07f};
+        }
+        constexpr auto ONE = 1 << GRAY_WEIGHT_BITS;
+        const auto red = static_cast<int32_t>(std::lround(real[0] * ONE));
+        const auto blue = static_cast<int32_t>(std::lround(real[2] * ONE));
+        return {.real = real, .fixed = {red, ONE - red - blue, blue}};
+    }
+
+    // Channels `conversion` writes for an input of `channels`, or 0 when it
+    // does not read that many.
+    int64_t output_channels(ColorConversion conversion, int64_t channels) {
+        switch (conversion) {
+            case ColorConversion::RgbToGray:
+            case ColorConversion::BgrToGray:
+                return channels == 3 ? 1 : 0;
+            case ColorConversion::GrayToRgb:
+                return channels == 1 ? 3 : 0;
+            case ColorConversion::SwapRedBlue:
+                return channels == 3 || channels == 4 ? channels : 0;
+            case ColorConversion::RgbToRgba:
+                return channels == 3 ? 4 : 0;
+            case ColorConversion::RgbaToRgb:
+                return channels == 4 ? 3 : 0;
+            case ColorConversion::RgbToHsv:
+            case ColorConversion::BgrToHsv:
+            case ColorConversion::HsvToRgb:
+            case ColorConversion::HsvToBgr:
+                return channels == 3 ? 3 : 0;
+        }
+        return 0;
+    }
+
+    // Calls fn(std::type_identity<V> {}, x) over a row of `count` values:
+    // whole registers of NativeVec<float, S>, then single lanes, so the tail
+    // runs the same operations as the body.
+    template<simd::SimdSet S, typename Fn>
+    void for_each_lanes(int64_t count, const Fn& fn) {
+        using VF = simd::NativeVec<float, S>;
+        constexpr auto LANES = static_cast<int64_t>(VF::LANES);
+        int64_t x = 0;
+        for (; x + LANES <= count; x += LANES) {
+            fn(std::type_identity<VF> {}, x);
+        }
+        for (; x < count; ++x) {
+            fn(std::type_identity<simd::Vec<float, 1, simd::SimdSet::NONE>> {}, x);
+        }
+    }
+
+    // The int32 Vec with the lanes of float Vec V.
+    template<typename V>
+    using IntLanes = simd::Vec<int32_t, V::LANES, V::INSTRUCTIONS>;
+
+    template<typename V>
+    V load_lanes(const float* src) {
+        return V::load(src);
+    }
+
+    template<typename V>
+    V load_lanes(const uint8_t* src) {
+        return simd::convert<float>(IntLanes<V>::load_u8(src));
+    }
+
+    template<typename V>
+    void store_lanes(const V& value, float* dst) {
+        value.store(dst);
+    }
+
+    // Rounds to nearest and saturates.
+    template<typename V>
+    void store_lanes(const V& value, uint8_t* dst) {
+        simd::convert<int32_t>(value.round()).store_u8(dst);
+    }
+
+    template<simd::SimdSet S>
+    void gray_row(
+        const uint8_t* r,
+        const uint8_t* g,
+        const uint8_t* b,
+        int64_t count,
+        const GrayWeights& weights,
+        uint8_t* gray
+    ) {
+        for_each_lanes<S>(count, [&](auto type, int64_t x) {
+            using VI = IntLanes<typename decltype(type)::type>;
+            const VI sum = (VI::load_u8(r + x) * VI::broadcast(weights.fixed[0]))
+                + (VI::load_u8(g + x) * VI::broadcast(weights.fixed[1]))
+                + (VI::load_u8(b + x) * VI::broadcast(weights.fixed[2]))
+                + VI::broadcast(1 << (GRAY_WEIGHT_BITS - 1));
+            sum.template shift_right<GRAY_WEIGHT_BITS>().store_u8(gray + x);
+        });
+    }
+
+    template<simd::SimdSet S>
+    void gray_row(
+        const float* r,
+        const float* g,
+        const float* b,
+        int64_t count,
+        const GrayWeights& weights,
+        float* gray
+    ) {
+        for_each_lanes<S>(count, [&](auto type, int64_t x) {
+            using V = typename decltype(type)::type;
+            V sum = V::load(r + x) * V::broadcast(weights.real[0]);
+            sum = simd::fma(V::load(g + x), V::broadcast(weights.real[1]), sum);
+            sum = simd::fma(V::load(b + x), V::broadcast(weights.real[2]), sum);
+            sum.store(gray + x);
+        });
+    }
+
+    // Hue scale and wrap of the HSV encoding of T: uint8 stores H / 2.
+    template<typename T>
+    constexpr float HUE_DEGREES_PER_SIXTH = std::is_same_v<T, uint8_t> ? 30.0f : 60.0f;
+
+    template<typename T>
+    constexpr float SATURATION_SCALE = std::is_same_v<T, uint8_t> ? 255.0f : 1.0f;
+
+    template<simd::SimdSet S, typename T>
+    void rgb_to_hsv_row(
+        const T* r,
+        const T* g,
+        const T* b,
+        int64_t count,
+        const std::array<T*, 4>& hsv
+    ) {
+        for_each_lanes<S>(count, [&](auto type, int64_t x) {
+            using V = typename decltype(type)::type;
+            const V zero = V::zero();
+            const V one = V::broadcast(1.0f);
+            const V red = load_lanes<V>(r + x);
+            const V green = load_lanes<V>(g + x);
+            const V blue = load_lanes<V>(b + x);
+
+            const V value = simd::max(simd::max(red, green), blue);
+            const V range = value - simd::min(simd::min(red, green), blue);
+            // Gray pixels have no hue: their differences are all 0, and a
+            // divisor of 1 keeps the hue at 0.
+            const V divisor = simd::select_less(zero, range, range, one);
+            const V from_red = (green - blue) / divisor;
+            const V from_green = V::broadcast(2.0f) + ((blue - red) / divisor);
+            const V from_blue = V::broadcast(4.0f) + ((red - green) / divisor);
+            // The channel equal to the maximum picks the sector; red wins ties.
+            V sixths = simd::select_less(
+                red,
+                value,
+                simd::select_less(green, value, from_blue, from_green),
+                from_red
+            );
+            sixths = simd::select_less(sixths, zero, sixths + V::broadcast(6.0f), sixths);
+
+            V hue = sixths * V::broadcast(HUE_DEGREES_PER_SIXTH<T>);
+            if constexpr (std::is_same_v<T, uint8_t>) {
+                hue = hue.round();
+            }
+            const V full_turn = V::broadcast(6.0f * HUE_DEGREES_PER_SIXTH<T>);
+            hue = simd::select_less(hue, full_turn, hue, zero);
+            const V saturation = range / simd::select_less(zero, value, value, one);
+
+            store_lanes(hue, hsv[0] + x);
+            store_lanes(saturation * V::broadcast(SATURATION_SCALE<T>), hsv[1] + x);
+            store_lanes(value, hsv[2] + x);
+        });
+    }
+
+    // One channel of HSV to RGB, for n = 5 (red), 3 (green) and 1 (blue):
+    // v - v * s * clamp(min(k, 4 - k), 0, 1) with k = (n + h) mod 6.
+    template<typename V>
+    V hsv_channel(const V& sixths, const V& saturation, const V& value, float n) {
+        const V six = V::broadcast(6.0f);
+        V k = V::broadcast(n) + sixths;
+        k = simd::select_less(k, six, k, k - six);
+        const V ramp = simd::max(
+            V::zero(),
+            simd::min(simd::min(k, V::broadcast(4.0f) - k), V::broadcast(1.0f))
+        );
+        return value - (value * saturation * ramp);
+    }
+
+    template<simd::SimdSet S, typename T>
+    void hsv_to_rgb_row(
+        const std::array<const T*, 4>& hsv,
+        int64_t count,
+        const std::array<T*, 3>& rgb
+    ) {
+        for_each_lanes<S>(count, [&](auto type, int64_t x) {
+            using V = typename decltype(type)::type;
+            const V sixths =
+                load_lanes<V>(hsv[0] + x) / V::broadcast(HUE_DEGREES_PER_SIXTH<T>);
+            const V saturation =
+                load_lanes<V>(hsv[1] + x) / V::broadcast(SATURATION_SCALE<T>);
+            const V value = load_lanes<V>(hsv[2] + x);
+            store_lanes(hsv_channel(sixths, saturation, value, 5.0f), rgb[0] + x);
+            store_lanes(hsv_channel(sixths, saturation, value, 3.0f), rgb[1] + x);
+            store_lanes(hsv_channel(sixths, saturation, value, 1.0f), rgb[2] + x);
+        });
+    }
+
+    // Converts one row given as channel rows. Writes computed channels to
+    // `work` and points `out` at the row of every output channel, which
+    // may be an input row or `alpha` when the conversion only reorders.
+    template<simd::SimdSet S, typename T>
+    void convert_row(
+        ColorConversion conversion,
+        const std::array<const T*, 4>& in,
+        int64_t count,
+        const GrayWeights& weights,
+        const T* alpha,
+        const std::array<T*, 4>& work,
+        std::array<const T*, 4>& out
+    ) {
+        out = {work[0], work[1], work[2], work[3]};
+        switch (conversion) {
+            case ColorConversion::RgbToGray:
+                gray_row<S>(in[0], in[1], in[2], count, weights, work[0]);
+                break;
+            case ColorConversion::BgrToGray:
+                gray_row<S>(in[2], in[1], in[0], count, weights, work[0]);
+                break;
+            case ColorConversion::GrayToRgb:
+                out = {in[0], in[0], in[0], nullptr};
+                break;
+            case ColorConversion::SwapRedBlue:
+                out = {in[2], in[1], in[0], in[3]};
+                break;
+            case ColorConversion::RgbToRgba:
+                out = {in[0], in[1], in[2], alpha};
+                break;
+            case ColorConversion::RgbaToRgb:
+                out = {in[0], in[1], in[2], nullptr};
+                break;
+            case ColorConversion::RgbToHsv:
+                rgb_to_hsv_row<S, T>(in[0], in[1], in[2], count, work);
+                break;
+            case ColorConversion::BgrToHsv:
+                rgb_to_hsv_row<S, T>(in[2], in[1], in[0], count, work);
+                break;
+            case ColorConversion::HsvToRgb:
+                hsv_to_rgb_row<S, T>(in, count, {work[0], work[1], work[2]});
+                break;
+            case ColorConversion::HsvToBgr:
+                hsv_to_rgb_row<S, T>(in, count, {work[2], work[1], work[0]});
+                break;
+        }
+    }
+
+    void split_row(const uint8_t* src, int64_t count, int64_t channels, uint8_t* const* planes) {
+        deinterleave_row(src, count, channels, planes);
+    }
+
+    void join_row(const uint8_t* const* planes, int64_t count, int64_t channels, uint8_t* dst) {
+        interleave_row(planes, count, channels, dst);
+    }
+
+    void split_row(const float* src, int64_t count, int64_t channels, float* const* planes) {
+        for (int64_t x = 0; x < count; ++x) {
+            for (int64_t c = 0; c < channels; ++c) {
+                planes[c][x] = src[(x * channels) + c];
+            }
+        }
+    }
+
+    void join_row(const float* const* planes, int64_t count, int64_t channels, float* dst) {
+        for (int64_t x = 0; x < count; ++x) {
+            for (int64_t c = 0; c < channels; ++c) {
+                dst[(x * channels) + c] = planes[c][x];
+            }
+        }
+    }
+
+    struct ColorImage {
+        int64_t height;
+        int64_t width;
+        int64_t in_channels;
+        int64_t out_channels;
+        bool planar;
+    };
+
+    template<typename T>
+    void convert_image(
+        const T* in,
+        T* out,
+        const ColorImage& image,
+        ColorConversion conversion,
+        const GrayWeights& weights
+    ) {
+        const int64_t height = image.height;
+        const int64_t width = image.width;
+        const int threads = simd::parallel_workers(height * width, COLOR_MIN_WORKER_PIXELS);
+        simd::parallel_for(threads, threads, [&](int64_t job) {
+            const int64_t begin = (job * height) / threads;
+            const int64_t end = ((job + 1) * height) / threads;
+
+            // Split input channels, computed channels and the alpha row.
+            std::vector<T> buffer(static_cast<size_t>(9 * width));
+            std::array<T*, 4> split {};
+            std::array<T*, 4> work {};
+            for (size_t c = 0; c < 4; ++c) {
+                split[c] = buffer.data() + (c * width);
+                work[c] = buffer.data() + ((4 + c) * width);
+            }
+            T* alpha = buffer.data() + (8 * width);
+            std::fill_n(alpha, width, std::is_same_v<T, uint8_t> ? T(255) : T(1));
+
+            simd::call_in_best_tier([&](auto tier) {
+                constexpr auto S = decltype(tier)::value;
+                std::array<const T*, 4> in_rows {};
+                std::array<const T*, 4> out_rows {};
+                for (int64_t row = begin; row < end; ++row) {
+                    if (image.planar) {
+                        for (int64_t c = 0; c < image.in_channels; ++c) {
+                            in_rows[c] = in + (((c * height) + row) * width);
+                        }
+                    } else {
+                        const T* pixels = in + (row * width * image.in_channels);
+                        split_row(pixels, width, image.in_channels, split.data());
+                        std::copy(split.begin(), split.end(), in_rows.begin());
+                    }
+
+                    convert_row<S, T>(conversion, in_rows, width, weights, alpha, work, out_rows);
+
+                    if (image.planar) {
+                        for (int64_t c = 0; c < image.out_channels; ++c) {
+                            std::copy_n(out_rows[c], width, out + (((c * height) + row) * width));
+                        }
+                    } else {
+                        T* pixels = out + (row * width * image.out_channels);
+                        join_row(out_rows.data(), width, image.out_channels, pixels);
+                    }
+                }
+            });
+        });
+    }
+}  // namespace
+
+P10Error convert_color(
+    const Tensor& input,
+    Tensor& output,
+    ColorConversion conversion,
+    const ColorOptions& options
+) {
+    if (input.dtype() != Dtype::Uint8 && input.dtype() != Dtype::Float32) {
+        return P10Error::InvalidArgument << "Input image must be of type UINT8 or FLOAT32.";
+    }
+    if (input.dims() != 3) {
+        return P10Error::InvalidArgument << "Input image must be 3D.";
+    }
+    if (!input.is_contiguous()) {
+        return P10Error::InvalidArgument << "Input image must be contiguous in memory.";
+    }
+
+    const bool planar = options.planar();
+    const auto shape = input.shape().as_span();
+    ColorImage image {
+        .height = planar ? shape[1] : shape[0],
+        .width = planar ? shape[2] : shape[1],
+        .in_channels = planar ? shape[0] : shape[2],
+        .out_channels = 0,
+        .planar = planar,
+    };
+    image.out_channels = output_channels(conversion, image.in_channels);
+    if (image.out_channels == 0) {
+        return P10Error::InvalidArgument << "Input image has the wrong channel count.";
+    }
+
+    const Shape out_shape = planar ? make_shape(image.out_channels, image.height, image.width)
+                                   : make_shape(image.height, image.width, image.out_channels);
+    P10_RETURN_IF_ERROR(output.create(out_shape, input.dtype()));
+
+    const GrayWeights weights = gray_weights(options.luma());
+    if (input.dtype() == Dtype::Uint8) {
+        convert_image(
+            input.as_span1d<const uint8_t>().unwrap().data(),
+            output.as_span1d<uint8_t>().unwrap().data(),
+            image,
+            conversion,
+            weights
+        );
+    } else {
+        convert_image(
+            input.as_span1d<const float>().unwrap().data(),
+            output.as_span1d<float>().unwrap().data(),
+            image,
+            conversion,
+            weights
+        );
+    }
+    return P10Error::Ok;
+}
+
+}  // namespace p10::op
@@ -1,7 +1,6 @@
 #include "ptensor/op/elemwise.hpp"
 
-#include <algorithm>
-
+#include "elemwise.vec.hpp"
 #include "ptensor/tensor.hpp"
 
 namespace p10::op {
@@ -10,6 +9,8 @@ namespace {
     void add_elemwise_impl(const T* a, const T* b, T* out, size_t size);
     template<typename T>
     void subtract_elemwise_impl(const T* a, const T* b, T* out, size_t size);
+    template<typename T>
+    void multiply_elemwise_impl(const T* a, const T* b, T* out, size_t size);
 }  // namespace
 
 P10Error add_elemwise(const Tensor& a, const Tensor& b, Tensor& out) {
@@ -68,12 +69,11 @@ P10Error multiply_elemwise(const Tensor& a, const Tensor& b, Tensor& out) {
     a.visit([&](auto a_span) {
         using SpanType = decltype(a_span)::value_type;
 
-        std::transform(
+        multiply_elemwise_impl(
             a_span.data(),
-            a_span.data() + a.size(),
             b.as_span1d<SpanType>().unwrap().data(),
             out.as_span1d<SpanType>().unwrap().data(),
-            std::multiplies<SpanType>()
+            a.size()
         );
     });
     return P10Error::Ok;
@@ -82,12 +82,23 @@ P10Error multiply_elemwise(const Tensor& a, const Tensor& b, Tensor& out) {
 namespace {
     template<typename T>
     void add_elemwise_impl(const T* a, const T* b, T* out, size_t size) {
-        std::transform(a, a + size, b, out, std::plus<T>());
+        binary_elemwise(a, b, out, static_cast<int64_t>(size), [](auto x, auto y) {
+            return x + y;
+        });
     }
 
     template<typename T>
     void subtract_elemwise_impl(const T* a, const T* b, T* out, size_t size) {
-        std::transform(a, a + size, b, out, std::minus<T>());
+        binary_elemwise(a, b, out, static_cast<int64_t>(size), [](auto x, auto y) {
+            return x - y;
+        });
+    }
+
+    template<typename T>
+    void multiply_elemwise_impl(const T* a, const T* b, T* out, size_t size) {
+        binary_elemwise(a, b, out, static_cast<int64_t>(size), [](auto x, auto y) {
+            return x * y;
+        });
     }
 }  // namespace
 
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <p10_internal/simd/tile1d.hpp>
+#include <p10_internal/simd/vec.hpp>
+
+namespace p10::op {
+
+// Elements per tile1d chunk: whole native registers for every dtype on every
+// tier (32 uint8 lanes, AVX2, is the widest).
+inline constexpr size_t ELEMWISE_CHUNK = 32;
+
+// `value` as an operand of type X: a broadcast register for Vec, a plain cast
+// for scalars, so one generic functor serves both.
+template<typename X, typename T>
+X splat(T value) {
+    if constexpr (simd::VecType<X>) {
+        return X::broadcast(static_cast<typename X::value_type>(value));
+    } else {
+        return static_cast<X>(value);
+    }
+}
+
+// out[i] = op(a[i], b[i]) over one chunk, a native register of S per step.
+template<simd::SimdSet S, typename T, typename Op>
+auto elemwise_chunk_kernel(const T* a, const T* b, T* out, Op op) {
+    return [=](const simd::TileRegion1D& region) {
+        using V = simd::NativeVec<T, S>;
+        const int64_t end = region.offset + region.size;
+        for (int64_t i = region.offset; i < end; i += static_cast<int64_t>(V::LANES)) {
+            op(V::load(a + i), V::load(b + i)).store(out + i);
+        }
+    };
+}
+
+// out[i] = op(in[i]) over one chunk, a native register of S per step.
+template<simd::SimdSet S, typename T, typename Op>
+auto unary_chunk_kernel(const T* in, T* out, Op op) {
+    return [=](const simd::TileRegion1D& region) {
+        using V = simd::NativeVec<T, S>;
+        const int64_t end = region.offset + region.size;
+        for (int64_t i = region.offset; i < end; i += static_cast<int64_t>(V::LANES)) {
+            op(V::load(in + i)).store(out + i);
+        }
+    };
+}
+
+// out[i] = op(in[i]) for `size` contiguous elements, tiled like
+// binary_elemwise. `op` takes Vec operands only (the simd::exp family); the
+// tail runs it on one-lane portable Vecs, which give the same bits as every
+// tier. `out` may alias `in`.
+template<typename T, typename Op>
+void unary_elemwise(const T* in, T* out, int64_t size, Op op) {
+    using simd::SimdSet;
+    const auto tail = [=](const simd::TileRegion1D& region) {
+        using One = simd::Vec<T, 1, SimdSet::NONE>;
+        for (int64_t i = region.offset; i < region.offset + region.size; ++i) {
+            op(One::load(in + i)).store(out + i);
+        }
+    };
+    simd::tile1d<T, simd::TileExecution::PARALLEL>(
+        size,
+        tail,
+        simd::Tiered_1D<SimdSet::AVX2, ELEMWISE_CHUNK, T>(
+            unary_chunk_kernel<SimdSet::AVX2>(in, out, op)
+        ),
+        simd::Tiered_1D<SimdSet::SSE41, ELEMWISE_CHUNK, T>(
+            unary_chunk_kernel<SimdSet::SSE41>(in, out, op)
+        ),
+        simd::Tiered_1D<SimdSet::AdvSIMD, ELEMWISE_CHUNK, T>(
+            unary_chunk_kernel<SimdSet::AdvSIMD>(in, out, op)
+        ),
+        simd::Portable_1D<ELEMWISE_CHUNK, T>(unary_chunk_kernel<SimdSet::NONE>(in, out, op))
+    );
+}
+
+// out[i] = op(a[i], b[i]) for `size` contiguous elements, on the best tier the
+// CPU supports and across the tile workers for long buffers. `op` must accept
+// both Vec and scalar operands (a generic lambda over +, -, *, min, ...);
+// integer lanes wrap exactly like the scalar expression cast back to T, so
+// every tier gives the same result. `out` may alias `a` or `b`.
+template<typename T, typename Op>
+void binary_elemwise(const T* a, const T* b, T* out, int64_t size, Op op) {
+    using simd::SimdSet;
+    const auto tail = [=](const simd::TileRegion1D& region) {
+        for (int64_t i = region.offset; i < region.offset + region.size; ++i) {
+            out[i] = static_cast<T>(op(a[i], b[i]));
+        }
+    };
+    simd::tile1d<T, simd::TileExecution::PARALLEL>(
+        size,
+        tail,
+        simd::Tiered_1D<SimdSet::AVX2, ELEMWISE_CHUNK, T>(
+            elemwise_chunk_kernel<SimdSet::AVX2>(a, b, out, op)
+        ),
+        simd::Tiered_1D<SimdSet::SSE41, ELEMWISE_CHUNK, T>(
+            elemwise_chunk_kernel<SimdSet::SSE41>(a, b, out, op)
+        ),
+        simd::Tiered_1D<SimdSet::AdvSIMD, ELEMWISE_CHUNK, T>(
+            elemwise_chunk_kernel<SimdSet::AdvSIMD>(a, b, out, op)
+        ),
+        simd::Portable_1D<ELEMWISE_CHUNK, T>(elemwise_chunk_kernel<SimdSet::NONE>(a, b, out, op))
+    );
+}
+
+}  // namespace p10::op
@@ -1,8 +1,16 @@
 #include "fft.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <utility>
+#include <vector>
 
 #ifdef _MSC_VER
     #pragma warning(push)
@@ -13,24 +21,318 @@
     #pragma warning(pop)
 #endif
 
+#include <p10_internal/simd/parallel_for.hpp>
 #include <ptensor/tensor.hpp>
-#include <ptensor/tensor_print.hpp>
 
 #include "ptensor/p10_error.hpp"
 #include "ptensor/p10_result.hpp"
-#include "tensor_scalar.hpp"
 
 namespace p10::op {
 namespace {
+    // Fewest elements a parallel FFT worker is handed; smaller batches run on
+    // the calling thread.
+    constexpr int64_t FFT_MIN_WORKER_ELEMENTS = 16 * 1024;
 
-    P10Result<int64_t> validate_frequency_arguments(const Tensor& frequency);
-    P10Error check_input_device_and_dtype(const Tensor& tensor);
+    // Plans kept per plan type (complex or real, float or double); the least
+    // recently used one is dropped first.
+    constexpr size_t FFT_PLAN_CACHE_SIZE = 16;
 
+    template<typename T>
+    using Complex = pocketfft::detail::cmplx<T>;
+
+    template<typename T>
+    using ComplexPlan = pocketfft::detail::pocketfft_c<T>;
+
+    template<typename T>
+    using RealPlan = pocketfft::detail::pocketfft_r<T>;
+
+    template<typename Plan>
+    struct PlanCache {
+        std::mutex mutex;
+        // Most recently used first.
+        std::list<std::pair<size_t, std::shared_ptr<const Plan>>> plans;
+    };
+
+    // The plan for `length`, built on first use and shared by every caller
+    // after that. Plans are immutable, so workers run one concurrently.
+    template<typename Plan>
+    std::shared_ptr<const Plan> cached_plan(size_t length) {
+        static PlanCache<Plan> cache;
+        const std::lock_guard<std::mutex> guard(cache.mutex);
+        auto& plans = cache.plans;
+        const auto found = std::find_if(plans.begin(), plans.end(), [&](const auto& entry) {
+            return entry.first == length;
+        });
+        if (found != plans.end()) {
+            plans.splice(plans.begin(), plans, found);
+            return plans.front().second;
+        }
+        plans.emplace_front(length, std::make_shared<const Plan>(length));
+        if (plans.size() > FFT_PLAN_CACHE_SIZE) {
+            plans.pop_back();
+        }
+        return plans.front().second;
+    }
+
+    // A C-contiguous array seen as [outer, length, inner] around one axis:
+    // outer * inner lines of `length` elements, `inner` apart.
+    struct AxisLines {
+        int64_t outer;
+        int64_t length;
+        int64_t inner;
+
+        int64_t count() const {
+            return outer * inner;
+        }
+
+        // Offset of the first element of `line` in an array whose axis has
+        // `axis_length` elements (the transformed length by default).
+        int64_t start(int64_t line, int64_t axis_length) const {
+            return ((line / inner) * axis_length * inner) + (line % inner);
+        }
+
+        int64_t start(int64_t line) const {
+            return start(line, length);
+        }
+    };
+
+    AxisLines axis_lines(std::span<const int64_t> shape, int64_t axis) {
+        AxisLines lines {.outer = 1, .length = shape[axis], .inner = 1};
+        for (int64_t i = 0; i < axis; ++i) {
+            lines.outer *= shape[i];
+        }
+        for (auto i = static_cast<size_t>(axis) + 1; i < shape.size(); ++i) {
+            lines.inner *= shape[i];
+        }
+        return lines;
+    }
+
+    template<typename T>
+    T normalize_factor(Fft::Normalize normalize, int64_t length) {
+        switch (normalize) {
+            case Fft::ByN:
+                return T(1) / static_cast<T>(length);
+            case Fft::BySqrtN:
+                return T(1) / std::sqrt(static_cast<T>(length));
+            default:
+                return T(1);
+        }
+    }
+
+    // fn(line, scratch) for every line, spread over the parallel workers.
+    // Each worker owns `scratch_size` elements of scratch (none when 0).
+    template<typename E, typename Fn>
+    void for_each_line(const AxisLines& lines, size_t scratch_size, const Fn& fn) {
+        const int64_t count = lines.count();
+        const int threads = simd::parallel_workers(count * lines.length, FFT_MIN_WORKER_ELEMENTS);
+        simd::parallel_for(threads, threads, [&](int64_t job) {
+            std::vector<E> scratch(scratch_size);
+            const int64_t begin = (job * count) / threads;
+            const int64_t end = ((job + 1) * count) / threads;
+            for (int64_t line = begin; line < end; ++line) {
+                fn(line, scratch.data());
+            }
+        });
+    }
+
+    // In-place complex transforms along one axis.
+    template<typename T>
+    void c2c_axis(Complex<T>* data, const AxisLines& lines, bool forward, T factor) {
+        const auto plan = cached_plan<ComplexPlan<T>>(static_cast<size_t>(lines.length));
+        const int64_t inner = lines.inner;
+        const size_t scratch = inner == 1 ? 0 : static_cast<size_t>(lines.length);
+        for_each_line<Complex<T>>(lines, scratch, [&](int64_t line, Complex<T>* buffer) {
+            Complex<T>* values = data + lines.start(line);
+            if (inner == 1) {
+                plan->exec(values, factor, forward);
+                return;
+            }
+            for (int64_t k = 0; k < lines.length; ++k) {
+                buffer[k] = values[k * inner];
+            }
+            plan->exec(buffer, factor, forward);
+            for (int64_t k = 0; k < lines.length; ++k) {
+                values[k * inner] = buffer[k];
+            }
+        });
+    }
+
+    // Forward real transforms along one axis: `lines` of real input to their
+    // `length / 2 + 1` non-negative frequencies.
+    template<typename T>
+    void r2c_axis(const T* in, Complex<T>* out, const AxisLines& lines, T factor) {
+        const int64_t length = lines.length;
+        const int64_t bins = (length / 2) + 1;
+        const auto plan = cached_plan<RealPlan<T>>(static_cast<size_t>(length));
+        const int64_t inner = lines.inner;
+        const size_t scratch = inner == 1 ? 0 : static_cast<size_t>(length);
+        for_each_line<T>(lines, scratch, [&](int64_t line, T* buffer) {
+            const T* signal = in + lines.start(line);
+            Complex<T>* frequency = out + lines.start(line, bins);
+            if (inner == 1) {
+                // Transform in the output row, one real to the right: the
+                // packed (r0, r1, i1, r2, i2, ...) result then only needs r0
+                // moved down and the zero imaginary parts filled in.
+                T* packed = reinterpret_cast<T*>(frequency);
+                std::copy_n(signal, length, packed + 1);
+                plan->exec(packed + 1, factor, true);
+                packed[0] = packed[1];
+                packed[1] = T(0);
+                if (length % 2 == 0) {
+                    packed[length + 1] = T(0);
+                }
+                return;
+            }
+            for (int64_t k = 0; k < length; ++k) {
+                buffer[k] = signal[k * inner];
+            }
+            plan->exec(buffer, factor, true);
+            frequency[0] = Complex<T>(buffer[0], T(0));
+            int64_t k = 1;
+            int64_t bin = 1;
+            for (; k + 1 < length; k += 2, ++bin) {
+                frequency[bin * inner] = Complex<T>(buffer[k], buffer[k + 1]);
+            }
+            if (k < length) {
+                frequency[bin * inner] = Complex<T>(buffer[k], T(0));
+            }
+        });
+    }
+
+    // Inverse real transforms along one axis: `length / 2 + 1` frequencies
+    // per line to `lines` of `length` reals. The imaginary parts of the zero
+    // (and, for even lengths, the last) frequency are ignored.
+    template<typename T>
+    void c2r_axis(const Complex<T>* in, T* out, const AxisLines& lines, T factor) {
+        const int64_t length = lines.length;
+        const int64_t bins = (length / 2) + 1;
+        const auto plan = cached_plan<RealPlan<T>>(static_cast<size_t>(length));
+        const int64_t inner = lines.inner;
+        const size_t scratch = inner == 1 ? 0 : static_cast<size_t>(length);
+        for_each_line<T>(lines, scratch, [&](int64_t line, T* buffer) {
+            const Complex<T>* frequency = in + lines.start(line, bins);
+            T* signal = out + lines.start(line);
+            // Packs (r0, r1, i1, r2, i2, ...) straight into a contiguous row.
+            T* packed = inner == 1 ? signal : buffer;
+            packed[0] = frequency[0].r;
+            int64_t k = 1;
+            int64_t bin = 1;
+            for (; k + 1 < length; k += 2, ++bin) {
+                packed[k] = frequency[bin * inner].r;
+                packed[k + 1] = frequency[bin * inner].i;
+            }
+            if (k < length) {
+                packed[k] = frequency[bin * inner].r;
+            }
+            plan->exec(packed, factor, false);
+            if (inner != 1) {
+                for (int64_t j = 0; j < length; ++j) {
+                    signal[j * inner] = buffer[j];
+                }
+            }
+        });
+    }
+
+    P10Error check_input_device_and_dtype(const Tensor& tensor) {
+        if (tensor.dtype() != Dtype::Float32 && tensor.dtype() != Dtype::Float64) {
+            return P10Error::InvalidArgument << "Input tensor must have Float32 or Float64 dtype";
+        }
+        if (tensor.device() != Device::Cpu) {
+            return P10Error::InvalidArgument << "Input tensor must be on CPU device";
+        }
+        if (!tensor.is_contiguous()) {
+            return P10Error::InvalidArgument << "Input tensor must be contiguous";
+        }
+        return P10Error::Ok;
+    }
+
+    // The signal shape of a complex tensor: its shape without the trailing 2.
+    P10Result<std::vector<int64_t>> complex_signal_shape(const Tensor& tensor) {
+        P10_RETURN_ERR_IF_ERROR(check_input_device_and_dtype(tensor));
+        const auto shape = tensor.shape().as_span();
+        if (shape.size() < 2 || shape.back() != 2) {
+            return Err(
+                P10Error::InvalidArgument
+                << "Input tensor last dimension must be 2 (real and imaginary)"
+            );
+        }
+        return Ok(std::vector<int64_t>(shape.begin(), shape.end() - 1));
+    }
+
+    // `axes` resolved against the signal `shape`: in range, distinct,
+    // non-negative and of non-zero length, in the order given.
+    P10Result<std::vector<int64_t>>
+    resolve_axes(const std::vector<int64_t>& axes, std::span<const int64_t> shape) {
+        const auto dims = static_cast<int64_t>(shape.size());
+        if (axes.empty()) {
+            return Err(P10Error::InvalidArgument << "FFT needs at least one axis");
+        }
+        std::vector<int64_t> resolved;
+        for (int64_t axis : axes) {
+            if (axis < 0) {
+                axis += dims;
+            }
+            if (axis < 0 || axis >= dims) {
+                return Err(P10Error::InvalidArgument << "FFT axis is out of range");
+            }
+            if (shape[axis] == 0) {
+                return Err(P10Error::InvalidArgument << "FFT axis must not be empty");
+            }
+            if (std::find(resolved.begin(), resolved.end(), axis) != resolved.end()) {
+                return Err(P10Error::InvalidArgument << "FFT axes must be distinct");
+            }
+            resolved.push_back(axis);
+        }
+        return Ok(std::move(resolved));
+    }
+
+    P10Error complex_transform(
+        const Tensor& input,
+        Tensor& output,
+        const std::vector<int64_t>& axes,
+        Fft::Normalize normalize,
+        bool forward
+    ) {
+        auto signal_shape = complex_signal_shape(input);
+        if (signal_shape.is_error()) {
+            return signal_shape.error();
+        }
+        const auto shape = signal_shape.unwrap();
+        auto resolved = resolve_axes(axes, shape);
+        if (resolved.is_error()) {
+            return resolved.error();
+        }
+
+        const auto type = input.dtype();
+        const void* source = input.as_bytes().data();
+        P10_RETURN_IF_ERROR(output.create(input.shape(), type));
+        return type.match(
+            [&](auto) -> P10Error {
+                return P10Error::InvalidArgument << "Unsupported tensor dtype for FFT";
+            },
+            [&](auto t) -> P10Error {
+                using scalar_t = decltype(t)::type;
+                auto* data = reinterpret_cast<Complex<scalar_t>*>(
+                    output.as_span1d<scalar_t>().unwrap().data()
+                );
+                if (data != source) {
+                    std::memcpy(data, source, input.size() * sizeof(scalar_t));
+                }
+                for (const int64_t axis : resolved.unwrap()) {
+                    const auto lines = axis_lines(shape, axis);
+                    const auto factor = normalize_factor<scalar_t>(normalize, lines.length);
+                    c2c_axis(data, lines, forward, factor);
+                }
+                return P10Error::Ok;
+            }
+        );
+    }
 }  // namespace
 
 Fft::Fft(const FftOptions& options) :
     direction_(options.direction()),
-    normalize_(options.normalize()) {}
+    normalize_(options.normalize()),
+    axes_(options.axes()) {}
 
 Fft::~Fft() {}
 
@@ -49,172 +351,151 @@ P10Error Fft::transform(const Tensor& input, Tensor& output) const {
     }
 }
 
-P10Error Fft::forward(const Tensor&, Tensor&) {
-    return P10Error::NotImplemented << "Forward complex FFT is not implemented yet";
+P10Error Fft::forward(const Tensor& time, Tensor& frequency) const {
+    return complex_transform(time, frequency, axes_, normalize_, true);
 }
 
 P10Error Fft::forward_real(const Tensor& signal_in, Tensor& freq_out) const {
-    if (signal_in.dims() > 2) {
-        return P10Error::InvalidArgument << "Input tensor must have [N x T]";
-    }
     P10_RETURN_IF_ERROR(check_input_device_and_dtype(signal_in));
-
-    const auto type = signal_in.dtype();
-    const auto signal_in_shape = signal_in.shape().as_span();
-
-    int64_t num_signals = 1;
-    int64_t num_samples = 0;
-    if (signal_in_shape.size() == 1) {
-        num_samples = signal_in_shape[0];
-    } else {  // .size() == 2
-        num_samples = signal_in_shape[1];
-        num_signals = signal_in_shape[0];
+    if (signal_in.dims() == 0 || signal_in.size() == 0) {
+        return P10Error::InvalidArgument << "Input tensor must not be empty";
     }
-
-    const auto num_ffts = num_samples / 2 + 1;
-
-    if (signal_in_shape.size() == 1) {
-        P10_RETURN_IF_ERROR(freq_out.create(make_shape(num_ffts, 2), type));
-    } else {
-        P10_RETURN_IF_ERROR(freq_out.create(make_shape(num_signals, num_ffts, 2), type));
+    const auto in_shape = signal_in.shape().as_span();
+    auto resolved = resolve_axes(axes_, in_shape);
+    if (resolved.is_error()) {
+        return resolved.error();
     }
-
-    double scalar_factor = 1.0;
-    if (normalize_ == Normalize::ByN) {
-        scalar_factor = 1.0 / static_cast<double>(num_samples);
+    const auto axes = resolved.unwrap();
+    const int64_t real_axis = axes.back();
+
+    // [..., T, ...] becomes [..., T / 2 + 1, ..., 2].
+    std::vector<int64_t> freq_shape(in_shape.begin(), in_shape.end());
+    freq_shape[real_axis] = (in_shape[real_axis] / 2) + 1;
+    std::vector<int64_t> out_dims = freq_shape;
+    out_dims.push_back(2);
+    auto out_shape = make_shape(std::span<const int64_t>(out_dims));
+    if (out_shape.is_error()) {
+        return out_shape.error();
     }
-    pocketfft::shape_t shape_in = {
-        static_cast<size_t>(num_signals),
-        static_cast<size_t>(num_samples)
-    };
+
+    const auto type = signal_in.dtype();
+    P10_RETURN_IF_ERROR(freq_out.create(out_shape.unwrap(), type));
     return type.match(
         [&](auto) -> P10Error {
             return P10Error::InvalidArgument << "Unsupported tensor dtype for FFT";
         },
         [&](auto t) -> P10Error {
             using scalar_t = decltype(t)::type;
-
-            auto freq_out_s =
-                freq_out.as_span2d<std::complex<scalar_t>, RankFit::Flexible>().unwrap();
-            const auto signal_in_s =
-                signal_in.as_span2d<const scalar_t, RankFit::Flexible>().unwrap();
-
-            pocketfft::stride_t stride_in = {
-                std::ptrdiff_t(num_samples * sizeof(scalar_t)),
-                sizeof(scalar_t)
-            };
-            pocketfft::stride_t stride_out = {
-                std::ptrdiff_t(num_ffts * sizeof(std::complex<scalar_t>)),
-                sizeof(std::complex<scalar_t>)
-            };
-
-            pocketfft::r2c<scalar_t>(
-                shape_in,
-                stride_in,
-                stride_out,
-                1,
-                pocketfft::FORWARD,
-                signal_in_s[0].data(),
-                freq_out_s[0].data(),
-                scalar_t(scalar_factor)
+            const scalar_t* signal = signal_in.as_span1d<const scalar_t>().unwrap().data();
+            auto* frequency = reinterpret_cast<Complex<scalar_t>*>(
+                freq_out.as_span1d<scalar_t>().unwrap().data()
             );
 
+            const auto real_lines = axis_lines(in_shape, real_axis);
+            r2c_axis(
+                signal,
+                frequency,
+                real_lines,
+                normalize_factor<scalar_t>(normalize_, real_lines.length)
+            );
+            for (size_t i = 0; i + 1 < axes.size(); ++i) {
+                const auto lines = axis_lines(freq_shape, axes[i]);
+                const auto factor = normalize_factor<scalar_t>(normalize_, lines.length);
+                c2c_axis(frequency, lines, true, factor);
+            }
             return P10Error::Ok;
         }
     );
 }
 
-P10Error Fft::inverse(const Tensor&, Tensor&) {
-    return P10Error::NotImplemented << "Inverse complex FFT is not implemented yet";
+P10Error Fft::inverse(const Tensor& input, Tensor& output) const {
+    return complex_transform(input, output, axes_, normalize_, false);
 }
 
 P10Error Fft::inverse_real(const Tensor& freq_in, Tensor& signal_out) const {
-    auto validation = validate_frequency_arguments(freq_in);
-    if (validation.is_error()) {
-        return validation.error();
+    auto signal_shape = complex_signal_shape(freq_in);
+    if (signal_shape.is_error()) {
+        return signal_shape.error();
+    }
+    const auto freq_shape = signal_shape.unwrap();
+    auto resolved = resolve_axes(axes_, freq_shape);
+    if (resolved.is_error()) {
+        return resolved.error();
+    }
+    const auto axes = resolved.unwrap();
+    const int64_t real_axis = axes.back();
+    if (freq_shape[real_axis] < 2) {
+        return P10Error::InvalidArgument << "Inverse real FFT needs at least 2 frequencies";
     }
-    const auto type = freq_in.dtype();
-    const auto num_signals = validation.unwrap();
-    const auto num_ffts = freq_in.shape(1).unwrap();
-    const auto num_samples = (num_ffts - 1) * 2;
-
-    P10_RETURN_IF_ERROR(signal_out.create(make_shape(num_signals, num_samples), type));
 
-    double scalar_factor = 1.0;
-    if (normalize_ == Normalize::ByN) {
-        scalar_factor = 1.0 / static_cast<double>(num_samples);
+    std::vector<int64_t> out_dims = freq_shape;
+    out_dims[real_axis] = (freq_shape[real_axis] - 1) * 2;
+    auto out_shape = make_shape(std::span<const int64_t>(out_dims));
+    if (out_shape.is_error()) {
+        return out_shape.error();
     }
 
-    pocketfft::shape_t shape_out = {
-        static_cast<size_t>(num_signals),
-        static_cast<size_t>(num_samples)
-    };
+    const auto type = freq_in.dtype();
+    P10_RETURN_IF_ERROR(signal_out.create(out_shape.unwrap(), type));
     return type.match(
         [&](auto) -> P10Error {
             return P10Error::InvalidArgument << "Unsupported tensor dtype for FFT";
         },
         [&](auto t) -> P10Error {
             using scalar_t = decltype(t)::type;
-            pocketfft::stride_t stride_in = {
-                std::ptrdiff_t(num_ffts * sizeof(std::complex<scalar_t>)),
-                sizeof(std::complex<scalar_t>)
-            };
-
-            pocketfft::stride_t stride_out = {
-                std::ptrdiff_t(num_samples * sizeof(scalar_t)),
-                sizeof(scalar_t)
-            };
-
-            const auto freq_in_s = freq_in.as_span2d<const std::complex<scalar_t>>().unwrap();
-            auto signal_out_s = signal_out.as_span2d<scalar_t>().unwrap();
-
-            pocketfft::c2r<scalar_t>(
-                shape_out,
-                stride_in,
-                stride_out,
-                1,
-                pocketfft::BACKWARD,
-                freq_in_s[0].data(),
-                signal_out_s[0].data(),
-                scalar_t(scalar_factor)
+            const auto* frequency = reinterpret_cast<const Complex<scalar_t>*>(
+                freq_in.as_span1d<const scalar_t>().unwrap().data()
             );
 
+            // The complex axes go first, on a copy of the input.
+            std::vector<Complex<scalar_t>> spectrum;
+            if (axes.size() > 1) {
+                spectrum.assign(frequency, frequency + (freq_in.size() / 2));
+                for (size_t i = 0; i + 1 < axes.size(); ++i) {
+                    const auto lines = axis_lines(freq_shape, axes[i]);
+                    const auto factor = normalize_factor<scalar_t>(normalize_, lines.length);
+                    c2c_axis(spectrum.data(), lines, false, factor);
+                }
+                frequency = spectrum.data();
+            }
+
+            const auto real_lines = axis_lines(out_dims, real_axis);
+            c2r_axis(
+                frequency,
+                signal_out.as_span1d<scalar_t>().unwrap().data(),
+                real_lines,
+                normalize_factor<scalar_t>(normalize_, real_lines.length)
+            );
             return P10Error::Ok;
         }
     );
 }
 
 namespace {
-    P10Result<int64_t> validate_frequency_arguments(const Tensor& frequency) {
-        if (frequency.dims() != 3) {
-            return Err(
-                P10Error::InvalidArgument << "Input tensor must have 3 dimensions [N x F x 2]"
-            );
-        }
+    P10Error transform2d(
+        const Tensor& input,
+        Tensor& output,
+        Fft::Direction direction,
+        Fft::Normalize normalize
+    ) {
+        return Fft(FftOptions(direction, normalize).axes({-2, -1})).transform(input, output);
+    }
+}  // namespace
 
-        if (auto err = check_input_device_and_dtype(frequency); err != P10Error::Ok) {
-            return Err(err);
-        }
+P10Error fft2(const Tensor& input, Tensor& output, Fft::Normalize normalize) {
+    return transform2d(input, output, Fft::Forward, normalize);
+}
 
-        int64_t num_signals = frequency.shape(0).unwrap();
-        if (frequency.shape(2).unwrap() != 2) {
-            return Err(
-                P10Error::InvalidArgument
-                << "Input tensor last dimension must be 2 (real and imaginary)"
-            );
-        }
-        return Ok(std::move(num_signals));
-    }
+P10Error ifft2(const Tensor& input, Tensor& output, Fft::Normalize normalize) {
+    return transform2d(input, output, Fft::Inverse, normalize);
+}
 
-    P10Error check_input_device_and_dtype(const Tensor& tensor) {
-        if (tensor.dtype() != Dtype::Float32) {
-            return P10Error::InvalidArgument << "Input tensor must have Float32 dtype";
-        }
-        if (tensor.device() != Device::Cpu) {
-            return P10Error::InvalidArgument << "Input tensor must be on CPU device";
-        }
+P10Error rfft2(const Tensor& input, Tensor& output, Fft::Normalize normalize) {
+    return transform2d(input, output, Fft::ForwardReal, normalize);
+}
+
+P10Error irfft2(const Tensor& input, Tensor& output, Fft::Normalize normalize) {
+    return transform2d(input, output, Fft::InverseReal, normalize);
+}
 
-        return P10Error::Ok;
-    }
-}  // namespace
 }  // namespace p10::op
@@ -0,0 +1,363 @@
+#include "fft_convolve.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <p10_internal/simd/parallel_for.hpp>
+#include <ptensor/tensor.hpp>
+
+#include "fft.hpp"
+
+namespace p10::op {
+namespace {
+    // Fewest output values a parallel direct-convolution worker is handed.
+    constexpr int64_t CONVOLVE_MIN_WORKER_ELEMENTS = 16 * 1024;
+
+    // Overlap-save FFT sizes aim for this many kernel lengths per axis (the
+    // valid part of a tile is then about 3/4 of it), and at least this many
+    // samples.
+    constexpr int64_t FFT_TILE_KERNELS = 4;
+    constexpr int64_t FFT_MIN_TILE = 32;
+
+    // Tile values transformed per batch of 2D FFTs, bounding the scratch.
+    constexpr int64_t FFT_BATCH_ELEMENTS = 1024 * 1024;
+
+    // Cost of one FFT tile value per log2 of the tile size, in direct
+    // multiply-adds: forward and inverse transforms, the spectrum product,
+    // gather and scatter.
+    constexpr double FFT_COST_PER_LOG = 2.5;
+
+    // One (H, W) plane per channel, and where the output sits in the full
+    // convolution.
+    struct Geometry {
+        int64_t channels;
+        int64_t height;
+        int64_t width;
+        int64_t kernel_height;
+        int64_t kernel_width;
+        int64_t out_height;
+        int64_t out_width;
+        int64_t row0;
+        int64_t col0;
+    };
+
+    P10Result<Geometry>
+    make_geometry(const Tensor& image, const Tensor& kernel, ConvolveMode mode) {
+        if (image.dtype() != Dtype::Float32 && image.dtype() != Dtype::Float64) {
+            return Err(P10Error::InvalidArgument << "Image must be Float32 or Float64");
+        }
+        if (kernel.dtype() != image.dtype()) {
+            return Err(P10Error::InvalidArgument << "Kernel must have the image's dtype");
+        }
+        if (image.device() != Device::Cpu || kernel.device() != Device::Cpu
+            || !image.is_contiguous() || !kernel.is_contiguous()) {
+            return Err(P10Error::InvalidArgument << "Image and kernel must be contiguous on CPU");
+        }
+        if ((image.dims() != 2 && image.dims() != 3) || kernel.dims() != 2) {
+            return Err(
+                P10Error::InvalidArgument << "Image must be [H, W] or [C, H, W], kernel [kh, kw]"
+            );
+        }
+
+        const auto shape = image.shape().as_span();
+        Geometry geometry {
+            .channels = image.dims() == 3 ? shape[0] : 1,
+            .height = shape[shape.size() - 2],
+            .width = shape.back(),
+            .kernel_height = kernel.shape(0).unwrap(),
+            .kernel_width = kernel.shape(1).unwrap(),
+            .out_height = 0,
+            .out_width = 0,
+            .row0 = 0,
+            .col0 = 0,
+        };
+        if (geometry.height == 0 || geometry.width == 0 || kernel.size() == 0) {
+            return Err(P10Error::InvalidArgument << "Image and kernel must not be empty");
+        }
+        switch (mode) {
+            case ConvolveMode::Full:
+                geometry.out_height = geometry.height + geometry.kernel_height - 1;
+                geometry.out_width = geometry.width + geometry.kernel_width - 1;
+                break;
+            case ConvolveMode::Same:
+                geometry.out_height = geometry.height;
+                geometry.out_width = geometry.width;
+                geometry.row0 = (geometry.kernel_height - 1) / 2;
+                geometry.col0 = (geometry.kernel_width - 1) / 2;
+                break;
+            case ConvolveMode::Valid:
+                geometry.out_height = geometry.height - geometry.kernel_height + 1;
+                geometry.out_width = geometry.width - geometry.kernel_width + 1;
+                geometry.row0 = geometry.kernel_height - 1;
+                geometry.col0 = geometry.kernel_width - 1;
+                if (geometry.out_height < 1 || geometry.out_width < 1) {
+                    return Err(
+                        P10Error::InvalidArgument
+                        << "Valid mode needs a kernel no larger than the image"
+                    );
+                }
+                break;
+        }
+        return Ok(std::move(geometry));
+    }
+
+    // FFT length along one axis: a power of two holding FFT_TILE_KERNELS
+    // kernels, or the whole output with its kernel overlap if that is smaller.
+    int64_t fft_length(int64_t kernel, int64_t out) {
+        const int64_t wanted = std::min(
+            out + kernel - 1,
+            std::max(FFT_TILE_KERNELS * kernel, FFT_MIN_TILE)
+        );
+        const auto length = static_cast<uint64_t>(std::max<int64_t>(wanted, 2));
+        return static_cast<int64_t>(std::bit_ceil(length));
+    }
+
+    // Accumulates full[row0 + y][col0 + x] = sum(image[y - i][x - j] *
+    // kernel[i][j]) row by row, the inner loop running along x.
+    template<typename T>
+    void convolve_direct(const T* image, const T* kernel, T* out, const Geometry& g) {
+        const int64_t rows = g.channels * g.out_height;
+        const int threads = simd::parallel_workers(
+            rows * g.out_width * g.kernel_height * g.kernel_width,
+            CONVOLVE_MIN_WORKER_ELEMENTS
+        );
+        simd::parallel_for(threads, threads, [&](int64_t job) {
+            const int64_t begin = (job * rows) / threads;
+            const int64_t end = ((job + 1) * rows) / threads;
+            for (int64_t row = begin; row < end; ++row) {
+                const int64_t channel = row / g.out_height;
+                const int64_t y = g.row0 + (row % g.out_height);
+                T* out_row = out + (row * g.out_width);
+                std::fill_n(out_row, g.out_width, T(0));
+                for (int64_t i = 0; i < g.kernel_height; ++i) {
+                    const int64_t source = y - i;
+                    if (source < 0 || source >= g.height) {
+                        continue;
+                    }
+                    const T* in_row = image + (((channel * g.height) + source) * g.width);
+                    for (int64_t j = 0; j < g.kernel_width; ++j) {
+                        const T weight = kernel[(i * g.kernel_width) + j];
+                        // in_row[col0 + x - j] must lie inside [0, width).
+                        const int64_t x_begin = std::max<int64_t>(0, j - g.col0);
+                        const int64_t x_end = std::min(g.out_width, g.width + j - g.col0);
+                        const int64_t shift = g.col0 - j;
+                        for (int64_t x = x_begin; x < x_end; ++x) {
+                            out_row[x] += weight * in_row[x + shift];
+                        }
+                    }
+                }
+            }
+        });
+    }
+
+    // Overlap-save: each tile reads the image block ending at its last output
+    // and keeps the part of the circular convolution that did not wrap.
+    template<typename T>
+    P10Error convolve_fft(const T* image, const T* kernel, T* out, const Geometry& g) {
+        const int64_t fft_height = fft_length(g.kernel_height, g.out_height);
+        const int64_t fft_width = fft_length(g.kernel_width, g.out_width);
+        const int64_t bins = (fft_width / 2) + 1;
+        const int64_t tile_height = fft_height - g.kernel_height + 1;
+        const int64_t tile_width = fft_width - g.kernel_width + 1;
+        const int64_t tiles_y = (g.out_height + tile_height - 1) / tile_height;
+        const int64_t tiles_x = (g.out_width + tile_width - 1) / tile_width;
+        const int64_t tiles = g.channels * tiles_y * tiles_x;
+        const int64_t tile_size = fft_height * fft_width;
+        const auto dtype = Dtype::from<T>();
+
+        Tensor padded_kernel;
+        P10_RETURN_IF_ERROR(padded_kernel.create(make_shape(fft_height, fft_width), dtype));
+        T* padded = padded_kernel.as_span1d<T>().unwrap().data();
+        std::fill_n(padded, tile_size, T(0));
+        for (int64_t i = 0; i < g.kernel_height; ++i) {
+            std::copy_n(kernel + (i * g.kernel_width), g.kernel_width, padded + (i * fft_width));
+        }
+        Tensor kernel_spectrum;
+        P10_RETURN_IF_ERROR(rfft2(padded_kernel, kernel_spectrum));
+        const T* kernel_bins = kernel_spectrum.as_span1d<const T>().unwrap().data();
+
+        const int64_t batch = std::clamp<int64_t>(FFT_BATCH_ELEMENTS / tile_size, 1, tiles);
+        Tensor blocks;
+        Tensor spectra;
+        for (int64_t first = 0; first < tiles; first += batch) {
+            const int64_t count = std::min(batch, tiles - first);
+            P10_RETURN_IF_ERROR(blocks.create(make_shape(count, fft_height, fft_width), dtype));
+            T* block_data = blocks.as_span1d<T>().unwrap().data();
+            const int threads =
+                simd::parallel_workers(count * tile_size, CONVOLVE_MIN_WORKER_ELEMENTS);
+            // Tile t of the batch as (channel, first output row, first output
+            // column).
+            const auto origin = [&](int64_t t) {
+                const int64_t tile = first + t;
+                return std::array<int64_t, 3> {
+                    tile / (tiles_y * tiles_x),
+                    ((tile / tiles_x) % tiles_y) * tile_height,
+                    (tile % tiles_x) * tile_width,
+                };
+            };
+
+            // Gather each tile's image block, zero outside the image.
+            simd::parallel_for(threads, threads, [&](int64_t job) {
+                for (int64_t t = (job * count) / threads; t < ((job + 1) * count) / threads; ++t) {
+                    const auto [channel, y0, x0] = origin(t);
+                    const int64_t top = g.row0 + y0 - g.kernel_height + 1;
+                    const int64_t left = g.col0 + x0 - g.kernel_width + 1;
+                    T* block = block_data + (t * tile_size);
+                    std::fill_n(block, tile_size, T(0));
+                    const int64_t x_begin = std::max<int64_t>(0, -left);
+                    const int64_t x_end = std::min(fft_width, g.width - left);
+                    for (int64_t a = 0; a < fft_height; ++a) {
+                        const int64_t source = top + a;
+                        if (source < 0 || source >= g.height || x_begin >= x_end) {
+                            continue;
+                        }
+                        const T* in_row = image + (((channel * g.height) + source) * g.width);
+                        std::copy(
+                            in_row + (left + x_begin),
+                            in_row + (left + x_end),
+                            block + (a * fft_width) + x_begin
+                        );
+                    }
+                }
+            });
+
+            P10_RETURN_IF_ERROR(rfft2(blocks, spectra));
+            T* spectrum_data = spectra.as_span1d<T>().unwrap().data();
+            const int64_t spectrum_size = fft_height * bins * 2;
+            simd::parallel_for(threads, threads, [&](int64_t job) {
+                for (int64_t t = (job * count) / threads; t < ((job + 1) * count) / threads; ++t) {
+                    T* values = spectrum_data + (t * spectrum_size);
+                    for (int64_t k = 0; k < spectrum_size; k += 2) {
+                        const T re = values[k];
+                        const T im = values[k + 1];
+                        values[k] = (re * kernel_bins[k]) - (im * kernel_bins[k + 1]);
+                        values[k + 1] = (re * kernel_bins[k + 1]) + (im * kernel_bins[k]);
+                    }
+                }
+            });
+            P10_RETURN_IF_ERROR(irfft2(spectra, blocks));
+            block_data = blocks.as_span1d<T>().unwrap().data();
+
+            // Scatter the unwrapped part of each tile.
+            simd::parallel_for(threads, threads, [&](int64_t job) {
+                for (int64_t t = (job * count) / threads; t < ((job + 1) * count) / threads; ++t) {
+                    const auto [channel, y0, x0] = origin(t);
+                    const int64_t height = std::min(tile_height, g.out_height - y0);
+                    const int64_t width = std::min(tile_width, g.out_width - x0);
+                    const T* block = block_data + (t * tile_size);
+                    for (int64_t dy = 0; dy < height; ++dy) {
+                        const int64_t from = ((g.kernel_height - 1 + dy) * fft_width)
+                            + g.kernel_width - 1;
+                        const int64_t to =
+                            (((channel * g.out_height) + y0 + dy) * g.out_width) + x0;
+                        std::copy_n(block + from, width, out + to);
+                    }
+                }
+            });
+        }
+        return P10Error::Ok;
+    }
+
+    bool prefer_fft(const Geometry& g) {
+        const double direct = static_cast<double>(g.channels * g.out_height * g.out_width)
+            * static_cast<double>(g.kernel_height * g.kernel_width);
+        const int64_t fft_height = fft_length(g.kernel_height, g.out_height);
+        const int64_t fft_width = fft_length(g.kernel_width, g.out_width);
+        const int64_t tile_height = fft_height - g.kernel_height + 1;
+        const int64_t tile_width = fft_width - g.kernel_width + 1;
+        const auto tiles = static_cast<double>(
+            g.channels * ((g.out_height + tile_height - 1) / tile_height)
+            * ((g.out_width + tile_width - 1) / tile_width)
+        );
+        const auto tile_size = static_cast<double>(fft_height * fft_width);
+        return tiles * tile_size * std::log2(tile_size) * FFT_COST_PER_LOG < direct;
+    }
+
+    P10Error convolve(
+        const Tensor& image,
+        const Tensor& kernel,
+        Tensor& output,
+        const ConvolveOptions& options,
+        bool flip
+    ) {
+        auto geometry_result = make_geometry(image, kernel, options.mode());
+        if (geometry_result.is_error()) {
+            return geometry_result.error();
+        }
+        const Geometry geometry = geometry_result.unwrap();
+
+        // `output` may be `image` or `kernel` itself. create() then reuses or
+        // replaces that buffer while both methods still read it, so read from
+        // copies instead.
+        const auto aliases = [&](const Tensor& input) {
+            return input.as_bytes().data() == output.as_bytes().data();
+        };
+        Tensor image_copy;
+        Tensor kernel_copy;
+        const Tensor* source = &image;
+        const Tensor* taps_source = &kernel;
+        if (aliases(image)) {
+            P10_RETURN_IF_ERROR(image_copy.create(image.shape(), image.dtype()));
+            P10_RETURN_IF_ERROR(image_copy.copy_from(image));
+            source = &image_copy;
+        }
+        if (aliases(kernel)) {
+            P10_RETURN_IF_ERROR(kernel_copy.create(kernel.shape(), kernel.dtype()));
+            P10_RETURN_IF_ERROR(kernel_copy.copy_from(kernel));
+            taps_source = &kernel_copy;
+        }
+
+        const auto out_shape = image.dims() == 3
+            ? make_shape(geometry.channels, geometry.out_height, geometry.out_width)
+            : make_shape(geometry.out_height, geometry.out_width);
+        P10_RETURN_IF_ERROR(output.create(out_shape, image.dtype()));
+
+        const bool use_fft = options.method() == ConvolveMethod::Fft
+            || (options.method() == ConvolveMethod::Auto && prefer_fft(geometry));
+        return image.dtype().match(
+            [&](auto) -> P10Error {
+                return P10Error::InvalidArgument << "Unsupported dtype for convolution";
+            },
+            [&](auto t) -> P10Error {
+                using scalar_t = decltype(t)::type;
+                const auto* image_data = source->as_span1d<const scalar_t>().unwrap().data();
+                const auto taps = taps_source->as_span1d<const scalar_t>().unwrap();
+                std::vector<scalar_t> flipped;
+                if (flip) {
+                    flipped.assign(taps.rbegin(), taps.rend());
+                }
+                const scalar_t* kernel_data = flip ? flipped.data() : taps.data();
+                scalar_t* out = output.as_span1d<scalar_t>().unwrap().data();
+                if (use_fft) {
+                    return convolve_fft(image_data, kernel_data, out, geometry);
+                }
+                convolve_direct(image_data, kernel_data, out, geometry);
+                return P10Error::Ok;
+            }
+        );
+    }
+}  // namespace
+
+P10Error fft_convolve2d(
+    const Tensor& image,
+    const Tensor& kernel,
+    Tensor& output,
+    const ConvolveOptions& options
+) {
+    return convolve(image, kernel, output, options, false);
+}
+
+P10Error fft_correlate2d(
+    const Tensor& image,
+    const Tensor& kernel,
+    Tensor& output,
+    const ConvolveOptions& options
+) {
+    return convolve(image, kernel, output, options, true);
+}
+
+}  // namespace p10::op
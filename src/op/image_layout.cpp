@@ -1,10 +1,146 @@
 #include <algorithm>
+#include <cstdint>
+#include <vector>
 
+#include <p10_internal/simd/parallel_for.hpp>
+#include <p10_internal/simd/vec.hpp>
 #include <ptensor/op/image_layout.hpp>
 #include <ptensor/tensor.hpp>
 
+#include "image_layout.lines.hpp"
+
 namespace p10::op {
 
+namespace {
+    // Fewest values a parallel conversion worker is handed; smaller images
+    // run on the calling thread.
+    constexpr int64_t LAYOUT_MIN_WORKER_VALUES = 64 * 1024;
+
+    // One channel row of floats to bytes: x * std + mean when `affine`, then
+    // x * 255 when normalising, clamped to [0, 255] and truncated.
+    template<simd::SimdSet S>
+    void float_to_bytes(
+        const float* src,
+        int64_t count,
+        bool normalize,
+        bool affine,
+        float mean,
+        float std,
+        uint8_t* dst
+    ) {
+        using VF = simd::NativeVec<float, S>;
+        constexpr auto LANES = static_cast<int64_t>(VF::LANES);
+        int64_t x = 0;
+        for (; x + LANES <= count; x += LANES) {
+            VF value = VF::load(src + x);
+            if (affine) {
+                value = simd::fma(value, VF::broadcast(std), VF::broadcast(mean));
+            }
+            if (normalize) {
+                value = value * VF::broadcast(255.0f);
+            }
+            value = simd::min(simd::max(value, VF::zero()), VF::broadcast(255.0f));
+            simd::convert<int32_t>(value).store_u8(dst + x);
+        }
+        for (; x < count; ++x) {
+            float value = src[x];
+            if (affine) {
+                value = (value * std) + mean;
+            }
+            if (normalize) {
+                value = value * 255.0f;
+            }
+            dst[x] = static_cast<uint8_t>(std::clamp(value, 0.0f, 255.0f));
+        }
+    }
+
+    // Splits rows [begin, end) across the workers, `fn(begin, end)` each.
+    template<typename Fn>
+    void parallel_rows(int64_t rows, int64_t values_per_row, const Fn& fn) {
+        const int threads =
+            simd::parallel_workers(rows * values_per_row, LAYOUT_MIN_WORKER_VALUES);
+        simd::parallel_for(threads, threads, [&](int64_t job) {
+            fn((job * rows) / threads, ((job + 1) * rows) / threads);
+        });
+    }
+
+    void image_to_float32(
+        const uint8_t* image,
+        int64_t height,
+        int64_t width,
+        int64_t channels,
+        bool normalize,
+        const ChannelAffine& affine,
+        float* out
+    ) {
+        parallel_rows(height, width * channels, [&](int64_t begin, int64_t end) {
+            std::vector<uint8_t> split(static_cast<size_t>(width * channels));
+            std::vector<uint8_t*> planes(static_cast<size_t>(channels));
+            for (int64_t c = 0; c < channels; ++c) {
+                planes[c] = split.data() + (c * width);
+            }
+            simd::call_in_best_tier([&](auto tier) {
+                constexpr auto S = decltype(tier)::value;
+                for (int64_t row = begin; row < end; ++row) {
+                    const uint8_t* pixels = image + (row * width * channels);
+                    if (channels > 1) {
+                        deinterleave_row(pixels, width, channels, planes.data());
+                    }
+                    for (int64_t c = 0; c < channels; ++c) {
+                        bytes_to_float<S>(
+                            channels > 1 ? planes[c] : pixels,
+                            width,
+                            normalize,
+                            affine.enabled,
+                            affine.mean[c],
+                            affine.std[c],
+                            out + (((c * height) + row) * width)
+                        );
+                    }
+                }
+            });
+        });
+    }
+
+    void float32_to_image(
+        const float* tensor,
+        int64_t height,
+        int64_t width,
+        int64_t channels,
+        bool normalize,
+        const ChannelAffine& affine,
+        uint8_t* image
+    ) {
+        parallel_rows(height, width * channels, [&](int64_t begin, int64_t end) {
+            std::vector<uint8_t> split(static_cast<size_t>(width * channels));
+            std::vector<const uint8_t*> planes(static_cast<size_t>(channels));
+            for (int64_t c = 0; c < channels; ++c) {
+                planes[c] = split.data() + (c * width);
+            }
+            simd::call_in_best_tier([&](auto tier) {
+                constexpr auto S = decltype(tier)::value;
+                for (int64_t row = begin; row < end; ++row) {
+                    uint8_t* pixels = image + (row * width * channels);
+                    for (int64_t c = 0; c < channels; ++c) {
+                        float_to_bytes<S>(
+                            tensor + (((c * height) + row) * width),
+                            width,
+                            normalize,
+                            affine.enabled,
+                            affine.mean[c],
+                            affine.std[c],
+                            channels > 1 ? split.data() + (c * width) : pixels
+                        );
+                    }
+                    if (channels > 1) {
+                        interleave_row(planes.data(), width, channels, pixels);
+                    }
+                }
+            });
+        });
+    }
+}  // namespace
+
 P10Error
 image_to_tensor(const Tensor& image, Tensor& out_tensor, const ImageToTensorOptions& options) {
     if (image.dtype() != Dtype::Uint8) {
@@ -27,6 +163,15 @@ image_to_tensor(const Tensor& image, Tensor& out_tensor, const ImageToTensorOpti
     const Dtype out_dtype = options.target_dtype().value_or(Dtype::Float32);
     const bool do_normalize = options.normalize();
 
+    ChannelAffine affine;
+    P10_RETURN_IF_ERROR(channel_affine(options.mean(), options.std(), num_channels, affine));
+    if (affine.enabled && !out_dtype.is_floating()) {
+        return P10Error::InvalidArgument << "Mean and std need a floating-point target.";
+    }
+    if (std::ranges::find(affine.std, 0.0f) != affine.std.end()) {
+        return P10Error::InvalidArgument << "Std entries must be non-zero.";
+    }
+
     out_tensor.create(
         make_shape(
             static_cast<int64_t>(num_channels),
@@ -36,32 +181,48 @@ image_to_tensor(const Tensor& image, Tensor& out_tensor, const ImageToTensorOpti
         out_dtype
     );
 
-    out_dtype.match(
-        [&](auto int_id) {
-            using T = decltype(int_id)::type;
-            auto out_span = out_tensor.as_span3d<T>().unwrap();
-            for (size_t row = 0; row < height; row++) {
-                for (size_t col = 0; col < width; col++) {
-                    const auto& ch = image_span[row][col];
-                    for (size_t c = 0; c < num_channels; c++) {
-                        out_span[c][row][col] = static_cast<T>(ch[c]);
+    if (out_dtype == Dtype::Float32) {
+        image_to_float32(
+            image.as_span1d<const uint8_t>().unwrap().data(),
+            static_cast<int64_t>(height),
+            static_cast<int64_t>(width),
+            static_cast<int64_t>(num_channels),
+            do_normalize,
+            affine,
+            out_tensor.as_span1d<float>().unwrap().data()
+        );
+    } else {
+        out_dtype.match(
+            [&](auto int_id) {
+                using T = decltype(int_id)::type;
+                auto out_span = out_tensor.as_span3d<T>().unwrap();
+                for (size_t row = 0; row < height; row++) {
+                    for (size_t col = 0; col < width; col++) {
+                        const auto& ch = image_span[row][col];
+                        for (size_t c = 0; c < num_channels; c++) {
+                            out_span[c][row][col] = static_cast<T>(ch[c]);
+                        }
                     }
                 }
-            }
-        },
-        [&](auto float_id) {
-            using T = decltype(float_id)::type;
-            auto out_span = out_tensor.as_span3d<T>().unwrap();
-            for (size_t row = 0; row < height; row++) {
-                for (size_t col = 0; col < width; col++) {
-                    const auto& ch = image_span[row][col];
-                    for (size_t c = 0; c < num_channels; c++) {
-                        out_span[c][row][col] = do_normalize ? T(ch[c]) / T(255) : T(ch[c]);
+            },
+            [&](auto float_id) {
+                using T = decltype(float_id)::type;
+                auto out_span = out_tensor.as_span3d<T>().unwrap();
+                for (size_t row = 0; row < height; row++) {
+                    for (size_t col = 0; col < width; col++) {
+                        const auto& ch = image_span[row][col];
+                        for (size_t c = 0; c < num_channels; c++) {
+                            T value = do_normalize ? T(ch[c]) / T(255) : T(ch[c]);
+                            if (affine.enabled) {
+                                value = (value - T(affine.mean[c])) / T(affine.std[c]);
+                            }
+                            out_span[c][row][col] = value;
+                        }
                     }
                 }
             }
-        }
-    );
+        );
+    }
 
     if (options.unsqueeze()) {
         out_tensor.reshape(make_shape(
@@ -103,6 +264,9 @@ P10Error image_from_tensor(
     const Dtype out_dtype = options.target_dtype().value_or(Dtype::Uint8);
     const bool do_normalize = options.normalize();
 
+    ChannelAffine affine;
+    P10_RETURN_IF_ERROR(channel_affine(options.mean(), options.std(), num_channels, affine));
+
     out_image_tensor.create(
         make_shape(
             static_cast<int64_t>(height),
@@ -112,6 +276,19 @@ P10Error image_from_tensor(
         out_dtype
     );
 
+    if (tensor.dtype() == Dtype::Float32 && out_dtype == Dtype::Uint8) {
+        float32_to_image(
+            reinterpret_cast<const float*>(tensor.as_bytes().data()),
+            static_cast<int64_t>(height),
+            static_cast<int64_t>(width),
+            static_cast<int64_t>(num_channels),
+            do_normalize,
+            affine,
+            out_image_tensor.as_span1d<uint8_t>().unwrap().data()
+        );
+        return P10Error::Ok;
+    }
+
     tensor.dtype().match(
         // The dtype check above guarantees this branch is never taken; it
         // exists only to satisfy Dtype::match's signature.
@@ -122,6 +299,13 @@ P10Error image_from_tensor(
             // share the same planar memory layout.
             const auto* in_data = reinterpret_cast<const Fin*>(tensor.as_bytes().data());
             const size_t plane_size = height * width;
+            const auto read = [&](size_t c, size_t row, size_t col) {
+                const Fin value = in_data[(c * plane_size) + (row * width) + col];
+                if (!affine.enabled) {
+                    return value;
+                }
+                return (value * Fin(affine.std[c])) + Fin(affine.mean[c]);
+            };
             out_dtype.match(
                 [&](auto int_out_id) {
                     using Tout = decltype(int_out_id)::type;
@@ -130,7 +314,7 @@ P10Error image_from_tensor(
                         for (size_t col = 0; col < width; col++) {
                             auto out_ch = out_span[row][col];
                             for (size_t c = 0; c < num_channels; c++) {
-                                const Fin in_val = in_data[(c * plane_size) + (row * width) + col];
+                                const Fin in_val = read(c, row, col);
                                 const Fin val = do_normalize ? in_val * Fin {255} : in_val;
                                 out_ch[c] = static_cast<Tout>(std::clamp(val, Fin {0}, Fin {255}));
                             }
@@ -144,9 +328,7 @@ P10Error image_from_tensor(
                         for (size_t col = 0; col < width; col++) {
                             auto out_ch = out_span[row][col];
                             for (size_t c = 0; c < num_channels; c++) {
-                                out_ch[c] = static_cast<Tout>(
-                                    in_data[(c * plane_size) + (row * width) + col]
-                                );
+                                out_ch[c] = static_cast<Tout>(read(c, row, col));
                             }
                         }
                     }
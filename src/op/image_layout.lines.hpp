@@ -0,0 +1,322 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <p10_internal/simd/compiler.hpp>
+#include <p10_internal/simd/cpuid.hpp>
+#include <p10_internal/simd/vec.hpp>
+#include <ptensor/p10_error.hpp>
+
+#if PTENSOR_HAS_INTRINSICS_H
+    #include <immintrin.h>  // SSE4.1 intrinsics
+#endif
+#if PTENSOR_HAS_NEON
+    #include <arm_neon.h>
+#endif
+
+namespace p10::op {
+
+// Pixels the shuffle kernels move per step: one 16-byte register per
+// channel.
+inline constexpr int64_t LAYOUT_SHUFFLE_PIXELS = 16;
+
+// Per-channel `(x - mean) / std` as the conversions read it: an empty
+// option means 0 and 1 for every channel.
+struct ChannelAffine {
+    std::vector<float> mean;
+    std::vector<float> std;
+    bool enabled = false;
+};
+
+inline P10Error channel_affine(
+    const std::vector<float>& mean,
+    const std::vector<float>& std,
+    size_t channels,
+    ChannelAffine& affine
+) {
+    const auto fits = [&](const std::vector<float>& values) {
+        return values.empty() || values.size() == channels;
+    };
+    if (!fits(mean) || !fits(std)) {
+        return P10Error::InvalidArgument << "Mean and std must have one entry per channel.";
+    }
+    affine.enabled = !mean.empty() || !std.empty();
+    affine.mean = mean.empty() ? std::vector<float>(channels, 0.0f) : mean;
+    affine.std = std.empty() ? std::vector<float>(channels, 1.0f) : std;
+    return P10Error::Ok;
+}
+
+// pshufb controls that split CHANNELS registers of interleaved pixels
+// into one register per channel: MASKS[c][r] moves the bytes of channel
+// c found in register r to their pixel's lane and zeroes the others, so
+// OR-ing the shuffles of every register gives the whole channel.
+template<int64_t CHANNELS>
+constexpr auto deinterleave_masks() {
+    std::array<std::array<std::array<uint8_t, 16>, CHANNELS>, CHANNELS> masks {};
+    for (auto& channel : masks) {
+        for (auto& reg : channel) {
+            reg.fill(0x80);
+        }
+    }
+    for (int64_t c = 0; c < CHANNELS; ++c) {
+        for (int64_t pixel = 0; pixel < LAYOUT_SHUFFLE_PIXELS; ++pixel) {
+            const int64_t byte = (pixel * CHANNELS) + c;
+            masks[c][byte / 16][pixel] = static_cast<uint8_t>(byte % 16);
+        }
+    }
+    return masks;
+}
+
+// The inverse: MASKS[r][c] places the bytes of channel register c that
+// belong in output register r.
+template<int64_t CHANNELS>
+constexpr auto interleave_masks() {
+    std::array<std::array<std::array<uint8_t, 16>, CHANNELS>, CHANNELS> masks {};
+    for (auto& reg : masks) {
+        for (auto& channel : reg) {
+            channel.fill(0x80);
+        }
+    }
+    for (int64_t byte = 0; byte < LAYOUT_SHUFFLE_PIXELS * CHANNELS; ++byte) {
+        masks[byte / 16][byte % CHANNELS][byte % 16] = static_cast<uint8_t>(byte / CHANNELS);
+    }
+    return masks;
+}
+
+#if PTENSOR_HAS_INTRINSICS_H
+// pshufb stays inside 128-bit lanes, and 3-byte pixels straddle them,
+// so the AVX2 tier runs these 128-bit kernels as well. CHANNELS is 2, 3
+// or 4.
+template<int64_t CHANNELS>
+PTENSOR_SSE41 inline int64_t
+deinterleave_sse41(const uint8_t* src, int64_t count, uint8_t* const* planes) {
+    static constexpr auto MASKS = deinterleave_masks<CHANNELS>();
+    int64_t x = 0;
+    for (; x + LAYOUT_SHUFFLE_PIXELS <= count; x += LAYOUT_SHUFFLE_PIXELS) {
+        __m128i pixels[CHANNELS];
+        for (int64_t r = 0; r < CHANNELS; ++r) {
+            pixels[r] = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(src + (x * CHANNELS) + (r * 16))
+            );
+        }
+        for (int64_t c = 0; c < CHANNELS; ++c) {
+            __m128i channel = _mm_setzero_si128();
+            for (int64_t r = 0; r < CHANNELS; ++r) {
+                const __m128i mask =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(MASKS[c][r].data()));
+                channel = _mm_or_si128(channel, _mm_shuffle_epi8(pixels[r], mask));
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(planes[c] + x), channel);
+        }
+    }
+    return x;
+}
+
+template<int64_t CHANNELS>
+PTENSOR_SSE41 inline int64_t
+interleave_sse41(const uint8_t* const* planes, int64_t count, uint8_t* dst) {
+    static constexpr auto MASKS = interleave_masks<CHANNELS>();
+    int64_t x = 0;
+    for (; x + LAYOUT_SHUFFLE_PIXELS <= count; x += LAYOUT_SHUFFLE_PIXELS) {
+        __m128i channels[CHANNELS];
+        for (int64_t c = 0; c < CHANNELS; ++c) {
+            channels[c] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[c] + x));
+        }
+        for (int64_t r = 0; r < CHANNELS; ++r) {
+            __m128i pixels = _mm_setzero_si128();
+            for (int64_t c = 0; c < CHANNELS; ++c) {
+                const __m128i mask =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(MASKS[r][c].data()));
+                pixels = _mm_or_si128(pixels, _mm_shuffle_epi8(channels[c], mask));
+            }
+            _mm_storeu_si128(
+                reinterpret_cast<__m128i*>(dst + (x * CHANNELS) + (r * 16)),
+                pixels
+            );
+        }
+    }
+    return x;
+}
+#endif
+
+#if PTENSOR_HAS_NEON
+// NEON splits and joins interleaved bytes in its structure loads and
+// stores.
+template<int64_t CHANNELS>
+inline int64_t deinterleave_neon(const uint8_t* src, int64_t count, uint8_t* const* planes) {
+    int64_t x = 0;
+    for (; x + LAYOUT_SHUFFLE_PIXELS <= count; x += LAYOUT_SHUFFLE_PIXELS) {
+        if constexpr (CHANNELS == 2) {
+            const uint8x16x2_t pixels = vld2q_u8(src + (x * 2));
+            for (int64_t c = 0; c < 2; ++c) {
+                vst1q_u8(planes[c] + x, pixels.val[c]);
+            }
+        } else if constexpr (CHANNELS == 3) {
+            const uint8x16x3_t pixels = vld3q_u8(src + (x * 3));
+            for (int64_t c = 0; c < 3; ++c) {
+                vst1q_u8(planes[c] + x, pixels.val[c]);
+            }
+        } else {
+            const uint8x16x4_t pixels = vld4q_u8(src + (x * 4));
+            for (int64_t c = 0; c < 4; ++c) {
+                vst1q_u8(planes[c] + x, pixels.val[c]);
+            }
+        }
+    }
+    return x;
+}
+
+template<int64_t CHANNELS>
+inline int64_t interleave_neon(const uint8_t* const* planes, int64_t count, uint8_t* dst) {
+    int64_t x = 0;
+    for (; x + LAYOUT_SHUFFLE_PIXELS <= count; x += LAYOUT_SHUFFLE_PIXELS) {
+        if constexpr (CHANNELS == 2) {
+            uint8x16x2_t pixels;
+            for (int64_t c = 0; c < 2; ++c) {
+                pixels.val[c] = vld1q_u8(planes[c] + x);
+            }
+            vst2q_u8(dst + (x * 2), pixels);
+        } else if constexpr (CHANNELS == 3) {
+            uint8x16x3_t pixels;
+            for (int64_t c = 0; c < 3; ++c) {
+                pixels.val[c] = vld1q_u8(planes[c] + x);
+            }
+            vst3q_u8(dst + (x * 3), pixels);
+        } else {
+            uint8x16x4_t pixels;
+            for (int64_t c = 0; c < 4; ++c) {
+                pixels.val[c] = vld1q_u8(planes[c] + x);
+            }
+            vst4q_u8(dst + (x * 4), pixels);
+        }
+    }
+    return x;
+}
+#endif
+
+// Leading pixels of a row a shuffle kernel of the best tier split, 0 when
+// none applies to `channels`.
+template<int64_t CHANNELS>
+inline int64_t deinterleave_shuffle(const uint8_t* src, int64_t count, uint8_t* const* planes) {
+#if PTENSOR_HAS_INTRINSICS_H
+    if (simd::is_supported(simd::SimdSet::SSE41)) {
+        return deinterleave_sse41<CHANNELS>(src, count, planes);
+    }
+#endif
+#if PTENSOR_HAS_NEON
+    if (simd::is_supported(simd::SimdSet::AdvSIMD)) {
+        return deinterleave_neon<CHANNELS>(src, count, planes);
+    }
+#endif
+    return 0;
+}
+
+template<int64_t CHANNELS>
+inline int64_t interleave_shuffle(const uint8_t* const* planes, int64_t count, uint8_t* dst) {
+#if PTENSOR_HAS_INTRINSICS_H
+    if (simd::is_supported(simd::SimdSet::SSE41)) {
+        return interleave_sse41<CHANNELS>(planes, count, dst);
+    }
+#endif
+#if PTENSOR_HAS_NEON
+    if (simd::is_supported(simd::SimdSet::AdvSIMD)) {
+        return interleave_neon<CHANNELS>(planes, count, dst);
+    }
+#endif
+    return 0;
+}
+
+// Splits a row of `count` interleaved pixels into one byte row per channel.
+inline void deinterleave_row(
+    const uint8_t* src,
+    int64_t count,
+    int64_t channels,
+    uint8_t* const* planes
+) {
+    if (channels == 1) {
+        std::copy_n(src, count, planes[0]);
+        return;
+    }
+    int64_t x = 0;
+    if (channels == 2) {
+        x = deinterleave_shuffle<2>(src, count, planes);
+    } else if (channels == 3) {
+        x = deinterleave_shuffle<3>(src, count, planes);
+    } else if (channels == 4) {
+        x = deinterleave_shuffle<4>(src, count, planes);
+    }
+    for (; x < count; ++x) {
+        for (int64_t c = 0; c < channels; ++c) {
+            planes[c][x] = src[(x * channels) + c];
+        }
+    }
+}
+
+inline void interleave_row(
+    const uint8_t* const* planes,
+    int64_t count,
+    int64_t channels,
+    uint8_t* dst
+) {
+    if (channels == 1) {
+        std::copy_n(planes[0], count, dst);
+        return;
+    }
+    int64_t x = 0;
+    if (channels == 2) {
+        x = interleave_shuffle<2>(planes, count, dst);
+    } else if (channels == 3) {
+        x = interleave_shuffle<3>(planes, count, dst);
+    } else if (channels == 4) {
+        x = interleave_shuffle<4>(planes, count, dst);
+    }
+    for (; x < count; ++x) {
+        for (int64_t c = 0; c < channels; ++c) {
+            dst[(x * channels) + c] = planes[c][x];
+        }
+    }
+}
+
+// One channel row of bytes to float: x / 255 when normalising, then
+// (x - mean) / std when `affine`. Divides rather than multiplying by the
+// reciprocal, so the values match the scalar conversion exactly.
+template<simd::SimdSet S>
+inline void bytes_to_float(
+    const uint8_t* src,
+    int64_t count,
+    bool normalize,
+    bool affine,
+    float mean,
+    float std,
+    float* dst
+) {
+    using VI = simd::NativeVec<int32_t, S>;
+    using VF = simd::NativeVec<float, S>;
+    constexpr auto LANES = static_cast<int64_t>(VF::LANES);
+    int64_t x = 0;
+    for (; x + LANES <= count; x += LANES) {
+        VF value = simd::convert<float>(VI::load_u8(src + x));
+        if (normalize) {
+            value = value / VF::broadcast(255.0f);
+        }
+        if (affine) {
+            value = (value - VF::broadcast(mean)) / VF::broadcast(std);
+        }
+        value.store(dst + x);
+    }
+    for (; x < count; ++x) {
+        float value = static_cast<float>(src[x]);
+        if (normalize) {
+            value = value / 255.0f;
+        }
+        if (affine) {
+            value = (value - mean) / std;
+        }
+        dst[x] = value;
+    }
+}
+
+}  // namespace p10::op
@@ -0,0 +1,390 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <p10_internal/simd/compiler.hpp>
+#include <p10_internal/simd/cpuid.hpp>
+#include <p10_internal/simd/parallel_for.hpp>
+#include <ptensor/dtype.hpp>
+#include <ptensor/span3d.hpp>
+#include <ptensor/tensor.hpp>
+
+#include "resize.hpp"
+#include "resize.lines.hpp"
+
+#if PTENSOR_HAS_INTRINSICS_H
+    #include <immintrin.h>  // SSE4.1 intrinsics
+#endif
+#if PTENSOR_HAS_NEON
+    #include <arm_neon.h>
+#endif
+
+namespace p10::op {
+
+// Tables for one input shape. Nearest sampling reads `src_rows` and
+// `src_offsets`, the first value of each output pixel's source pixel within
+// its row; the interpolating modes read `rows_axis` and the interleaved
+// `cols_axis`.
+struct ImageResize::Plan {
+    int64_t height = 0;
+    int64_t width = 0;
+    int64_t channels = 0;
+
+    std::vector<int32_t> src_rows;
+    std::vector<int32_t> src_offsets;
+    // Leading output columns, a multiple of 4, that the uint8 shuffle kernels
+    // write: every 32-bit source load and 16-byte store stays inside its row.
+    int64_t shuffle_cols = 0;
+
+    ResampleAxis rows_axis;
+    ResampleAxis cols_axis;
+};
+
+namespace {
+    // Source index of every output index along one axis, the mapping of the
+    // planar nearest resize: truncate `o * scale`, clamped to the source.
+    std::vector<int32_t> nearest_indices(int64_t src_size, int64_t dst_size) {
+        const float scale = static_cast<float>(src_size) / static_cast<float>(dst_size);
+        std::vector<int32_t> indices(static_cast<size_t>(dst_size));
+        for (int64_t o = 0; o < dst_size; ++o) {
+            indices[o] = static_cast<int32_t>(
+                std::min(static_cast<int64_t>(static_cast<float>(o) * scale), src_size - 1)
+            );
+        }
+        return indices;
+    }
+
+    // Output columns [0, n) the shuffle kernels may take, n a multiple of 4.
+    // With 3 channels each 32-bit load reads one byte past its pixel, so the
+    // last source column is excluded, and each 16-byte store writes 4 bytes
+    // past its 4 pixels, which must stay inside the output row.
+    int64_t shuffle_columns(const std::vector<int32_t>& src_cols, int64_t width, int64_t channels) {
+        if (channels != 3 && channels != 4) {
+            return 0;
+        }
+        const auto new_width = static_cast<int64_t>(src_cols.size());
+        int64_t cols = channels == 3 ? new_width - 2 : new_width;
+        if (channels == 3) {
+            const auto last = std::ranges::find(src_cols, static_cast<int32_t>(width - 1));
+            cols = std::min(cols, static_cast<int64_t>(last - src_cols.begin()));
+        }
+        return std::max<int64_t>(cols, 0) / 4 * 4;
+    }
+
+    // Copies output columns [begin, end) of one row, a pixel of CHANNELS
+    // values at a time (`channels` when CHANNELS is 0).
+    template<typename scalar_t, int64_t CHANNELS>
+    void nearest_pixels(
+        const scalar_t* src,
+        const int32_t* offsets,
+        scalar_t* dst,
+        int64_t begin,
+        int64_t end,
+        int64_t channels
+    ) {
+        const int64_t count = CHANNELS > 0 ? CHANNELS : channels;
+        for (int64_t x = begin; x < end; ++x) {
+            std::memcpy(dst + (x * count), src + offsets[x], sizeof(scalar_t) * count);
+        }
+    }
+
+    int32_t load_pixel_bytes(const uint8_t* src) {
+        int32_t bytes = 0;
+        std::memcpy(&bytes, src, sizeof(bytes));
+        return bytes;
+    }
+
+    // uint8 output bytes 0-2, 4-6, 8-10 and 12-14 of four 4-byte loads: four
+    // packed 3-channel pixels, then four zero bytes.
+    constexpr std::array<uint8_t, 16> COMPACT_RGB {
+        0,
+        1,
+        2,
+        4,
+        5,
+        6,
+        8,
+        9,
+        10,
+        12,
+        13,
+        14,
+        0x80,
+        0x80,
+        0x80,
+        0x80
+    };
+
+#if PTENSOR_HAS_INTRINSICS_H
+    // Four output pixels per register: one 32-bit load per source pixel, and
+    // for 3 channels a byte shuffle that drops every fourth byte. The store
+    // of 16 bytes runs 4 bytes past the 12 pixel bytes; the next step writes
+    // over them.
+    template<int64_t CHANNELS>
+    PTENSOR_SSE41 void
+    nearest_shuffle_sse41(const uint8_t* src, const int32_t* offsets, uint8_t* dst, int64_t cols) {
+        const __m128i compact =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(COMPACT_RGB.data()));
+        for (int64_t x = 0; x < cols; x += 4) {
+            __m128i pixels = _mm_setr_epi32(
+                load_pixel_bytes(src + offsets[x]),
+                load_pixel_bytes(src + offsets[x + 1]),
+                load_pixel_bytes(src + offsets[x + 2]),
+                load_pixel_bytes(src + offsets[x + 3])
+            );
+            if constexpr (CHANNELS == 3) {
+                pixels = _mm_shuffle_epi8(pixels, compact);
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (x * CHANNELS)), pixels);
+        }
+    }
+#endif
+
+#if PTENSOR_HAS_NEON
+    // NEON spelling of nearest_shuffle_sse41; tbl zeroes the out-of-range
+    // 0x80 lanes as pshufb does.
+    template<int64_t CHANNELS>
+    void nearest_shuffle_neon(
+        const uint8_t* src,
+        const int32_t* offsets,
+        uint8_t* dst,
+        int64_t cols
+    ) {
+        const uint8x16_t compact = vld1q_u8(COMPACT_RGB.data());
+        for (int64_t x = 0; x < cols; x += 4) {
+            const std::array<int32_t, 4> lanes {
+                load_pixel_bytes(src + offsets[x]),
+                load_pixel_bytes(src + offsets[x + 1]),
+                load_pixel_bytes(src + offsets[x + 2]),
+                load_pixel_bytes(src + offsets[x + 3])
+            };
+            uint8x16_t pixels = vreinterpretq_u8_s32(vld1q_s32(lanes.data()));
+            if constexpr (CHANNELS == 3) {
+                pixels = vqtbl1q_u8(pixels, compact);
+            }
+            vst1q_u8(dst + (x * CHANNELS), pixels);
+        }
+    }
+#endif
+
+    // Writes the leading `cols` output columns of a uint8 row with the shuffle
+    // kernel of the best tier and returns how many it wrote: `cols`, or 0
+    // when no tier has one.
+    template<int64_t CHANNELS>
+    int64_t nearest_shuffle(
+        const uint8_t* src,
+        const int32_t* offsets,
+        uint8_t* dst,
+        int64_t cols
+    ) {
+#if PTENSOR_HAS_INTRINSICS_H
+        if (simd::is_supported(simd::SimdSet::SSE41)) {
+            nearest_shuffle_sse41<CHANNELS>(src, offsets, dst, cols);
+            return cols;
+        }
+#endif
+#if PTENSOR_HAS_NEON
+        if (simd::is_supported(simd::SimdSet::AdvSIMD)) {
+            nearest_shuffle_neon<CHANNELS>(src, offsets, dst, cols);
+            return cols;
+        }
+#endif
+        return 0;
+    }
+
+    // Nearest resize of a whole image through the source row and column
+    // tables, output rows spread over the workers.
+    template<typename scalar_t, int64_t CHANNELS>
+    void nearest_image(
+        const scalar_t* src,
+        scalar_t* dst,
+        int64_t width,
+        int64_t channels,
+        const std::vector<int32_t>& src_rows,
+        const std::vector<int32_t>& src_offsets,
+        int64_t shuffle_cols
+    ) {
+        const auto new_height = static_cast<int64_t>(src_rows.size());
+        const auto new_width = static_cast<int64_t>(src_offsets.size());
+        const int64_t src_pitch = width * channels;
+        const int64_t dst_pitch = new_width * channels;
+        constexpr bool SHUFFLE =
+            std::is_same_v<scalar_t, uint8_t> && (CHANNELS == 3 || CHANNELS == 4);
+        const int threads =
+            simd::parallel_workers(new_height * dst_pitch, RESIZE_MIN_WORKER_PIXELS);
+        simd::parallel_for(threads, threads, [&](int64_t job) {
+            const int64_t begin = (job * new_height) / threads;
+            const int64_t end = ((job + 1) * new_height) / threads;
+            for (int64_t y = begin; y < end; ++y) {
+                const scalar_t* src_row = src + (src_rows[y] * src_pitch);
+                scalar_t* dst_row = dst + (y * dst_pitch);
+                int64_t x = 0;
+                if constexpr (SHUFFLE) {
+                    x = nearest_shuffle<CHANNELS>(
+                        src_row,
+                        src_offsets.data(),
+                        dst_row,
+                        shuffle_cols
+                    );
+                }
+                nearest_pixels<scalar_t, CHANNELS>(
+                    src_row,
+                    src_offsets.data(),
+                    dst_row,
+                    x,
+                    new_width,
+                    channels
+                );
+            }
+        });
+    }
+
+    // Nearest resize dispatched on the common channel counts.
+    template<typename scalar_t>
+    void nearest_image(
+        const scalar_t* src,
+        scalar_t* dst,
+        int64_t width,
+        int64_t channels,
+        const std::vector<int32_t>& src_rows,
+        const std::vector<int32_t>& src_offsets,
+        int64_t shuffle_cols
+    ) {
+        switch (channels) {
+            case 1:
+                nearest_image<scalar_t, 1>(src, dst, width, 1, src_rows, src_offsets, shuffle_cols);
+                break;
+            case 3:
+                nearest_image<scalar_t, 3>(src, dst, width, 3, src_rows, src_offsets, shuffle_cols);
+                break;
+            case 4:
+                nearest_image<scalar_t, 4>(src, dst, width, 4, src_rows, src_offsets, shuffle_cols);
+                break;
+            default:
+                nearest_image<scalar_t, 0>(
+                    src,
+                    dst,
+                    width,
+                    channels,
+                    src_rows,
+                    src_offsets,
+                    shuffle_cols
+                );
+        }
+    }
+}  // namespace
+
+ImageResize::ImageResize(int64_t new_width, int64_t new_height, Interpolation interpolation) :
+    new_width_(new_width),
+    new_height_(new_height),
+    interpolation_(interpolation),
+    plan_(std::make_unique<Plan>()) {}
+
+ImageResize::ImageResize(ImageResize&& other) noexcept = default;
+ImageResize& ImageResize::operator=(ImageResize&& other) noexcept = default;
+ImageResize::~ImageResize() = default;
+
+P10Result<ImageResize>
+ImageResize::create(size_t new_width, size_t new_height, const ResizeOptions& options) {
+    if (new_width == 0 || new_height == 0) {
+        return Err(P10Error::InvalidArgument, "Target width and height must be positive.");
+    }
+    return Ok(ImageResize(
+        static_cast<int64_t>(new_width),
+        static_cast<int64_t>(new_height),
+        options.interpolation()
+    ));
+}
+
+P10Error ImageResize::transform(const Tensor& image, Tensor& output) {
+    if (image.shape().dims() != 3) {
+        return P10Error::InvalidArgument << "Image tensor must have shape [H, W, C].";
+    }
+    const Dtype dtype = image.dtype();
+    if (dtype != Dtype::Uint8 && dtype != Dtype::Float32) {
+        return P10Error::InvalidArgument << "Image tensor must be uint8 or float32.";
+    }
+    const int64_t height = image.shape(0).unwrap();
+    const int64_t width = image.shape(1).unwrap();
+    const int64_t channels = image.shape(2).unwrap();
+    if (height == 0 || width == 0 || channels == 0) {
+        return P10Error::InvalidArgument << "Image tensor must not be empty.";
+    }
+
+    Tensor contiguous;
+    if (!image.is_contiguous()) {
+        auto copy = image.to_contiguous();
+        if (copy.is_error()) {
+            return copy.error();
+        }
+        contiguous = copy.unwrap();
+    }
+    const Tensor& source = image.is_contiguous() ? image : contiguous;
+
+    Plan& plan = *plan_;
+    if (plan.height != height || plan.width != width || plan.channels != channels) {
+        plan = Plan();
+        plan.height = height;
+        plan.width = width;
+        plan.channels = channels;
+        if (interpolation_ == Interpolation::Nearest) {
+            plan.src_rows = nearest_indices(height, new_height_);
+            plan.src_offsets = nearest_indices(width, new_width_);
+            plan.shuffle_cols = shuffle_columns(plan.src_offsets, width, channels);
+            for (auto& offset : plan.src_offsets) {
+                offset *= static_cast<int32_t>(channels);
+            }
+        } else {
+            plan.rows_axis = resample_axis(height, new_height_, interpolation_);
+            plan.cols_axis =
+                interleave_axis(resample_axis(width, new_width_, interpolation_), channels);
+        }
+    }
+
+    P10_RETURN_IF_ERROR(output.create(make_shape(new_height_, new_width_, channels), dtype));
+
+    return dtype.match([&](auto type_tag) -> P10Error {
+        using scalar_t = decltype(type_tag)::type;
+
+        if constexpr (std::is_same_v<scalar_t, uint8_t> || std::is_same_v<scalar_t, float>) {
+            const scalar_t* src = source.as_span1d<const scalar_t>().unwrap().data();
+            scalar_t* dst = output.as_span1d<scalar_t>().unwrap().data();
+            if (interpolation_ == Interpolation::Nearest) {
+                nearest_image(
+                    src,
+                    dst,
+                    width,
+                    channels,
+                    plan.src_rows,
+                    plan.src_offsets,
+                    plan.shuffle_cols
+                );
+                return P10Error::Ok;
+            }
+
+            // One plane whose rows are the interleaved image rows.
+            const Span3D<const scalar_t> rows(src, 1, height, width * channels);
+            const Span3D<scalar_t> out_rows(dst, 1, new_height_, new_width_ * channels);
+            switch (interpolation_) {
+                case Interpolation::Bilinear:
+                    resample_planes<scalar_t, 2>(rows, out_rows, plan.rows_axis, plan.cols_axis);
+                    break;
+                case Interpolation::Bicubic:
+                    resample_planes<scalar_t, 4>(rows, out_rows, plan.rows_axis, plan.cols_axis);
+                    break;
+                default:
+                    resample_planes<scalar_t, 0>(rows, out_rows, plan.rows_axis, plan.cols_axis);
+            }
+            return P10Error::Ok;
+        } else {
+            return P10Error::InvalidArgument << "Unsupported data type for this operation.";
+        }
+    });
+}
+
+}  // namespace p10::op
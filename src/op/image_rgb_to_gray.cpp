@@ -1,5 +1,6 @@
 #include "image_rgb_to_gray.hpp"
 
+#include <ptensor/op/color.hpp>
 #include <ptensor/tensor.hpp>
 
 #include "ptensor/p10_error.hpp"
@@ -14,30 +15,25 @@ p10::P10Error image_rgb_to_gray(const p10::Tensor& rgb_image, p10::Tensor& gray_
         return P10Error::InvalidArgument << "Input RGB image must have Uint8 dtype";
     }
 
-    auto height = rgb_image.shape(0).unwrap();
-    auto width = rgb_image.shape(1).unwrap();
-    P10_RETURN_IF_ERROR(gray_image.create(make_shape(height, width), Dtype::Uint8));
-
-    auto rgb_span = rgb_image.as_accessor3d<const uint8_t>().unwrap();
-    auto gray_span = gray_image.as_span2d<uint8_t>().unwrap();
-
-    for (size_t h = 0; h < static_cast<size_t>(height); ++h) {
-        const auto rgb_row = rgb_span[h];
-        auto gray_row = gray_span[h];
-        for (size_t w = 0; w < static_cast<size_t>(width); ++w) {
-            const auto rgb_pixel = rgb_row[w];
-            uint8_t const r = rgb_pixel[0];
-            uint8_t const g = rgb_pixel[1];
-            uint8_t const b = rgb_pixel[2];
-
-            // Convert to grayscale using luminosity method
-            gray_row[w] = static_cast<uint8_t>(
-                0.21f * static_cast<float>(r) + 0.72f * static_cast<float>(g)
-                + 0.07f * static_cast<float>(b)
-            );
+    // convert_color reads contiguous images only; strided views are copied.
+    Tensor contiguous;
+    if (!rgb_image.is_contiguous()) {
+        auto copy = rgb_image.to_contiguous();
+        if (copy.is_error()) {
+            return copy.error();
         }
+        contiguous = copy.unwrap();
     }
-
-    return P10Error::Ok;
+    const Tensor& source = rgb_image.is_contiguous() ? rgb_image : contiguous;
+
+    const auto height = rgb_image.shape(0).unwrap();
+    const auto width = rgb_image.shape(1).unwrap();
+    P10_RETURN_IF_ERROR(convert_color(
+        source,
+        gray_image,
+        ColorConversion::RgbToGray,
+        ColorOptions().luma(LumaWeights::Luminosity)
+    ));
+    return gray_image.reshape(make_shape(height, width));
 }
 }  // namespace p10::op
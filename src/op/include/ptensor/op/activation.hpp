@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+
+#include "ptensor/p10_error.hpp"
+
+namespace p10 {
+class Tensor;
+}
+
+namespace p10::op {
+
+/// Element-wise e^x.
+///
+/// The element-wise ops here run the vectorised float32 math of the SIMD
+/// layer on the best tier the CPU supports, spread over the parallel workers
+/// for long tensors. Results are identical on every tier; the worst error is
+/// 2 ulp for `exp` and `log` and 3 ulp for `sigmoid`.
+///
+/// # Arguments
+///
+/// * `input` - A contiguous float32 tensor of any shape.
+/// * `output` - Created with the shape of `input`; may be `input` itself.
+///
+/// # Returns
+///
+/// * `P10Error::Ok` on success.
+/// * `P10Error::InvalidArgument` if `input` is not float32 or not contiguous.
+P10Error exp(const Tensor& input, Tensor& output);
+
+/// Element-wise natural logarithm: -inf at 0 and NaN below. See `exp`.
+P10Error log(const Tensor& input, Tensor& output);
+
+/// Element-wise logistic function, 1 / (1 + e^-x). See `exp`.
+P10Error sigmoid(const Tensor& input, Tensor& output);
+
+/// Softmax along `axis`: e^(x - max) / sum(e^(x - max)) over each line of the
+/// axis, so large logits do not overflow.
+///
+/// The last axis is vectorised along the line; any other axis is vectorised
+/// across the contiguous elements after it. Lines are spread over the
+/// parallel workers. Sums are accumulated per vector lane, so tiers of
+/// different widths agree to rounding rather than bit for bit.
+///
+/// # Arguments
+///
+/// * `input` - A contiguous float32 tensor with at least one dimension.
+/// * `output` - Created with the shape of `input`; may be `input` itself.
+/// * `axis` - The axis to normalise; negative values count from the end.
+///
+/// # Returns
+///
+/// * `P10Error::Ok` on success.
+/// * `P10Error::InvalidArgument` if `input` is not float32, not contiguous or
+///   empty, or `axis` is out of range.
+P10Error softmax(const Tensor& input, Tensor& output, int64_t axis = -1);
+
+/// log(softmax(x)) along `axis`, computed as x - max - log(sum(e^(x - max)))
+/// so it stays finite where softmax underflows to 0. See `softmax`.
+P10Error log_softmax(const Tensor& input, Tensor& output, int64_t axis = -1);
+
+}  // namespace p10::op
@@ -30,9 +30,58 @@ class GaussianBlur {
 
     } kernel_;
 
+    // Copy of the input for in-place transforms: the row bands run in
+    // parallel, and a band's first output rows would overwrite the source
+    // rows the band above still reads.
+    Tensor scratch_;
+
     GaussianBlur(size_t kernel_size) : kernel_ {.data = {}, .size = kernel_size} {}
+};
 
-    Tensor scratch_;
+/// Gaussian blur by third-order recursive filtering (Young-van Vliet), for the
+/// large sigmas GaussianBlur's MAX_KERNEL_SIZE taps cannot reach. Each axis runs
+/// a causal and an anti-causal pass whose cost per pixel does not depend on
+/// sigma. Edges are replicated like GaussianBlur's (Triggs-Sdika boundary
+/// initialization). Per axis the response is within a few percent of the
+/// Gaussian's peak (about 1% from sigma 20 up), so prefer GaussianBlur for
+/// small sigmas.
+class RecursiveGaussianBlur {
+  public:
+    static constexpr float MIN_SIGMA = 0.5F;
+    /// create() fits the filter to a sampled Gaussian, whose cost grows with
+    /// sigma; past this the blur is flat over any practical image anyway.
+    static constexpr float MAX_SIGMA = 1000.0F;
+
+    /// # Errors
+    /// * InvalidArgument: `sigma` is not finite or outside [MIN_SIGMA, MAX_SIGMA].
+    static P10Result<RecursiveGaussianBlur> create(float sigma);
+
+    /// Blurs each (H, W) plane of `input` ((H, W) or (C, H, W)) into `output`, which gets
+    /// the input's shape and dtype. Filtering runs in double; integer outputs are rounded and
+    /// saturated.
+    ///
+    /// # Errors
+    /// * InvalidArgument: `input` has fewer than 2 dimensions or a non-numeric dtype.
+    P10Error transform(const Tensor& input, Tensor& output);
+
+  private:
+    // y[n] = gain * x[n] + feedback[0] * y[n-1] + feedback[1] * y[n-2]
+    //        + feedback[2] * y[n-3]
+    // for the causal pass, mirrored for the anti-causal one. `edge` maps the
+    // causal pass's last three outputs, less the edge pixel, to the
+    // anti-causal pass's three states past the edge.
+    double gain_;
+    std::array<double, 3> feedback_;
+    std::array<double, 9> edge_;
+
+    RecursiveGaussianBlur(
+        double gain,
+        const std::array<double, 3>& feedback,
+        const std::array<double, 9>& edge
+    ) :
+        gain_(gain),
+        feedback_(feedback),
+        edge_(edge) {}
 };
 
 }  // namespace p10::op
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstdint>
+
+#include "ptensor/p10_error.hpp"
+
+namespace p10 {
+class Tensor;
+}
+
+namespace p10::op {
+
+/// Conversions `convert_color` performs, named input to output.
+enum class ColorConversion : uint8_t {
+    /// 3 channels to 1: the weighted sum of `ColorOptions::luma`.
+    RgbToGray,
+    /// As `RgbToGray`, reading the channels in B, G, R order.
+    BgrToGray,
+    /// 1 channel to 3 copies of it (RGB and BGR alike).
+    GrayToRgb,
+    /// Swaps the first and third channels of 3 or 4 channel images: RGB to
+    /// BGR and back, RGBA to BGRA and back.
+    SwapRedBlue,
+    /// Appends an opaque alpha channel: 255 for uint8, 1 for float32.
+    RgbToRgba,
+    /// Drops the fourth channel.
+    RgbaToRgb,
+    /// RGB to hue, saturation, value. uint8 stores H / 2 in [0, 180) and S,
+    /// V in [0, 255]; float32 takes RGB in [0, 1] and gives H in degrees,
+    /// [0, 360), and S, V in [0, 1].
+    RgbToHsv,
+    /// As `RgbToHsv`, reading the channels in B, G, R order.
+    BgrToHsv,
+    /// The inverse of `RgbToHsv`, with the same ranges.
+    HsvToRgb,
+    /// As `HsvToRgb`, writing the channels in B, G, R order.
+    HsvToBgr,
+};
+
+/// Weights of R, G and B in luma.
+enum class LumaWeights : uint8_t {
+    /// 0.299, 0.587, 0.114 (ITU-R BT.601).
+    BT601,
+    /// 0.2126, 0.7152, 0.0722 (ITU-R BT.709).
+    BT709,
+    /// 0.21, 0.72, 0.07, the weights of `image_rgb_to_gray`.
+    Luminosity,
+};
+
+/// Options for `convert_color`.
+class ColorOptions {
+  public:
+    ColorOptions() = default;
+
+    /// Luma weights of the gray conversions. Defaults to `LumaWeights::BT601`.
+    LumaWeights luma() const {
+        return luma_;
+    }
+
+    ColorOptions& luma(LumaWeights luma) {
+        luma_ = luma;
+        return *this;
+    }
+
+    /// If true, images are planar `[C, H, W]` instead of interleaved
+    /// `[H, W, C]`, in and out. Defaults to false.
+    bool planar() const {
+        return planar_;
+    }
+
+    ColorOptions& planar(bool planar) {
+        planar_ = planar;
+        return *this;
+    }
+
+  private:
+    LumaWeights luma_ = LumaWeights::BT601;
+    bool planar_ = false;
+};
+
+/// Converts `input` between colour models and channel layouts.
+///
+/// uint8 and float32 images are supported; the output has the input's dtype
+/// and layout, with the conversion's channel count. Rows are spread over the
+/// parallel workers and each is converted channel row by channel row with
+/// the Vec kernels: interleaved rows are split and joined with byte shuffles
+/// (uint8) first, gray runs in 14-bit fixed point for uint8 and in float for
+/// float32, and HSV runs in float with selects instead of branches, rounding
+/// to the nearest uint8. Results are identical on every SIMD tier.
+///
+/// # Arguments
+///
+/// * `input` - A contiguous `[H, W, C]` image, or `[C, H, W]` with
+///   `options.planar()`, with the channels `conversion` reads.
+/// * `output` - Created with the same layout and dtype.
+/// * `conversion` - What to convert.
+/// * `options` - Luma weights and layout.
+///
+/// # Returns
+///
+/// * `P10Error::Ok` on success.
+/// * `P10Error::InvalidArgument` if `input` is not uint8 or float32, not 3D,
+///   not contiguous, or has a channel count `conversion` does not read.
+P10Error convert_color(
+    const Tensor& input,
+    Tensor& output,
+    ColorConversion conversion,
+    const ColorOptions& options = ColorOptions()
+);
+
+}  // namespace p10::op
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 #include <ptensor/p10_error.hpp>
 
 namespace p10 {
@@ -11,6 +15,12 @@ class FftOptions;
 
 /**
  * @brief Fft is NOT thread-safe. Do not use the same instance concurrently from multiple threads.
+ *
+ * Complex tensors store each value as a trailing pair, [..., 2] = (real, imaginary), in Float32
+ * or Float64. Transforms run along `FftOptions::axes()` of the signal shape (the shape without
+ * that trailing 2); every other dimension is a batch, and the 1D transforms of a batch are spread
+ * over the parallel workers. Plans (factorisations and twiddles) are cached per length and dtype
+ * across calls and instances.
  */
 class Fft {
   public:
@@ -25,16 +35,26 @@ class Fft {
     Fft& operator=(Fft&&) = delete;
     ~Fft();
 
+    /// Runs the transform of `FftOptions::direction()`:
+    ///
+    /// * `Forward`, `Inverse` - complex `[..., 2]` to complex of the same shape.
+    /// * `ForwardReal` - real `[..., T]` to complex `[..., T / 2 + 1, 2]`, the
+    ///   last transformed axis shrinking to its non-negative frequencies.
+    /// * `InverseReal` - complex `[..., F, 2]` to real `[..., 2 * (F - 1)]`.
+    ///
+    /// `Normalize` divides by the product of the transformed lengths (or its
+    /// square root); `None` leaves `Inverse(Forward(x))` scaled by it.
     P10Error transform(const Tensor& input, Tensor& output) const;
 
   private:
-    static P10Error forward(const Tensor& time, Tensor& frequency);
+    P10Error forward(const Tensor& time, Tensor& frequency) const;
     P10Error forward_real(const Tensor& signal_in, Tensor& freq_out) const;
-    static P10Error inverse(const Tensor& input, Tensor& output);
+    P10Error inverse(const Tensor& input, Tensor& output) const;
     P10Error inverse_real(const Tensor& freq_in, Tensor& signal_out) const;
 
     Direction direction_ = Direction::Forward;
     Normalize normalize_ = Normalize::None;
+    std::vector<int64_t> axes_;
 };
 
 class FftOptions {
@@ -51,6 +71,13 @@ class FftOptions {
         return normalize_;
     }
 
+    /// Signal axes to transform, negative values counting from the end; for
+    /// the real directions the last one listed is the real axis. Defaults to
+    /// `{-1}`, one transform per row.
+    const std::vector<int64_t>& axes() const {
+        return axes_;
+    }
+
     FftOptions& direction(Fft::Direction t) {
         direction_ = t;
         return *this;
@@ -61,9 +88,31 @@ class FftOptions {
         return *this;
     }
 
+    FftOptions& axes(std::vector<int64_t> axes) {
+        axes_ = std::move(axes);
+        return *this;
+    }
+
   private:
     Fft::Direction direction_;
     Fft::Normalize normalize_;
+    std::vector<int64_t> axes_ {-1};
 };
 
-}  // namespace p10::op
\ No newline at end of file
+/// 2D complex FFT over the last two signal axes: `[..., H, W, 2]` to the
+/// same shape, leading dimensions batched. Shorthand for `Fft` with axes
+/// `{-2, -1}`.
+P10Error fft2(const Tensor& input, Tensor& output, Fft::Normalize normalize = Fft::None);
+
+/// Inverse of `fft2`; `ByN` (the default) makes `ifft2(fft2(x)) == x`.
+P10Error ifft2(const Tensor& input, Tensor& output, Fft::Normalize normalize = Fft::ByN);
+
+/// 2D FFT of real `[..., H, W]` to its non-negative column frequencies,
+/// `[..., H, W / 2 + 1, 2]`.
+P10Error rfft2(const Tensor& input, Tensor& output, Fft::Normalize normalize = Fft::None);
+
+/// Inverse of `rfft2`: `[..., H, F, 2]` to real `[..., H, 2 * (F - 1)]`, so
+/// only even widths come back.
+P10Error irfft2(const Tensor& input, Tensor& output, Fft::Normalize normalize = Fft::ByN);
+
+}  // namespace p10::op
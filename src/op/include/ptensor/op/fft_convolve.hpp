@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+
+#include "ptensor/p10_error.hpp"
+
+namespace p10 {
+class Tensor;
+}
+
+namespace p10::op {
+
+/// Which part of the full 2D convolution `fft_convolve2d` returns.
+enum class ConvolveMode : uint8_t {
+    /// Every overlap: `(H + kh - 1) x (W + kw - 1)`.
+    Full,
+    /// The image's size, centred on the full result like scipy's `same`.
+    Same,
+    /// Only where the kernel lies inside the image:
+    /// `(H - kh + 1) x (W - kw + 1)`.
+    Valid,
+};
+
+/// How `fft_convolve2d` computes the result.
+enum class ConvolveMethod : uint8_t {
+    /// The cheaper of the two by an operation count estimate: direct for
+    /// small kernels, FFT for large ones.
+    Auto,
+    /// Sliding sum over the kernel taps.
+    Direct,
+    /// Overlap-save tiles multiplied in the frequency domain.
+    Fft,
+};
+
+/// Options for `fft_convolve2d` and `fft_correlate2d`.
+class ConvolveOptions {
+  public:
+    /// Defaults to `ConvolveMode::Same`.
+    ConvolveMode mode() const {
+        return mode_;
+    }
+
+    ConvolveOptions& mode(ConvolveMode mode) {
+        mode_ = mode;
+        return *this;
+    }
+
+    /// Defaults to `ConvolveMethod::Auto`.
+    ConvolveMethod method() const {
+        return method_;
+    }
+
+    ConvolveOptions& method(ConvolveMethod method) {
+        method_ = method;
+        return *this;
+    }
+
+  private:
+    ConvolveMode mode_ = ConvolveMode::Same;
+    ConvolveMethod method_ = ConvolveMethod::Auto;
+};
+
+/// 2D linear convolution of each (H, W) plane of `image` with `kernel`,
+/// zero outside the image.
+///
+/// The FFT method splits the output into overlap-save tiles whose transform
+/// size grows with the kernel, not the image, and runs the tiles as batches
+/// of 2D real FFTs against the kernel's spectrum, computed once per call.
+/// Both methods agree to float rounding.
+///
+/// # Arguments
+///
+/// * `image` - Contiguous Float32 or Float64 `[H, W]` or `[C, H, W]`.
+/// * `kernel` - Contiguous `[kh, kw]` of the image's dtype.
+/// * `output` - Created as `[C,] out_h, out_w` per `ConvolveOptions::mode()`.
+///   May be `image` or `kernel` itself; the input is then read from a copy.
+///
+/// # Returns
+///
+/// * `P10Error::Ok` on success.
+/// * `P10Error::InvalidArgument` on other shapes or dtypes, or if a `Valid`
+///   result would be empty.
+P10Error fft_convolve2d(
+    const Tensor& image,
+    const Tensor& kernel,
+    Tensor& output,
+    const ConvolveOptions& options = ConvolveOptions()
+);
+
+/// 2D cross-correlation, `sum(image[y + i][x + j] * kernel[i][j])`: the
+/// convolution with the kernel flipped on both axes. With `ConvolveMode::Valid`
+/// this is template matching's sliding dot product. See `fft_convolve2d`.
+P10Error fft_correlate2d(
+    const Tensor& image,
+    const Tensor& kernel,
+    Tensor& output,
+    const ConvolveOptions& options = ConvolveOptions()
+);
+
+}  // namespace p10::op
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <optional>
+#include <utility>
+#include <vector>
 
 #include <ptensor/dtype.hpp>
 #include <ptensor/p10_error.hpp>
@@ -19,8 +21,9 @@ class ImageToTensorOptions {
     ImageToTensorOptions() = default;
 
     /// Mirror the shared settings of a from-tensor conversion so the two
-    /// directions stay symmetric. Copies `normalize`; the output dtype keeps
-    /// this direction's default (float32) unless set explicitly.
+    /// directions stay symmetric. Copies `normalize`, `mean` and `std`; the
+    /// output dtype keeps this direction's default (float32) unless set
+    /// explicitly.
     explicit ImageToTensorOptions(const ImageFromTensorOptions& other);
 
     /// Target dtype of the output tensor. If unset, defaults to `Dtype::Float32`.
@@ -49,6 +52,29 @@ class ImageToTensorOptions {
         return *this;
     }
 
+    /// Per-channel mean subtracted after `normalize`, for a floating-point
+    /// target: channel `c` becomes `(x - mean[c]) / std[c]`. Empty (the
+    /// default) subtracts 0.
+    const std::vector<float>& mean() const {
+        return mean_;
+    }
+
+    ImageToTensorOptions& mean(std::vector<float> mean) {
+        mean_ = std::move(mean);
+        return *this;
+    }
+
+    /// Per-channel divisor applied after `mean`. Empty (the default) divides
+    /// by 1.
+    const std::vector<float>& std() const {
+        return std_;
+    }
+
+    ImageToTensorOptions& std(std::vector<float> std) {
+        std_ = std::move(std);
+        return *this;
+    }
+
     /// If true, prepend a batch dimension of size 1 to the output shape:
     /// `[C, H, W]` becomes `[1, C, H, W]`.
     bool unsqueeze() const {
@@ -63,6 +89,8 @@ class ImageToTensorOptions {
   private:
     std::optional<Dtype> target_type_ = std::nullopt;
     bool normalize_ = false;
+    std::vector<float> mean_;
+    std::vector<float> std_;
     bool unsqueeze_ = false;
 };
 
@@ -74,10 +102,12 @@ class ImageFromTensorOptions {
     ImageFromTensorOptions() = default;
 
     /// Mirror the shared settings of a to-tensor conversion so a round trip
-    /// stays symmetric. Copies `normalize`; the output dtype keeps this
-    /// direction's default (uint8) unless set explicitly.
+    /// stays symmetric. Copies `normalize`, `mean` and `std`; the output dtype
+    /// keeps this direction's default (uint8) unless set explicitly.
     explicit ImageFromTensorOptions(const ImageToTensorOptions& other) :
-        normalize_(other.normalize()) {}
+        normalize_(other.normalize()),
+        mean_(other.mean()),
+        std_(other.std()) {}
 
     /// Target dtype of the output image tensor. If unset, defaults to `Dtype::Uint8`.
     std::optional<Dtype> target_dtype() const {
@@ -101,17 +131,48 @@ class ImageFromTensorOptions {
         return *this;
     }
 
+    /// Per-channel mean added back before `normalize`: channel `c` becomes
+    /// `x * std[c] + mean[c]`, undoing the to-tensor normalisation. Empty
+    /// (the default) adds 0.
+    const std::vector<float>& mean() const {
+        return mean_;
+    }
+
+    ImageFromTensorOptions& mean(std::vector<float> mean) {
+        mean_ = std::move(mean);
+        return *this;
+    }
+
+    /// Per-channel factor applied before `mean`. Empty (the default)
+    /// multiplies by 1.
+    const std::vector<float>& std() const {
+        return std_;
+    }
+
+    ImageFromTensorOptions& std(std::vector<float> std) {
+        std_ = std::move(std);
+        return *this;
+    }
+
   private:
     std::optional<Dtype> target_type_ = std::nullopt;
     bool normalize_ = false;
+    std::vector<float> mean_;
+    std::vector<float> std_;
 };
 
 inline ImageToTensorOptions::ImageToTensorOptions(const ImageFromTensorOptions& other) :
-    normalize_(other.normalize()) {}
+    normalize_(other.normalize()),
+    mean_(other.mean()),
+    std_(other.std()) {}
 
 /// Convert an image tensor `[H, W, C]` (uint8) to a planar tensor `[C, H, W]`,
 /// or `[1, C, H, W]` when `options.unsqueeze()` is true.
 ///
+/// float32 targets take a vectorised path, parallel over rows: byte shuffles
+/// split each row into its channels (SSE4.1 and AVX2 tiers, NEON; 3 and 4
+/// channels), then the channel rows widen to float and normalise in SIMD.
+///
 /// # Arguments
 ///
 /// * `image` - Input image tensor. Must be uint8, 3D `[height, width, channels]`,
@@ -122,7 +183,9 @@ inline ImageToTensorOptions::ImageToTensorOptions(const ImageFromTensorOptions&
 /// # Returns
 ///
 /// * `P10Error::Ok` on success.
-/// * `P10Error::InvalidArgument` if `image` is not uint8, not 3D, or not contiguous.
+/// * `P10Error::InvalidArgument` if `image` is not uint8, not 3D, or not contiguous,
+///   or if `mean` or `std` is set for an integer target, has a length other
+///   than the channel count, or `std` has a zero entry.
 P10Error image_to_tensor(
     const Tensor& image,
     Tensor& out_tensor,
@@ -134,9 +197,14 @@ P10Error image_to_tensor(
 /// options from the ones used there (`ImageFromTensorOptions(to_options)`) to
 /// keep a round trip symmetric.
 ///
-/// With `options.normalize()` and an integer target, values are scaled by 255
-/// and clamped to `[0, 255]`; otherwise values are cast as-is and clamped. For a
-/// floating-point target, values are copied unchanged.
+/// Values first undo `mean` and `std` when set. With `options.normalize()` and
+/// an integer target, values are then scaled by 255 and clamped to `[0, 255]`;
+/// otherwise values are cast as-is and clamped. For a floating-point target,
+/// values are otherwise copied unchanged.
+///
+/// float32 to uint8 takes a vectorised path, parallel over rows: each channel
+/// row scales, clamps and narrows in SIMD, then byte shuffles interleave the
+/// channels (SSE4.1 and AVX2 tiers, NEON; 3 and 4 channels).
 ///
 /// # Arguments
 ///
@@ -149,7 +217,8 @@ P10Error image_to_tensor(
 ///
 /// * `P10Error::Ok` on success.
 /// * `P10Error::InvalidArgument` if `tensor` is not floating-point, not 3D/4D,
-///   not contiguous, or has a 4D shape whose leading dim is not 1.
+///   not contiguous, or has a 4D shape whose leading dim is not 1, or if
+///   `mean` or `std` has a length other than the channel count.
 P10Error image_from_tensor(
     const Tensor& tensor,
     Tensor& out_image_tensor,
@@ -7,5 +7,10 @@ class Tensor;
 }
 
 namespace p10::op {
+/// Converts an interleaved uint8 RGB image `[H x W x 3]` to gray `[H x W]`
+/// with the 0.21, 0.72, 0.07 luminosity weights, rounded to nearest. Runs
+/// `convert_color` with `LumaWeights::Luminosity`; prefer calling that
+/// directly, which also takes BT.601/BT.709 weights, float32 and planar
+/// images.
 p10::P10Error image_rgb_to_gray(const p10::Tensor& rgb_image, p10::Tensor& gray_image);
 }
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+
+#include <ptensor/p10_error.hpp>
+
+namespace p10 {
+class Tensor;
+}
+
+namespace p10::op {
+
+/// Computes the summed-area table of each (H, W) plane of `image`, which is (H, W) or (C, H, W).
+/// `sum` has the image shape with one more row and column: `sum[y][x]` is the sum of image rows
+/// `[0, y)` and columns `[0, x)`, so its first row and column are zero and any box sum is
+/// four lookups, `sum[y1][x1] - sum[y0][x1] - sum[y1][x0] + sum[y0][x0]`.
+///
+/// Uint8 images accumulate in Uint32. The table itself wraps past 2^32, but box sums taken as
+/// above are exact while the box total fits 32 bits (boxes up to 16843009 pixels). Every
+/// other dtype accumulates in Float64.
+///
+/// # Errors
+/// * InvalidArgument: `image` has fewer than 2 dimensions or a non-numeric dtype.
+P10Error integral_image(const Tensor& image, Tensor& sum);
+
+/// Like `integral_image(image, sum)`, and also fills `squared_sum`, the Float64 summed-area
+/// table of the squared pixels. Together they give the variance of any box in O(1):
+/// `E[x^2] - E[x]^2`.
+///
+/// # Errors
+/// * InvalidArgument: `image` has fewer than 2 dimensions or a non-numeric dtype.
+P10Error integral_image(const Tensor& image, Tensor& sum, Tensor& squared_sum);
+
+/// Replaces each pixel by the mean of the `(2 * radius + 1)` square box around it, plane by
+/// plane, with edges replicated like GaussianBlur. The box slides over running row and column
+/// sums, so the cost per pixel does not depend on `radius`. `output` has the dtype and shape
+/// of `image`; integer means are rounded to nearest. `output` may be `image` itself, in which
+/// case the input is filtered from a copy.
+///
+/// # Errors
+/// * InvalidArgument: `image` has fewer than 2 dimensions or a non-numeric dtype.
+P10Error box_filter(const Tensor& image, size_t radius, Tensor& output);
+
+}  // namespace p10::op
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <ptensor/dtype.hpp>
+
+#include "ptensor/op/resize.hpp"
+#include "ptensor/p10_error.hpp"
+#include "ptensor/p10_result.hpp"
+
+namespace p10 {
+class Tensor;
+}
+
+namespace p10::op {
+
+/// Options for `LetterboxPreprocess`.
+class LetterboxOptions {
+  public:
+    /// Letterboxes into a `width` x `height` model input.
+    LetterboxOptions(size_t width, size_t height) : width_(width), height_(height) {}
+
+    /// Target width in pixels.
+    size_t width() const {
+        return width_;
+    }
+
+    /// Target height in pixels.
+    size_t height() const {
+        return height_;
+    }
+
+    /// Per-channel mean subtracted from the pixel values, indexed by output
+    /// channel (after `reverse_channels`). Empty (the default) subtracts 0.
+    const std::vector<float>& mean() const {
+        return mean_;
+    }
+
+    LetterboxOptions& mean(std::vector<float> mean) {
+        mean_ = std::move(mean);
+        return *this;
+    }
+
+    /// Per-channel divisor applied after the mean, indexed like `mean`. Empty
+    /// (the default) divides by 1.
+    const std::vector<float>& std() const {
+        return std_;
+    }
+
+    LetterboxOptions& std(std::vector<float> std) {
+        std_ = std::move(std);
+        return *this;
+    }
+
+    /// If true, output channel `c` reads input channel `C - 1 - c`: RGB frames
+    /// feed BGR models and vice versa. Defaults to false.
+    bool reverse_channels() const {
+        return reverse_channels_;
+    }
+
+    LetterboxOptions& reverse_channels(bool reverse_channels) {
+        reverse_channels_ = reverse_channels;
+        return *this;
+    }
+
+    /// How the image is resampled to its letterboxed size. Defaults to
+    /// `Interpolation::Bilinear`.
+    Interpolation interpolation() const {
+        return interpolation_;
+    }
+
+    LetterboxOptions& interpolation(Interpolation interpolation) {
+        interpolation_ = interpolation;
+        return *this;
+    }
+
+    /// If false, images smaller than the target keep their size and are only
+    /// padded. Defaults to true.
+    bool upscale() const {
+        return upscale_;
+    }
+
+    LetterboxOptions& upscale(bool upscale) {
+        upscale_ = upscale;
+        return *this;
+    }
+
+    /// If non-zero, pads each axis only to the smallest size that holds the
+    /// resized image and differs from the target by a multiple of
+    /// `pad_stride`, so the model input shrinks with the image in steps its
+    /// strides divide (1 skips the padding). 0 (the default) pads to the
+    /// full target size.
+    size_t pad_stride() const {
+        return pad_stride_;
+    }
+
+    LetterboxOptions& pad_stride(size_t pad_stride) {
+        pad_stride_ = pad_stride;
+        return *this;
+    }
+
+    /// Value written to the padding, in output units (after normalisation).
+    /// Defaults to 0.
+    float pad_value() const {
+        return pad_value_;
+    }
+
+    LetterboxOptions& pad_value(float pad_value) {
+        pad_value_ = pad_value;
+        return *this;
+    }
+
+    /// If true, input images are planar `[C, H, W]` (or `[N, C, H, W]`)
+    /// instead of interleaved `[H, W, C]` (or `[N, H, W, C]`). Defaults to
+    /// false.
+    bool planar_input() const {
+        return planar_input_;
+    }
+
+    LetterboxOptions& planar_input(bool planar_input) {
+        planar_input_ = planar_input;
+        return *this;
+    }
+
+    /// Output dtype, `Dtype::Float32` (the default) or `Dtype::Float16`.
+    Dtype dtype() const {
+        return dtype_;
+    }
+
+    LetterboxOptions& dtype(Dtype dtype) {
+        dtype_ = dtype;
+        return *this;
+    }
+
+  private:
+    size_t width_;
+    size_t height_;
+    std::vector<float> mean_;
+    std::vector<float> std_;
+    bool reverse_channels_ = false;
+    Interpolation interpolation_ = Interpolation::Bilinear;
+    bool upscale_ = true;
+    size_t pad_stride_ = 0;
+    float pad_value_ = 0.0f;
+    bool planar_input_ = false;
+    Dtype dtype_ = Dtype::Float32;
+};
+
+/// Where `LetterboxPreprocess` placed the image inside the model input, for
+/// mapping detections back to source coordinates.
+struct LetterboxGeometry {
+    /// Resized size over source size, the same on both axes.
+    float scale = 1.0f;
+    /// Padding columns left of the image.
+    int64_t left = 0;
+    /// Padding rows above the image.
+    int64_t top = 0;
+    /// Width of the resized image inside the padding.
+    int64_t width = 0;
+    /// Height of the resized image inside the padding.
+    int64_t height = 0;
+};
+
+/// Turns decoded uint8 frames into a model input: resizes each image to fit
+/// the target with its aspect ratio kept, centers it in the padding, swaps
+/// the channel order if asked, normalises `(x - mean) / std` and writes
+/// planar `[N, C, H, W]` float32 or float16.
+///
+/// Everything happens in one pass over the output rows, spread over the
+/// parallel workers: each row is resampled with the kernels of `resize`
+/// into a buffer that stays in cache, then normalised and stored into the
+/// channel planes with its padding, so neither the resized image nor an
+/// unnormalised copy is ever written out. The resampling tables depend only
+/// on the input shape and are rebuilt when it changes, so keep one instance
+/// per stream.
+///
+/// Not thread-safe: `transform` updates the cached tables.
+class LetterboxPreprocess {
+  public:
+    /// Creates a preprocessor for `options`.
+    ///
+    /// # Errors
+    /// * InvalidArgument: the target size is zero, `mean` and
+    ///   `std` are both set with different lengths, a `std` entry is zero or
+    ///   not finite, or the dtype is neither float32 nor float16.
+    static P10Result<LetterboxPreprocess> create(const LetterboxOptions& options);
+
+    LetterboxPreprocess(LetterboxPreprocess&& other) noexcept;
+    LetterboxPreprocess& operator=(LetterboxPreprocess&& other) noexcept;
+    LetterboxPreprocess(const LetterboxPreprocess&) = delete;
+    LetterboxPreprocess& operator=(const LetterboxPreprocess&) = delete;
+    ~LetterboxPreprocess();
+
+    /// Letterboxes `images` into `output`, created as `[N, C, H, W]` with the
+    /// padded size and the options' dtype; a 3D image gives N = 1. Every
+    /// output value is written, padding included.
+    ///
+    /// # Returns
+    ///
+    /// * Where the resized image sits inside the padding.
+    ///
+    /// # Errors
+    /// * InvalidArgument: `images` is not uint8, not 3D or 4D, has no pixels
+    ///   or channels, or has a channel count other than the length of `mean`
+    ///   or `std` when those are set.
+    P10Result<LetterboxGeometry> transform(const Tensor& images, Tensor& output);
+
+  private:
+    struct Plan;
+
+    explicit LetterboxPreprocess(const LetterboxOptions& options);
+
+    LetterboxOptions options_;
+    std::unique_ptr<Plan> plan_;
+};
+
+}  // namespace p10::op
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <ptensor/p10_error.hpp>
+#include <ptensor/p10_result.hpp>
+#include <ptensor/tensor.hpp>
+
+namespace p10::op {
+
+/// Options for `MelSpectrogram` and `Mfcc`. The defaults are librosa's.
+class MelOptions {
+  public:
+    /// Filters for spectra of `frame_length`-sample frames at `sample_rate` Hz.
+    MelOptions(double sample_rate, size_t frame_length) :
+        sample_rate_(sample_rate),
+        frame_length_(frame_length) {}
+
+    double sample_rate() const {
+        return sample_rate_;
+    }
+
+    size_t frame_length() const {
+        return frame_length_;
+    }
+
+    /// Number of mel bands. Defaults to 128.
+    size_t mels() const {
+        return mels_;
+    }
+
+    MelOptions& mels(size_t mels) {
+        mels_ = mels;
+        return *this;
+    }
+
+    /// Lowest filter edge in Hz. Defaults to 0.
+    double min_frequency() const {
+        return min_frequency_;
+    }
+
+    MelOptions& min_frequency(double hz) {
+        min_frequency_ = hz;
+        return *this;
+    }
+
+    /// Highest filter edge in Hz; 0 (the default) is `sample_rate / 2`.
+    double max_frequency() const {
+        return max_frequency_ > 0.0 ? max_frequency_ : sample_rate_ / 2.0;
+    }
+
+    MelOptions& max_frequency(double hz) {
+        max_frequency_ = hz;
+        return *this;
+    }
+
+    /// If true, `MelSpectrogram` emits decibels like librosa's
+    /// `power_to_db(S, ref=1.0, amin=1e-10, top_db=top_db())`. Defaults to
+    /// false (mel power). `Mfcc` always works on decibels.
+    bool log() const {
+        return log_;
+    }
+
+    MelOptions& log(bool log) {
+        log_ = log;
+        return *this;
+    }
+
+    /// Decibels below the largest value of a call at which log outputs are
+    /// clamped; 0 disables the clamp. Defaults to 80. The maximum is taken per
+    /// call, so a stream fed in chunks clamps each chunk on its own.
+    float top_db() const {
+        return top_db_;
+    }
+
+    MelOptions& top_db(float top_db) {
+        top_db_ = top_db;
+        return *this;
+    }
+
+    /// Cepstral coefficients `Mfcc` keeps. Defaults to 20.
+    size_t coefficients() const {
+        return coefficients_;
+    }
+
+    MelOptions& coefficients(size_t coefficients) {
+        coefficients_ = coefficients;
+        return *this;
+    }
+
+  private:
+    double sample_rate_;
+    size_t frame_length_;
+    size_t mels_ = 128;
+    double min_frequency_ = 0.0;
+    double max_frequency_ = 0.0;
+    bool log_ = false;
+    float top_db_ = 80.0F;
+    size_t coefficients_ = 20;
+};
+
+/// Mel spectrogram of complex spectra, as librosa's `melspectrogram` with its
+/// defaults (power 2, Slaney mel scale and area normalisation).
+///
+/// The input is an `Stft` or real `Fft` output, so the framing, window and
+/// streaming are theirs: feed chunks through an `Stft` with
+/// `WindowFunction::PeriodicHanning` to match librosa with `center=False`.
+/// Each triangular filter is stored over its non-zero bins only and applied
+/// as a SIMD dot product with the frame's power spectrum.
+class MelSpectrogram {
+  public:
+    /// # Errors
+    /// * InvalidArgument: the sample rate, frame length (below 2) or band count
+    ///   is 0, or the frequency range is empty or above `sample_rate / 2`.
+    static P10Result<MelSpectrogram> create(const MelOptions& options);
+
+    /// Maps `spectrum` (`[..., frame_length / 2 + 1, 2]`, Float32) to `mel`
+    /// (`[..., mels]`). Every leading dimension (channels, frames) is a batch.
+    ///
+    /// # Errors
+    /// * InvalidArgument: `spectrum` is not a contiguous Float32 CPU tensor
+    ///   of that shape.
+    P10Error transform(const Tensor& spectrum, Tensor& mel) const;
+
+    /// The dense `[mels, frame_length / 2 + 1]` filter bank, for inspection.
+    Tensor filters() const;
+
+  private:
+    explicit MelSpectrogram(const MelOptions& options) : options_(options) {}
+
+    MelOptions options_;
+    // Filter m covers bins [first_[m], first_[m] + count_[m]) with weights
+    // from weights_[offset_[m]].
+    std::vector<int64_t> first_;
+    std::vector<int64_t> count_;
+    std::vector<int64_t> offset_;
+    std::vector<float> weights_;
+};
+
+/// Mel-frequency cepstral coefficients, as librosa's `mfcc` with its defaults:
+/// the orthonormal DCT-II of the decibel mel spectrogram, first
+/// `coefficients()` kept.
+class Mfcc {
+  public:
+    /// # Errors
+    /// * InvalidArgument: as `MelSpectrogram::create`, or `coefficients()` is
+    ///   0 or above `mels()`.
+    static P10Result<Mfcc> create(const MelOptions& options);
+
+    /// Maps `spectrum` (`[..., frame_length / 2 + 1, 2]`, Float32) to `mfcc`
+    /// (`[..., coefficients]`).
+    ///
+    /// # Errors
+    /// * InvalidArgument: as `MelSpectrogram::transform`.
+    P10Error transform(const Tensor& spectrum, Tensor& mfcc);
+
+  private:
+    Mfcc(MelSpectrogram mel, std::vector<float> dct) :
+        mel_(std::move(mel)),
+        dct_(std::move(dct)) {}
+
+    MelSpectrogram mel_;
+    // [coefficients, mels] DCT-II rows.
+    std::vector<float> dct_;
+    Tensor decibels_;
+};
+
+}  // namespace p10::op
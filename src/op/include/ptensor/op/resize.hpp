@@ -1,18 +1,73 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
 #include "ptensor/p10_error.hpp"
+#include "ptensor/p10_result.hpp"
 
 namespace p10 {
 class Tensor;
 }
 
 namespace p10::op {
-/// Resize a tensor using nearest-neighbor sampling.
+
+/// How `resize` computes an output pixel from the source pixels around it.
+///
+/// The interpolating modes place pixel centers at half-integer coordinates, so
+/// output pixel `x` samples the source at `(x + 0.5) * (width / new_width) - 0.5`,
+/// and replicate the edge pixels past the borders.
+enum class Interpolation : uint8_t {
+    /// Copies the source pixel at `x * (width / new_width)`. Fastest, but
+    /// aliases when downscaling and blocks when upscaling.
+    Nearest,
+    /// Weights the 2x2 source pixels around the sample point. Smooth for
+    /// upscaling and mild downscaling (up to 2x).
+    Bilinear,
+    /// Cubic convolution over the 4x4 source pixels around the sample point
+    /// (a = -0.75). Sharper than bilinear; may overshoot at edges, so integer
+    /// outputs are saturated.
+    Bicubic,
+    /// Averages the source pixels each output pixel covers, weighted by the
+    /// covered fraction. The antialiasing choice for downscaling, at a cost
+    /// that grows with the scale factor.
+    Area,
+};
+
+/// Options for `resize`.
+class ResizeOptions {
+  public:
+    ResizeOptions() = default;
+
+    ResizeOptions(Interpolation interpolation) : interpolation_(interpolation) {}
+
+    /// The interpolation mode. Defaults to `Interpolation::Nearest`.
+    Interpolation interpolation() const {
+        return interpolation_;
+    }
+
+    ResizeOptions& interpolation(Interpolation interpolation) {
+        interpolation_ = interpolation;
+        return *this;
+    }
+
+  private:
+    Interpolation interpolation_ = Interpolation::Nearest;
+};
+
+/// Resize a tensor, by default using nearest-neighbor sampling.
 ///
 /// Both input and output tensors use layout [C x H x W] (channels-first).
 /// The output tensor is allocated internally; any existing content is overwritten.
-/// Supports all dtypes. On x86/x86-64 with AVX2, contiguous uint8 tensors use
-/// an optimized SIMD path.
+/// Supports all numeric dtypes. On x86/x86-64 with AVX2, contiguous uint8 tensors use
+/// an optimized SIMD path for nearest sampling.
+///
+/// The interpolating modes resample each plane in two separable passes over
+/// per-row and per-column tables of source indices and weights, built once per
+/// call; output rows are spread over the parallel workers. uint8 runs in
+/// fixed point (Q11 weights), float32 in float and every other dtype in the
+/// wider blur accumulator; integer outputs are rounded and saturated.
 ///
 /// # Arguments
 ///
@@ -21,9 +76,65 @@ namespace p10::op {
 ///   and the same dtype as `input`.
 /// * `new_width`: Target width in pixels.
 /// * `new_height`: Target height in pixels.
+/// * `options`: Interpolation mode.
 ///
 /// # Returns
 ///
 /// * `P10Error::Ok` on success, or an error if the input shape is invalid.
-P10Error resize(const Tensor& input, Tensor& output, size_t new_width, size_t new_height);
+///
+/// # Errors
+/// * InvalidArgument: `input` is not 3D, or an interpolating mode gets empty
+///   input planes or a non-numeric dtype.
+P10Error resize(
+    const Tensor& input,
+    Tensor& output,
+    size_t new_width,
+    size_t new_height,
+    const ResizeOptions& options = ResizeOptions()
+);
+/// Resizes interleaved `[H, W, C]` images, uint8 or float32 (the layout video
+/// frames decode to), without a round trip through planar `[C, H, W]`.
+///
+/// The source row and column tables depend only on the input shape: the first
+/// `transform` builds them and later calls reuse them until the shape changes,
+/// so keep one instance per stream. Nearest sampling copies whole pixels
+/// through the column table; uint8 images with 3 or 4 channels assemble four
+/// output pixels per register with a byte shuffle (SSE4.1, NEON) and write
+/// them with one store. The interpolating modes run the kernels of `resize`
+/// over the interleaved rows.
+///
+/// Not thread-safe: `transform` updates the cached tables.
+class ImageResize {
+  public:
+    /// Creates a resizer to `new_width` x `new_height` pixels.
+    ///
+    /// # Errors
+    /// * InvalidArgument: `new_width` or `new_height` is zero.
+    static P10Result<ImageResize>
+    create(size_t new_width, size_t new_height, const ResizeOptions& options = ResizeOptions());
+
+    ImageResize(ImageResize&& other) noexcept;
+    ImageResize& operator=(ImageResize&& other) noexcept;
+    ImageResize(const ImageResize&) = delete;
+    ImageResize& operator=(const ImageResize&) = delete;
+    ~ImageResize();
+
+    /// Resizes `image` into `output`, created as `[new_height, new_width, C]`
+    /// with the dtype of `image`.
+    ///
+    /// # Errors
+    /// * InvalidArgument: `image` is not 3D, has no pixels or channels, or is
+    ///   neither uint8 nor float32.
+    P10Error transform(const Tensor& image, Tensor& output);
+
+  private:
+    struct Plan;
+
+    ImageResize(int64_t new_width, int64_t new_height, Interpolation interpolation);
+
+    int64_t new_width_;
+    int64_t new_height_;
+    Interpolation interpolation_;
+    std::unique_ptr<Plan> plan_;
+};
 }  // namespace p10::op
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <ptensor/p10_error.hpp>
+#include <ptensor/p10_result.hpp>
+#include <ptensor/tensor.hpp>
+
+#include "fft.hpp"
+#include "window_function.hpp"
+
+namespace p10::op {
+
+/// Options for `Stft` and `Istft`.
+class StftOptions {
+  public:
+    /// Frames of `frame_length` samples, starting every `hop_length` samples.
+    StftOptions(size_t frame_length, size_t hop_length) :
+        frame_length_(frame_length),
+        hop_length_(hop_length) {}
+
+    /// Samples per frame, and so the FFT length.
+    size_t frame_length() const {
+        return frame_length_;
+    }
+
+    /// Samples between the starts of consecutive frames.
+    size_t hop_length() const {
+        return hop_length_;
+    }
+
+    /// Frequency bins per frame, `frame_length / 2 + 1`.
+    size_t bins() const {
+        return (frame_length_ / 2) + 1;
+    }
+
+    /// Analysis (and synthesis) window. Defaults to `WindowFunction::Hanning`.
+    WindowFunction::Function window() const {
+        return window_;
+    }
+
+    StftOptions& window(WindowFunction::Function window) {
+        window_ = window;
+        return *this;
+    }
+
+  private:
+    size_t frame_length_;
+    size_t hop_length_;
+    WindowFunction::Function window_ = WindowFunction::Hanning;
+};
+
+/// Streaming short-time Fourier transform of Float32 mono audio.
+///
+/// Chunks of any length are appended to an internal buffer; each call emits
+/// the frames that became complete, windowed and transformed as one batch of
+/// real FFTs. Samples still needed by later frames are kept for the next call,
+/// so consecutive calls see one continuous signal. The window is generated
+/// once and, once chunk sizes repeat, no call allocates.
+///
+/// Not thread-safe; use one instance per stream.
+class Stft {
+  public:
+    /// # Errors
+    /// * InvalidArgument: `frame_length` is below 2, or `hop_length` is 0 or
+    ///   above `frame_length`.
+    static P10Result<Stft> create(const StftOptions& options);
+
+    /// Appends `chunk` (`[T]`, Float32) and writes the completed frames to
+    /// `spectrum` as `[frames, bins, 2]` (real, imaginary), unnormalised.
+    /// `frames` is 0 until `frame_length` samples have arrived.
+    ///
+    /// # Errors
+    /// * InvalidArgument: `chunk` is not a contiguous 1D Float32 CPU tensor.
+    P10Error transform(const Tensor& chunk, Tensor& spectrum);
+
+    /// Drops the buffered samples, starting a new stream.
+    void reset();
+
+  private:
+    explicit Stft(const StftOptions& options);
+
+    StftOptions options_;
+    Tensor window_;
+    std::unique_ptr<Fft> fft_;
+    // Samples not yet consumed by a hop; the next frame starts at index 0.
+    std::vector<float> pending_;
+    Tensor frames_;
+};
+
+/// Streaming inverse of `Stft`: overlap-adds the windowed inverse FFT of each
+/// frame and divides by the overlapped squared window, so an `Stft` spectrum
+/// with the same options comes back as the original samples.
+///
+/// Each frame completes `hop_length` samples; the `frame_length - hop_length`
+/// still open at the end of a call are emitted by later calls or `flush`.
+/// Samples whose squared window sum is ~0 (the very start under a Hanning
+/// window) are left unnormalised.
+///
+/// Not thread-safe; use one instance per stream.
+class Istft {
+  public:
+    /// # Errors
+    /// * InvalidArgument: as `Stft::create`, or `frame_length` is odd.
+    static P10Result<Istft> create(const StftOptions& options);
+
+    /// Reconstructs `spectrum` (`[frames, bins, 2]`, Float32) into `chunk`,
+    /// `[frames * hop_length]` samples.
+    ///
+    /// # Errors
+    /// * InvalidArgument: `spectrum` is not a contiguous Float32 CPU tensor of
+    ///   shape `[frames, bins, 2]`.
+    P10Error transform(const Tensor& spectrum, Tensor& chunk);
+
+    /// Emits the `frame_length - hop_length` samples still open into `chunk`
+    /// and ends the stream.
+    P10Error flush(Tensor& chunk);
+
+    /// Drops the open samples, starting a new stream.
+    void reset();
+
+  private:
+    explicit Istft(const StftOptions& options);
+
+    StftOptions options_;
+    Tensor window_;
+    std::unique_ptr<Fft> fft_;
+    // Overlap-add sums of the samples still open, and of the squared window
+    // at each of them.
+    std::vector<float> overlap_;
+    std::vector<float> weight_;
+    Tensor frames_;
+};
+
+}  // namespace p10::op
@@ -12,15 +12,24 @@ class Tensor;
 namespace p10::op {
 class WindowFunction {
   public:
-    enum Function { Hanning, Hamming, Identity };
+    /// `PeriodicHanning` is the Hanning window of `size + 1` samples without
+    /// its last one, as used by librosa and scipy for spectral analysis.
+    enum Function { Hanning, Hamming, Identity, PeriodicHanning };
 
     WindowFunction(Function func);
 
+    /// Multiplies each row of the `[N, T]` `input` (N signals of T samples) by
+    /// the T-sample window.
     P10Error transform(const Tensor& input, Tensor& output);
 
     P10Error transform_borders(const Tensor& input, Tensor& output, size_t border_size);
 
+    /// Writes the `size`-sample window of `func` into `output`, a 1D tensor of
+    /// `type`.
+    static P10Error generate(Function func, size_t size, Dtype type, Tensor& output);
+
   private:
+    // Regenerates `window_` only when the size or dtype changes.
     P10Error generate_window(size_t size, Dtype type);
 
     Function func_;
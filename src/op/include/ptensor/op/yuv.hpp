@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cstdint>
+
+#include "ptensor/op/image_layout.hpp"
+#include "ptensor/p10_error.hpp"
+
+namespace p10 {
+class Tensor;
+}
+
+namespace p10::op {
+
+/// Memory layout of a YUV frame. Every format is passed as one contiguous
+/// uint8 tensor holding the frame's bytes, rows of planes stacked the way
+/// decoders and capture devices lay them out.
+enum class YuvFormat : uint8_t {
+    /// 4:2:0: the `H x W` Y plane, then an `H / 2 x W` plane of interleaved
+    /// U, V pairs. A `[H * 3 / 2, W]` tensor.
+    NV12,
+    /// 4:2:0: the `H x W` Y plane, then the `H / 2 x W / 2` U and V planes.
+    /// A `[H * 3 / 2, W]` tensor.
+    I420,
+    /// 4:2:2 packed: Y0 U Y1 V for each pair of pixels. A `[H, W * 2]`
+    /// tensor.
+    YUYV,
+};
+
+/// Luma coefficients the frame was encoded with.
+enum class YuvMatrix : uint8_t {
+    /// ITU-R BT.601, standard definition video and JPEG.
+    BT601,
+    /// ITU-R BT.709, HD video.
+    BT709,
+};
+
+/// Range of the coded values.
+enum class YuvRange : uint8_t {
+    /// Y in [16, 235], U and V in [16, 240]: the broadcast and most video
+    /// codecs' default.
+    Limited,
+    /// Y, U and V over the whole [0, 255]: JPEG and some cameras.
+    Full,
+};
+
+/// Options for `yuv_to_rgb` and `yuv_to_model_input`.
+class YuvOptions {
+  public:
+    YuvOptions() = default;
+
+    YuvOptions(YuvFormat format) : format_(format) {}
+
+    /// Layout of the input frame. Defaults to `YuvFormat::NV12`.
+    YuvFormat format() const {
+        return format_;
+    }
+
+    YuvOptions& format(YuvFormat format) {
+        format_ = format;
+        return *this;
+    }
+
+    /// Conversion matrix. Defaults to `YuvMatrix::BT601`.
+    YuvMatrix matrix() const {
+        return matrix_;
+    }
+
+    YuvOptions& matrix(YuvMatrix matrix) {
+        matrix_ = matrix;
+        return *this;
+    }
+
+    /// Range of the coded values. Defaults to `YuvRange::Limited`.
+    YuvRange range() const {
+        return range_;
+    }
+
+    YuvOptions& range(YuvRange range) {
+        range_ = range;
+        return *this;
+    }
+
+    /// If true, the channels come out in B, G, R order. Defaults to false.
+    bool bgr() const {
+        return bgr_;
+    }
+
+    YuvOptions& bgr(bool bgr) {
+        bgr_ = bgr;
+        return *this;
+    }
+
+  private:
+    YuvFormat format_ = YuvFormat::NV12;
+    YuvMatrix matrix_ = YuvMatrix::BT601;
+    YuvRange range_ = YuvRange::Limited;
+    bool bgr_ = false;
+};
+
+/// Converts a YUV frame to an interleaved RGB (or BGR) image.
+///
+/// Chroma samples apply to every pixel they cover (no chroma filtering). The
+/// conversion runs in 16-bit fixed point, vectorised and parallel over
+/// rows: the chroma terms of a chroma row are computed once for the luma
+/// rows sharing it, and the channel rows are interleaved with the byte
+/// shuffles of `image_from_tensor`. Results are within 1 of the rounded
+/// exact conversion and identical on every SIMD tier.
+///
+/// # Arguments
+///
+/// * `yuv` - The frame, uint8 and contiguous, laid out as `options.format()`
+///   describes.
+/// * `rgb` - Created as uint8 `[H, W, 3]`.
+/// * `options` - Format, matrix, range and channel order.
+///
+/// # Returns
+///
+/// * `P10Error::Ok` on success.
+/// * `P10Error::InvalidArgument` if `yuv` is not uint8, not 2D or not
+///   contiguous, or its shape does not describe a non-empty frame of
+///   `options.format()` with an even width (and, for 4:2:0, an even height).
+P10Error yuv_to_rgb(const Tensor& yuv, Tensor& rgb, const YuvOptions& options = YuvOptions());
+
+/// Converts a YUV frame straight to a planar model input, the same values
+/// as `image_to_tensor` of the `yuv_to_rgb` result without the intermediate
+/// interleaved image: each converted row is normalised into the output
+/// planes while it is still in cache.
+///
+/// # Arguments
+///
+/// * `yuv` - The frame, as for `yuv_to_rgb`.
+/// * `output` - Created as float32 `[3, H, W]`, or `[1, 3, H, W]` with
+///   `options.unsqueeze()`.
+/// * `yuv_options` - Format, matrix, range and channel order; `mean` and
+///   `std` are indexed in the output channel order.
+/// * `options` - Normalisation, as for `image_to_tensor`.
+///
+/// # Returns
+///
+/// * `P10Error::Ok` on success.
+/// * `P10Error::InvalidArgument` for the frames `yuv_to_rgb` rejects, a target
+///   dtype other than float32, `mean` or `std` with a length other than 3,
+///   or a zero `std` entry.
+P10Error yuv_to_model_input(
+    const Tensor& yuv,
+    Tensor& output,
+    const YuvOptions& yuv_options = YuvOptions(),
+    const ImageToTensorOptions& options = ImageToTensorOptions()
+);
+
+}  // namespace p10::op
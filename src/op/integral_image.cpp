@@ -0,0 +1,366 @@
+#include "integral_image.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include <p10_internal/simd/parallel_for.hpp>
+#include <p10_internal/simd/vec.hpp>
+#include <ptensor/config.h>
+#include <ptensor/dtype.hpp>
+#include <ptensor/p10_error.hpp>
+#include <ptensor/tensor.hpp>
+
+namespace p10::op {
+
+namespace {
+    // Pixels per worker below which the passes stay on the caller.
+    constexpr int64_t INTEGRAL_MIN_WORKER_PIXELS = 64 * 1024;
+
+    // Column strips of the vertical pass are rounded to this many columns, so
+    // strips start on whole registers and stay a few cache lines wide.
+    constexpr int64_t INTEGRAL_STRIP_ALIGN = 64;
+
+    // Summed-area table scalar for pixel type T: uint8 wraps in uint32 (box
+    // differences stay exact), everything else sums in double.
+    template<typename T>
+    using integral_t = std::conditional_t<std::is_same_v<T, uint8_t>, uint32_t, double>;
+
+    // `shape` with its last two extents grown by one.
+    P10Result<Shape> integral_shape(const Shape& shape) {
+        const auto extents = shape.as_span();
+        std::array<int64_t, P10_MAX_SHAPE> grown {};
+        std::copy(extents.begin(), extents.end(), grown.begin());
+        grown[extents.size() - 1] += 1;
+        grown[extents.size() - 2] += 1;
+        return make_shape(std::span<const int64_t>(grown.data(), extents.size()));
+    }
+
+    // Row y of `image` as inclusive prefix sums into row y + 1 of `table`,
+    // behind its zero first column. The carry runs along the row, so this
+    // half of the scan is scalar.
+    template<typename scalar_t, typename sum_t, typename Value>
+    void prefix_row(std::span<const scalar_t> row, std::span<sum_t> out, Value value) {
+        sum_t sum = 0;
+        out[0] = 0;
+        for (size_t x = 0; x < row.size(); ++x) {
+            sum += value(row[x]);
+            out[x + 1] = sum;
+        }
+    }
+
+    // Adds every row of `table` into the next over columns [col_begin,
+    // col_end), turning row prefix sums into the summed-area table. Columns
+    // are independent here, so whole registers of S add at once.
+    template<simd::SimdSet S, typename sum_t>
+    void accumulate_rows(Span2D<sum_t> table, int64_t col_begin, int64_t col_end) {
+        using V = simd::NativeVec<sum_t, S>;
+        constexpr auto LANES = static_cast<int64_t>(V::LANES);
+        for (int64_t row = 2; row < table.rows(); ++row) {
+            const sum_t* above = table[row - 1].data();
+            sum_t* current = table[row].data();
+            int64_t col = col_begin;
+            for (; col + LANES <= col_end; col += LANES) {
+                (V::load(current + col) + V::load(above + col)).store(current + col);
+            }
+            for (; col < col_end; ++col) {
+                current[col] += above[col];
+            }
+        }
+    }
+
+    // Summed-area tables of every plane of `src`, the squared one only when
+    // `squared` is non-null. Rows are independent in the first pass and column
+    // strips in the second, so each pass is split across the workers on its
+    // own axis.
+    template<typename scalar_t>
+    void integral_planes(
+        Span3D<const scalar_t> src,
+        Span3D<integral_t<scalar_t>> sum,
+        Span3D<double>* squared
+    ) {
+        using sum_t = integral_t<scalar_t>;
+        const int64_t planes = src.channels();
+        const int64_t rows = src.rows();
+        const int64_t table_cols = sum.cols();
+        if (planes == 0) {
+            return;
+        }
+        const int threads =
+            simd::parallel_workers(planes * rows * src.cols(), INTEGRAL_MIN_WORKER_PIXELS);
+
+        for (int64_t plane = 0; plane < planes; ++plane) {
+            std::ranges::fill(sum[plane][0], sum_t {0});
+            if (squared != nullptr) {
+                std::ranges::fill((*squared)[plane][0], 0.0);
+            }
+        }
+
+        simd::parallel_for(planes * rows, threads, [&](int64_t job) {
+            const int64_t plane = job / rows;
+            const int64_t row = job % rows;
+            const auto pixels = src[plane][row];
+            prefix_row(pixels, sum[plane][row + 1], [](scalar_t value) {
+                return static_cast<sum_t>(value);
+            });
+            if (squared != nullptr) {
+                prefix_row(pixels, (*squared)[plane][row + 1], [](scalar_t value) {
+                    const auto x = static_cast<double>(value);
+                    return x * x;
+                });
+            }
+        });
+
+        const int64_t strips_per_plane = (threads + planes - 1) / planes;
+        const int64_t strip_cols = std::max<int64_t>(
+            (((table_cols + strips_per_plane - 1) / strips_per_plane) + INTEGRAL_STRIP_ALIGN - 1)
+                / INTEGRAL_STRIP_ALIGN * INTEGRAL_STRIP_ALIGN,
+            INTEGRAL_STRIP_ALIGN
+        );
+        const int64_t strips = (table_cols + strip_cols - 1) / strip_cols;
+        simd::parallel_for(planes * strips, threads, [&](int64_t job) {
+            const int64_t plane = job / strips;
+            const int64_t col_begin = (job % strips) * strip_cols;
+            const int64_t col_end = std::min(col_begin + strip_cols, table_cols);
+            simd::call_in_best_tier([&](auto tier) {
+                accumulate_rows<decltype(tier)::value>(sum[plane], col_begin, col_end);
+                if (squared != nullptr) {
+                    accumulate_rows<decltype(tier)::value>((*squared)[plane], col_begin, col_end);
+                }
+            });
+        });
+    }
+
+    P10Error integral_image_impl(const Tensor& image, Tensor& sum, Tensor* squared_sum) {
+        if (image.shape().dims() < 2) {
+            return P10Error::InvalidArgument << "Input tensor must have at least 2 dimensions.";
+        }
+        auto shape_res = integral_shape(image.shape());
+        if (shape_res.is_error()) {
+            return shape_res.error();
+        }
+        const Shape table_shape = shape_res.unwrap();
+
+        return image.dtype().match([&](auto type_tag) -> P10Error {
+            using scalar_t = decltype(type_tag)::type;
+
+            if constexpr (std::is_arithmetic_v<scalar_t>) {
+                using sum_t = integral_t<scalar_t>;
+                auto src_res = image.as_span3d<const scalar_t, RankFit::Flexible>();
+                if (src_res.is_error()) {
+                    return src_res.error();
+                }
+
+                P10_RETURN_IF_ERROR(sum.create(table_shape, Dtype::from<sum_t>()));
+                auto sum_span = sum.as_span3d<sum_t, RankFit::Flexible>().unwrap();
+                if (squared_sum == nullptr) {
+                    integral_planes<scalar_t>(src_res.unwrap(), sum_span, nullptr);
+                    return P10Error::Ok;
+                }
+
+                P10_RETURN_IF_ERROR(squared_sum->create(table_shape, Dtype::Float64));
+                auto squared_span = squared_sum->as_span3d<double, RankFit::Flexible>().unwrap();
+                integral_planes<scalar_t>(src_res.unwrap(), sum_span, &squared_span);
+                return P10Error::Ok;
+            } else {
+                return P10Error::InvalidArgument << "Unsupported data type for this operation.";
+            }
+        });
+    }
+
+    // Pixels per worker below which the box filter stays on the caller.
+    constexpr int64_t BOX_MIN_WORKER_PIXELS = 32 * 1024;
+
+    // Box sums along one source row, edges replicated: the window total is
+    // seeded once, then slides by adding the entering pixel and subtracting
+    // the leaving one. Sums run in double, exact for every integer dtype.
+    template<typename scalar_t>
+    void box_row(std::span<const scalar_t> row, int64_t radius, double* out) {
+        const auto cols = static_cast<int64_t>(row.size());
+        const auto at = [&](int64_t col) {
+            return static_cast<double>(row[std::clamp<int64_t>(col, 0, cols - 1)]);
+        };
+        double window = 0.0;
+        for (int64_t k = -radius; k <= radius; ++k) {
+            window += at(k);
+        }
+        // Only the first and last `radius` + 1 columns reach past an edge.
+        const int64_t interior_begin = std::min(radius, cols);
+        const int64_t interior_end = std::max(cols - radius - 1, interior_begin);
+        int64_t col = 0;
+        for (; col < interior_begin; ++col) {
+            out[col] = window;
+            window += at(col + radius + 1) - at(col - radius);
+        }
+        const scalar_t* pixels = row.data();
+        for (; col < interior_end; ++col) {
+            out[col] = window;
+            window += static_cast<double>(pixels[col + radius + 1])
+                - static_cast<double>(pixels[col - radius]);
+        }
+        for (; col < cols; ++col) {
+            out[col] = window;
+            window += at(col + radius + 1) - at(col - radius);
+        }
+    }
+
+    // Per-job scratch of box_band: the running column sums and the row sums
+    // entering and leaving the window.
+    struct BoxLines {
+        std::vector<double> columns;
+        std::vector<double> entering;
+        std::vector<double> leaving;
+
+        explicit BoxLines(int64_t cols) :
+            columns(static_cast<size_t>(cols)),
+            entering(static_cast<size_t>(cols)),
+            leaving(static_cast<size_t>(cols)) {}
+    };
+
+    // Box filter of rows [row_begin, row_end) of one plane. The column sums
+    // are seeded with the 2 * radius + 1 row sums around row_begin, then each
+    // row moves the window down one row: one row sum enters, one leaves, and
+    // the column update runs whole registers of S.
+    template<simd::SimdSet S, typename scalar_t>
+    void box_band(
+        Span2D<const scalar_t> src,
+        Span2D<scalar_t> dst,
+        int64_t row_begin,
+        int64_t row_end,
+        int64_t radius,
+        BoxLines& lines
+    ) {
+        using V = simd::NativeVec<double, S>;
+        constexpr auto LANES = static_cast<int64_t>(V::LANES);
+        const int64_t rows = src.rows();
+        const int64_t cols = src.cols();
+        const auto source_row = [&](int64_t row) {
+            return src[std::clamp<int64_t>(row, 0, rows - 1)];
+        };
+        const double scale = 1.0 / static_cast<double>(((2 * radius) + 1) * ((2 * radius) + 1));
+        double* columns = lines.columns.data();
+        double* entering = lines.entering.data();
+        double* leaving = lines.leaving.data();
+
+        std::ranges::fill(lines.columns, 0.0);
+        for (int64_t k = -radius; k <= radius; ++k) {
+            box_row(source_row(row_begin + k), radius, entering);
+            for (int64_t col = 0; col < cols; ++col) {
+                columns[col] += entering[col];
+            }
+        }
+
+        for (int64_t row = row_begin; row < row_end; ++row) {
+            auto out = dst[row];
+            for (int64_t col = 0; col < cols; ++col) {
+                const double mean = columns[col] * scale;
+                if constexpr (std::is_integral_v<scalar_t>) {
+                    out[col] = static_cast<scalar_t>(std::floor(mean + 0.5));
+                } else {
+                    out[col] = static_cast<scalar_t>(mean);
+                }
+            }
+            if (row + 1 == row_end) {
+                break;
+            }
+
+            box_row(source_row(row + radius + 1), radius, entering);
+            box_row(source_row(row - radius), radius, leaving);
+            int64_t col = 0;
+            for (; col + LANES <= cols; col += LANES) {
+                const V moved = V::load(columns + col) + V::load(entering + col)
+                    - V::load(leaving + col);
+                moved.store(columns + col);
+            }
+            for (; col < cols; ++col) {
+                columns[col] += entering[col] - leaving[col];
+            }
+        }
+    }
+
+    template<typename scalar_t>
+    void box_planes(Span3D<const scalar_t> src, Span3D<scalar_t> dst, int64_t radius) {
+        const int64_t channels = src.channels();
+        const int64_t rows = src.rows();
+        const int64_t cols = src.cols();
+        if (channels == 0 || rows == 0 || cols == 0) {
+            return;
+        }
+
+        const int threads = simd::parallel_workers(channels * rows * cols, BOX_MIN_WORKER_PIXELS);
+        // As in fused_blur: a job per worker, but bands several windows tall so
+        // the seeding rows stay a small share of each band.
+        const int64_t bands = std::clamp<int64_t>(
+            (threads + channels - 1) / channels,
+            1,
+            std::max<int64_t>(rows / (4 * ((2 * radius) + 1)), 1)
+        );
+        const int64_t band_rows = (rows + bands - 1) / bands;
+
+        simd::parallel_for(channels * bands, threads, [&](int64_t job) {
+            const int64_t channel = job / bands;
+            const int64_t row_begin = (job % bands) * band_rows;
+            const int64_t row_end = std::min(row_begin + band_rows, rows);
+            if (row_begin >= row_end) {
+                return;
+            }
+            BoxLines lines(cols);
+            simd::call_in_best_tier([&](auto tier) {
+                box_band<decltype(tier)::value>(
+                    src[channel],
+                    dst[channel],
+                    row_begin,
+                    row_end,
+                    radius,
+                    lines
+                );
+            });
+        });
+    }
+}  // namespace
+
+P10Error integral_image(const Tensor& image, Tensor& sum) {
+    return integral_image_impl(image, sum, nullptr);
+}
+
+P10Error integral_image(const Tensor& image, Tensor& sum, Tensor& squared_sum) {
+    return integral_image_impl(image, sum, &squared_sum);
+}
+
+P10Error box_filter(const Tensor& image, size_t radius, Tensor& output) {
+    if (image.shape().dims() < 2) {
+        return P10Error::InvalidArgument << "Input tensor must have at least 2 dimensions.";
+    }
+
+    // Bands read rows other bands write, so an in-place call filters a copy.
+    Tensor scratch;
+    const Tensor* source = &image;
+    if (image.as_bytes().data() == output.as_bytes().data()) {
+        P10_RETURN_IF_ERROR(scratch.create(image.shape(), image.dtype()));
+        P10_RETURN_IF_ERROR(scratch.copy_from(image));
+        source = &scratch;
+    }
+
+    return source->dtype().match([&](auto type_tag) -> P10Error {
+        using scalar_t = decltype(type_tag)::type;
+
+        if constexpr (std::is_arithmetic_v<scalar_t>) {
+            auto src_res = source->as_span3d<const scalar_t, RankFit::Flexible>();
+            if (src_res.is_error()) {
+                return src_res.error();
+            }
+            P10_RETURN_IF_ERROR(output.create(image.shape(), image.dtype()));
+            auto dst = output.as_span3d<scalar_t, RankFit::Flexible>().unwrap();
+            box_planes<scalar_t>(src_res.unwrap(), dst, static_cast<int64_t>(radius));
+            return P10Error::Ok;
+        } else {
+            return P10Error::InvalidArgument << "Unsupported data type for this operation.";
+        }
+    });
+}
+
+}  // namespace p10::op
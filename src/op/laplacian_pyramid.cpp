@@ -33,7 +33,13 @@ void LaplacianPyramid::store_gaussian_pyramid(const Tensor& in_tensor, size_t nu
         const auto half_width = prev.shape(2).unwrap() / 2;
 
         blur_op_.transform(prev, blur_buffer).expect("Blur failed");
-        resize(blur_buffer, gaussian_pyramid_[level], half_width, half_height)
+        resize(
+            blur_buffer,
+            gaussian_pyramid_[level],
+            half_width,
+            half_height,
+            Interpolation::Bilinear
+        )
             .expect("Resize failed");
     }
 }
@@ -47,7 +53,13 @@ void LaplacianPyramid::pyramid_from_gaussian_to_laplacian(std::span<Tensor> outp
         size_t const height = gaussian_pyramid_[level].shape(1).unwrap();
         size_t const width = gaussian_pyramid_[level].shape(2).unwrap();
 
-        resize(gaussian_pyramid_[level + 1], upsample_buffer, width, height)
+        resize(
+            gaussian_pyramid_[level + 1],
+            upsample_buffer,
+            width,
+            height,
+            Interpolation::Bilinear
+        )
             .expect("Upsample failed");
         subtract_elemwise(gaussian_pyramid_[level], upsample_buffer, output[level])
             .expect("Subtract failed");
@@ -69,12 +81,14 @@ P10Error LaplacianPyramid::reconstruct(std::span<const Tensor> pyramid, Tensor&
     P10_RETURN_IF_ERROR(output.create(pyramid[0].shape(), pyramid[0].dtype()));
     P10_RETURN_IF_ERROR(output.copy_from(pyramid.back()));
     for (int level = num_levels - 2; level >= 0; --level) {
-        const auto ll = pyramid[level].clone().unwrap();
+        const Tensor& ll = pyramid[level];
         const size_t height = ll.shape(1).unwrap();
         const size_t width = ll.shape(2).unwrap();
 
-        assert(resize(output, upsample_buffer, width, height).is_ok());
-        assert(add_elemwise(ll, upsample_buffer, output).is_ok());
+        P10_RETURN_IF_ERROR(
+            resize(output, upsample_buffer, width, height, Interpolation::Bilinear)
+        );
+        P10_RETURN_IF_ERROR(add_elemwise(ll, upsample_buffer, output));
     }
     return P10Error::Ok;
 }
@@ -0,0 +1,438 @@
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <p10_internal/simd/parallel_for.hpp>
+#include <p10_internal/simd/vec.hpp>
+#include <ptensor/op/letterbox.hpp>
+#include <ptensor/tensor.hpp>
+
+#include "resize.lines.hpp"
+
+namespace p10::op {
+
+namespace {
+    // Input shape a plan was built for, and everything derived from it.
+    struct LetterboxPlan {
+        int64_t height = 0;
+        int64_t width = 0;
+        int64_t channels = 0;
+
+        LetterboxGeometry geometry;
+        int64_t out_width = 0;
+        int64_t out_height = 0;
+
+        // Rows over the resized height; columns over the resized width,
+        // interleaved per channel for [H, W, C] input.
+        ResampleAxis rows_axis;
+        ResampleAxis cols_axis;
+        // Offset of every resized pixel's first value in an interleaved
+        // row, `x * channels`, for gathering one channel at a time.
+        std::vector<int32_t> pixel_index;
+        // Normalisation as one multiply-add per output channel:
+        // (x - mean) / std = x * scale + offset.
+        std::vector<float> scale;
+        std::vector<float> offset;
+    };
+
+    // Resized and padded size of one axis: fit `size` into `target` at
+    // `ratio`, then pad up to the smallest `target - k * stride` that holds
+    // it, or to `target` when `stride` is 0.
+    std::pair<int64_t, int64_t>
+    letterbox_axis(int64_t size, int64_t target, float ratio, int64_t stride) {
+        const auto resized = std::clamp<int64_t>(
+            static_cast<int64_t>(std::round(static_cast<float>(size) * ratio)),
+            1,
+            target
+        );
+        return {resized, stride > 0 ? resized + ((target - resized) % stride) : target};
+    }
+
+    // IEEE half of `value`, rounded to nearest even; overflow gives infinity
+    // and NaN stays NaN.
+    uint16_t float_to_half(float value) {
+        constexpr uint32_t FLOAT_INFINITY = 255u << 23;
+        constexpr uint32_t HALF_OVERFLOW = (127u + 16u) << 23;
+        constexpr uint32_t HALF_MIN_NORMAL = (127u - 14u) << 23;
+        // 0.5f: adding it lines the half subnormal bits up with the low
+        // float mantissa bits and lets the FPU do the rounding.
+        constexpr uint32_t SUBNORMAL_MAGIC = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+        uint32_t bits = std::bit_cast<uint32_t>(value);
+        const auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+        bits &= 0x7fffffffu;
+        if (bits >= HALF_OVERFLOW) {
+            return sign | (bits > FLOAT_INFINITY ? 0x7e00u : 0x7c00u);
+        }
+        if (bits < HALF_MIN_NORMAL) {
+            const float shifted =
+                std::bit_cast<float>(bits) + std::bit_cast<float>(SUBNORMAL_MAGIC);
+            const uint32_t half = std::bit_cast<uint32_t>(shifted) - SUBNORMAL_MAGIC;
+            return sign | static_cast<uint16_t>(half);
+        }
+        const uint32_t odd = (bits >> 13) & 1u;
+        bits += ((15u - 127u) << 23) + 0xfffu + odd;
+        return sign | static_cast<uint16_t>(bits >> 13);
+    }
+
+    template<simd::SimdSet S>
+    void widen_u8(const uint8_t* src, int32_t* dst, int64_t count) {
+        using V = simd::NativeVec<int32_t, S>;
+        constexpr auto LANES = static_cast<int64_t>(V::LANES);
+        int64_t x = 0;
+        for (; x + LANES <= count; x += LANES) {
+            V::load_u8(src + x).store(dst + x);
+        }
+        for (; x < count; ++x) {
+            dst[x] = src[x];
+        }
+    }
+
+    // out[x] = values[index[x]] * scale + offset, or values[x] when `index`
+    // is null.
+    template<simd::SimdSet S>
+    void normalize_values(
+        const int32_t* values,
+        const int32_t* index,
+        int64_t count,
+        float scale,
+        float offset,
+        float* out
+    ) {
+        using VI = simd::NativeVec<int32_t, S>;
+        using VF = simd::NativeVec<float, S>;
+        constexpr auto LANES = static_cast<int64_t>(VF::LANES);
+        const VF scale_vec = VF::broadcast(scale);
+        const VF offset_vec = VF::broadcast(offset);
+        int64_t x = 0;
+        for (; x + LANES <= count; x += LANES) {
+            const VI pixels =
+                index != nullptr ? VI::gather(values, index + x) : VI::load(values + x);
+            simd::fma(simd::convert<float>(pixels), scale_vec, offset_vec).store(out + x);
+        }
+        for (; x < count; ++x) {
+            const int32_t pixel = index != nullptr ? values[index[x]] : values[x];
+            out[x] = (static_cast<float>(pixel) * scale) + offset;
+        }
+    }
+
+    // One output row of every channel plane, as float32 or float16.
+    template<typename out_t>
+    struct OutputRows {
+        out_t* data;
+        int64_t plane_size;
+        int64_t width;
+
+        out_t* row(int64_t plane, int64_t y) const {
+            return data + (plane * plane_size) + (y * width);
+        }
+    };
+
+    template<typename out_t>
+    void fill_values(out_t* dst, int64_t count, out_t value) {
+        std::fill(dst, dst + count, value);
+    }
+
+    // Stores one channel of a resized row, normalised, with its side padding.
+    template<simd::SimdSet S, typename out_t>
+    void store_channel(
+        const int32_t* values,
+        const int32_t* index,
+        const LetterboxPlan& plan,
+        int64_t channel,
+        out_t pad,
+        out_t* dst,
+        std::vector<float>& normalized
+    ) {
+        const LetterboxGeometry& geometry = plan.geometry;
+        fill_values(dst, geometry.left, pad);
+        float* pixels = nullptr;
+        if constexpr (std::is_same_v<out_t, float>) {
+            pixels = dst + geometry.left;
+        } else {
+            pixels = normalized.data();
+        }
+        normalize_values<S>(
+            values,
+            index,
+            geometry.width,
+            plan.scale[channel],
+            plan.offset[channel],
+            pixels
+        );
+        if constexpr (!std::is_same_v<out_t, float>) {
+            for (int64_t x = 0; x < geometry.width; ++x) {
+                dst[geometry.left + x] = float_to_half(pixels[x]);
+            }
+        }
+        const int64_t right = geometry.left + geometry.width;
+        fill_values(dst + right, plan.out_width - right, pad);
+    }
+
+    // Output rows [begin, end) counted over all images: pads the rows above
+    // and below the image, and resamples, normalises and stores the others.
+    template<simd::SimdSet S, int64_t TAPS, typename out_t>
+    void letterbox_rows(
+        const uint8_t* images,
+        const OutputRows<out_t>& output,
+        const LetterboxPlan& plan,
+        bool planar,
+        bool reverse,
+        out_t pad,
+        int64_t begin,
+        int64_t end
+    ) {
+        using Lines = ResampleLines<uint8_t, S, TAPS>;
+        const LetterboxGeometry& geometry = plan.geometry;
+        const int64_t channels = plan.channels;
+        const int64_t image_size = plan.height * plan.width * channels;
+        // Values of one resampled row: all channels interleaved, or one plane.
+        const int64_t src_cols = planar ? plan.width : plan.width * channels;
+        const int64_t dst_cols = planar ? geometry.width : geometry.width * channels;
+
+        std::vector<int32_t> line(static_cast<size_t>(src_cols));
+        std::vector<uint8_t> resized(static_cast<size_t>(dst_cols));
+        std::vector<int32_t> values(static_cast<size_t>(dst_cols));
+        std::vector<float> normalized(static_cast<size_t>(geometry.width));
+        std::vector<const uint8_t*> rows(static_cast<size_t>(plan.rows_axis.taps));
+        std::vector<int32_t> weights(static_cast<size_t>(plan.rows_axis.taps));
+
+        const auto resample_row = [&]() {
+            Lines::vertical(
+                rows.data(),
+                weights.data(),
+                plan.rows_axis.taps,
+                line.data(),
+                src_cols
+            );
+            Lines::horizontal(
+                line.data(),
+                plan.cols_axis.index.data(),
+                plan.cols_axis.fixed.data(),
+                plan.cols_axis.taps,
+                resized.data(),
+                dst_cols
+            );
+            widen_u8<S>(resized.data(), values.data(), dst_cols);
+        };
+
+        for (int64_t row = begin; row < end; ++row) {
+            const int64_t image = row / plan.out_height;
+            const int64_t y = row % plan.out_height;
+            const uint8_t* src = images + (image * image_size);
+            const int64_t sy = y - geometry.top;
+            if (sy < 0 || sy >= geometry.height) {
+                for (int64_t c = 0; c < channels; ++c) {
+                    fill_values(output.row((image * channels) + c, y), plan.out_width, pad);
+                }
+                continue;
+            }
+
+            for (int64_t k = 0; k < plan.rows_axis.taps; ++k) {
+                const int64_t at = (k * geometry.height) + sy;
+                rows[k] = src + (plan.rows_axis.index[at] * src_cols);
+                weights[k] = plan.rows_axis.fixed[at];
+            }
+            if (!planar) {
+                resample_row();
+                for (int64_t c = 0; c < channels; ++c) {
+                    const int64_t input_channel = reverse ? channels - 1 - c : c;
+                    store_channel<S>(
+                        values.data() + input_channel,
+                        plan.pixel_index.data(),
+                        plan,
+                        c,
+                        pad,
+                        output.row((image * channels) + c, y),
+                        normalized
+                    );
+                }
+                continue;
+            }
+            for (int64_t input_channel = 0; input_channel < channels; ++input_channel) {
+                if (input_channel > 0) {
+                    const int64_t plane_step = plan.height * plan.width;
+                    for (auto& source_row : rows) {
+                        source_row += plane_step;
+                    }
+                }
+                resample_row();
+                const int64_t c = reverse ? channels - 1 - input_channel : input_channel;
+                store_channel<S>(
+                    values.data(),
+                    nullptr,
+                    plan,
+                    c,
+                    pad,
+                    output.row((image * channels) + c, y),
+                    normalized
+                );
+            }
+        }
+    }
+}  // namespace
+
+struct LetterboxPreprocess::Plan : LetterboxPlan {};
+
+LetterboxPreprocess::LetterboxPreprocess(const LetterboxOptions& options) :
+    options_(options),
+    plan_(std::make_unique<Plan>()) {}
+
+LetterboxPreprocess::LetterboxPreprocess(LetterboxPreprocess&& other) noexcept = default;
+LetterboxPreprocess&
+LetterboxPreprocess::operator=(LetterboxPreprocess&& other) noexcept = default;
+LetterboxPreprocess::~LetterboxPreprocess() = default;
+
+P10Result<LetterboxPreprocess> LetterboxPreprocess::create(const LetterboxOptions& options) {
+    if (options.width() == 0 || options.height() == 0) {
+        return Err(P10Error::InvalidArgument, "Target width and height must be positive.");
+    }
+    if (!options.mean().empty() && !options.std().empty()
+        && options.mean().size() != options.std().size()) {
+        return Err(P10Error::InvalidArgument, "Mean and std must have the same length.");
+    }
+    for (const float std : options.std()) {
+        if (!std::isfinite(std) || std == 0.0f) {
+            return Err(P10Error::InvalidArgument, "Std entries must be finite and non-zero.");
+        }
+    }
+    if (options.dtype() != Dtype::Float32 && options.dtype() != Dtype::Float16) {
+        return Err(P10Error::InvalidArgument, "Output dtype must be float32 or float16.");
+    }
+    return Ok(LetterboxPreprocess(options));
+}
+
+P10Result<LetterboxGeometry> LetterboxPreprocess::transform(const Tensor& images, Tensor& output) {
+    if (images.dtype() != Dtype::Uint8) {
+        return Err(P10Error::InvalidArgument, "Images must be uint8.");
+    }
+    const auto dims = images.shape().dims();
+    if (dims != 3 && dims != 4) {
+        return Err(P10Error::InvalidArgument, "Images must be a 3D or 4D tensor.");
+    }
+    const auto shape = images.shape().as_span();
+    const int64_t count = dims == 4 ? shape[0] : 1;
+    const auto image_shape = shape.subspan(dims - 3);
+    const bool planar = options_.planar_input();
+    const int64_t channels = planar ? image_shape[0] : image_shape[2];
+    const int64_t height = planar ? image_shape[1] : image_shape[0];
+    const int64_t width = planar ? image_shape[2] : image_shape[1];
+    if (count == 0 || height == 0 || width == 0 || channels == 0) {
+        return Err(P10Error::InvalidArgument, "Images must not be empty.");
+    }
+    const auto expects_channels = [&](const std::vector<float>& values) {
+        return values.empty() || static_cast<int64_t>(values.size()) == channels;
+    };
+    if (!expects_channels(options_.mean()) || !expects_channels(options_.std())) {
+        return Err(P10Error::InvalidArgument, "Mean and std must have one entry per channel.");
+    }
+
+    Tensor contiguous;
+    if (!images.is_contiguous()) {
+        auto copy = images.to_contiguous();
+        if (copy.is_error()) {
+            return Err(copy.error());
+        }
+        contiguous = copy.unwrap();
+    }
+    const Tensor& source = images.is_contiguous() ? images : contiguous;
+
+    Plan& plan = *plan_;
+    if (plan.height != height || plan.width != width || plan.channels != channels) {
+        plan = Plan();
+        plan.height = height;
+        plan.width = width;
+        plan.channels = channels;
+
+        const auto target_width = static_cast<int64_t>(options_.width());
+        const auto target_height = static_cast<int64_t>(options_.height());
+        float ratio = std::min(
+            static_cast<float>(target_width) / static_cast<float>(width),
+            static_cast<float>(target_height) / static_cast<float>(height)
+        );
+        if (!options_.upscale()) {
+            ratio = std::min(ratio, 1.0f);
+        }
+        const auto stride = static_cast<int64_t>(options_.pad_stride());
+        LetterboxGeometry& geometry = plan.geometry;
+        geometry.scale = ratio;
+        std::tie(geometry.width, plan.out_width) =
+            letterbox_axis(width, target_width, ratio, stride);
+        std::tie(geometry.height, plan.out_height) =
+            letterbox_axis(height, target_height, ratio, stride);
+        geometry.left = (plan.out_width - geometry.width) / 2;
+        geometry.top = (plan.out_height - geometry.height) / 2;
+
+        const Interpolation interpolation = options_.interpolation();
+        plan.rows_axis = resample_axis(height, geometry.height, interpolation);
+        plan.cols_axis = resample_axis(width, geometry.width, interpolation);
+        if (!planar) {
+            plan.cols_axis = interleave_axis(plan.cols_axis, channels);
+            plan.pixel_index.resize(static_cast<size_t>(geometry.width));
+            for (int64_t x = 0; x < geometry.width; ++x) {
+                plan.pixel_index[x] = static_cast<int32_t>(x * channels);
+            }
+        }
+        plan.scale.resize(static_cast<size_t>(channels));
+        plan.offset.resize(static_cast<size_t>(channels));
+        for (int64_t c = 0; c < channels; ++c) {
+            const float mean = options_.mean().empty() ? 0.0f : options_.mean()[c];
+            const float std = options_.std().empty() ? 1.0f : options_.std()[c];
+            plan.scale[c] = 1.0f / std;
+            plan.offset[c] = -mean / std;
+        }
+    }
+
+    P10_RETURN_ERR_IF_ERROR(output.create(
+        make_shape(count, channels, plan.out_height, plan.out_width),
+        options_.dtype()
+    ));
+
+    const uint8_t* src = source.as_span1d<const uint8_t>().unwrap().data();
+    const auto run = [&]<typename out_t>(out_t* dst, out_t pad) {
+        const OutputRows<out_t> rows {dst, plan.out_height * plan.out_width, plan.out_width};
+        const bool reverse = options_.reverse_channels();
+        const int64_t total_rows = count * plan.out_height;
+        const int threads = simd::parallel_workers(
+            total_rows * plan.out_width * channels,
+            RESIZE_MIN_WORKER_PIXELS
+        );
+        simd::parallel_for(threads, threads, [&](int64_t job) {
+            const int64_t begin = (job * total_rows) / threads;
+            const int64_t end = ((job + 1) * total_rows) / threads;
+            simd::call_in_best_tier([&](auto tier) {
+                constexpr auto S = decltype(tier)::value;
+                switch (options_.interpolation()) {
+                    case Interpolation::Nearest:
+                        letterbox_rows<S, 1>(src, rows, plan, planar, reverse, pad, begin, end);
+                        break;
+                    case Interpolation::Bilinear:
+                        letterbox_rows<S, 2>(src, rows, plan, planar, reverse, pad, begin, end);
+                        break;
+                    case Interpolation::Bicubic:
+                        letterbox_rows<S, 4>(src, rows, plan, planar, reverse, pad, begin, end);
+                        break;
+                    default:
+                        letterbox_rows<S, 0>(src, rows, plan, planar, reverse, pad, begin, end);
+                }
+            });
+        });
+    };
+
+    std::byte* dst = output.as_bytes().data();
+    if (options_.dtype() == Dtype::Float16) {
+        run(reinterpret_cast<uint16_t*>(dst), float_to_half(options_.pad_value()));
+    } else {
+        run(reinterpret_cast<float*>(dst), options_.pad_value());
+    }
+    return Ok(plan.geometry);
+}
+
+}  // namespace p10::op
@@ -0,0 +1,288 @@
+#include "mel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include <p10_internal/simd/parallel_for.hpp>
+#include <p10_internal/simd/vec.hpp>
+#include <p10_internal/simd/vec_math.hpp>
+#include <ptensor/tensor.hpp>
+
+#include "elemwise.vec.hpp"
+
+namespace p10::op {
+namespace {
+    // Fewest spectrum values a parallel mel worker is handed; smaller batches
+    // run on the calling thread.
+    constexpr int64_t MEL_MIN_WORKER_ELEMENTS = 32 * 1024;
+
+    // librosa's power_to_db floor and 10 / ln(10), decibels per neper of power.
+    constexpr float MIN_POWER = 1e-10F;
+    constexpr float DECIBELS_PER_LOG = static_cast<float>(10.0 / std::numbers::ln10);
+
+    // Slaney's mel scale: linear below 1 kHz, logarithmic above.
+    constexpr double MEL_LINEAR_HZ = 200.0 / 3.0;
+    constexpr double MEL_LOG_HZ = 1000.0;
+    constexpr double MEL_LOG_MEL = MEL_LOG_HZ / MEL_LINEAR_HZ;
+    // ln(6.4) / 27.
+    constexpr double MEL_LOG_STEP = 0.06875177742094912;
+
+    double hz_to_mel(double hz) {
+        if (hz < MEL_LOG_HZ) {
+            return hz / MEL_LINEAR_HZ;
+        }
+        return MEL_LOG_MEL + (std::log(hz / MEL_LOG_HZ) / MEL_LOG_STEP);
+    }
+
+    double mel_to_hz(double mel) {
+        if (mel < MEL_LOG_MEL) {
+            return mel * MEL_LINEAR_HZ;
+        }
+        return MEL_LOG_HZ * std::exp(MEL_LOG_STEP * (mel - MEL_LOG_MEL));
+    }
+
+    // sum(a[i] * b[i]) over `count` values, lane-wise then the tail.
+    template<simd::SimdSet S>
+    float dot(const float* a, const float* b, int64_t count) {
+        using V = simd::NativeVec<float, S>;
+        constexpr auto LANES = static_cast<int64_t>(V::LANES);
+        V lanes = V::zero();
+        int64_t x = 0;
+        for (; x + LANES <= count; x += LANES) {
+            lanes = simd::fma(V::load(a + x), V::load(b + x), lanes);
+        }
+        float sum = simd::reduce_add(lanes);
+        for (; x < count; ++x) {
+            sum += a[x] * b[x];
+        }
+        return sum;
+    }
+
+    // Number of [bins, 2] spectra in `spectrum`.
+    P10Result<int64_t> spectrum_rows(const Tensor& spectrum, int64_t bins) {
+        if (spectrum.dtype() != Dtype::Float32 || spectrum.device() != Device::Cpu
+            || !spectrum.is_contiguous()) {
+            return Err(
+                P10Error::InvalidArgument << "Spectrum must be a contiguous Float32 CPU tensor"
+            );
+        }
+        const auto shape = spectrum.shape().as_span();
+        if (shape.size() < 2 || shape[shape.size() - 2] != bins || shape.back() != 2) {
+            return Err(
+                P10Error::InvalidArgument << "Spectrum must be [..., frame_length / 2 + 1, 2]"
+            );
+        }
+        return Ok(static_cast<int64_t>(spectrum.size()) / (bins * 2));
+    }
+
+    // The spectrum's leading dimensions followed by `last`.
+    Shape batch_shape(const Tensor& spectrum, int64_t last) {
+        const auto shape = spectrum.shape().as_span();
+        std::vector<int64_t> dims(shape.begin(), shape.end() - 2);
+        dims.push_back(last);
+        return make_shape(std::span<const int64_t>(dims)).unwrap();
+    }
+
+    // fn(rows [begin, end)) across the parallel workers.
+    template<typename Fn>
+    void for_each_rows(int64_t rows, int64_t work, const Fn& fn) {
+        const int threads = simd::parallel_workers(work, MEL_MIN_WORKER_ELEMENTS);
+        simd::parallel_for(threads, threads, [&](int64_t job) {
+            fn((job * rows) / threads, ((job + 1) * rows) / threads);
+        });
+    }
+
+    // power_to_db in place: 10 * log10(max(x, MIN_POWER)), then clamped to
+    // `top_db` below the largest value.
+    void to_decibels(float* values, int64_t size, float top_db) {
+        unary_elemwise(values, values, size, [](const auto& x) {
+            using V = std::decay_t<decltype(x)>;
+            const V power = simd::max(x, V::broadcast(MIN_POWER));
+            return simd::log(power) * V::broadcast(DECIBELS_PER_LOG);
+        });
+        if (top_db <= 0.0F || size == 0) {
+            return;
+        }
+        const float floor = *std::max_element(values, values + size) - top_db;
+        unary_elemwise(values, values, size, [floor](const auto& x) {
+            using V = std::decay_t<decltype(x)>;
+            return simd::max(x, V::broadcast(floor));
+        });
+    }
+}  // namespace
+
+P10Result<MelSpectrogram> MelSpectrogram::create(const MelOptions& options) {
+    const double nyquist = options.sample_rate() / 2.0;
+    if (!(options.sample_rate() > 0.0) || options.frame_length() < 2 || options.mels() == 0) {
+        return Err(
+            P10Error::InvalidArgument
+            << "Mel filters need a sample rate, a frame length of 2 or more and a band"
+        );
+    }
+    if (!(options.min_frequency() >= 0.0) || options.min_frequency() >= options.max_frequency()
+        || options.max_frequency() > nyquist) {
+        return Err(
+            P10Error::InvalidArgument << "Mel frequency range must be within [0, sample_rate / 2]"
+        );
+    }
+
+    // librosa.filters.mel: triangles between mels + 2 points evenly spaced in
+    // mel, each scaled to unit area in Hz.
+    const auto mels = static_cast<int64_t>(options.mels());
+    const auto bins = static_cast<int64_t>(options.frame_length() / 2) + 1;
+    const double bin_hz = options.sample_rate() / static_cast<double>(options.frame_length());
+    const double low = hz_to_mel(options.min_frequency());
+    const double high = hz_to_mel(options.max_frequency());
+    std::vector<double> edges(static_cast<size_t>(mels) + 2);
+    for (size_t i = 0; i < edges.size(); ++i) {
+        const double step = static_cast<double>(i) / static_cast<double>(mels + 1);
+        edges[i] = mel_to_hz(low + ((high - low) * step));
+    }
+
+    MelSpectrogram result(options);
+    std::vector<float> dense(static_cast<size_t>(bins));
+    for (int64_t m = 0; m < mels; ++m) {
+        const double left = edges[m];
+        const double center = edges[m + 1];
+        const double right = edges[m + 2];
+        const double area = 2.0 / (right - left);
+        for (int64_t k = 0; k < bins; ++k) {
+            const double hz = static_cast<double>(k) * bin_hz;
+            const double rising = (hz - left) / (center - left);
+            const double falling = (right - hz) / (right - center);
+            dense[k] = static_cast<float>(std::max(0.0, std::min(rising, falling)) * area);
+        }
+
+        const auto nonzero = [](float w) { return w != 0.0F; };
+        const auto first = std::find_if(dense.begin(), dense.end(), nonzero);
+        const auto last = std::find_if(dense.rbegin(), dense.rend(), nonzero).base();
+        result.first_.push_back(first < last ? first - dense.begin() : 0);
+        result.count_.push_back(first < last ? last - first : 0);
+        result.offset_.push_back(static_cast<int64_t>(result.weights_.size()));
+        if (first < last) {
+            result.weights_.insert(result.weights_.end(), first, last);
+        }
+    }
+    return Ok(std::move(result));
+}
+
+P10Error MelSpectrogram::transform(const Tensor& spectrum, Tensor& mel) const {
+    const auto bins = static_cast<int64_t>(options_.frame_length() / 2) + 1;
+    auto rows_result = spectrum_rows(spectrum, bins);
+    if (rows_result.is_error()) {
+        return rows_result.error();
+    }
+    const int64_t rows = rows_result.unwrap();
+    const auto mels = static_cast<int64_t>(options_.mels());
+    P10_RETURN_IF_ERROR(mel.create(batch_shape(spectrum, mels), Dtype::Float32));
+
+    const float* in = spectrum.as_span1d<const float>().unwrap().data();
+    float* out = mel.as_span1d<float>().unwrap().data();
+    for_each_rows(rows, rows * bins * 2, [&](int64_t begin, int64_t end) {
+        std::vector<float> power(static_cast<size_t>(bins));
+        simd::call_in_best_tier([&](auto tier) {
+            constexpr auto S = decltype(tier)::value;
+            for (int64_t row = begin; row < end; ++row) {
+                const float* values = in + (row * bins * 2);
+                for (int64_t k = 0; k < bins; ++k) {
+                    const float re = values[2 * k];
+                    const float im = values[(2 * k) + 1];
+                    power[k] = (re * re) + (im * im);
+                }
+                float* bands = out + (row * mels);
+                for (int64_t m = 0; m < mels; ++m) {
+                    const float* weights = weights_.data() + offset_[m];
+                    bands[m] = dot<S>(weights, power.data() + first_[m], count_[m]);
+                }
+            }
+        });
+    });
+
+    if (options_.log()) {
+        to_decibels(out, rows * mels, options_.top_db());
+    }
+    return P10Error::Ok;
+}
+
+Tensor MelSpectrogram::filters() const {
+    const auto bins = static_cast<int64_t>(options_.frame_length() / 2) + 1;
+    const auto mels = static_cast<int64_t>(options_.mels());
+    Tensor result = Tensor::zeros(make_shape(mels, bins), Dtype::Float32).unwrap();
+    auto dense = result.as_span1d<float>().unwrap();
+    for (int64_t m = 0; m < mels; ++m) {
+        std::copy_n(
+            weights_.begin() + offset_[m],
+            count_[m],
+            dense.begin() + (m * bins) + first_[m]
+        );
+    }
+    return result;
+}
+
+P10Result<Mfcc> Mfcc::create(const MelOptions& options) {
+    if (options.coefficients() == 0 || options.coefficients() > options.mels()) {
+        return Err(
+            P10Error::InvalidArgument << "MFCC coefficients must be between 1 and the band count"
+        );
+    }
+    auto mel_options = options;
+    auto mel = MelSpectrogram::create(mel_options.log(true));
+    if (mel.is_error()) {
+        return Err(mel.unwrap_err());
+    }
+
+    // Orthonormal DCT-II: row k is cos(pi * k * (2m + 1) / 2M), scaled by
+    // sqrt(1 / M) for k = 0 and sqrt(2 / M) otherwise.
+    const auto mels = static_cast<int64_t>(options.mels());
+    const auto coefficients = static_cast<int64_t>(options.coefficients());
+    std::vector<float> dct(static_cast<size_t>(coefficients * mels));
+    for (int64_t k = 0; k < coefficients; ++k) {
+        const double scale = std::sqrt((k == 0 ? 1.0 : 2.0) / static_cast<double>(mels));
+        for (int64_t m = 0; m < mels; ++m) {
+            const double angle = std::numbers::pi * static_cast<double>(k * ((2 * m) + 1))
+                / static_cast<double>(2 * mels);
+            dct[(k * mels) + m] = static_cast<float>(scale * std::cos(angle));
+        }
+    }
+    return Ok(Mfcc(mel.unwrap(), std::move(dct)));
+}
+
+P10Error Mfcc::transform(const Tensor& spectrum, Tensor& mfcc) {
+    P10_RETURN_IF_ERROR(mel_.transform(spectrum, decibels_));
+    const auto shape = decibels_.shape().as_span();
+    const int64_t mels = shape.back();
+    const auto coefficients = static_cast<int64_t>(dct_.size()) / mels;
+    const auto rows = static_cast<int64_t>(decibels_.size()) / mels;
+
+    std::vector<int64_t> dims(shape.begin(), shape.end());
+    dims.back() = coefficients;
+    auto out_shape = make_shape(std::span<const int64_t>(dims));
+    if (out_shape.is_error()) {
+        return out_shape.error();
+    }
+    P10_RETURN_IF_ERROR(mfcc.create(out_shape.unwrap(), Dtype::Float32));
+
+    const float* in = decibels_.as_span1d<const float>().unwrap().data();
+    float* out = mfcc.as_span1d<float>().unwrap().data();
+    for_each_rows(rows, rows * coefficients * mels, [&](int64_t begin, int64_t end) {
+        simd::call_in_best_tier([&](auto tier) {
+            constexpr auto S = decltype(tier)::value;
+            for (int64_t row = begin; row < end; ++row) {
+                const float* bands = in + (row * mels);
+                for (int64_t k = 0; k < coefficients; ++k) {
+                    const float* basis = dct_.data() + (k * mels);
+                    out[(row * coefficients) + k] = dot<S>(basis, bands, mels);
+                }
+            }
+        });
+    });
+    return P10Error::Ok;
+}
+
+}  // namespace p10::op
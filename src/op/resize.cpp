@@ -1,15 +1,21 @@
 #include "resize.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
+#include <type_traits>
+#include <vector>
 
 #include <p10_internal/simd/compiler.hpp>
 #include <p10_internal/simd/cpuid.hpp>
 #include <ptensor/dtype.hpp>
 #include <ptensor/tensor.hpp>
 
+#include "resize.lines.hpp"
+
 #if PTENSOR_HAS_INTRINSICS_H
-    #include <immintrin.h>  // AVX2 intrinsics
+    #include <immintrin.h>  // AVX2 and SSE4.1 intrinsics
 #endif
 
 namespace p10::op {
@@ -29,10 +35,42 @@ namespace {
         int64_t new_width,
         int64_t new_height
     );
+
+    P10Error resize_sse41_impl(
+        Accessor3D<const uint8_t> input,
+        Accessor3D<uint8_t> output,
+        int64_t new_width,
+        int64_t new_height,
+        bool contiguous
+    );
 #endif
+
+    P10Error resize_interpolated(
+        const Tensor& input,
+        Tensor& output,
+        int64_t new_width,
+        int64_t new_height,
+        Interpolation interpolation
+    );
 }  // namespace
 
-P10Error resize(const Tensor& input, Tensor& output, size_t new_width, size_t new_height) {
+P10Error resize(
+    const Tensor& input,
+    Tensor& output,
+    size_t new_width,
+    size_t new_height,
+    const ResizeOptions& options
+) {
+    if (options.interpolation() != Interpolation::Nearest) {
+        return resize_interpolated(
+            input,
+            output,
+            static_cast<int64_t>(new_width),
+            static_cast<int64_t>(new_height),
+            options.interpolation()
+        );
+    }
+
     return input.dtype().match([&](auto type_tag) {
         using scalar_t = decltype(type_tag)::type;
 
@@ -65,6 +103,14 @@ P10Error resize(const Tensor& input, Tensor& output, size_t new_width, size_t ne
                     int64_t(new_width),
                     int64_t(new_height)
                 );
+            } else if (simd::is_supported(simd::SimdSet::SSE41)) {
+                return resize_sse41_impl(
+                    input_accessor,
+                    output.as_accessor3d<scalar_t>().unwrap(),
+                    int64_t(new_width),
+                    int64_t(new_height),
+                    input.is_contiguous()
+                );
             } else {
                 return default_impl();
             }
@@ -155,7 +201,7 @@ namespace {
 
                     __m256 src_x_f = _mm256_mul_ps(_mm256_cvtepi32_ps(col_indices), x_scale_vec);
 
-                    __m256i src_x = _mm256_cvtps_epi32(src_x_f);
+                    __m256i src_x = _mm256_cvttps_epi32(src_x_f);
 
                     src_x = _mm256_min_epi32(src_x, width_max_vec);
                     src_x = _mm256_max_epi32(src_x, _mm256_setzero_si256());
@@ -184,7 +230,218 @@ namespace {
 
         return P10Error::Ok;
     }
+
+    // Source column of every output column, 4 at a time: truncating convert
+    // and clamp, the same mapping as resize_ref_impl.
+    PTENSOR_SSE41 void
+    nearest_columns_sse41(int32_t width, float x_scale, std::vector<int32_t>& src_cols) {
+        const auto new_width = static_cast<int32_t>(src_cols.size());
+        const __m128 x_scale_vec = _mm_set1_ps(x_scale);
+        const __m128i width_max_vec = _mm_set1_epi32(width - 1);
+
+        int32_t col = 0;
+        for (; col + 4 <= new_width; col += 4) {
+            const __m128i col_indices =
+                _mm_add_epi32(_mm_set1_epi32(col), _mm_setr_epi32(0, 1, 2, 3));
+            const __m128 src_x_f = _mm_mul_ps(_mm_cvtepi32_ps(col_indices), x_scale_vec);
+            const __m128i src_x = _mm_min_epi32(_mm_cvttps_epi32(src_x_f), width_max_vec);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(src_cols.data() + col), src_x);
+        }
+        for (; col < new_width; ++col) {
+            src_cols[col] = std::min(int32_t(float(col) * x_scale), width - 1);
+        }
+    }
+
+    // 16 output columns copied from a window of at most 32 source bytes by
+    // byte shuffles: `low` picks from [base, base + 16), `high` from
+    // [base + 16, base + 32), and 0x80 zeroes the lanes a mask does not pick.
+    struct ShuffleBlock {
+        int32_t base = 0;
+        // 1 or 2 loads; 0 sends the block through the column table.
+        int32_t loads = 0;
+        std::array<uint8_t, 16> low {};
+        std::array<uint8_t, 16> high {};
+    };
+
+    // Shuffle blocks for every whole 16 output columns. The column map never
+    // decreases, so a block's window runs from its first to its last source
+    // column: 16 bytes or less when upscaling, 32 or less down to half size.
+    // Wider windows, and rows narrower than the loads, use the table.
+    std::vector<ShuffleBlock>
+    nearest_shuffles(int32_t width, const std::vector<int32_t>& src_cols) {
+        std::vector<ShuffleBlock> blocks(src_cols.size() / 16);
+        for (size_t b = 0; b < blocks.size(); ++b) {
+            const int32_t* cols = src_cols.data() + (b * 16);
+            const int32_t span = cols[15] - cols[0] + 1;
+            const int32_t loads = span <= 16 ? 1 : (span <= 32 ? 2 : 0);
+            if (loads == 0 || width < 16 * loads) {
+                continue;
+            }
+            // Near the right edge the window shifts left to stay in the row.
+            ShuffleBlock& block = blocks[b];
+            block.loads = loads;
+            block.base = std::min(cols[0], width - (16 * loads));
+            for (size_t i = 0; i < 16; ++i) {
+                const int32_t offset = cols[i] - block.base;
+                block.low[i] = offset < 16 ? static_cast<uint8_t>(offset) : 0x80;
+                block.high[i] = offset >= 16 ? static_cast<uint8_t>(offset - 16) : 0x80;
+            }
+        }
+        return blocks;
+    }
+
+    PTENSOR_SSE41 void nearest_row_sse41(
+        const uint8_t* row_in,
+        uint8_t* row_out,
+        const std::vector<int32_t>& src_cols,
+        const std::vector<ShuffleBlock>& blocks
+    ) {
+        const auto new_width = static_cast<int64_t>(src_cols.size());
+        int64_t col = 0;
+        for (const ShuffleBlock& block : blocks) {
+            if (block.loads == 0) {
+                for (int64_t i = col; i < col + 16; ++i) {
+                    row_out[i] = row_in[src_cols[i]];
+                }
+            } else {
+                const auto* window = reinterpret_cast<const __m128i*>(row_in + block.base);
+                __m128i pixels = _mm_shuffle_epi8(
+                    _mm_loadu_si128(window),
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(block.low.data()))
+                );
+                if (block.loads == 2) {
+                    pixels = _mm_or_si128(
+                        pixels,
+                        _mm_shuffle_epi8(
+                            _mm_loadu_si128(window + 1),
+                            _mm_loadu_si128(reinterpret_cast<const __m128i*>(block.high.data()))
+                        )
+                    );
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(row_out + col), pixels);
+            }
+            col += 16;
+        }
+        for (; col < new_width; ++col) {
+            row_out[col] = row_in[src_cols[col]];
+        }
+    }
+
+    // SSE4.1 has no gather, so the column map and its byte shuffles are
+    // computed once and reused by every row and channel. Output rows reading
+    // the same source row as the one above (upscaling) are copied from it.
+    // Strided inputs go through the column table one pixel at a time.
+    P10Error resize_sse41_impl(
+        Accessor3D<const uint8_t> input,
+        Accessor3D<uint8_t> output,
+        int64_t new_width,
+        int64_t new_height,
+        bool contiguous
+    ) {
+        const auto channels = input.channels();
+        const int32_t height = int32_t(input.rows());
+        const int32_t width = int32_t(input.cols());
+
+        const float x_scale = float(width) / float(new_width);
+        const float y_scale = float(height) / float(new_height);
+
+        std::vector<int32_t> src_cols(static_cast<size_t>(new_width));
+        nearest_columns_sse41(width, x_scale, src_cols);
+        std::vector<ShuffleBlock> blocks;
+        if (contiguous) {
+            blocks = nearest_shuffles(width, src_cols);
+        }
+
+        for (int64_t chn = 0; chn < channels; ++chn) {
+            auto plane_out = output[chn];
+            auto plane_in = input[chn];
+
+            int32_t previous_y = -1;
+            for (int64_t row = 0; row < new_height; ++row) {
+                const auto src_y = std::min(int32_t(float(row) * y_scale), height - 1);
+
+                auto row_out = plane_out[row];
+                if (src_y == previous_y) {
+                    const uint8_t* above = plane_out[row - 1].data();
+                    std::copy(above, above + new_width, row_out.data());
+                    continue;
+                }
+                previous_y = src_y;
+
+                auto row_in = plane_in[src_y];
+                if (contiguous) {
+                    nearest_row_sse41(row_in.data(), row_out.data(), src_cols, blocks);
+                } else {
+                    for (int64_t col = 0; col < new_width; ++col) {
+                        row_out[col] = row_in[src_cols[col]];
+                    }
+                }
+            }
+        }
+
+        return P10Error::Ok;
+    }
 #endif  // x86
 }  // namespace
 
+namespace {
+    P10Error resize_interpolated(
+        const Tensor& input,
+        Tensor& output,
+        int64_t new_width,
+        int64_t new_height,
+        Interpolation interpolation
+    ) {
+        if (input.shape().dims() != 3) {
+            return P10Error::InvalidArgument << "Input tensor must be a 3D tensor.";
+        }
+        const int64_t channels = input.shape(0).unwrap();
+        const int64_t height = input.shape(1).unwrap();
+        const int64_t width = input.shape(2).unwrap();
+        if (height == 0 || width == 0) {
+            return P10Error::InvalidArgument << "Input planes must not be empty.";
+        }
+
+        Tensor contiguous;
+        if (!input.is_contiguous()) {
+            auto copy = input.to_contiguous();
+            if (copy.is_error()) {
+                return copy.error();
+            }
+            contiguous = copy.unwrap();
+        }
+        const Tensor& source = input.is_contiguous() ? input : contiguous;
+
+        const Dtype dtype = input.dtype();
+        P10_RETURN_IF_ERROR(output.create(make_shape(channels, new_height, new_width), dtype));
+        if (new_width == 0 || new_height == 0) {
+            return P10Error::Ok;
+        }
+        const ResampleAxis rows_axis = resample_axis(height, new_height, interpolation);
+        const ResampleAxis cols_axis = resample_axis(width, new_width, interpolation);
+
+        return dtype.match([&](auto type_tag) -> P10Error {
+            using scalar_t = decltype(type_tag)::type;
+
+            if constexpr (std::is_arithmetic_v<scalar_t>) {
+                const auto src = source.as_span3d<const scalar_t>().unwrap();
+                auto dst = output.as_span3d<scalar_t>().unwrap();
+                switch (interpolation) {
+                    case Interpolation::Bilinear:
+                        resample_planes<scalar_t, 2>(src, dst, rows_axis, cols_axis);
+                        break;
+                    case Interpolation::Bicubic:
+                        resample_planes<scalar_t, 4>(src, dst, rows_axis, cols_axis);
+                        break;
+                    default:
+                        resample_planes<scalar_t, 0>(src, dst, rows_axis, cols_axis);
+                }
+                return P10Error::Ok;
+            } else {
+                return P10Error::InvalidArgument << "Unsupported data type for this operation.";
+            }
+        });
+    }
+}  // namespace
+
 }  // namespace p10::op
\ No newline at end of file
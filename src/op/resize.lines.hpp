@@ -0,0 +1,428 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <p10_internal/simd/parallel_for.hpp>
+#include <p10_internal/simd/vec.hpp>
+#include <ptensor/op/resize.hpp>
+#include <ptensor/span3d.hpp>
+
+#include "blur.lines.hpp"
+
+namespace p10::op {
+
+// Fewest output pixels a parallel resize worker is handed; smaller images
+// run on the calling thread.
+inline constexpr int64_t RESIZE_MIN_WORKER_PIXELS = 32 * 1024;
+
+// Fractional bits of the uint8 fixed-point weights. Both passes multiply
+// by Q11 weights, so an output is a Q22 value before the final shift. The
+// bicubic weights of one axis add up in magnitude to at most 1.375, which
+// keeps every partial sum below 255 * (1.375 * 2^11)^2 < 2^31 in int32.
+inline constexpr int RESIZE_WEIGHT_BITS = 11;
+
+// Cubic convolution weight at distance `x` (Keys, a = -0.75).
+inline double cubic_weight(double x) {
+    constexpr double A = -0.75;
+    x = std::abs(x);
+    if (x <= 1.0) {
+        return ((((A + 2.0) * x) - (A + 3.0)) * x * x) + 1.0;
+    }
+    if (x < 2.0) {
+        return (((((A * x) - (5.0 * A)) * x) + (8.0 * A)) * x) - (4.0 * A);
+    }
+    return 0.0;
+}
+
+// Source indices and weights of one axis, tap-major: output coordinate
+// `o` of `size` reads the source at `index[k * size + o]` with weight
+// `weight[k * size + o]` for k < taps, so tap k of consecutive outputs is
+// one contiguous run the SIMD kernels load whole. Indices are clamped to
+// the source, which replicates the edges, and unused taps carry weight 0.
+// `fixed` holds the same weights in Q11, each output's summing to exactly
+// 1 << 11 so constant planes stay constant.
+struct ResampleAxis {
+    int64_t size = 0;
+    int64_t taps = 0;
+    std::vector<int32_t> index;
+    std::vector<float> weight;
+    std::vector<int32_t> fixed;
+};
+
+inline ResampleAxis
+resample_axis(int64_t src_size, int64_t dst_size, Interpolation interpolation) {
+    ResampleAxis axis;
+    axis.size = dst_size;
+    if (interpolation == Interpolation::Nearest) {
+        // One tap of full weight at the source pixel of the planar nearest
+        // resize, so the kernels reproduce it exactly.
+        const float nearest_scale = static_cast<float>(src_size) / static_cast<float>(dst_size);
+        axis.taps = 1;
+        axis.index.resize(static_cast<size_t>(dst_size));
+        axis.weight.assign(static_cast<size_t>(dst_size), 1.0f);
+        axis.fixed.assign(static_cast<size_t>(dst_size), 1 << RESIZE_WEIGHT_BITS);
+        for (int64_t o = 0; o < dst_size; ++o) {
+            axis.index[o] = static_cast<int32_t>(std::min(
+                static_cast<int64_t>(static_cast<float>(o) * nearest_scale),
+                src_size - 1
+            ));
+        }
+        return axis;
+    }
+
+    const double scale = static_cast<double>(src_size) / static_cast<double>(dst_size);
+    if (interpolation == Interpolation::Bilinear) {
+        axis.taps = 2;
+    } else if (interpolation == Interpolation::Bicubic) {
+        axis.taps = 4;
+    } else {
+        // A box `scale` pixels wide straddles at most ceil(scale) + 1 pixels.
+        axis.taps = static_cast<int64_t>(std::ceil(scale)) + 1;
+    }
+    const auto entries = static_cast<size_t>(dst_size * axis.taps);
+    axis.index.resize(entries);
+    axis.weight.resize(entries);
+    axis.fixed.resize(entries);
+
+    std::vector<double> weights(static_cast<size_t>(axis.taps));
+    for (int64_t o = 0; o < dst_size; ++o) {
+        int64_t first = 0;
+        if (interpolation == Interpolation::Area) {
+            const double begin = static_cast<double>(o) * scale;
+            const double end =
+                std::min(static_cast<double>(o + 1) * scale, static_cast<double>(src_size));
+            first = static_cast<int64_t>(std::floor(begin));
+            for (int64_t k = 0; k < axis.taps; ++k) {
+                const auto pixel = static_cast<double>(first + k);
+                weights[k] = std::max(std::min(end, pixel + 1.0) - std::max(begin, pixel), 0.0);
+            }
+        } else {
+            const double center = ((static_cast<double>(o) + 0.5) * scale) - 0.5;
+            const double floor = std::floor(center);
+            const double t = center - floor;
+            first = static_cast<int64_t>(floor);
+            if (interpolation == Interpolation::Bilinear) {
+                weights[0] = 1.0 - t;
+                weights[1] = t;
+            } else {
+                first -= 1;
+                for (int64_t k = 0; k < 4; ++k) {
+                    weights[k] = cubic_weight(t + 1.0 - static_cast<double>(k));
+                }
+            }
+        }
+
+        double total = 0.0;
+        for (const double weight : weights) {
+            total += weight;
+        }
+        int64_t fixed_total = 0;
+        int64_t largest = 0;
+        for (int64_t k = 0; k < axis.taps; ++k) {
+            const int64_t at = (k * dst_size) + o;
+            const double weight = weights[k] / total;
+            axis.index[at] =
+                static_cast<int32_t>(std::clamp<int64_t>(first + k, 0, src_size - 1));
+            axis.weight[at] = static_cast<float>(weight);
+            axis.fixed[at] =
+                static_cast<int32_t>(std::llround(weight * (1 << RESIZE_WEIGHT_BITS)));
+            fixed_total += axis.fixed[at];
+            if (weights[k] > weights[largest]) {
+                largest = k;
+            }
+        }
+        axis.fixed[(largest * dst_size) + o] +=
+            static_cast<int32_t>((1 << RESIZE_WEIGHT_BITS) - fixed_total);
+    }
+    return axis;
+}
+
+// `axis` over pixels of `channels` interleaved values: entry o * channels + c
+// reads source value index * channels + c with the pixel's weight, so the
+// planar kernels resample the rows of an [H, W, C] image as they are.
+inline ResampleAxis interleave_axis(const ResampleAxis& axis, int64_t channels) {
+    ResampleAxis interleaved;
+    interleaved.size = axis.size * channels;
+    interleaved.taps = axis.taps;
+    const auto entries = static_cast<size_t>(interleaved.size * axis.taps);
+    interleaved.index.resize(entries);
+    interleaved.weight.resize(entries);
+    interleaved.fixed.resize(entries);
+    for (int64_t k = 0; k < axis.taps; ++k) {
+        for (int64_t o = 0; o < axis.size; ++o) {
+            const int64_t from = (k * axis.size) + o;
+            for (int64_t c = 0; c < channels; ++c) {
+                const int64_t to = (k * interleaved.size) + (o * channels) + c;
+                interleaved.index[to] = static_cast<int32_t>((axis.index[from] * channels) + c);
+                interleaved.weight[to] = axis.weight[from];
+                interleaved.fixed[to] = axis.fixed[from];
+            }
+        }
+    }
+    return interleaved;
+}
+
+// Runtime tap count of a kernel: TAPS when it is a compile-time constant
+// (bilinear, bicubic) so the tap loops unroll, `taps` when TAPS is 0.
+template<int64_t TAPS>
+constexpr int64_t resample_taps(int64_t taps) {
+    return TAPS > 0 ? TAPS : taps;
+}
+
+// Line kernels of one pixel type, each a Vec loop over whole registers of
+// tier S followed by the same sums in scalar code for the columns past
+// the last one.
+//
+// vertical(): line[x] = sum_k weights[k] * rows[k][x] over the `taps`
+// source rows of one output row.
+//
+// horizontal(): out[x] = sum_k weight[k][x] * line[index[k][x]] from the
+// tap-major column table, then narrows to the pixel type. AVX2 gathers
+// each tap's lanes in one instruction; the 128-bit sets fill them one at a
+// time, which still leaves the multiply-adds and stores vectorized.
+template<typename scalar_t, simd::SimdSet S, int64_t TAPS>
+struct ResampleLines;
+
+// float32 in float lines.
+template<simd::SimdSet S, int64_t TAPS>
+struct ResampleLines<float, S, TAPS> {
+    using line_t = float;
+    using weight_t = float;
+    using V = simd::NativeVec<float, S>;
+    static constexpr auto LANES = static_cast<int64_t>(V::LANES);
+
+    static void vertical(
+        const float* const* rows,
+        const float* weights,
+        int64_t taps,
+        float* line,
+        int64_t cols
+    ) {
+        int64_t x = 0;
+        for (; x + LANES <= cols; x += LANES) {
+            V acc = V::load(rows[0] + x) * V::broadcast(weights[0]);
+            for (int64_t k = 1; k < taps; ++k) {
+                acc = simd::fma(V::load(rows[k] + x), V::broadcast(weights[k]), acc);
+            }
+            acc.store(line + x);
+        }
+        for (; x < cols; ++x) {
+            float acc = rows[0][x] * weights[0];
+            for (int64_t k = 1; k < taps; ++k) {
+                acc = (rows[k][x] * weights[k]) + acc;
+            }
+            line[x] = acc;
+        }
+    }
+
+    static void horizontal(
+        const float* line,
+        const int32_t* index,
+        const float* weights,
+        int64_t taps,
+        float* out,
+        int64_t cols
+    ) {
+        const int64_t count = resample_taps<TAPS>(taps);
+        int64_t x = 0;
+        for (; x + LANES <= cols; x += LANES) {
+            V acc = V::gather(line, index + x) * V::load(weights + x);
+            for (int64_t k = 1; k < count; ++k) {
+                const int64_t at = (k * cols) + x;
+                acc = simd::fma(V::gather(line, index + at), V::load(weights + at), acc);
+            }
+            acc.store(out + x);
+        }
+        for (; x < cols; ++x) {
+            float acc = line[index[x]] * weights[x];
+            for (int64_t k = 1; k < count; ++k) {
+                const int64_t at = (k * cols) + x;
+                acc = (line[index[at]] * weights[at]) + acc;
+            }
+            out[x] = acc;
+        }
+    }
+};
+
+// uint8 in fixed point: rows widen to int32 lines of Q11 values, and the
+// Q22 outputs round, shift and saturate back to bytes.
+template<simd::SimdSet S, int64_t TAPS>
+struct ResampleLines<uint8_t, S, TAPS> {
+    using line_t = int32_t;
+    using weight_t = int32_t;
+    using V = simd::NativeVec<int32_t, S>;
+    static constexpr auto LANES = static_cast<int64_t>(V::LANES);
+    static constexpr int SHIFT = 2 * RESIZE_WEIGHT_BITS;
+
+    static void vertical(
+        const uint8_t* const* rows,
+        const int32_t* weights,
+        int64_t taps,
+        int32_t* line,
+        int64_t cols
+    ) {
+        int64_t x = 0;
+        for (; x + LANES <= cols; x += LANES) {
+            V acc = V::load_u8(rows[0] + x) * V::broadcast(weights[0]);
+            for (int64_t k = 1; k < taps; ++k) {
+                acc = simd::fma(V::load_u8(rows[k] + x), V::broadcast(weights[k]), acc);
+            }
+            acc.store(line + x);
+        }
+        for (; x < cols; ++x) {
+            int32_t acc = rows[0][x] * weights[0];
+            for (int64_t k = 1; k < taps; ++k) {
+                acc += rows[k][x] * weights[k];
+            }
+            line[x] = acc;
+        }
+    }
+
+    static void horizontal(
+        const int32_t* line,
+        const int32_t* index,
+        const int32_t* weights,
+        int64_t taps,
+        uint8_t* out,
+        int64_t cols
+    ) {
+        const int64_t count = resample_taps<TAPS>(taps);
+        int64_t x = 0;
+        for (; x + LANES <= cols; x += LANES) {
+            V acc = V::gather(line, index + x) * V::load(weights + x);
+            for (int64_t k = 1; k < count; ++k) {
+                const int64_t at = (k * cols) + x;
+                acc = simd::fma(V::gather(line, index + at), V::load(weights + at), acc);
+            }
+            const V rounded = acc + V::broadcast(1 << (SHIFT - 1));
+            rounded.template shift_right<SHIFT>().store_u8(out + x);
+        }
+        for (; x < cols; ++x) {
+            int32_t acc = line[index[x]] * weights[x];
+            for (int64_t k = 1; k < count; ++k) {
+                const int64_t at = (k * cols) + x;
+                acc += line[index[at]] * weights[at];
+            }
+            const int32_t value = (acc + (1 << (SHIFT - 1))) >> SHIFT;
+            out[x] = static_cast<uint8_t>(std::clamp(value, 0, 255));
+        }
+    }
+};
+
+// Every other dtype: scalar sums in the blur accumulator type, rounded and
+// saturated on store for integers.
+template<typename scalar_t, simd::SimdSet S, int64_t TAPS>
+struct ResampleLines {
+    using line_t = typename Accumulator<scalar_t>::accum_t;
+    using weight_t = float;
+
+    static void vertical(
+        const scalar_t* const* rows,
+        const float* weights,
+        int64_t taps,
+        line_t* line,
+        int64_t cols
+    ) {
+        for (int64_t x = 0; x < cols; ++x) {
+            line_t acc = 0;
+            for (int64_t k = 0; k < taps; ++k) {
+                acc += static_cast<line_t>(rows[k][x]) * static_cast<line_t>(weights[k]);
+            }
+            line[x] = acc;
+        }
+    }
+
+    static void horizontal(
+        const line_t* line,
+        const int32_t* index,
+        const float* weights,
+        int64_t taps,
+        scalar_t* out,
+        int64_t cols
+    ) {
+        const int64_t count = resample_taps<TAPS>(taps);
+        for (int64_t x = 0; x < cols; ++x) {
+            Accumulator<scalar_t> acc;
+            for (int64_t k = 0; k < count; ++k) {
+                const int64_t at = (k * cols) + x;
+                acc.sum += line[index[at]] * static_cast<line_t>(weights[at]);
+            }
+            out[x] = acc.store();
+        }
+    }
+};
+
+// Weights of `axis` in the representation the line kernels of scalar_t
+// take: Q11 for uint8, float for everything else.
+template<typename scalar_t>
+const auto& resample_weights(const ResampleAxis& axis) {
+    if constexpr (std::is_same_v<scalar_t, uint8_t>) {
+        return axis.fixed;
+    } else {
+        return axis.weight;
+    }
+}
+
+// Resamples every plane of `src` into `dst`, vertical pass first: each
+// output row sums its source rows into one line of the source width, then
+// gathers the output columns from that line. The vertical pass is plain
+// register loads, so running it first keeps the gathers, the costlier
+// half, to output pixels only. Output rows are independent, so each
+// worker takes a contiguous run of them with its own line buffer.
+template<typename scalar_t, int64_t TAPS>
+void resample_planes(
+    Span3D<const scalar_t> src,
+    Span3D<scalar_t> dst,
+    const ResampleAxis& rows_axis,
+    const ResampleAxis& cols_axis
+) {
+    const auto& row_weights = resample_weights<scalar_t>(rows_axis);
+    const auto& col_weights = resample_weights<scalar_t>(cols_axis);
+    using weight_t = std::remove_cvref_t<decltype(row_weights)>::value_type;
+
+    const int64_t out_rows = dst.rows();
+    const int64_t total_rows = dst.channels() * out_rows;
+    const int threads =
+        simd::parallel_workers(total_rows * dst.cols(), RESIZE_MIN_WORKER_PIXELS);
+    simd::parallel_for(threads, threads, [&](int64_t job) {
+        const int64_t begin = (job * total_rows) / threads;
+        const int64_t end = ((job + 1) * total_rows) / threads;
+
+        simd::call_in_best_tier([&](auto tier) {
+            using Lines = ResampleLines<scalar_t, decltype(tier)::value, TAPS>;
+            std::vector<typename Lines::line_t> line(static_cast<size_t>(src.cols()));
+            std::vector<const scalar_t*> rows(static_cast<size_t>(rows_axis.taps));
+            std::vector<weight_t> weights(static_cast<size_t>(rows_axis.taps));
+            for (int64_t row = begin; row < end; ++row) {
+                const int64_t plane = row / out_rows;
+                const int64_t y = row % out_rows;
+                for (int64_t k = 0; k < rows_axis.taps; ++k) {
+                    const int64_t at = (k * out_rows) + y;
+                    rows[k] = src[plane][rows_axis.index[at]].data();
+                    weights[k] = row_weights[at];
+                }
+                Lines::vertical(
+                    rows.data(),
+                    weights.data(),
+                    rows_axis.taps,
+                    line.data(),
+                    src.cols()
+                );
+                Lines::horizontal(
+                    line.data(),
+                    cols_axis.index.data(),
+                    col_weights.data(),
+                    cols_axis.taps,
+                    dst[plane][y].data(),
+                    dst.cols()
+                );
+            }
+        });
+    });
+}
+
+}  // namespace p10::op
@@ -0,0 +1,181 @@
+#include "stft.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <ptensor/tensor.hpp>
+
+#include "elemwise.vec.hpp"
+
+namespace p10::op {
+namespace {
+    // Squared window sums at or below this are left undivided by Istft.
+    constexpr float MIN_WINDOW_WEIGHT = 1e-6F;
+
+    P10Error check_options(const StftOptions& options) {
+        if (options.frame_length() < 2) {
+            return P10Error::InvalidArgument << "STFT frame length must be at least 2";
+        }
+        if (options.hop_length() == 0 || options.hop_length() > options.frame_length()) {
+            return P10Error::InvalidArgument
+                << "STFT hop length must be between 1 and the frame length";
+        }
+        return P10Error::Ok;
+    }
+
+    P10Error check_float_tensor(const Tensor& tensor, const char* message) {
+        if (tensor.dtype() != Dtype::Float32 || tensor.device() != Device::Cpu
+            || !tensor.is_contiguous()) {
+            return P10Error::InvalidArgument << message;
+        }
+        return P10Error::Ok;
+    }
+
+    Tensor make_window(const StftOptions& options) {
+        Tensor window;
+        WindowFunction::generate(options.window(), options.frame_length(), Dtype::Float32, window)
+            .expect("STFT window generation failed");
+        return window;
+    }
+}  // namespace
+
+P10Result<Stft> Stft::create(const StftOptions& options) {
+    P10_RETURN_ERR_IF_ERROR(check_options(options));
+    return Ok(Stft(options));
+}
+
+Stft::Stft(const StftOptions& options) :
+    options_(options),
+    window_(make_window(options)),
+    fft_(std::make_unique<Fft>(FftOptions(Fft::ForwardReal))) {}
+
+P10Error Stft::transform(const Tensor& chunk, Tensor& spectrum) {
+    P10_RETURN_IF_ERROR(
+        check_float_tensor(chunk, "STFT input must be a contiguous Float32 CPU tensor")
+    );
+    if (chunk.dims() != 1) {
+        return P10Error::InvalidArgument << "STFT input must be 1D [T]";
+    }
+    const auto samples = chunk.as_span1d<const float>().unwrap();
+    pending_.insert(pending_.end(), samples.begin(), samples.end());
+
+    const auto length = static_cast<int64_t>(options_.frame_length());
+    const auto hop = static_cast<int64_t>(options_.hop_length());
+    const auto buffered = static_cast<int64_t>(pending_.size());
+    const int64_t frames = buffered < length ? 0 : ((buffered - length) / hop) + 1;
+    if (frames == 0) {
+        return spectrum.create(
+            make_shape(0, static_cast<int64_t>(options_.bins()), 2),
+            Dtype::Float32
+        );
+    }
+
+    P10_RETURN_IF_ERROR(frames_.create(make_shape(frames, length), Dtype::Float32));
+    const float* window = window_.as_span1d<const float>().unwrap().data();
+    float* rows = frames_.as_span1d<float>().unwrap().data();
+    for (int64_t frame = 0; frame < frames; ++frame) {
+        binary_elemwise(
+            pending_.data() + (frame * hop),
+            window,
+            rows + (frame * length),
+            length,
+            [](auto x, auto w) { return x * w; }
+        );
+    }
+    P10_RETURN_IF_ERROR(fft_->transform(frames_, spectrum));
+
+    const auto consumed = static_cast<size_t>(frames * hop);
+    std::copy(pending_.begin() + consumed, pending_.end(), pending_.begin());
+    pending_.resize(pending_.size() - consumed);
+    return P10Error::Ok;
+}
+
+void Stft::reset() {
+    pending_.clear();
+}
+
+P10Result<Istft> Istft::create(const StftOptions& options) {
+    P10_RETURN_ERR_IF_ERROR(check_options(options));
+    // The inverse real FFT of `bins` frequencies has 2 * (bins - 1) samples.
+    if (options.frame_length() % 2 != 0) {
+        return Err(P10Error::InvalidArgument << "ISTFT frame length must be even");
+    }
+    return Ok(Istft(options));
+}
+
+Istft::Istft(const StftOptions& options) :
+    options_(options),
+    window_(make_window(options)),
+    fft_(std::make_unique<Fft>(FftOptions(Fft::InverseReal, Fft::ByN))),
+    overlap_(options.frame_length() - options.hop_length(), 0.0F),
+    weight_(options.frame_length() - options.hop_length(), 0.0F) {}
+
+P10Error Istft::transform(const Tensor& spectrum, Tensor& chunk) {
+    P10_RETURN_IF_ERROR(
+        check_float_tensor(spectrum, "ISTFT input must be a contiguous Float32 CPU tensor")
+    );
+    const auto bins = static_cast<int64_t>(options_.bins());
+    if (spectrum.dims() != 3 || spectrum.shape(1).unwrap() != bins
+        || spectrum.shape(2).unwrap() != 2) {
+        return P10Error::InvalidArgument << "ISTFT input must be [frames, frame_length / 2 + 1, 2]";
+    }
+
+    const auto length = static_cast<int64_t>(options_.frame_length());
+    const auto hop = static_cast<int64_t>(options_.hop_length());
+    const int64_t frames = spectrum.shape(0).unwrap();
+    P10_RETURN_IF_ERROR(chunk.create(make_shape(frames * hop), Dtype::Float32));
+    if (frames == 0) {
+        return P10Error::Ok;
+    }
+    P10_RETURN_IF_ERROR(fft_->transform(spectrum, frames_));
+
+    // The open samples are followed by frames * hop new ones.
+    const int64_t open = length - hop;
+    const auto total = static_cast<size_t>((frames * hop) + open);
+    overlap_.resize(total, 0.0F);
+    weight_.resize(total, 0.0F);
+
+    const float* window = window_.as_span1d<const float>().unwrap().data();
+    const float* rows = frames_.as_span1d<const float>().unwrap().data();
+    for (int64_t frame = 0; frame < frames; ++frame) {
+        const float* row = rows + (frame * length);
+        float* sum = overlap_.data() + (frame * hop);
+        float* weight = weight_.data() + (frame * hop);
+        for (int64_t k = 0; k < length; ++k) {
+            sum[k] += row[k] * window[k];
+            weight[k] += window[k] * window[k];
+        }
+    }
+
+    float* out = chunk.as_span1d<float>().unwrap().data();
+    for (int64_t i = 0; i < frames * hop; ++i) {
+        out[i] = weight_[i] > MIN_WINDOW_WEIGHT ? overlap_[i] / weight_[i] : overlap_[i];
+    }
+
+    const auto emitted = static_cast<size_t>(frames * hop);
+    std::copy(overlap_.begin() + emitted, overlap_.end(), overlap_.begin());
+    std::copy(weight_.begin() + emitted, weight_.end(), weight_.begin());
+    overlap_.resize(static_cast<size_t>(open));
+    weight_.resize(static_cast<size_t>(open));
+    return P10Error::Ok;
+}
+
+P10Error Istft::flush(Tensor& chunk) {
+    const auto open = static_cast<int64_t>(overlap_.size());
+    P10_RETURN_IF_ERROR(chunk.create(make_shape(open), Dtype::Float32));
+    float* out = chunk.as_span1d<float>().unwrap().data();
+    for (int64_t i = 0; i < open; ++i) {
+        out[i] = weight_[i] > MIN_WINDOW_WEIGHT ? overlap_[i] / weight_[i] : overlap_[i];
+    }
+    reset();
+    return P10Error::Ok;
+}
+
+void Istft::reset() {
+    std::fill(overlap_.begin(), overlap_.end(), 0.0F);
+    std::fill(weight_.begin(), weight_.end(), 0.0F);
+}
+
+}  // namespace p10::op
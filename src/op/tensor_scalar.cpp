@@ -2,14 +2,22 @@
 
 #include <ptensor/tensor.hpp>
 
+#include "elemwise.vec.hpp"
+
 namespace p10::op {
 void multiply_scalar(Tensor& a, double scalar) {
     a.visit([=](auto span) {
         using T = decltype(span)::value_type;
         const T scalar_value = static_cast<T>(scalar);
-        for (size_t i = 0; i < span.size(); ++i) {
-            span[i] *= scalar_value;
-        }
+        T* data = span.data();
+        // In place: the second operand is ignored, the factor is splatted.
+        binary_elemwise(
+            data,
+            data,
+            data,
+            static_cast<int64_t>(span.size()),
+            [scalar_value](auto x, auto) { return x * splat<decltype(x)>(scalar_value); }
+        );
     });
 }
 }  // namespace p10::op
\ No newline at end of file
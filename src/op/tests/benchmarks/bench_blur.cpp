@@ -5,9 +5,9 @@
 #include <ptensor/op/blur.hpp>
 #include <ptensor/tensor.hpp>
 
-// Private kernel header: the per-kernel benchmarks call the convolution sweeps
-// directly, bypassing GaussianBlur::transform and the tile2d dispatch.
-#include "blur.hblur.hpp"
+// Private kernel header: the per-kernel benchmarks call the line kernels
+// directly, bypassing GaussianBlur::transform and its dispatch.
+#include "blur.lines.hpp"
 
 namespace p10::op {
 namespace {
@@ -27,8 +27,8 @@ namespace {
             .unwrap();
     }
 
-    // Whole operator: both separable passes, tiling, kernel dispatch and the
-    // intermediate transpose. The end-to-end number to compare against.
+    // Whole operator: the band split, line-kernel dispatch and parallel
+    // workers. The end-to-end number to compare against.
     // NOLINTNEXTLINE(readability-identifier-naming) -- BM_ is the Google Benchmark convention.
     void BM_Blur(benchmark::State& state) {
         const int height = static_cast<int>(state.range(0));
@@ -47,38 +47,31 @@ namespace {
         state.SetItemsProcessed(state.iterations() * height * width);
     }
 
-    // Interior kernel only: no edge clamp, KHALF a compile-time constant so the
-    // tap loop unrolls exactly as the real interior path. Swept over every plane
-    // row directly (no tiler), over the halo-inset columns the interior covers.
-    template<int64_t KHALF>
-    void run_portable(benchmark::State& state) {
+    // Recursive blur: the cost per pixel should stay flat as sigma grows.
+    // NOLINTNEXTLINE(readability-identifier-naming) -- BM_ is the Google Benchmark convention.
+    void BM_RecursiveBlur(benchmark::State& state) {
         const int height = static_cast<int>(state.range(0));
         const int width = static_cast<int>(state.range(1));
-        const auto kernel = make_kernel(2 * KHALF + 1);
+        const auto sigma = static_cast<float>(state.range(2));
 
         const Tensor input = random_plane(height, width);
+        RecursiveGaussianBlur blur_op = RecursiveGaussianBlur::create(sigma).unwrap();
+
         Tensor output;
         output.create_like(input);
-        const auto in = input.as_span2d<const float>().unwrap();
-        auto out = output.as_span2d<float>().unwrap();
-        const int64_t inner = width - 2 * KHALF;
-
         for ([[maybe_unused]] auto _ : state) {
-            for (int64_t row = 0; row < height; ++row) {
-                hblur_portable<float, KHALF>(
-                    in(row).slice(KHALF, inner),
-                    out(row).slice(KHALF, inner),
-                    kernel.data()
-                );
-            }
-            benchmark::ClobberMemory();
+            blur_op.transform(input, output);
+            benchmark::DoNotOptimize(output);
         }
-        state.SetItemsProcessed(state.iterations() * height * inner);
+        state.SetItemsProcessed(state.iterations() * height * width);
     }
 
-    // Border kernel only: clamps every tap (runtime half), swept over every full
-    // row. Compare against run_portable to see the clamp cost.
-    void run_scalar(benchmark::State& state) {
+    // One plane as a single band on the calling thread, with the portable line
+    // kernels: the per-core streaming cost, without the parallel split or the
+    // SIMD dispatch. KHALF = 0 runs the runtime-half loops larger kernels use;
+    // compare against a fixed KHALF to see what unrolling the taps buys.
+    template<int64_t KHALF>
+    void run_band(benchmark::State& state) {
         const int height = static_cast<int>(state.range(0));
         const int width = static_cast<int>(state.range(1));
         const int half = static_cast<int>(state.range(2));
@@ -89,11 +82,18 @@ namespace {
         output.create_like(input);
         const auto in = input.as_span2d<const float>().unwrap();
         auto out = output.as_span2d<float>().unwrap();
+        BlurLineBuffer<float> buffer(width, half);
 
         for ([[maybe_unused]] auto _ : state) {
-            for (int64_t row = 0; row < height; ++row) {
-                hblur_scalar<float>(in(row), out(row), half, kernel.data());
-            }
+            blur_band<PortableBlurLines<float, KHALF>>(
+                in,
+                out,
+                0,
+                height,
+                kernel.data(),
+                half,
+                buffer
+            );
             benchmark::ClobberMemory();
         }
         state.SetItemsProcessed(state.iterations() * height * width);
@@ -103,15 +103,23 @@ namespace {
         ->Args({256, 256, 3})
         ->Args({512, 512, 5})
         ->Args({1024, 1024, 7})
+        ->Args({1024, 1024, 15})
+        ->Args({1024, 1024, 25})
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK(BM_RecursiveBlur)
+        ->Args({1024, 1024, 3})
+        ->Args({1024, 1024, 10})
+        ->Args({1024, 1024, 50})
         ->Unit(benchmark::kMicrosecond);
 
-    BENCHMARK_TEMPLATE(run_portable, 3)
-        ->Args({256, 256})
-        ->Args({512, 512})
-        ->Args({1024, 1024})
+    BENCHMARK_TEMPLATE(run_band, 3)
+        ->Args({256, 256, 3})
+        ->Args({512, 512, 3})
+        ->Args({1024, 1024, 3})
         ->Unit(benchmark::kMicrosecond);
 
-    BENCHMARK(run_scalar)
+    BENCHMARK_TEMPLATE(run_band, 0)
         ->Args({256, 256, 3})
         ->Args({512, 512, 3})
         ->Args({1024, 1024, 3})
@@ -0,0 +1,164 @@
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <ptensor/op/activation.hpp>
+#include <ptensor/tensor.hpp>
+#include <ptensor/testing/catch2_assertions.hpp>
+#include <ptensor/testing/compare_tensors.hpp>
+#include <ptensor/testing/simd_tiers.hpp>
+
+namespace p10::op {
+
+namespace {
+    Tensor random_tensor(const Shape& shape, double lo, double hi, uint64_t seed) {
+        return Tensor::from_random(
+                   shape,
+                   std::mt19937_64(seed),
+                   TensorOptions().dtype(Dtype::Float32),
+                   lo,
+                   hi
+        )
+            .unwrap();
+    }
+
+    // Softmax (or log softmax) of `input` along `axis` in double precision.
+    std::vector<double> reference_softmax(const Tensor& input, int64_t axis, bool log) {
+        const auto shape = input.shape().as_span();
+        int64_t outer = 1;
+        for (int64_t i = 0; i < axis; ++i) {
+            outer *= shape[i];
+        }
+        const int64_t lines = shape[axis];
+        int64_t inner = 1;
+        for (size_t i = static_cast<size_t>(axis) + 1; i < shape.size(); ++i) {
+            inner *= shape[i];
+        }
+
+        const auto values = input.as_span1d<const float>().unwrap();
+        std::vector<double> result(values.size());
+        for (int64_t o = 0; o < outer; ++o) {
+            for (int64_t i = 0; i < inner; ++i) {
+                const auto at = [&](int64_t k) { return ((o * lines) + k) * inner + i; };
+                double max = values[at(0)];
+                for (int64_t k = 1; k < lines; ++k) {
+                    max = std::max(max, static_cast<double>(values[at(k)]));
+                }
+                double sum = 0.0;
+                for (int64_t k = 0; k < lines; ++k) {
+                    sum += std::exp(values[at(k)] - max);
+                }
+                for (int64_t k = 0; k < lines; ++k) {
+                    const double shifted = values[at(k)] - max;
+                    result[at(k)] = log ? shifted - std::log(sum) : std::exp(shifted) / sum;
+                }
+            }
+        }
+        return result;
+    }
+}  // namespace
+
+TEST_CASE("Op: exp, log and sigmoid match libm", "[tensorop][activation]") {
+    // Large enough to be split over several workers, with a ragged tail.
+    const Tensor input = random_tensor(make_shape(301, 257), -20.0, 20.0, 3);
+    const auto values = input.as_span1d<const float>().unwrap();
+
+    Tensor exp_output;
+    Tensor log_output;
+    Tensor sigmoid_output;
+    REQUIRE(op::exp(input, exp_output) == P10Error::Ok);
+    REQUIRE(op::sigmoid(input, sigmoid_output) == P10Error::Ok);
+    REQUIRE(op::log(exp_output, log_output) == P10Error::Ok);
+    REQUIRE(exp_output.shape() == input.shape());
+
+    const auto exps = exp_output.as_span1d<const float>().unwrap();
+    const auto logs = log_output.as_span1d<const float>().unwrap();
+    const auto sigmoids = sigmoid_output.as_span1d<const float>().unwrap();
+    for (size_t i = 0; i < values.size(); ++i) {
+        const double x = values[i];
+        REQUIRE(std::abs(exps[i] - std::exp(x)) <= 3e-7 * std::exp(x));
+        REQUIRE(std::abs(logs[i] - std::log(static_cast<double>(exps[i]))) <= 1e-6);
+        REQUIRE(std::abs(sigmoids[i] - (1.0 / (1.0 + std::exp(-x)))) <= 3e-7);
+    }
+
+    REQUIRE_THAT(
+        testing::compare_simd_tiers([&](Tensor& tier_output) {
+            op::sigmoid(input, tier_output).expect("sigmoid failed");
+        }),
+        testing::is_ok()
+    );
+}
+
+TEST_CASE("Op: element-wise activations run in place", "[tensorop][activation]") {
+    Tensor values = random_tensor(make_shape(5, 7), 0.5, 4.0, 5);
+    Tensor expected;
+    REQUIRE(op::log(values, expected) == P10Error::Ok);
+    REQUIRE(op::log(values, values) == P10Error::Ok);
+    REQUIRE_THAT(testing::compare_tensors(values, expected), testing::is_ok());
+}
+
+TEST_CASE("Op: softmax matches the double-precision reference", "[tensorop][activation]") {
+    const auto [shape, axis] = GENERATE(
+        std::pair {make_shape(64, 1003), int64_t {-1}},
+        std::pair {make_shape(3, 37, 5), int64_t {1}},
+        std::pair {make_shape(4, 50, 600), int64_t {1}},
+        std::pair {make_shape(300, 7), int64_t {0}},
+        std::pair {make_shape(9), int64_t {0}}
+    );
+    const bool log = GENERATE(false, true);
+    CAPTURE(shape, axis, log);
+
+    // Logits far beyond e^x's float range, which the max shift absorbs.
+    const Tensor input = random_tensor(shape, -500.0, 500.0, 11);
+    const auto run = [&](Tensor& output) {
+        return log ? log_softmax(input, output, axis) : softmax(input, output, axis);
+    };
+    Tensor output;
+    REQUIRE(run(output) == P10Error::Ok);
+    REQUIRE(output.shape() == input.shape());
+
+    const int64_t dims = static_cast<int64_t>(input.dims());
+    const auto expected = reference_softmax(input, axis < 0 ? axis + dims : axis, log);
+    const auto actual = output.as_span1d<const float>().unwrap();
+    for (size_t i = 0; i < expected.size(); ++i) {
+        const double tolerance = log ? 1e-6 * std::max(1.0, std::abs(expected[i])) : 1e-6;
+        REQUIRE(std::abs(actual[i] - expected[i]) <= tolerance);
+    }
+
+    // Line sums run per vector lane, so tiers differ in the last bits; log
+    // softmax values reach -1000, where a float step is 6e-5.
+    const auto tolerance = testing::CompareOptions().tolerance(log ? 1e-4 : 1e-6);
+    REQUIRE_THAT(
+        testing::compare_simd_tiers(
+            [&](Tensor& tier_output) { run(tier_output).expect("softmax failed"); },
+            tolerance
+        ),
+        testing::is_ok()
+    );
+}
+
+TEST_CASE("Op: softmax runs in place", "[tensorop][activation]") {
+    const int64_t axis = GENERATE(0, 1);
+    Tensor values = random_tensor(make_shape(6, 300), -5.0, 5.0, 13);
+    Tensor expected;
+    REQUIRE(softmax(values, expected, axis) == P10Error::Ok);
+    REQUIRE(softmax(values, values, axis) == P10Error::Ok);
+    REQUIRE_THAT(testing::compare_tensors(values, expected), testing::is_ok());
+}
+
+TEST_CASE("Op: activation errors", "[tensorop][activation]") {
+    Tensor output;
+    const Tensor doubles = Tensor::zeros(make_shape(4), Dtype::Float64).unwrap();
+    REQUIRE(op::exp(doubles, output) == P10Error::InvalidArgument);
+    REQUIRE(softmax(doubles, output) == P10Error::InvalidArgument);
+
+    const Tensor values = Tensor::zeros(make_shape(2, 3), Dtype::Float32).unwrap();
+    REQUIRE(softmax(values, output, 2) == P10Error::InvalidArgument);
+    REQUIRE(log_softmax(values, output, -3) == P10Error::InvalidArgument);
+    REQUIRE(softmax(values, output, -2) == P10Error::Ok);
+}
+
+}  // namespace p10::op
@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <numbers>
 #include <random>
 #include <vector>
@@ -13,6 +14,7 @@
 #include <ptensor/tensor.hpp>
 #include <ptensor/testing/catch2_assertions.hpp>
 #include <ptensor/testing/compare_tensors.hpp>
+#include <ptensor/testing/simd_tiers.hpp>
 
 #include "testing.hpp"
 
@@ -76,14 +78,14 @@ namespace {
     }
 }  // namespace
 
-// The fast path (2D float32, kernel 3/5/7/9) runs a simd-tiled horizontal pass,
-// a transpose, another horizontal pass, and a final transpose. Check it against
-// a naive clamped separable convolution (horizontal then vertical).
+// The blur streams each plane through a ring of horizontally filtered rows and
+// takes the vertical tap over the ring. Check it against a naive clamped
+// separable convolution (horizontal then vertical).
 TEST_CASE("Op: Blur float32 plane", "[tensorop][blur]") {
     const int height = 67;  // non-multiples of the SIMD block to exercise borders
     const int width = 83;
     const float sigma = 1.5F;
-    const auto kernel_size = GENERATE(3, 5, 7, 9);
+    const auto kernel_size = GENERATE(3, 5, 7, 9, 15, 25);
 
     DYNAMIC_SECTION("kernel size " << kernel_size) {
         std::mt19937_64 rng(123);
@@ -134,4 +136,380 @@ TEST_CASE("Op: Blur float32 plane", "[tensorop][blur]") {
         }
     }
 }
+
+// Planes large enough to split into bands across the workers, in float and in
+// uint8, whose horizontal pass rounds to uint8 before the vertical one. The
+// uint8 blur quantizes the kernel, so it may differ from the float reference
+// by a step.
+TEST_CASE("Op: Blur large multi-channel planes", "[tensorop][blur]") {
+    const int channels = 2;
+    const int height = 301;
+    const int width = 211;
+    const auto kernel_size = GENERATE(5, 11);
+    const auto dtype = GENERATE(Dtype::Float32, Dtype::Uint8);
+
+    DYNAMIC_SECTION("kernel size " << kernel_size << ", " << to_string(dtype)) {
+        const bool is_uint8 = dtype == Dtype::Uint8;
+        const Tensor input = Tensor::from_random(
+                                 make_shape(channels, height, width),
+                                 std::mt19937_64(99),
+                                 TensorOptions().dtype(dtype),
+                                 0.0,
+                                 is_uint8 ? 255.0 : 1.0
+        )
+                                 .unwrap();
+        auto blur_op = GaussianBlur::create(kernel_size, 2.0F).unwrap();
+        Tensor output;
+        REQUIRE(blur_op.transform(input, output).is_ok());
+
+        const auto as_floats = [&](const Tensor& tensor) {
+            if (is_uint8) {
+                const auto values = tensor.as_span1d<uint8_t>().unwrap();
+                return std::vector<float>(values.begin(), values.end());
+            }
+            const auto values = tensor.as_span1d<float>().unwrap();
+            return std::vector<float>(values.begin(), values.end());
+        };
+        const auto round_to_dtype = [&](float value) {
+            return is_uint8 ? std::clamp(std::round(value), 0.0F, 255.0F) : value;
+        };
+        const std::vector<float> in = as_floats(input);
+        const std::vector<float> out = as_floats(output);
+        const auto kernel = gaussian_1d(kernel_size, 2.0F);
+        const int half = kernel_size / 2;
+
+        std::vector<float> horizontal(static_cast<size_t>(height * width));
+        for (int channel = 0; channel < channels; ++channel) {
+            const float* in_plane = in.data() + (channel * height * width);
+            const float* out_plane = out.data() + (channel * height * width);
+            for (int y = 0; y < height; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    float sum = 0.0F;
+                    for (int k = -half; k <= half; ++k) {
+                        sum += in_plane[(y * width) + std::clamp(x + k, 0, width - 1)]
+                            * kernel[k + half];
+                    }
+                    horizontal[(y * width) + x] = round_to_dtype(sum);
+                }
+            }
+            for (int y = 0; y < height; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    float sum = 0.0F;
+                    for (int k = -half; k <= half; ++k) {
+                        sum += horizontal[(std::clamp(y + k, 0, height - 1) * width) + x]
+                            * kernel[k + half];
+                    }
+                    CAPTURE(channel, y, x);
+                    REQUIRE(
+                        out_plane[(y * width) + x]
+                        == Catch::Approx(round_to_dtype(sum)).margin(is_uint8 ? 1.0 : 1e-4)
+                    );
+                }
+            }
+        }
+    }
+}
+
+namespace {
+    // Independent spelling of the integer blur's fixed-point math: weights
+    // quantized to sum to exactly `one`, center tap taking the rounding error;
+    // folded taps; round half up at the end of each pass.
+    std::vector<int64_t> quantize(const std::vector<float>& kernel, int64_t one, int64_t max) {
+        const size_t center = kernel.size() / 2;
+        std::vector<int64_t> weights(kernel.size());
+        int64_t sum = 0;
+        for (size_t k = 0; k < kernel.size(); ++k) {
+            if (k != center) {
+                weights[k] = std::llround(static_cast<double>(kernel[k]) * one);
+                sum += weights[k];
+            }
+        }
+        weights[center] = std::clamp<int64_t>(one - sum, 0, max);
+        return weights;
+    }
+
+    // One fixed-point tap pass of `line` (count samples `stride` apart, clamped
+    // at the ends) at index i.
+    template<typename scalar_t>
+    int64_t fixed_tap(
+        const std::vector<int64_t>& line,
+        int64_t i,
+        const std::vector<int64_t>& weights
+    ) {
+        const auto count = static_cast<int64_t>(line.size());
+        const auto half = static_cast<int64_t>(weights.size() / 2);
+        const auto at = [&](int64_t j) { return line[std::clamp<int64_t>(j, 0, count - 1)]; };
+        int64_t sum = 0;
+        if constexpr (std::is_same_v<scalar_t, uint8_t>) {
+            // Q7 pixels times Q16 weights, top 16 bits of each product.
+            sum = ((at(i) << 7) * weights[half]) >> 16;
+            for (int64_t k = 1; k <= half; ++k) {
+                sum += (((at(i - k) + at(i + k)) << 7) * weights[half - k]) >> 16;
+            }
+            return std::min<int64_t>((sum + 64) >> 7, 255);
+        } else {
+            sum = at(i) * weights[half];
+            for (int64_t k = 1; k <= half; ++k) {
+                sum += (at(i - k) + at(i + k)) * weights[half - k];
+            }
+            return std::min<int64_t>((sum + (1 << 14)) >> 15, 65535);
+        }
+    }
+
+    template<typename scalar_t>
+    void check_fixed_point_blur(int kernel_size, float sigma) {
+        constexpr bool IS_UINT8 = std::is_same_v<scalar_t, uint8_t>;
+        const int64_t height = 53;
+        const int64_t width = 147;  // not a multiple of any register width
+        const Tensor input = Tensor::from_random(
+                                 make_shape(2, height, width),
+                                 std::mt19937_64(kernel_size),
+                                 TensorOptions().dtype(Dtype::from<scalar_t>()),
+                                 0.0,
+                                 IS_UINT8 ? 255.0 : 65535.0
+        )
+                                 .unwrap();
+        auto blur_op = GaussianBlur::create(kernel_size, sigma).unwrap();
+        Tensor output;
+        REQUIRE(blur_op.transform(input, output).is_ok());
+
+        const auto weights = IS_UINT8 ? quantize(gaussian_1d(kernel_size, sigma), 1 << 16, 0xFFFF)
+                                      : quantize(gaussian_1d(kernel_size, sigma), 1 << 15, 1 << 15);
+        const auto in = input.as_span3d<const scalar_t>().unwrap();
+        const auto out = output.as_span3d<const scalar_t>().unwrap();
+        for (int64_t channel = 0; channel < 2; ++channel) {
+            std::vector<std::vector<int64_t>> horizontal(height);
+            for (int64_t y = 0; y < height; ++y) {
+                const std::vector<int64_t> row(in[channel][y].begin(), in[channel][y].end());
+                for (int64_t x = 0; x < width; ++x) {
+                    horizontal[y].push_back(fixed_tap<scalar_t>(row, x, weights));
+                }
+            }
+            for (int64_t x = 0; x < width; ++x) {
+                std::vector<int64_t> column;
+                for (int64_t y = 0; y < height; ++y) {
+                    column.push_back(horizontal[y][x]);
+                }
+                for (int64_t y = 0; y < height; ++y) {
+                    CAPTURE(channel, y, x);
+                    REQUIRE(out[channel][y][x] == fixed_tap<scalar_t>(column, y, weights));
+                }
+            }
+        }
+
+        REQUIRE_THAT(
+            testing::compare_simd_tiers(
+                [&](Tensor& tier_output) {
+                    blur_op.transform(input, tier_output).expect("blur failed");
+                }
+            ),
+            testing::is_ok()
+        );
+    }
+}  // namespace
+
+// uint8 and uint16 blur in fixed point, bit-exact on every tier.
+TEST_CASE("Op: Blur uint8 and uint16 in fixed point", "[tensorop][blur]") {
+    const auto kernel_size = GENERATE(3, 7, 13, 25);
+
+    DYNAMIC_SECTION("kernel size " << kernel_size) {
+        check_fixed_point_blur<uint8_t>(kernel_size, 0.3F * static_cast<float>(kernel_size));
+        check_fixed_point_blur<uint16_t>(kernel_size, 0.3F * static_cast<float>(kernel_size));
+    }
+
+    SECTION("A constant image stays constant") {
+        const auto constant =
+            Tensor::full(make_shape(40, 70), 201.0, TensorOptions().dtype(Dtype::Uint8)).unwrap();
+        auto blur_op = GaussianBlur::create(25, 6.0F).unwrap();
+        Tensor blurred;
+        REQUIRE(blur_op.transform(constant, blurred).is_ok());
+        REQUIRE_THAT(testing::compare_tensors(constant, blurred), testing::is_ok());
+    }
+}
+
+TEST_CASE("Op: Blur agrees across SIMD tiers", "[tensorop][blur]") {
+    const auto kernel_size = GENERATE(3, 7, 11, 25);
+
+    DYNAMIC_SECTION("kernel size " << kernel_size) {
+        std::mt19937_64 rng(7);
+        const Tensor input = Tensor::from_random(
+                                 make_shape(61, 97),
+                                 rng,
+                                 TensorOptions().dtype(Dtype::Float32)
+        )
+                                 .unwrap();
+        auto blur_op = GaussianBlur::create(kernel_size, 2.0F).unwrap();
+
+        REQUIRE_THAT(
+            testing::compare_simd_tiers(
+                [&](Tensor& output) { blur_op.transform(input, output).expect("blur failed"); },
+                testing::CompareOptions().tolerance(1e-5)
+            ),
+            testing::is_ok()
+        );
+    }
+}
+
+TEST_CASE("Op: Blur in place matches a separate output", "[tensorop][blur]") {
+    const auto dtype = GENERATE(Dtype::Float32, Dtype::Uint8);
+    const auto kernel_size = GENERATE(3, 25);
+
+    DYNAMIC_SECTION("kernel size " << kernel_size << ", " << to_string(dtype)) {
+        // Tall enough to split into row bands on several workers.
+        const Tensor input = Tensor::from_random(
+                                 make_shape(2, 480, 320),
+                                 std::mt19937_64(21),
+                                 TensorOptions().dtype(dtype),
+                                 0.0,
+                                 255.0
+        )
+                                 .unwrap();
+        auto blur_op = GaussianBlur::create(kernel_size, 4.0F).unwrap();
+        Tensor expected;
+        REQUIRE(blur_op.transform(input, expected).is_ok());
+
+        Tensor values = input.clone().unwrap();
+        REQUIRE(blur_op.transform(values, values).is_ok());
+        REQUIRE_THAT(testing::compare_tensors(values, expected), testing::is_ok());
+    }
+}
+
+namespace {
+    // Separable Gaussian of radius ceil(4 sigma) with replicated edges, in double.
+    template<typename scalar_t>
+    std::vector<double> direct_gaussian_blur(const Tensor& input, double sigma) {
+        const auto in = input.as_span3d<const scalar_t, RankFit::Flexible>().unwrap();
+        const int64_t rows = in.rows();
+        const int64_t cols = in.cols();
+        const auto radius = static_cast<int64_t>(std::ceil(4.0 * sigma));
+        std::vector<double> kernel(static_cast<size_t>((2 * radius) + 1));
+        double total = 0.0;
+        for (int64_t i = -radius; i <= radius; ++i) {
+            kernel[i + radius] = std::exp(-static_cast<double>(i * i) / (2.0 * sigma * sigma));
+            total += kernel[i + radius];
+        }
+        for (auto& weight : kernel) {
+            weight /= total;
+        }
+
+        std::vector<double> horizontal(static_cast<size_t>(rows * cols));
+        std::vector<double> reference(static_cast<size_t>(in.channels() * rows * cols));
+        for (int64_t c = 0; c < in.channels(); ++c) {
+            for (int64_t y = 0; y < rows; ++y) {
+                for (int64_t x = 0; x < cols; ++x) {
+                    double sum = 0.0;
+                    for (int64_t k = -radius; k <= radius; ++k) {
+                        const int64_t sx = std::clamp<int64_t>(x + k, 0, cols - 1);
+                        sum += static_cast<double>(in[c][y][sx]) * kernel[k + radius];
+                    }
+                    horizontal[(y * cols) + x] = sum;
+                }
+            }
+            double* plane = reference.data() + (c * rows * cols);
+            for (int64_t y = 0; y < rows; ++y) {
+                for (int64_t x = 0; x < cols; ++x) {
+                    double sum = 0.0;
+                    for (int64_t k = -radius; k <= radius; ++k) {
+                        const int64_t sy = std::clamp<int64_t>(y + k, 0, rows - 1);
+                        sum += horizontal[(sy * cols) + x] * kernel[k + radius];
+                    }
+                    plane[(y * cols) + x] = sum;
+                }
+            }
+        }
+        return reference;
+    }
+}  // namespace
+
+// The recursive filter only approximates the Gaussian, so compare against the
+// exact convolution with a tolerance; the fit improves as sigma grows.
+TEST_CASE("Op: Recursive Gaussian blur", "[tensorop][blur]") {
+    const auto sigma = GENERATE(3.0F, 10.0F, 25.0F, 60.0F);
+
+    DYNAMIC_SECTION("float32 sigma " << sigma) {
+        // Odd sizes leave rows past the transposed blocks and columns past the
+        // SIMD strips.
+        const Tensor input = Tensor::from_random(
+                                 make_shape(67, 149),
+                                 std::mt19937_64(21),
+                                 TensorOptions().dtype(Dtype::Float32),
+                                 0.0,
+                                 1.0
+        )
+                                 .unwrap();
+        auto blur_op = RecursiveGaussianBlur::create(sigma).unwrap();
+        Tensor output;
+        REQUIRE(blur_op.transform(input, output).is_ok());
+        REQUIRE(output.shape() == input.shape());
+        REQUIRE(output.dtype() == Dtype::Float32);
+
+        const auto reference = direct_gaussian_blur<float>(input, sigma);
+        const auto out = output.as_span1d<const float>().unwrap();
+        const double tolerance = sigma < 10.0F ? 1e-2 : 5e-3;
+        for (size_t i = 0; i < reference.size(); ++i) {
+            CAPTURE(i);
+            REQUIRE(out[i] == Catch::Approx(reference[i]).margin(tolerance));
+        }
+
+        REQUIRE_THAT(
+            testing::compare_simd_tiers(
+                [&](Tensor& tier_output) {
+                    blur_op.transform(input, tier_output).expect("blur failed");
+                },
+                testing::CompareOptions().tolerance(1e-5)
+            ),
+            testing::is_ok()
+        );
+    }
+
+    SECTION("uint8 planes split into bands and strips") {
+        const Tensor input = Tensor::from_random(
+                                 make_shape(3, 301, 211),
+                                 std::mt19937_64(8),
+                                 TensorOptions().dtype(Dtype::Uint8),
+                                 0.0,
+                                 255.0
+        )
+                                 .unwrap();
+        auto blur_op = RecursiveGaussianBlur::create(8.0F).unwrap();
+        Tensor output;
+        REQUIRE(blur_op.transform(input, output).is_ok());
+        REQUIRE(output.dtype() == Dtype::Uint8);
+
+        const auto reference = direct_gaussian_blur<uint8_t>(input, 8.0);
+        const auto out = output.as_span1d<const uint8_t>().unwrap();
+        for (size_t i = 0; i < reference.size(); ++i) {
+            CAPTURE(i);
+            REQUIRE(static_cast<double>(out[i]) == Catch::Approx(reference[i]).margin(3.0));
+        }
+    }
+
+    SECTION("Blurring a constant image keeps the constant") {
+        const auto constant = Tensor::full(make_shape(2, 45, 70), 0.25).unwrap();
+        auto blur_op = RecursiveGaussianBlur::create(12.0F).unwrap();
+        Tensor blurred;
+        REQUIRE(blur_op.transform(constant, blurred).is_ok());
+        REQUIRE_THAT(
+            testing::compare_tensors(constant, blurred, testing::CompareOptions().tolerance(1e-5)),
+            testing::is_ok()
+        );
+
+        const Tensor gray =
+            Tensor::full(make_shape(45, 70), 200.0, TensorOptions().dtype(Dtype::Uint8)).unwrap();
+        REQUIRE(blur_op.transform(gray, blurred).is_ok());
+        REQUIRE_THAT(testing::compare_tensors(gray, blurred), testing::is_ok());
+    }
+
+    SECTION("Should fail with invalid sigma or input") {
+        REQUIRE(RecursiveGaussianBlur::create(0.3F).is_error());
+        REQUIRE(RecursiveGaussianBlur::create(std::nanf("")).is_error());
+        REQUIRE(RecursiveGaussianBlur::create(1e9F).is_error());
+        REQUIRE(RecursiveGaussianBlur::create(RecursiveGaussianBlur::MAX_SIGMA).is_ok());
+
+        auto blur_op = RecursiveGaussianBlur::create(5.0F).unwrap();
+        const auto line = Tensor::full(make_shape(16), 1.0).unwrap();
+        Tensor output;
+        REQUIRE(blur_op.transform(line, output) == P10Error::InvalidArgument);
+    }
+}
 }  // namespace p10::op
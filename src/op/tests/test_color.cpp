@@ -0,0 +1,265 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <ptensor/op/color.hpp>
+#include <ptensor/tensor.hpp>
+#include <ptensor/testing/catch2_assertions.hpp>
+#include <ptensor/testing/compare_tensors.hpp>
+#include <ptensor/testing/simd_tiers.hpp>
+
+namespace p10::op {
+
+namespace {
+    Tensor random_image(const Shape& shape, Dtype dtype, uint64_t seed) {
+        const double high = dtype == Dtype::Uint8 ? 255.0 : 1.0;
+        return Tensor::from_random(
+                   shape,
+                   std::mt19937_64(seed),
+                   TensorOptions().dtype(dtype),
+                   0.0,
+                   high
+        )
+            .unwrap();
+    }
+
+    // Planar [C, H, W] copy of an interleaved [H, W, C] image.
+    template<typename T>
+    Tensor to_planar(const Tensor& image) {
+        const auto shape = image.shape().as_span();
+        const int64_t height = shape[0];
+        const int64_t width = shape[1];
+        const int64_t channels = shape[2];
+        Tensor planar = Tensor::zeros(make_shape(channels, height, width), image.dtype()).unwrap();
+        const auto src = image.as_span1d<const T>().unwrap();
+        auto dst = planar.as_span1d<T>().unwrap();
+        for (int64_t pixel = 0; pixel < height * width; ++pixel) {
+            for (int64_t c = 0; c < channels; ++c) {
+                dst[(c * height * width) + pixel] = src[(pixel * channels) + c];
+            }
+        }
+        return planar;
+    }
+
+    // HSV of an RGB pixel in double precision: H in degrees, S and V in
+    // the units of the input.
+    std::array<double, 3> exact_hsv(double r, double g, double b) {
+        const double value = std::max({r, g, b});
+        const double range = value - std::min({r, g, b});
+        double hue = 0.0;
+        if (range > 0.0) {
+            if (value == r) {
+                hue = 60.0 * (g - b) / range;
+            } else if (value == g) {
+                hue = 120.0 + (60.0 * (b - r) / range);
+            } else {
+                hue = 240.0 + (60.0 * (r - g) / range);
+            }
+        }
+        if (hue < 0.0) {
+            hue += 360.0;
+        }
+        return {hue, value > 0.0 ? range / value : 0.0, value};
+    }
+
+    std::array<double, 3> exact_rgb(double hue, double saturation, double value) {
+        std::array<double, 3> rgb {};
+        const std::array<double, 3> n {5.0, 3.0, 1.0};
+        for (size_t c = 0; c < 3; ++c) {
+            const double k = std::fmod(n[c] + (hue / 60.0), 6.0);
+            rgb[c] = value - (value * saturation * std::clamp(std::min(k, 4.0 - k), 0.0, 1.0));
+        }
+        return rgb;
+    }
+}  // namespace
+
+TEST_CASE("Op: convert_color gray is within 1 of the exact weights", "[tensorop][color]") {
+    const auto luma = GENERATE(LumaWeights::BT601, LumaWeights::BT709, LumaWeights::Luminosity);
+    const bool bgr = GENERATE(false, true);
+    CAPTURE(luma, bgr);
+    std::array<double, 3> weights = {0.299, 0.587, 0.114};
+    if (luma == LumaWeights::BT709) {
+        weights = {0.2126, 0.7152, 0.0722};
+    } else if (luma == LumaWeights::Luminosity) {
+        weights = {0.21, 0.72, 0.07};
+    }
+
+    const Tensor image = random_image(make_shape(7, 45, 3), Dtype::Uint8, 3);
+    const auto conversion = bgr ? ColorConversion::BgrToGray : ColorConversion::RgbToGray;
+    const auto options = ColorOptions().luma(luma);
+    Tensor gray;
+    REQUIRE(convert_color(image, gray, conversion, options) == P10Error::Ok);
+    REQUIRE(gray.shape() == make_shape(7, 45, 1));
+
+    const auto pixels = image.as_span1d<const uint8_t>().unwrap();
+    const auto values = gray.as_span1d<const uint8_t>().unwrap();
+    for (size_t i = 0; i < values.size(); ++i) {
+        const uint8_t* rgb = &pixels[i * 3];
+        const double red = bgr ? rgb[2] : rgb[0];
+        const double blue = bgr ? rgb[0] : rgb[2];
+        const double expected = (weights[0] * red) + (weights[1] * rgb[1]) + (weights[2] * blue);
+        REQUIRE(std::abs(values[i] - std::round(expected)) <= 1.0);
+    }
+
+    const Tensor white = Tensor::full(make_shape(2, 3, 3), 255, Dtype::Uint8).unwrap();
+    REQUIRE(convert_color(white, gray, conversion, options) == P10Error::Ok);
+    const auto whites = gray.as_span1d<const uint8_t>().unwrap();
+    REQUIRE(std::all_of(whites.begin(), whites.end(), [](uint8_t v) { return v == 255; }));
+}
+
+TEST_CASE("Op: convert_color HSV matches the exact conversion", "[tensorop][color]") {
+    const Tensor image = random_image(make_shape(9, 37, 3), Dtype::Uint8, 5);
+    Tensor hsv;
+    REQUIRE(convert_color(image, hsv, ColorConversion::RgbToHsv) == P10Error::Ok);
+
+    const auto pixels = image.as_span1d<const uint8_t>().unwrap();
+    const auto values = hsv.as_span1d<const uint8_t>().unwrap();
+    for (size_t i = 0; i < pixels.size(); i += 3) {
+        const auto expected = exact_hsv(pixels[i], pixels[i + 1], pixels[i + 2]);
+        // Hue is circular: 179 and 0 are neighbours.
+        const double hue_error = std::abs(values[i] - std::round(expected[0] / 2.0));
+        REQUIRE(std::min(hue_error, 180.0 - hue_error) <= 1.0);
+        REQUIRE(std::abs(values[i + 1] - std::round(expected[1] * 255.0)) <= 1.0);
+        REQUIRE(values[i + 2] == expected[2]);
+    }
+
+    Tensor rgb;
+    REQUIRE(convert_color(hsv, rgb, ColorConversion::HsvToRgb) == P10Error::Ok);
+    const auto restored = rgb.as_span1d<const uint8_t>().unwrap();
+    for (size_t i = 0; i < values.size(); i += 3) {
+        const auto expected = exact_rgb(values[i] * 2.0, values[i + 1] / 255.0, values[i + 2]);
+        for (size_t c = 0; c < 3; ++c) {
+            REQUIRE(std::abs(restored[i + c] - std::round(expected[c])) <= 1.0);
+        }
+    }
+}
+
+TEST_CASE("Op: convert_color float HSV round trip", "[tensorop][color]") {
+    const Tensor image = random_image(make_shape(5, 29, 3), Dtype::Float32, 7);
+    Tensor hsv;
+    REQUIRE(convert_color(image, hsv, ColorConversion::RgbToHsv) == P10Error::Ok);
+
+    const auto pixels = image.as_span1d<const float>().unwrap();
+    const auto values = hsv.as_span1d<const float>().unwrap();
+    for (size_t i = 0; i < pixels.size(); i += 3) {
+        const auto expected = exact_hsv(pixels[i], pixels[i + 1], pixels[i + 2]);
+        REQUIRE(std::abs(values[i] - expected[0]) < 1e-3);
+        REQUIRE(std::abs(values[i + 1] - expected[1]) < 1e-5);
+        REQUIRE(values[i + 2] == static_cast<float>(expected[2]));
+    }
+
+    Tensor rgb;
+    REQUIRE(convert_color(hsv, rgb, ColorConversion::HsvToRgb) == P10Error::Ok);
+    REQUIRE_THAT(
+        testing::compare_tensors(rgb, image, testing::CompareOptions().tolerance(1e-5)),
+        testing::is_ok()
+    );
+}
+
+TEST_CASE("Op: convert_color reorders channels", "[tensorop][color]") {
+    const Tensor image = random_image(make_shape(4, 19, 3), Dtype::Uint8, 11);
+    const auto pixels = image.as_span1d<const uint8_t>().unwrap();
+
+    Tensor bgr;
+    REQUIRE(convert_color(image, bgr, ColorConversion::SwapRedBlue) == P10Error::Ok);
+    Tensor rgba;
+    REQUIRE(convert_color(image, rgba, ColorConversion::RgbToRgba) == P10Error::Ok);
+    REQUIRE(rgba.shape() == make_shape(4, 19, 4));
+    Tensor rgb;
+    REQUIRE(convert_color(rgba, rgb, ColorConversion::RgbaToRgb) == P10Error::Ok);
+    REQUIRE_THAT(testing::compare_tensors(rgb, image), testing::is_ok());
+
+    const auto swapped = bgr.as_span1d<const uint8_t>().unwrap();
+    const auto with_alpha = rgba.as_span1d<const uint8_t>().unwrap();
+    for (size_t pixel = 0; pixel < pixels.size() / 3; ++pixel) {
+        for (size_t c = 0; c < 3; ++c) {
+            REQUIRE(swapped[(pixel * 3) + c] == pixels[(pixel * 3) + 2 - c]);
+            REQUIRE(with_alpha[(pixel * 4) + c] == pixels[(pixel * 3) + c]);
+        }
+        REQUIRE(with_alpha[(pixel * 4) + 3] == 255);
+    }
+
+    Tensor gray;
+    Tensor spread;
+    REQUIRE(convert_color(image, gray, ColorConversion::RgbToGray) == P10Error::Ok);
+    REQUIRE(convert_color(gray, spread, ColorConversion::GrayToRgb) == P10Error::Ok);
+    const auto grays = gray.as_span1d<const uint8_t>().unwrap();
+    const auto spreads = spread.as_span1d<const uint8_t>().unwrap();
+    for (size_t pixel = 0; pixel < grays.size(); ++pixel) {
+        for (size_t c = 0; c < 3; ++c) {
+            REQUIRE(spreads[(pixel * 3) + c] == grays[pixel]);
+        }
+    }
+}
+
+TEST_CASE("Op: convert_color planar matches interleaved", "[tensorop][color]") {
+    const auto conversion = GENERATE(
+        ColorConversion::RgbToGray,
+        ColorConversion::SwapRedBlue,
+        ColorConversion::RgbToRgba,
+        ColorConversion::RgbToHsv,
+        ColorConversion::HsvToBgr
+    );
+    const auto dtype = GENERATE(Dtype::Uint8, Dtype::Float32);
+    CAPTURE(conversion, dtype);
+
+    // Large enough to be split over several workers.
+    const Tensor image = random_image(make_shape(181, 403, 3), dtype, 13);
+    Tensor interleaved;
+    REQUIRE(convert_color(image, interleaved, conversion) == P10Error::Ok);
+
+    const bool bytes = dtype == Dtype::Uint8;
+    const Tensor planar_image = bytes ? to_planar<uint8_t>(image) : to_planar<float>(image);
+    Tensor planar;
+    REQUIRE(
+        convert_color(planar_image, planar, conversion, ColorOptions().planar(true))
+        == P10Error::Ok
+    );
+    const Tensor expected = bytes ? to_planar<uint8_t>(interleaved) : to_planar<float>(interleaved);
+    REQUIRE_THAT(testing::compare_tensors(planar, expected), testing::is_ok());
+}
+
+TEST_CASE("Op: convert_color SIMD tiers agree", "[tensorop][color]") {
+    const auto conversion = GENERATE(
+        ColorConversion::RgbToGray,
+        ColorConversion::BgrToHsv,
+        ColorConversion::HsvToRgb
+    );
+    const auto dtype = GENERATE(Dtype::Uint8, Dtype::Float32);
+    CAPTURE(conversion, dtype);
+
+    Tensor image = random_image(make_shape(6, 53, 3), dtype, 17);
+    if (dtype == Dtype::Uint8) {
+        // Gray pixels and saturated primaries exercise the hue edge cases.
+        auto pixels = image.as_span1d<uint8_t>().unwrap();
+        std::fill_n(pixels.begin(), 9, uint8_t {77});
+        std::copy_n(std::array<uint8_t, 6> {255, 0, 0, 0, 0, 255}.begin(), 6, pixels.begin() + 9);
+    }
+    REQUIRE_THAT(
+        testing::compare_simd_tiers([&](Tensor& tier_output) {
+            convert_color(image, tier_output, conversion).expect("convert_color failed");
+        }),
+        testing::is_ok()
+    );
+}
+
+TEST_CASE("Op: convert_color errors", "[tensorop][color]") {
+    Tensor output;
+    const Tensor gray = Tensor::zeros(make_shape(4, 4, 1), Dtype::Uint8).unwrap();
+    REQUIRE(convert_color(gray, output, ColorConversion::RgbToHsv) == P10Error::InvalidArgument);
+    const Tensor rgb = Tensor::zeros(make_shape(4, 4, 3), Dtype::Uint8).unwrap();
+    REQUIRE(convert_color(rgb, output, ColorConversion::RgbaToRgb) == P10Error::InvalidArgument);
+    REQUIRE(convert_color(rgb, output, ColorConversion::GrayToRgb) == P10Error::InvalidArgument);
+    const Tensor doubles = Tensor::zeros(make_shape(4, 4, 3), Dtype::Float64).unwrap();
+    REQUIRE(
+        convert_color(doubles, output, ColorConversion::RgbToGray) == P10Error::InvalidArgument
+    );
+    const Tensor flat = Tensor::zeros(make_shape(4, 12), Dtype::Uint8).unwrap();
+    REQUIRE(convert_color(flat, output, ColorConversion::RgbToGray) == P10Error::InvalidArgument);
+}
+
+}  // namespace p10::op
@@ -2,7 +2,10 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
 #include <ptensor/op/elemwise.hpp>
+#include <ptensor/op/tensor_scalar.hpp>
 #include <ptensor/tensor.hpp>
+#include <ptensor/testing/catch2_assertions.hpp>
+#include <ptensor/testing/simd_tiers.hpp>
 
 namespace p10::op {
 using Catch::Approx;
@@ -71,4 +74,31 @@ TEST_CASE("Tensorop: elemwise multiply", "[tensor]") {
     }
 }
 
+TEST_CASE("Tensorop: elemwise on long buffers agrees across SIMD tiers", "[tensorop][simd]") {
+    // Long enough to be split across workers, odd so the scalar tail runs.
+    auto type = GENERATE(Dtype::Float32, Dtype::Int32, Dtype::Uint8, Dtype::Float64);
+    DYNAMIC_SECTION("Testing with type " << to_string(type)) {
+        const auto a = Tensor::from_range(make_shape(3, 40001), type).unwrap();
+        const auto b = Tensor::from_range(make_shape(3, 40001), type).unwrap();
+
+        REQUIRE_THAT(
+            testing::compare_simd_tiers([&](Tensor& out) {
+                multiply_elemwise(a, b, out).expect("multiply failed");
+                multiply_scalar(out, 3.0);
+            }),
+            testing::is_ok()
+        );
+
+        Tensor sum;
+        REQUIRE(add_elemwise(a, b, sum).is_ok());
+        sum.visit([&](auto span) {
+            using T = decltype(span)::value_type;
+            const auto values = a.as_span1d<const T>().unwrap();
+            for (size_t i = 0; i < span.size(); ++i) {
+                REQUIRE(span[i] == static_cast<T>(values[i] + values[i]));
+            }
+        });
+    }
+}
+
 }  // namespace p10::op
@@ -1,5 +1,10 @@
+#include <algorithm>
 #include <complex>
+#include <cstdint>
 #include <numbers>
+#include <random>
+#include <span>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
@@ -37,7 +42,6 @@ TEST_CASE("Op: FFT and IFFT", "[tensorop]") {
         );
 
         SECTION("Should inverse into complex and forward FFT correctly") {
-            SKIP("TODO: not implemented");
             Tensor signal;
             REQUIRE_THAT(
                 Fft(FftOptions().direction(Fft::Inverse).normalize(Fft::ByN))
@@ -162,13 +166,316 @@ TEST_CASE("Op: FFT and IFFT", "[tensorop]") {
         }
     }
 
-    SECTION("ForwardReal rejects more than 2 dimensions") {
-        auto signal_3d = Tensor::zeros(make_shape(2, 2, 4)).unwrap();
+    SECTION("ForwardReal transforms every row of a 3D batch") {
+        auto signal_3d = Tensor::from_random(
+                             make_shape(2, 3, 10),
+                             std::mt19937_64(3),
+                             TensorOptions().dtype(Dtype::Float32)
+        )
+                             .unwrap();
         Tensor freq;
         REQUIRE_THAT(
             Fft(FftOptions().direction(Fft::ForwardReal)).transform(signal_3d, freq),
-            testing::is_error(P10Error::InvalidArgument)
+            testing::is_ok()
+        );
+        REQUIRE(freq.shape() == make_shape(2, 3, 6, 2));
+
+        auto signal_2d = signal_3d.as_reshape(make_shape(6, 10)).unwrap();
+        Tensor freq_2d;
+        REQUIRE_THAT(
+            Fft(FftOptions().direction(Fft::ForwardReal)).transform(signal_2d, freq_2d),
+            testing::is_ok()
         );
+        auto freq_3d = freq_2d.as_reshape(make_shape(2, 3, 6, 2)).unwrap();
+        REQUIRE_THAT(testing::compare_tensors(freq, freq_3d), testing::is_ok());
+    }
+}
+
+namespace {
+    // Complex [..., 2] tensor of `dtype` with random values in [-1, 1].
+    Tensor random_complex(const Shape& shape, Dtype dtype, uint64_t seed) {
+        return Tensor::from_random(shape, std::mt19937_64(seed), TensorOptions().dtype(dtype), -1.0)
+            .unwrap();
+    }
+
+    // Naive DFT of `values` along `axis` of `shape`, `values` holding one
+    // complex number per element of `shape`.
+    std::vector<std::complex<double>> reference_dft(
+        const std::vector<std::complex<double>>& values,
+        const std::vector<int64_t>& shape,
+        int64_t axis,
+        bool forward
+    ) {
+        int64_t outer = 1;
+        for (int64_t i = 0; i < axis; ++i) {
+            outer *= shape[i];
+        }
+        const int64_t length = shape[axis];
+        int64_t inner = 1;
+        for (auto i = static_cast<size_t>(axis) + 1; i < shape.size(); ++i) {
+            inner *= shape[i];
+        }
+
+        const double sign = forward ? -1.0 : 1.0;
+        std::vector<std::complex<double>> result(values.size());
+        for (int64_t o = 0; o < outer; ++o) {
+            for (int64_t i = 0; i < inner; ++i) {
+                const auto at = [&](int64_t k) { return ((o * length) + k) * inner + i; };
+                for (int64_t f = 0; f < length; ++f) {
+                    std::complex<double> sum = 0.0;
+                    for (int64_t k = 0; k < length; ++k) {
+                        const double angle =
+                            sign * 2.0 * std::numbers::pi * static_cast<double>(f * k)
+                            / static_cast<double>(length);
+                        sum += values[at(k)] * std::polar(1.0, angle);
+                    }
+                    result[at(f)] = sum;
+                }
+            }
+        }
+        return result;
+    }
+
+    template<typename T>
+    std::vector<std::complex<double>> to_complex(const Tensor& tensor) {
+        const auto values = tensor.as_span1d<const T>().unwrap();
+        std::vector<std::complex<double>> result(values.size() / 2);
+        for (size_t i = 0; i < result.size(); ++i) {
+            result[i] = {values[2 * i], values[(2 * i) + 1]};
+        }
+        return result;
     }
+
+    template<typename T>
+    double max_difference(const Tensor& actual, const std::vector<std::complex<double>>& expected) {
+        const auto values = to_complex<T>(actual);
+        REQUIRE(values.size() == expected.size());
+        double worst = 0.0;
+        for (size_t i = 0; i < values.size(); ++i) {
+            worst = std::max(worst, std::abs(values[i] - expected[i]));
+        }
+        return worst;
+    }
+}  // namespace
+
+TEST_CASE("Op: complex FFT matches the naive DFT", "[tensorop][fft]") {
+    // Powers of two, a prime (Bluestein) and a mixed radix, along the last
+    // axis and along an inner one.
+    const auto [shape, axis] = GENERATE(
+        std::pair {std::vector<int64_t> {3, 16}, int64_t {-1}},
+        std::pair {std::vector<int64_t> {2, 17}, int64_t {-1}},
+        std::pair {std::vector<int64_t> {4, 30, 3}, int64_t {1}},
+        std::pair {std::vector<int64_t> {12, 5}, int64_t {0}}
+    );
+    const bool forward = GENERATE(true, false);
+    CAPTURE(shape, axis, forward);
+
+    std::vector<int64_t> dims = shape;
+    dims.push_back(2);
+    const auto input_shape = make_shape(std::span<const int64_t>(dims)).unwrap();
+    const Tensor input = random_complex(input_shape, Dtype::Float64, 5);
+    const auto resolved = axis < 0 ? axis + static_cast<int64_t>(shape.size()) : axis;
+    const auto expected = reference_dft(to_complex<double>(input), shape, resolved, forward);
+
+    const auto direction = forward ? Fft::Forward : Fft::Inverse;
+    Tensor output;
+    REQUIRE_THAT(
+        Fft(FftOptions().direction(direction).axes({axis})).transform(input, output),
+        testing::is_ok()
+    );
+    REQUIRE(output.shape() == input.shape());
+    REQUIRE(max_difference<double>(output, expected) < 1e-12);
+
+    Tensor input32;
+    REQUIRE_THAT(
+        input32.convert_from(input, TensorOptions().dtype(Dtype::Float32)),
+        testing::is_ok()
+    );
+    REQUIRE_THAT(
+        Fft(FftOptions().direction(direction).axes({axis})).transform(input32, output),
+        testing::is_ok()
+    );
+    REQUIRE(output.dtype() == Dtype::Float32);
+    REQUIRE(max_difference<float>(output, expected) < 1e-4);
+}
+
+TEST_CASE("Op: FFT over several axes", "[tensorop][fft]") {
+    const std::vector<int64_t> shape {3, 6, 8};
+    const Tensor input = random_complex(make_shape(3, 6, 8, 2), Dtype::Float64, 7);
+
+    auto expected = reference_dft(to_complex<double>(input), shape, 1, true);
+    expected = reference_dft(expected, shape, 2, true);
+
+    Tensor output;
+    REQUIRE_THAT(
+        Fft(FftOptions().direction(Fft::Forward).axes({-2, -1})).transform(input, output),
+        testing::is_ok()
+    );
+    REQUIRE(max_difference<double>(output, expected) < 1e-12);
+
+    SECTION("Real forward and inverse round trip") {
+        const Tensor real = Tensor::from_random(
+                                make_shape(3, 6, 8),
+                                std::mt19937_64(9),
+                                TensorOptions().dtype(Dtype::Float64)
+        )
+                                .unwrap();
+        Tensor spectrum;
+        REQUIRE_THAT(
+            Fft(FftOptions().direction(Fft::ForwardReal).axes({1, 2})).transform(real, spectrum),
+            testing::is_ok()
+        );
+        REQUIRE(spectrum.shape() == make_shape(3, 6, 5, 2));
+
+        // The real spectrum is the non-negative half of the complex one.
+        Tensor complex_input = Tensor::zeros(make_shape(3, 6, 8, 2), Dtype::Float64).unwrap();
+        const auto real_values = real.as_span1d<const double>().unwrap();
+        auto complex_values = complex_input.as_span1d<double>().unwrap();
+        for (size_t i = 0; i < real_values.size(); ++i) {
+            complex_values[2 * i] = real_values[i];
+        }
+        Tensor full;
+        REQUIRE_THAT(
+            Fft(FftOptions().direction(Fft::Forward).axes({1, 2})).transform(complex_input, full),
+            testing::is_ok()
+        );
+        const auto full_values = to_complex<double>(full);
+        const auto half_values = to_complex<double>(spectrum);
+        for (int64_t row = 0; row < 18; ++row) {
+            for (int64_t bin = 0; bin < 5; ++bin) {
+                const auto difference =
+                    half_values[(row * 5) + bin] - full_values[(row * 8) + bin];
+                REQUIRE(std::abs(difference) < 1e-12);
+            }
+        }
+
+        Tensor recovered;
+        REQUIRE_THAT(
+            Fft(FftOptions().direction(Fft::InverseReal).normalize(Fft::ByN).axes({1, 2}))
+                .transform(spectrum, recovered),
+            testing::is_ok()
+        );
+        REQUIRE(recovered.shape() == real.shape());
+        REQUIRE_THAT(testing::compare_tensors(recovered, real), testing::is_ok());
+    }
+}
+
+TEST_CASE("Op: 2D FFT helpers", "[tensorop][fft]") {
+    const Tensor complex = random_complex(make_shape(3, 6, 10, 2), Dtype::Float32, 13);
+
+    Tensor frequency;
+    Tensor expected;
+    REQUIRE_THAT(fft2(complex, frequency), testing::is_ok());
+    REQUIRE_THAT(
+        Fft(FftOptions().direction(Fft::Forward).axes({1, 2})).transform(complex, expected),
+        testing::is_ok()
+    );
+    REQUIRE_THAT(testing::compare_tensors(frequency, expected), testing::is_ok());
+
+    Tensor recovered;
+    REQUIRE_THAT(ifft2(frequency, recovered), testing::is_ok());
+    REQUIRE_THAT(
+        testing::compare_tensors(recovered, complex, testing::CompareOptions().tolerance(1e-5)),
+        testing::is_ok()
+    );
+
+    const Tensor real = Tensor::from_random(
+                            make_shape(2, 12, 9),
+                            std::mt19937_64(17),
+                            TensorOptions().dtype(Dtype::Float64),
+                            -1.0,
+                            1.0
+    )
+                            .unwrap();
+    Tensor spectrum;
+    REQUIRE_THAT(rfft2(real, spectrum), testing::is_ok());
+    REQUIRE(spectrum.shape() == make_shape(2, 12, 5, 2));
+    REQUIRE_THAT(irfft2(spectrum, recovered), testing::is_ok());
+    // The inverse of an odd last axis comes back one sample shorter.
+    REQUIRE(recovered.shape() == make_shape(2, 12, 8));
+
+    const Tensor even = real.as_reshape(make_shape(2, 9, 12)).unwrap();
+    REQUIRE_THAT(rfft2(even, spectrum), testing::is_ok());
+    REQUIRE_THAT(irfft2(spectrum, recovered), testing::is_ok());
+    REQUIRE_THAT(testing::compare_tensors(recovered, even), testing::is_ok());
+}
+
+TEST_CASE("Op: FFT normalisation", "[tensorop][fft]") {
+    const Tensor input = random_complex(make_shape(4, 20, 2), Dtype::Float32, 11);
+
+    SECTION("BySqrtN on both directions round trips") {
+        Tensor frequency;
+        Tensor recovered;
+        REQUIRE_THAT(
+            Fft(FftOptions(Fft::Forward, Fft::BySqrtN)).transform(input, frequency),
+            testing::is_ok()
+        );
+        REQUIRE_THAT(
+            Fft(FftOptions(Fft::Inverse, Fft::BySqrtN)).transform(frequency, recovered),
+            testing::is_ok()
+        );
+        REQUIRE_THAT(testing::compare_tensors(recovered, input), testing::is_ok());
+    }
+
+    SECTION("Transforms run in place") {
+        Tensor expected;
+        REQUIRE_THAT(Fft(FftOptions(Fft::Forward)).transform(input, expected), testing::is_ok());
+        Tensor values = input.clone().unwrap();
+        REQUIRE_THAT(Fft(FftOptions(Fft::Forward)).transform(values, values), testing::is_ok());
+        REQUIRE_THAT(testing::compare_tensors(values, expected), testing::is_ok());
+    }
+}
+
+TEST_CASE("Op: FFT errors", "[tensorop][fft]") {
+    Tensor output;
+    const Tensor complex = Tensor::zeros(make_shape(4, 8, 2), Dtype::Float32).unwrap();
+    const Tensor odd_pairs = Tensor::zeros(make_shape(4, 3), Dtype::Float32).unwrap();
+    const Tensor integers = Tensor::zeros(make_shape(4, 8, 2), Dtype::Int32).unwrap();
+    const Tensor one_bin = Tensor::zeros(make_shape(4, 1, 2), Dtype::Float32).unwrap();
+
+    REQUIRE_THAT(
+        Fft(FftOptions(Fft::Forward)).transform(odd_pairs, output),
+        testing::is_error(P10Error::InvalidArgument)
+    );
+    REQUIRE_THAT(
+        Fft(FftOptions(Fft::Forward)).transform(integers, output),
+        testing::is_error(P10Error::InvalidArgument)
+    );
+    REQUIRE_THAT(
+        Fft(FftOptions(Fft::Forward).axes({2})).transform(complex, output),
+        testing::is_error(P10Error::InvalidArgument)
+    );
+    REQUIRE_THAT(
+        Fft(FftOptions(Fft::Forward).axes({1, -1})).transform(complex, output),
+        testing::is_error(P10Error::InvalidArgument)
+    );
+    REQUIRE_THAT(
+        Fft(FftOptions(Fft::Forward).axes({})).transform(complex, output),
+        testing::is_error(P10Error::InvalidArgument)
+    );
+    REQUIRE_THAT(
+        Fft(FftOptions(Fft::InverseReal)).transform(one_bin, output),
+        testing::is_error(P10Error::InvalidArgument)
+    );
+
+    // A zero-length transform axis is an error, not a zero-length plan.
+    const Tensor no_bins = Tensor::zeros(make_shape(4, 0, 2), Dtype::Float32).unwrap();
+    const Tensor no_rows = Tensor::zeros(make_shape(0, 5, 2), Dtype::Float32).unwrap();
+    REQUIRE_THAT(
+        Fft(FftOptions(Fft::Forward)).transform(no_bins, output),
+        testing::is_error(P10Error::InvalidArgument)
+    );
+    REQUIRE_THAT(
+        Fft(FftOptions(Fft::Inverse)).transform(no_bins, output),
+        testing::is_error(P10Error::InvalidArgument)
+    );
+    REQUIRE_THAT(
+        Fft(FftOptions(Fft::InverseReal).axes({0, 1})).transform(no_rows, output),
+        testing::is_error(P10Error::InvalidArgument)
+    );
+    REQUIRE_THAT(
+        Fft(FftOptions(Fft::Forward).axes({0, 1})).transform(no_rows, output),
+        testing::is_error(P10Error::InvalidArgument)
+    );
 }
 }  // namespace p10::op
@@ -0,0 +1,229 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <ptensor/op/fft_convolve.hpp>
+#include <ptensor/tensor.hpp>
+#include <ptensor/testing/catch2_assertions.hpp>
+#include <ptensor/testing/compare_tensors.hpp>
+
+namespace p10::op {
+
+namespace {
+    Tensor random_tensor(const Shape& shape, Dtype dtype, uint64_t seed) {
+        return Tensor::from_random(
+                   shape,
+                   std::mt19937_64(seed),
+                   TensorOptions().dtype(dtype),
+                   -1.0,
+                   1.0
+        )
+            .unwrap();
+    }
+
+    // Full 2D convolution of one [height, width] plane, in double.
+    std::vector<double> reference_full(
+        std::span<const float> image,
+        int64_t height,
+        int64_t width,
+        std::span<const float> kernel,
+        int64_t kernel_height,
+        int64_t kernel_width
+    ) {
+        const int64_t out_width = width + kernel_width - 1;
+        std::vector<double> full((height + kernel_height - 1) * out_width);
+        for (int64_t y = 0; y < height; ++y) {
+            for (int64_t x = 0; x < width; ++x) {
+                const double pixel = image[(y * width) + x];
+                for (int64_t i = 0; i < kernel_height; ++i) {
+                    double* row = full.data() + ((y + i) * out_width) + x;
+                    for (int64_t j = 0; j < kernel_width; ++j) {
+                        row[j] += pixel * kernel[(i * kernel_width) + j];
+                    }
+                }
+            }
+        }
+        return full;
+    }
+}  // namespace
+
+TEST_CASE("Op: fft_convolve2d matches the direct sum", "[tensorop][fft]") {
+    const auto [height, width, kernel_height, kernel_width] = GENERATE(
+        std::array<int64_t, 4> {20, 17, 3, 3},
+        std::array<int64_t, 4> {31, 40, 4, 7},
+        // Several overlap-save tiles per axis.
+        std::array<int64_t, 4> {150, 133, 21, 18}
+    );
+    const auto mode = GENERATE(ConvolveMode::Full, ConvolveMode::Same, ConvolveMode::Valid);
+    CAPTURE(height, width, kernel_height, kernel_width, mode);
+
+    const Tensor image = random_tensor(make_shape(2, height, width), Dtype::Float32, 3);
+    const Tensor kernel =
+        random_tensor(make_shape(kernel_height, kernel_width), Dtype::Float32, 5);
+    const auto image_values = image.as_span1d<const float>().unwrap();
+    const auto kernel_values = kernel.as_span1d<const float>().unwrap();
+
+    int64_t out_height = height;
+    int64_t out_width = width;
+    int64_t row0 = (kernel_height - 1) / 2;
+    int64_t col0 = (kernel_width - 1) / 2;
+    if (mode == ConvolveMode::Full) {
+        out_height = height + kernel_height - 1;
+        out_width = width + kernel_width - 1;
+        row0 = col0 = 0;
+    } else if (mode == ConvolveMode::Valid) {
+        out_height = height - kernel_height + 1;
+        out_width = width - kernel_width + 1;
+        row0 = kernel_height - 1;
+        col0 = kernel_width - 1;
+    }
+
+    for (const auto method : {ConvolveMethod::Direct, ConvolveMethod::Fft}) {
+        CAPTURE(method);
+        Tensor output;
+        REQUIRE_THAT(
+            fft_convolve2d(image, kernel, output, ConvolveOptions().mode(mode).method(method)),
+            testing::is_ok()
+        );
+        REQUIRE(output.shape() == make_shape(2, out_height, out_width));
+        const auto values = output.as_span1d<const float>().unwrap();
+        for (int64_t channel = 0; channel < 2; ++channel) {
+            const auto full = reference_full(
+                image_values.subspan(channel * height * width, height * width),
+                height,
+                width,
+                kernel_values,
+                kernel_height,
+                kernel_width
+            );
+            const int64_t full_width = width + kernel_width - 1;
+            for (int64_t y = 0; y < out_height; ++y) {
+                for (int64_t x = 0; x < out_width; ++x) {
+                    const double expected = full[((row0 + y) * full_width) + col0 + x];
+                    const float actual = values[(((channel * out_height) + y) * out_width) + x];
+                    REQUIRE(std::abs(actual - expected) < 1e-4);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Op: fft_correlate2d finds a template", "[tensorop][fft]") {
+    const auto method = GENERATE(ConvolveMethod::Auto, ConvolveMethod::Direct, ConvolveMethod::Fft);
+    CAPTURE(method);
+
+    Tensor image = random_tensor(make_shape(120, 90), Dtype::Float64, 7);
+    const Tensor pattern = random_tensor(make_shape(25, 19), Dtype::Float64, 9);
+    auto pixels = image.as_span1d<double>().unwrap();
+    const auto taps = pattern.as_span1d<const double>().unwrap();
+    for (int64_t i = 0; i < 25; ++i) {
+        for (int64_t j = 0; j < 19; ++j) {
+            pixels[((60 + i) * 90) + 33 + j] = 4.0 * taps[(i * 19) + j];
+        }
+    }
+
+    Tensor scores;
+    REQUIRE_THAT(
+        fft_correlate2d(
+            image,
+            pattern,
+            scores,
+            ConvolveOptions().mode(ConvolveMode::Valid).method(method)
+        ),
+        testing::is_ok()
+    );
+    REQUIRE(scores.shape() == make_shape(96, 72));
+    const auto values = scores.as_span1d<const double>().unwrap();
+    const auto best = std::max_element(values.begin(), values.end()) - values.begin();
+    REQUIRE(best == (60 * 72) + 33);
+
+    // The correlation at the match is the pattern's dot product with itself.
+    double energy = 0.0;
+    for (const double tap : taps) {
+        energy += 4.0 * tap * tap;
+    }
+    REQUIRE(std::abs(values[best] - energy) < 1e-9);
+}
+
+TEST_CASE("Op: fft_convolve2d picks the same result on every method", "[tensorop][fft]") {
+    const auto kernel_size = GENERATE(int64_t {3}, int64_t {31});
+    const Tensor image = random_tensor(make_shape(3, 64, 80), Dtype::Float32, 11);
+    const Tensor kernel = random_tensor(make_shape(kernel_size, kernel_size), Dtype::Float32, 13);
+
+    Tensor automatic;
+    Tensor direct;
+    REQUIRE_THAT(fft_convolve2d(image, kernel, automatic), testing::is_ok());
+    REQUIRE_THAT(
+        fft_convolve2d(image, kernel, direct, ConvolveOptions().method(ConvolveMethod::Direct)),
+        testing::is_ok()
+    );
+    REQUIRE_THAT(
+        testing::compare_tensors(automatic, direct, testing::CompareOptions().tolerance(1e-4)),
+        testing::is_ok()
+    );
+}
+
+TEST_CASE("Op: fft_convolve2d in place matches a separate output", "[tensorop][fft]") {
+    const auto method = GENERATE(ConvolveMethod::Direct, ConvolveMethod::Fft);
+    const auto mode = GENERATE(ConvolveMode::Same, ConvolveMode::Full);
+    CAPTURE(method, mode);
+    const Tensor image = random_tensor(make_shape(2, 40, 37), Dtype::Float32, 15);
+    const Tensor kernel = random_tensor(make_shape(7, 6), Dtype::Float32, 17);
+    const auto options = ConvolveOptions().mode(mode).method(method);
+
+    Tensor expected;
+    REQUIRE_THAT(fft_convolve2d(image, kernel, expected, options), testing::is_ok());
+
+    Tensor values = image.clone().unwrap();
+    REQUIRE_THAT(fft_convolve2d(values, kernel, values, options), testing::is_ok());
+    REQUIRE_THAT(
+        testing::compare_tensors(values, expected, testing::CompareOptions().tolerance(1e-5)),
+        testing::is_ok()
+    );
+
+    Tensor taps = kernel.clone().unwrap();
+    REQUIRE_THAT(fft_correlate2d(image, taps, taps, options), testing::is_ok());
+    Tensor correlated;
+    REQUIRE_THAT(fft_correlate2d(image, kernel, correlated, options), testing::is_ok());
+    REQUIRE_THAT(
+        testing::compare_tensors(taps, correlated, testing::CompareOptions().tolerance(1e-5)),
+        testing::is_ok()
+    );
+}
+
+TEST_CASE("Op: fft_convolve2d errors", "[tensorop][fft]") {
+    Tensor output;
+    const Tensor image = Tensor::zeros(make_shape(8, 8), Dtype::Float32).unwrap();
+    const Tensor kernel = Tensor::zeros(make_shape(3, 3), Dtype::Float32).unwrap();
+    const Tensor big_kernel = Tensor::zeros(make_shape(9, 3), Dtype::Float32).unwrap();
+
+    REQUIRE_THAT(
+        fft_convolve2d(image, Tensor::zeros(make_shape(3, 3), Dtype::Float64).unwrap(), output),
+        testing::is_error(P10Error::InvalidArgument)
+    );
+    REQUIRE_THAT(
+        fft_convolve2d(Tensor::zeros(make_shape(8, 8), Dtype::Uint8).unwrap(), kernel, output),
+        testing::is_error(P10Error::InvalidArgument)
+    );
+    REQUIRE_THAT(
+        fft_convolve2d(image, Tensor::zeros(make_shape(3), Dtype::Float32).unwrap(), output),
+        testing::is_error(P10Error::InvalidArgument)
+    );
+    REQUIRE_THAT(
+        fft_correlate2d(image, big_kernel, output, ConvolveOptions().mode(ConvolveMode::Valid)),
+        testing::is_error(P10Error::InvalidArgument)
+    );
+    REQUIRE_THAT(
+        fft_correlate2d(image, big_kernel, output, ConvolveOptions().mode(ConvolveMode::Full)),
+        testing::is_ok()
+    );
+    REQUIRE(output.shape() == make_shape(16, 10));
+}
+
+}  // namespace p10::op
@@ -1,3 +1,8 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
 #include <ptensor/io/image.hpp>
@@ -5,11 +10,88 @@
 #include <ptensor/tensor.hpp>
 #include <ptensor/testing/catch2_assertions.hpp>
 #include <ptensor/testing/compare_tensors.hpp>
+#include <ptensor/testing/simd_tiers.hpp>
 
 #include "testing.hpp"
 
 namespace p10::op {
 
+namespace {
+    Tensor random_image(const Shape& shape, uint64_t seed) {
+        return Tensor::from_random(
+                   shape,
+                   std::mt19937_64(seed),
+                   TensorOptions().dtype(Dtype::Uint8),
+                   0.0,
+                   255.0
+        )
+            .unwrap();
+    }
+
+    // Element by element image_to_tensor for a float32 target.
+    Tensor reference_to_tensor(
+        const Tensor& image,
+        bool normalize,
+        const std::vector<float>& mean,
+        const std::vector<float>& std
+    ) {
+        const auto shape = image.shape().as_span();
+        const int64_t height = shape[0];
+        const int64_t width = shape[1];
+        const int64_t channels = shape[2];
+        Tensor out = Tensor::zeros(make_shape(channels, height, width), Dtype::Float32).unwrap();
+        const auto pixels = image.as_span1d<const uint8_t>().unwrap();
+        auto values = out.as_span1d<float>().unwrap();
+        for (int64_t row = 0; row < height; ++row) {
+            for (int64_t col = 0; col < width; ++col) {
+                for (int64_t c = 0; c < channels; ++c) {
+                    float value = pixels[(((row * width) + col) * channels) + c];
+                    if (normalize) {
+                        value = value / 255.0f;
+                    }
+                    if (!mean.empty()) {
+                        value = (value - mean[c]) / std[c];
+                    }
+                    values[(((c * height) + row) * width) + col] = value;
+                }
+            }
+        }
+        return out;
+    }
+
+    // Element by element image_from_tensor for float32 to uint8.
+    Tensor reference_from_tensor(
+        const Tensor& tensor,
+        bool normalize,
+        const std::vector<float>& mean,
+        const std::vector<float>& std
+    ) {
+        const auto shape = tensor.shape().as_span();
+        const int64_t channels = shape[0];
+        const int64_t height = shape[1];
+        const int64_t width = shape[2];
+        Tensor out = Tensor::zeros(make_shape(height, width, channels), Dtype::Uint8).unwrap();
+        const auto values = tensor.as_span1d<const float>().unwrap();
+        auto pixels = out.as_span1d<uint8_t>().unwrap();
+        for (int64_t c = 0; c < channels; ++c) {
+            for (int64_t row = 0; row < height; ++row) {
+                for (int64_t col = 0; col < width; ++col) {
+                    float value = values[(((c * height) + row) * width) + col];
+                    if (!mean.empty()) {
+                        value = (value * std[c]) + mean[c];
+                    }
+                    if (normalize) {
+                        value = value * 255.0f;
+                    }
+                    pixels[(((row * width) + col) * channels) + c] =
+                        static_cast<uint8_t>(std::clamp(value, 0.0f, 255.0f));
+                }
+            }
+        }
+        return out;
+    }
+}  // namespace
+
 TEST_CASE("op::image::to tensor", "[imageop]") {
     const Tensor image_tensor = Tensor::zeros(make_shape(256, 256, 3), Dtype::Uint8).unwrap();
     Tensor float_tensor;
@@ -134,6 +216,134 @@ TEST_CASE("op::image::from tensor value clamping", "[imageop]") {
     }
 }
 
+TEST_CASE("op::image::to tensor matches the scalar reference", "[imageop]") {
+    const int64_t channels = GENERATE(1, 2, 3, 4, 5);
+    const int64_t width = GENERATE(1, 15, 16, 37, 67);
+    const bool normalize = GENERATE(false, true);
+    const bool affine = GENERATE(false, true);
+    CAPTURE(channels, width, normalize, affine);
+
+    const Tensor image = random_image(make_shape(9, width, channels), 11);
+    std::vector<float> mean;
+    std::vector<float> std;
+    if (affine) {
+        for (int64_t c = 0; c < channels; ++c) {
+            mean.push_back(normalize ? 0.4f + (0.01f * c) : 100.0f + c);
+            std.push_back(normalize ? 0.2f + (0.01f * c) : 50.0f + c);
+        }
+    }
+    const auto options = ImageToTensorOptions().normalize(normalize).mean(mean).std(std);
+
+    Tensor tensor;
+    REQUIRE(image_to_tensor(image, tensor, options) == P10Error::Ok);
+    REQUIRE_THAT(
+        testing::compare_tensors(tensor, reference_to_tensor(image, normalize, mean, std)),
+        testing::is_ok()
+    );
+    REQUIRE_THAT(
+        testing::compare_simd_tiers([&](Tensor& tier_output) {
+            image_to_tensor(image, tier_output, options).expect("image_to_tensor failed");
+        }),
+        testing::is_ok()
+    );
+}
+
+TEST_CASE("op::image::from tensor matches the scalar reference", "[imageop]") {
+    const int64_t channels = GENERATE(1, 2, 3, 4, 5);
+    const int64_t width = GENERATE(1, 15, 16, 37, 67);
+    const bool affine = GENERATE(false, true);
+    CAPTURE(channels, width, affine);
+
+    // Values spread past [0, 1] so both clamps are exercised.
+    const Tensor tensor = Tensor::from_random(
+                              make_shape(channels, 9, width),
+                              std::mt19937_64(13),
+                              TensorOptions().dtype(Dtype::Float32),
+                              -0.5,
+                              1.5
+    )
+                              .unwrap();
+    std::vector<float> mean;
+    std::vector<float> std;
+    if (affine) {
+        for (int64_t c = 0; c < channels; ++c) {
+            mean.push_back(0.4f + (0.01f * c));
+            std.push_back(0.2f + (0.01f * c));
+        }
+    }
+    const auto options = ImageFromTensorOptions().normalize(true).mean(mean).std(std);
+
+    Tensor image;
+    REQUIRE(image_from_tensor(tensor, image, options) == P10Error::Ok);
+    REQUIRE_THAT(
+        testing::compare_tensors(image, reference_from_tensor(tensor, true, mean, std)),
+        testing::is_ok()
+    );
+    REQUIRE_THAT(
+        testing::compare_simd_tiers([&](Tensor& tier_output) {
+            image_from_tensor(tensor, tier_output, options).expect("image_from_tensor failed");
+        }),
+        testing::is_ok()
+    );
+}
+
+TEST_CASE("op::image::mean and std round trip", "[imageop]") {
+    // Large enough to be split over several workers.
+    const Tensor image = random_image(make_shape(541, 960, 3), 17);
+    const auto to_options = ImageToTensorOptions()
+                                .normalize(true)
+                                .mean({0.485f, 0.456f, 0.406f})
+                                .std({0.229f, 0.224f, 0.225f});
+    Tensor tensor;
+    REQUIRE(image_to_tensor(image, tensor, to_options) == P10Error::Ok);
+    REQUIRE_THAT(
+        testing::compare_tensors(
+            tensor,
+            reference_to_tensor(image, true, to_options.mean(), to_options.std())
+        ),
+        testing::is_ok()
+    );
+
+    Tensor result;
+    REQUIRE(
+        image_from_tensor(tensor, result, ImageFromTensorOptions(to_options)) == P10Error::Ok
+    );
+    const auto original = image.as_span1d<const uint8_t>().unwrap();
+    const auto recovered = result.as_span1d<const uint8_t>().unwrap();
+    for (size_t i = 0; i < original.size(); ++i) {
+        // Truncation can land one below the original byte.
+        REQUIRE(int {original[i]} - int {recovered[i]} <= 1);
+        REQUIRE(int {original[i]} >= int {recovered[i]});
+    }
+}
+
+TEST_CASE("op::image::mean and std errors", "[imageop]") {
+    const Tensor image = random_image(make_shape(4, 4, 3), 19);
+    Tensor tensor;
+
+    SECTION("Integer target") {
+        const auto options =
+            ImageToTensorOptions().target_dtype(Dtype::Int32).mean({1.0f, 2.0f, 3.0f});
+        REQUIRE(image_to_tensor(image, tensor, options) == P10Error::InvalidArgument);
+    }
+
+    SECTION("Length mismatch") {
+        const auto options = ImageToTensorOptions().mean({1.0f, 2.0f});
+        REQUIRE(image_to_tensor(image, tensor, options) == P10Error::InvalidArgument);
+
+        const Tensor planar = Tensor::zeros(make_shape(3, 4, 4), Dtype::Float32).unwrap();
+        REQUIRE(
+            image_from_tensor(planar, tensor, ImageFromTensorOptions().std({1.0f}))
+            == P10Error::InvalidArgument
+        );
+    }
+
+    SECTION("Zero std") {
+        const auto options = ImageToTensorOptions().std({1.0f, 0.0f, 1.0f});
+        REQUIRE(image_to_tensor(image, tensor, options) == P10Error::InvalidArgument);
+    }
+}
+
 // End-to-end: load a real image from disk, run it through the HWC->CHW->HWC
 // round trip, save the result for inspection, and assert the pixels survive.
 TEST_CASE("op::image layout disk round trip", "[imageop][integration]") {
@@ -1,5 +1,10 @@
+#include <cmath>
+#include <cstdint>
+#include <random>
+
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <ptensor/op/color.hpp>
 #include <ptensor/op/image_rgb_to_gray.hpp>
 #include <ptensor/tensor.hpp>
 #include <ptensor/testing/catch2_assertions.hpp>
@@ -312,4 +317,66 @@ TEST_CASE("RGB to gray: Output tensor reuse", "[image_rgb_to_gray]") {
     REQUIRE(gray.shape() == make_shape(20, 20));
 }
 
+TEST_CASE("RGB to gray: Matches convert_color with luminosity weights", "[image_rgb_to_gray]") {
+    const auto rgb = Tensor::from_random(
+                         make_shape(13, 37, 3),
+                         std::mt19937_64(3),
+                         TensorOptions().dtype(Dtype::Uint8),
+                         0.0,
+                         255.0
+    )
+                         .unwrap();
+
+    Tensor gray;
+    REQUIRE_THAT(image_rgb_to_gray(rgb, gray), is_ok());
+    Tensor expected;
+    REQUIRE_THAT(
+        convert_color(
+            rgb,
+            expected,
+            ColorConversion::RgbToGray,
+            ColorOptions().luma(LumaWeights::Luminosity)
+        ),
+        is_ok()
+    );
+
+    REQUIRE(gray.shape() == make_shape(13, 37));
+    const auto values = gray.as_span1d<const uint8_t>().unwrap();
+    const auto expected_values = expected.as_span1d<const uint8_t>().unwrap();
+    const auto pixels = rgb.as_span1d<const uint8_t>().unwrap();
+    for (size_t i = 0; i < values.size(); ++i) {
+        REQUIRE(values[i] == expected_values[i]);
+        const float legacy = 0.21f * pixels[i * 3] + 0.72f * pixels[(i * 3) + 1]
+            + 0.07f * pixels[(i * 3) + 2];
+        REQUIRE(std::abs(values[i] - legacy) <= 1.0f);
+    }
+}
+
+TEST_CASE("RGB to gray: Strided input", "[image_rgb_to_gray]") {
+    // Rows and columns swapped in memory: [4, 5, 3] stored as [5, 4, 3].
+    auto rgb = Tensor::empty(
+                   make_shape(4, 5, 3),
+                   TensorOptions().dtype(Dtype::Uint8).stride(make_stride(3, 12, 1))
+    )
+                   .unwrap();
+    REQUIRE_FALSE(rgb.is_contiguous());
+    auto storage = rgb.as_span1d<uint8_t>().unwrap();
+    for (size_t i = 0; i < storage.size(); ++i) {
+        storage[i] = static_cast<uint8_t>((i * 37) % 256);
+    }
+
+    Tensor gray;
+    REQUIRE_THAT(image_rgb_to_gray(rgb, gray), is_ok());
+    REQUIRE(gray.shape() == make_shape(4, 5));
+
+    const auto gray_span = gray.as_span2d<const uint8_t>().unwrap();
+    for (int64_t h = 0; h < 4; ++h) {
+        for (int64_t w = 0; w < 5; ++w) {
+            const uint8_t* pixel = &storage[(h * 3) + (w * 12)];
+            const float expected = 0.21f * pixel[0] + 0.72f * pixel[1] + 0.07f * pixel[2];
+            REQUIRE(gray_span[h][w] == Approx(expected).margin(1));
+        }
+    }
+}
+
 }  // namespace p10::op
@@ -0,0 +1,256 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <type_traits>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <ptensor/op/integral_image.hpp>
+#include <ptensor/tensor.hpp>
+#include <ptensor/testing/catch2_assertions.hpp>
+#include <ptensor/testing/compare_tensors.hpp>
+#include <ptensor/testing/simd_tiers.hpp>
+
+namespace p10::op {
+
+namespace {
+    // Sum of `plane` over rows [y0, y1) and columns [x0, x1), summed directly.
+    template<typename scalar_t>
+    double direct_box_sum(
+        Span2D<const scalar_t> plane,
+        int64_t y0,
+        int64_t x0,
+        int64_t y1,
+        int64_t x1
+    ) {
+        double sum = 0.0;
+        for (int64_t y = y0; y < y1; ++y) {
+            for (int64_t x = x0; x < x1; ++x) {
+                sum += static_cast<double>(plane[y][x]);
+            }
+        }
+        return sum;
+    }
+
+    // Box mean around every pixel with replicated edges, summed directly.
+    template<typename scalar_t>
+    Tensor direct_box_filter(const Tensor& input, int64_t radius) {
+        Tensor output;
+        output.create(input.shape(), input.dtype()).expect("create failed");
+        const auto in = input.as_span3d<const scalar_t, RankFit::Flexible>().unwrap();
+        auto out = output.as_span3d<scalar_t, RankFit::Flexible>().unwrap();
+        const double area = static_cast<double>(((2 * radius) + 1) * ((2 * radius) + 1));
+        for (int64_t c = 0; c < in.channels(); ++c) {
+            for (int64_t y = 0; y < in.rows(); ++y) {
+                for (int64_t x = 0; x < in.cols(); ++x) {
+                    double sum = 0.0;
+                    for (int64_t dy = -radius; dy <= radius; ++dy) {
+                        for (int64_t dx = -radius; dx <= radius; ++dx) {
+                            const int64_t sy = std::clamp<int64_t>(y + dy, 0, in.rows() - 1);
+                            const int64_t sx = std::clamp<int64_t>(x + dx, 0, in.cols() - 1);
+                            sum += static_cast<double>(in[c][sy][sx]);
+                        }
+                    }
+                    const double mean = sum * (1.0 / area);
+                    if constexpr (std::is_integral_v<scalar_t>) {
+                        out[c][y][x] = static_cast<scalar_t>(std::floor(mean + 0.5));
+                    } else {
+                        out[c][y][x] = static_cast<scalar_t>(mean);
+                    }
+                }
+            }
+        }
+        return output;
+    }
+}  // namespace
+
+TEST_CASE("Op: Integral image", "[tensorop][integral_image]") {
+    SECTION("uint8 sums in uint32 and squares in float64") {
+        const Tensor input = Tensor::from_random(
+                                 make_shape(2, 37, 53),
+                                 std::mt19937_64(5),
+                                 TensorOptions().dtype(Dtype::Uint8),
+                                 0.0,
+                                 255.0
+        )
+                                 .unwrap();
+        Tensor sum;
+        Tensor squared_sum;
+        REQUIRE(integral_image(input, sum, squared_sum) == P10Error::Ok);
+        REQUIRE(sum.dtype() == Dtype::Uint32);
+        REQUIRE(squared_sum.dtype() == Dtype::Float64);
+        REQUIRE(sum.shape() == make_shape(2, 38, 54));
+        REQUIRE(squared_sum.shape() == make_shape(2, 38, 54));
+
+        const auto in = input.as_span3d<const uint8_t>().unwrap();
+        const auto table = sum.as_span3d<const uint32_t>().unwrap();
+        const auto squared = squared_sum.as_span3d<const double>().unwrap();
+        for (int64_t c = 0; c < 2; ++c) {
+            for (int64_t y = 0; y <= 37; ++y) {
+                for (int64_t x = 0; x <= 53; ++x) {
+                    double expected_squared = 0.0;
+                    for (int64_t sy = 0; sy < y; ++sy) {
+                        for (int64_t sx = 0; sx < x; ++sx) {
+                            const double value = in[c][sy][sx];
+                            expected_squared += value * value;
+                        }
+                    }
+                    CAPTURE(c, y, x);
+                    REQUIRE(table[c][y][x] == direct_box_sum(in[c], 0, 0, y, x));
+                    REQUIRE(squared[c][y][x] == expected_squared);
+                }
+            }
+        }
+    }
+
+    SECTION("Box sums from four lookups match direct sums") {
+        // Large enough to split both passes across the parallel workers.
+        const Tensor input = Tensor::from_random(
+                                 make_shape(3, 211, 301),
+                                 std::mt19937_64(11),
+                                 TensorOptions().dtype(Dtype::Float32),
+                                 -1.0,
+                                 1.0
+        )
+                                 .unwrap();
+        Tensor sum;
+        REQUIRE(integral_image(input, sum) == P10Error::Ok);
+        REQUIRE(sum.dtype() == Dtype::Float64);
+
+        const auto in = input.as_span3d<const float>().unwrap();
+        const auto table = sum.as_span3d<const double>().unwrap();
+        std::mt19937_64 rng(3);
+        for (int i = 0; i < 200; ++i) {
+            const int64_t c = static_cast<int64_t>(rng() % 3);
+            int64_t y0 = static_cast<int64_t>(rng() % 212);
+            int64_t y1 = static_cast<int64_t>(rng() % 212);
+            int64_t x0 = static_cast<int64_t>(rng() % 302);
+            int64_t x1 = static_cast<int64_t>(rng() % 302);
+            std::tie(y0, y1) = std::minmax(y0, y1);
+            std::tie(x0, x1) = std::minmax(x0, x1);
+            const double from_table =
+                table[c][y1][x1] - table[c][y0][x1] - table[c][y1][x0] + table[c][y0][x0];
+            CAPTURE(c, y0, x0, y1, x1);
+            REQUIRE(std::abs(from_table - direct_box_sum(in[c], y0, x0, y1, x1)) < 1e-9);
+        }
+    }
+
+    SECTION("Agrees across SIMD tiers") {
+        const Tensor input = Tensor::from_random(
+                                 make_shape(61, 97),
+                                 std::mt19937_64(2),
+                                 TensorOptions().dtype(Dtype::Uint8),
+                                 0.0,
+                                 255.0
+        )
+                                 .unwrap();
+        REQUIRE_THAT(
+            testing::compare_simd_tiers([&](Tensor& output) {
+                integral_image(input, output).expect("integral_image failed");
+            }),
+            testing::is_ok()
+        );
+    }
+
+    SECTION("Should fail with fewer than 2 dimensions") {
+        const auto line = Tensor::full(make_shape(16), 1.0).unwrap();
+        Tensor sum;
+        REQUIRE(integral_image(line, sum) == P10Error::InvalidArgument);
+    }
+}
+
+TEST_CASE("Op: Box filter", "[tensorop][box_filter]") {
+    // Radius 40 is wider than the 23-row planes, so the window clamps on
+    // both edges at once.
+    const auto radius = GENERATE(0, 1, 3, 9, 40);
+
+    DYNAMIC_SECTION("uint8 radius " << radius) {
+        const Tensor input = Tensor::from_random(
+                                 make_shape(2, 23, 67),
+                                 std::mt19937_64(radius),
+                                 TensorOptions().dtype(Dtype::Uint8),
+                                 0.0,
+                                 255.0
+        )
+                                 .unwrap();
+        Tensor output;
+        REQUIRE(box_filter(input, radius, output) == P10Error::Ok);
+        REQUIRE_THAT(
+            testing::compare_tensors(output, direct_box_filter<uint8_t>(input, radius)),
+            testing::is_ok()
+        );
+    }
+
+    DYNAMIC_SECTION("float32 radius " << radius) {
+        const Tensor input = Tensor::from_random(
+                                 make_shape(23, 67),
+                                 std::mt19937_64(radius),
+                                 TensorOptions().dtype(Dtype::Float32)
+        )
+                                 .unwrap();
+        Tensor output;
+        REQUIRE(box_filter(input, radius, output) == P10Error::Ok);
+        REQUIRE(output.shape() == input.shape());
+        REQUIRE_THAT(
+            testing::compare_tensors(
+                output,
+                direct_box_filter<float>(input, radius),
+                testing::CompareOptions().tolerance(1e-5)
+            ),
+            testing::is_ok()
+        );
+        REQUIRE_THAT(
+            testing::compare_simd_tiers(
+                [&](Tensor& tier_output) {
+                    box_filter(input, radius, tier_output).expect("box_filter failed");
+                },
+                testing::CompareOptions().tolerance(1e-5)
+            ),
+            testing::is_ok()
+        );
+    }
+
+    SECTION("Large multi-channel planes split into bands") {
+        const Tensor input = Tensor::from_random(
+                                 make_shape(3, 301, 211),
+                                 std::mt19937_64(17),
+                                 TensorOptions().dtype(Dtype::Uint16),
+                                 0.0,
+                                 65535.0
+        )
+                                 .unwrap();
+        Tensor output;
+        REQUIRE(box_filter(input, 4, output) == P10Error::Ok);
+        REQUIRE_THAT(
+            testing::compare_tensors(output, direct_box_filter<uint16_t>(input, 4)),
+            testing::is_ok()
+        );
+    }
+}
+
+TEST_CASE("Op: Box filter in place matches a separate output", "[tensorop][box_filter]") {
+    const auto dtype = GENERATE(Dtype::Float32, Dtype::Uint8);
+    const auto radius = GENERATE(1, 9);
+
+    DYNAMIC_SECTION("radius " << radius << ", " << to_string(dtype)) {
+        // Tall enough to split into row bands on several workers.
+        const Tensor input = Tensor::from_random(
+                                 make_shape(2, 480, 320),
+                                 std::mt19937_64(23),
+                                 TensorOptions().dtype(dtype),
+                                 0.0,
+                                 255.0
+        )
+                                 .unwrap();
+        Tensor expected;
+        REQUIRE(box_filter(input, radius, expected) == P10Error::Ok);
+
+        Tensor values = input.clone().unwrap();
+        REQUIRE(box_filter(values, radius, values) == P10Error::Ok);
+        REQUIRE_THAT(testing::compare_tensors(values, expected), testing::is_ok());
+    }
+}
+
+}  // namespace p10::op
@@ -0,0 +1,324 @@
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <ptensor/op/letterbox.hpp>
+#include <ptensor/op/resize.hpp>
+#include <ptensor/tensor.hpp>
+#include <ptensor/testing/catch2_assertions.hpp>
+#include <ptensor/testing/compare_tensors.hpp>
+#include <ptensor/testing/simd_tiers.hpp>
+
+namespace p10::op {
+
+namespace {
+    Tensor random_frames(const Shape& shape, uint64_t seed) {
+        return Tensor::from_random(
+                   shape,
+                   std::mt19937_64(seed),
+                   TensorOptions().dtype(Dtype::Uint8),
+                   0.0,
+                   255.0
+        )
+            .unwrap();
+    }
+
+    // Planar [N, C, H, W] copy of interleaved [N, H, W, C] frames.
+    Tensor to_planar(const Tensor& frames) {
+        const auto shape = frames.shape().as_span();
+        const int64_t count = shape[0];
+        const int64_t height = shape[1];
+        const int64_t width = shape[2];
+        const int64_t channels = shape[3];
+        Tensor planar;
+        planar.create(make_shape(count, channels, height, width), Dtype::Uint8)
+            .expect("create failed");
+        const auto src = frames.as_span1d<const uint8_t>().unwrap();
+        auto dst = planar.as_span1d<uint8_t>().unwrap();
+        for (int64_t n = 0; n < count; ++n) {
+            for (int64_t y = 0; y < height; ++y) {
+                for (int64_t x = 0; x < width; ++x) {
+                    for (int64_t c = 0; c < channels; ++c) {
+                        dst[(((n * channels + c) * height) + y) * width + x] =
+                            src[(((n * height + y) * width) + x) * channels + c];
+                    }
+                }
+            }
+        }
+        return planar;
+    }
+
+    // Letterbox of planar [N, C, H, W] frames from `resize` into the geometry
+    // `transform` reported, normalised and padded one value at a time.
+    Tensor reference_letterbox(
+        const Tensor& planar,
+        const LetterboxOptions& options,
+        const LetterboxGeometry& geometry,
+        const Shape& output_shape
+    ) {
+        const auto shape = planar.shape().as_span();
+        const int64_t count = shape[0];
+        const int64_t channels = shape[1];
+        const int64_t out_height = output_shape.as_span()[2];
+        const int64_t out_width = output_shape.as_span()[3];
+
+        const Tensor planes =
+            planar.as_reshape(make_shape(count * channels, shape[2], shape[3])).unwrap();
+        Tensor resized;
+        resize(planes, resized, geometry.width, geometry.height, options.interpolation())
+            .expect("resize failed");
+        const auto pixels = resized.as_span3d<const uint8_t>().unwrap();
+
+        Tensor expected;
+        expected.create(output_shape, Dtype::Float32).expect("create failed");
+        auto out = expected.as_span1d<float>().unwrap();
+        for (int64_t n = 0; n < count; ++n) {
+            for (int64_t c = 0; c < channels; ++c) {
+                const int64_t input_channel = options.reverse_channels() ? channels - 1 - c : c;
+                const float mean = options.mean().empty() ? 0.0f : options.mean()[c];
+                const float std = options.std().empty() ? 1.0f : options.std()[c];
+                for (int64_t y = 0; y < out_height; ++y) {
+                    for (int64_t x = 0; x < out_width; ++x) {
+                        const int64_t sy = y - geometry.top;
+                        const int64_t sx = x - geometry.left;
+                        float value = options.pad_value();
+                        if (sy >= 0 && sy < geometry.height && sx >= 0 && sx < geometry.width) {
+                            const auto pixel = pixels[(n * channels) + input_channel][sy][sx];
+                            value = (static_cast<float>(pixel) - mean) / std;
+                        }
+                        out[(((n * channels + c) * out_height) + y) * out_width + x] = value;
+                    }
+                }
+            }
+        }
+        return expected;
+    }
+
+    float half_to_float(uint16_t half) {
+        const int exponent = (half >> 10) & 0x1f;
+        const int mantissa = half & 0x3ff;
+        float magnitude = 0.0f;
+        if (exponent == 0) {
+            magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+        } else if (exponent == 31) {
+            magnitude = mantissa == 0 ? INFINITY : NAN;
+        } else {
+            magnitude = std::ldexp(static_cast<float>(mantissa + 1024), exponent - 25);
+        }
+        return (half & 0x8000) != 0 ? -magnitude : magnitude;
+    }
+}  // namespace
+
+TEST_CASE("Op: Letterbox preprocess", "[tensorop][letterbox]") {
+    const auto interpolation = GENERATE(
+        Interpolation::Nearest,
+        Interpolation::Bilinear,
+        Interpolation::Bicubic,
+        Interpolation::Area
+    );
+    const auto planar = GENERATE(false, true);
+
+    DYNAMIC_SECTION(
+        "mode " << static_cast<int>(interpolation) << (planar ? " planar" : " interleaved")
+    ) {
+        // Wide frames: the image fills the width and is padded above and
+        // below, 61 columns leave a tail past the SIMD registers.
+        const Tensor frames = random_frames(make_shape(2, 37, 61, 3), 7);
+        const auto options = LetterboxOptions(53, 48)
+                                 .mean({104.0f, 117.0f, 123.0f})
+                                 .std({58.0f, 57.0f, 57.5f})
+                                 .reverse_channels(true)
+                                 .interpolation(interpolation)
+                                 .pad_value(-1.5f)
+                                 .planar_input(planar);
+        auto letterbox = LetterboxPreprocess::create(options).unwrap();
+        const Tensor input = planar ? to_planar(frames) : frames.as_view();
+        Tensor output;
+        auto geometry = letterbox.transform(input, output).unwrap();
+        REQUIRE(output.shape() == make_shape(2, 3, 48, 53));
+        REQUIRE(output.dtype() == Dtype::Float32);
+        REQUIRE(geometry.width == 53);
+        REQUIRE(geometry.height == 32);
+        REQUIRE(geometry.left == 0);
+        REQUIRE(geometry.top == 8);
+
+        REQUIRE_THAT(
+            testing::compare_tensors(
+                output,
+                reference_letterbox(to_planar(frames), options, geometry, output.shape()),
+                testing::CompareOptions().tolerance(1e-5)
+            ),
+            testing::is_ok()
+        );
+        REQUIRE_THAT(
+            testing::compare_simd_tiers([&](Tensor& tier_output) {
+                letterbox.transform(input, tier_output).unwrap();
+            }),
+            testing::is_ok()
+        );
+    }
+}
+
+TEST_CASE("Op: Letterbox preprocess edge cases", "[tensorop][letterbox]") {
+    SECTION("Tall gray frames are padded left and right") {
+        const Tensor frame = random_frames(make_shape(90, 40, 1), 3);
+        const auto options = LetterboxOptions(64, 64).mean({127.5f}).std({127.5f});
+        auto letterbox = LetterboxPreprocess::create(options).unwrap();
+        Tensor output;
+        auto geometry = letterbox.transform(frame, output).unwrap();
+        REQUIRE(output.shape() == make_shape(1, 1, 64, 64));
+        REQUIRE(geometry.height == 64);
+        REQUIRE(geometry.width == 28);
+        REQUIRE(geometry.left == 18);
+        REQUIRE(geometry.top == 0);
+
+        const Tensor planar = frame.as_reshape(make_shape(1, 1, 90, 40)).unwrap();
+        REQUIRE_THAT(
+            testing::compare_tensors(
+                output,
+                reference_letterbox(planar, options, geometry, output.shape()),
+                testing::CompareOptions().tolerance(1e-6)
+            ),
+            testing::is_ok()
+        );
+    }
+
+    SECTION("Without upscaling small frames are only padded, in stride steps") {
+        const Tensor frames = random_frames(make_shape(1, 3, 200, 300), 4);
+        const auto options = LetterboxOptions(320, 320)
+                                 .interpolation(Interpolation::Area)
+                                 .upscale(false)
+                                 .pad_stride(16)
+                                 .planar_input(true);
+        auto letterbox = LetterboxPreprocess::create(options).unwrap();
+        Tensor output;
+        auto geometry = letterbox.transform(frames, output).unwrap();
+        REQUIRE(geometry.scale == 1.0f);
+        REQUIRE(output.shape() == make_shape(1, 3, 208, 304));
+        REQUIRE(geometry.left == 2);
+        REQUIRE(geometry.top == 4);
+        REQUIRE_THAT(
+            testing::compare_tensors(
+                output,
+                reference_letterbox(frames, options, geometry, output.shape())
+            ),
+            testing::is_ok()
+        );
+    }
+
+    SECTION("Replans when the frame size changes") {
+        auto letterbox = LetterboxPreprocess::create(LetterboxOptions(96, 96)).unwrap();
+        for (const auto& shape :
+             {make_shape(1, 50, 80, 3), make_shape(1, 50, 80, 3), make_shape(1, 120, 70, 3)}) {
+            const Tensor frames = random_frames(shape, 9);
+            Tensor output;
+            auto geometry = letterbox.transform(frames, output).unwrap();
+            REQUIRE_THAT(
+                testing::compare_tensors(
+                    output,
+                    reference_letterbox(
+                        to_planar(frames),
+                        LetterboxOptions(96, 96),
+                        geometry,
+                        output.shape()
+                    ),
+                    testing::CompareOptions().tolerance(1e-6)
+                ),
+                testing::is_ok()
+            );
+        }
+    }
+
+    SECTION("Batches of large frames split across the workers") {
+        const Tensor frames = random_frames(make_shape(2, 480, 640, 3), 5);
+        const auto options = LetterboxOptions(320, 320).mean({0.5f, 1.5f, 2.5f});
+        auto letterbox = LetterboxPreprocess::create(options).unwrap();
+        Tensor output;
+        auto geometry = letterbox.transform(frames, output).unwrap();
+        REQUIRE(geometry.scale == 0.5f);
+        REQUIRE_THAT(
+            testing::compare_tensors(
+                output,
+                reference_letterbox(to_planar(frames), options, geometry, output.shape())
+            ),
+            testing::is_ok()
+        );
+    }
+
+    SECTION("float16 output rounds the float32 values to nearest even") {
+        const Tensor frames = random_frames(make_shape(1, 30, 45, 3), 6);
+        const auto options = LetterboxOptions(40, 40).mean({100.0f, 110.0f, 120.0f}).std({
+            3.0f,
+            7.0f,
+            0.01f
+        });
+        auto letterbox = LetterboxPreprocess::create(options).unwrap();
+        Tensor expected;
+        letterbox.transform(frames, expected).unwrap();
+
+        auto half_letterbox =
+            LetterboxPreprocess::create(LetterboxOptions(options).dtype(Dtype::Float16)).unwrap();
+        Tensor output;
+        half_letterbox.transform(frames, output).unwrap();
+        REQUIRE(output.dtype() == Dtype::Float16);
+        REQUIRE(output.shape() == expected.shape());
+
+        const auto values = expected.as_span1d<const float>().unwrap();
+        const auto* halves = reinterpret_cast<const uint16_t*>(output.as_bytes().data());
+        for (size_t i = 0; i < values.size(); ++i) {
+            CAPTURE(i, values[i]);
+            const float value = half_to_float(halves[i]);
+            // Within half a unit in the last place of 11 significant bits.
+            REQUIRE(std::abs(value - values[i]) <= std::abs(values[i]) * 0x1p-11f);
+        }
+    }
+
+    SECTION("float16 padding covers subnormals, overflow and ties") {
+        const Tensor frame = random_frames(make_shape(4, 8, 3), 1);
+        for (const auto& [pad, expected] :
+             {std::pair<float, uint16_t> {0.1f, 0x2e66},
+              std::pair<float, uint16_t> {-2.0f, 0xc000},
+              std::pair<float, uint16_t> {1e-7f, 0x0002},
+              std::pair<float, uint16_t> {65504.0f, 0x7bff},
+              std::pair<float, uint16_t> {65520.0f, 0x7c00},
+              // Halfway between 1 and the next half: rounds to the even 1.
+              std::pair<float, uint16_t> {1.0f + 0x1p-11f, 0x3c00}}) {
+            CAPTURE(pad);
+            auto letterbox = LetterboxPreprocess::create(
+                                 LetterboxOptions(8, 8).pad_value(pad).dtype(Dtype::Float16)
+            )
+                                 .unwrap();
+            Tensor output;
+            letterbox.transform(frame, output).unwrap();
+            const auto* halves = reinterpret_cast<const uint16_t*>(output.as_bytes().data());
+            REQUIRE(halves[0] == expected);
+        }
+    }
+
+    SECTION("Should fail on invalid options") {
+        REQUIRE(LetterboxPreprocess::create(LetterboxOptions(0, 8)).is_error());
+        REQUIRE(LetterboxPreprocess::create(LetterboxOptions(8, 8).mean({1, 2}).std({1, 2, 3}))
+                    .is_error());
+        REQUIRE(LetterboxPreprocess::create(LetterboxOptions(8, 8).std({1, 0, 1})).is_error());
+        REQUIRE(
+            LetterboxPreprocess::create(LetterboxOptions(8, 8).dtype(Dtype::Uint8)).is_error()
+        );
+    }
+
+    SECTION("Should fail on unsupported frames") {
+        auto letterbox = LetterboxPreprocess::create(LetterboxOptions(8, 8).mean({1, 2, 3}))
+                             .unwrap();
+        Tensor output;
+        REQUIRE(letterbox.transform(Tensor::full(make_shape(8, 8, 3), 1.0).unwrap(), output)
+                    .is_error());
+        REQUIRE(letterbox.transform(random_frames(make_shape(8, 8), 1), output).is_error());
+        REQUIRE(letterbox.transform(random_frames(make_shape(8, 8, 4), 1), output).is_error());
+        REQUIRE(letterbox.transform(random_frames(make_shape(0, 8, 8, 3), 1), output).is_error());
+    }
+}
+
+}  // namespace p10::op
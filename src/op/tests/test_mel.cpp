@@ -0,0 +1,249 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <ptensor/op/mel.hpp>
+#include <ptensor/op/stft.hpp>
+#include <ptensor/op/window_function.hpp>
+#include <ptensor/tensor.hpp>
+#include <ptensor/testing/catch2_assertions.hpp>
+#include <ptensor/testing/compare_tensors.hpp>
+#include <ptensor/testing/simd_tiers.hpp>
+
+namespace p10::op {
+
+namespace {
+    Tensor random_tensor(const Shape& shape, uint64_t seed) {
+        return Tensor::from_random(
+                   shape,
+                   std::mt19937_64(seed),
+                   TensorOptions().dtype(Dtype::Float32),
+                   -1.0,
+                   1.0
+        )
+            .unwrap();
+    }
+
+    // librosa's Slaney mel scale.
+    double hz_to_mel(double hz) {
+        if (hz < 1000.0) {
+            return hz * 3.0 / 200.0;
+        }
+        return 15.0 + (std::log(hz / 1000.0) * 27.0 / std::log(6.4));
+    }
+
+    double mel_to_hz(double mel) {
+        if (mel < 15.0) {
+            return mel * 200.0 / 3.0;
+        }
+        return 1000.0 * std::exp((mel - 15.0) * std::log(6.4) / 27.0);
+    }
+
+    // librosa.filters.mel(sr, n_fft, n_mels, fmin, fmax), [mels][bins].
+    std::vector<std::vector<double>>
+    reference_filters(double rate, int64_t frame_length, int64_t mels, double fmin, double fmax) {
+        const int64_t bins = (frame_length / 2) + 1;
+        std::vector<double> hz(mels + 2);
+        for (int64_t i = 0; i < mels + 2; ++i) {
+            const double mel = hz_to_mel(fmin)
+                + ((hz_to_mel(fmax) - hz_to_mel(fmin)) * static_cast<double>(i)
+                   / static_cast<double>(mels + 1));
+            hz[i] = mel_to_hz(mel);
+        }
+        std::vector<std::vector<double>> filters(mels, std::vector<double>(bins));
+        for (int64_t m = 0; m < mels; ++m) {
+            for (int64_t k = 0; k < bins; ++k) {
+                const double f = static_cast<double>(k) * rate / static_cast<double>(frame_length);
+                const double lower = (f - hz[m]) / (hz[m + 1] - hz[m]);
+                const double upper = (hz[m + 2] - f) / (hz[m + 2] - hz[m + 1]);
+                filters[m][k] = std::max(0.0, std::min(lower, upper)) * 2.0 / (hz[m + 2] - hz[m]);
+            }
+        }
+        return filters;
+    }
+
+    // Mel power of every [bins, 2] row of `spectrum`, in double.
+    std::vector<double>
+    reference_mel(const Tensor& spectrum, const std::vector<std::vector<double>>& filters) {
+        const auto values = spectrum.as_span1d<const float>().unwrap();
+        const auto bins = static_cast<int64_t>(filters[0].size());
+        const auto rows = static_cast<int64_t>(values.size()) / (bins * 2);
+        std::vector<double> result;
+        for (int64_t row = 0; row < rows; ++row) {
+            for (const auto& filter : filters) {
+                double sum = 0.0;
+                for (int64_t k = 0; k < bins; ++k) {
+                    const double re = values[(row * bins * 2) + (2 * k)];
+                    const double im = values[(row * bins * 2) + (2 * k) + 1];
+                    sum += filter[k] * ((re * re) + (im * im));
+                }
+                result.push_back(sum);
+            }
+        }
+        return result;
+    }
+
+    // librosa.power_to_db(mel, top_db=top_db).
+    std::vector<double> reference_decibels(std::vector<double> mel, double top_db) {
+        for (auto& value : mel) {
+            value = 10.0 * std::log10(std::max(value, 1e-10));
+        }
+        const double floor = *std::max_element(mel.begin(), mel.end()) - top_db;
+        for (auto& value : mel) {
+            value = std::max(value, floor);
+        }
+        return mel;
+    }
+}  // namespace
+
+TEST_CASE("Op: mel filters match librosa's", "[tensorop][mel]") {
+    const auto options = MelOptions(22050.0, 2048).mels(128);
+    const auto mel = MelSpectrogram::create(options).unwrap();
+    const auto expected = reference_filters(22050.0, 2048, 128, 0.0, 11025.0);
+
+    const Tensor filters = mel.filters();
+    REQUIRE(filters.shape() == make_shape(128, 1025));
+    const auto weights = filters.as_span1d<const float>().unwrap();
+    for (size_t m = 0; m < expected.size(); ++m) {
+        for (size_t k = 0; k < expected[m].size(); ++k) {
+            REQUIRE(std::abs(weights[(m * 1025) + k] - expected[m][k]) <= 1e-6 * expected[m][k]);
+        }
+    }
+}
+
+TEST_CASE("Op: mel spectrogram of a multi-channel batch", "[tensorop][mel]") {
+    const auto options =
+        MelOptions(16000.0, 400).mels(40).min_frequency(20.0).max_frequency(7600.0);
+    const auto mel = MelSpectrogram::create(options).unwrap();
+    const auto filters = reference_filters(16000.0, 400, 40, 20.0, 7600.0);
+
+    // [channels, frames, bins, 2].
+    const Tensor spectrum = random_tensor(make_shape(3, 7, 201, 2), 3);
+    Tensor power;
+    REQUIRE_THAT(mel.transform(spectrum, power), testing::is_ok());
+    REQUIRE(power.shape() == make_shape(3, 7, 40));
+
+    const auto expected = reference_mel(spectrum, filters);
+    const auto actual = power.as_span1d<const float>().unwrap();
+    for (size_t i = 0; i < expected.size(); ++i) {
+        REQUIRE(std::abs(actual[i] - expected[i]) <= 1e-5 * expected[i]);
+    }
+
+    const auto log_mel = MelSpectrogram::create(MelOptions(options).log(true)).unwrap();
+    Tensor decibels;
+    REQUIRE_THAT(log_mel.transform(spectrum, decibels), testing::is_ok());
+    const auto expected_db = reference_decibels(expected, 80.0);
+    const auto actual_db = decibels.as_span1d<const float>().unwrap();
+    for (size_t i = 0; i < expected_db.size(); ++i) {
+        REQUIRE(std::abs(actual_db[i] - expected_db[i]) <= 1e-4);
+    }
+
+    REQUIRE_THAT(
+        testing::compare_simd_tiers(
+            [&](Tensor& tier_output) { mel.transform(spectrum, tier_output).expect("mel failed"); },
+            testing::CompareOptions().tolerance(1e-5)
+        ),
+        testing::is_ok()
+    );
+}
+
+TEST_CASE("Op: MFCC is the orthonormal DCT-II of the log mel", "[tensorop][mel]") {
+    const auto options = MelOptions(22050.0, 512).mels(64).coefficients(13);
+    auto mfcc = Mfcc::create(options).unwrap();
+    const auto filters = reference_filters(22050.0, 512, 64, 0.0, 11025.0);
+
+    // Quiet frames pull some bands under the 80 dB clamp.
+    Tensor spectrum = random_tensor(make_shape(6, 257, 2), 5);
+    auto values = spectrum.as_span1d<float>().unwrap();
+    std::transform(values.begin(), values.begin() + 257 * 2, values.begin(), [](float x) {
+        return x * 1e-5F;
+    });
+
+    Tensor coefficients;
+    REQUIRE_THAT(mfcc.transform(spectrum, coefficients), testing::is_ok());
+    REQUIRE(coefficients.shape() == make_shape(6, 13));
+
+    const auto decibels = reference_decibels(reference_mel(spectrum, filters), 80.0);
+    const auto actual = coefficients.as_span1d<const float>().unwrap();
+    for (int64_t row = 0; row < 6; ++row) {
+        for (int64_t k = 0; k < 13; ++k) {
+            double expected = 0.0;
+            for (int64_t m = 0; m < 64; ++m) {
+                expected += decibels[(row * 64) + m]
+                    * std::cos(std::numbers::pi * static_cast<double>(k * ((2 * m) + 1)) / 128.0);
+            }
+            expected *= std::sqrt((k == 0 ? 1.0 : 2.0) / 64.0);
+            REQUIRE(std::abs(actual[(row * 13) + k] - expected) <= 1e-3);
+        }
+    }
+}
+
+TEST_CASE("Op: MFCC of a streamed STFT", "[tensorop][mel]") {
+    const auto stft_options = StftOptions(512, 128).window(WindowFunction::PeriodicHanning);
+    const auto options = MelOptions(16000.0, 512).mels(40).top_db(0.0F);
+    const Tensor signal = random_tensor(make_shape(4096), 7);
+
+    auto whole_stft = Stft::create(stft_options).unwrap();
+    auto whole_mfcc = Mfcc::create(options).unwrap();
+    Tensor spectrum;
+    Tensor expected;
+    REQUIRE_THAT(whole_stft.transform(signal, spectrum), testing::is_ok());
+    REQUIRE_THAT(whole_mfcc.transform(spectrum, expected), testing::is_ok());
+
+    auto stft = Stft::create(stft_options).unwrap();
+    auto mfcc = Mfcc::create(options).unwrap();
+    const auto samples = signal.as_span1d<const float>().unwrap();
+    const auto expected_values = expected.as_span1d<const float>().unwrap();
+    Tensor chunk = Tensor::empty(make_shape(1024), Dtype::Float32).unwrap();
+    Tensor coefficients;
+    size_t emitted = 0;
+    for (size_t begin = 0; begin < samples.size(); begin += 1024) {
+        std::copy_n(samples.begin() + begin, 1024, chunk.as_span1d<float>().unwrap().begin());
+        REQUIRE_THAT(stft.transform(chunk, spectrum), testing::is_ok());
+        REQUIRE_THAT(mfcc.transform(spectrum, coefficients), testing::is_ok());
+        for (const float value : coefficients.as_span1d<const float>().unwrap()) {
+            REQUIRE(value == expected_values[emitted++]);
+        }
+    }
+    REQUIRE(emitted == expected_values.size());
+}
+
+TEST_CASE("Op: periodic Hanning window", "[tensorop][mel]") {
+    Tensor window;
+    REQUIRE_THAT(
+        WindowFunction::generate(WindowFunction::PeriodicHanning, 8, Dtype::Float64, window),
+        testing::is_ok()
+    );
+    const auto values = window.as_span1d<const double>().unwrap();
+    REQUIRE(values[0] == 0.0);
+    REQUIRE(std::abs(values[2] - 0.5) < 1e-15);
+    REQUIRE(values[4] == 1.0);
+    REQUIRE(std::abs(values[7] - values[1]) < 1e-15);
+}
+
+TEST_CASE("Op: mel errors", "[tensorop][mel]") {
+    REQUIRE(MelSpectrogram::create(MelOptions(0.0, 512)).is_error());
+    REQUIRE(MelSpectrogram::create(MelOptions(16000.0, 1)).is_error());
+    REQUIRE(MelSpectrogram::create(MelOptions(16000.0, 512).mels(0)).is_error());
+    REQUIRE(MelSpectrogram::create(MelOptions(16000.0, 512).max_frequency(9000.0)).is_error());
+    REQUIRE(MelSpectrogram::create(MelOptions(16000.0, 512).min_frequency(8000.0)).is_error());
+    REQUIRE(Mfcc::create(MelOptions(16000.0, 512).mels(10).coefficients(11)).is_error());
+    REQUIRE(Mfcc::create(MelOptions(16000.0, 512).coefficients(0)).is_error());
+
+    const auto mel = MelSpectrogram::create(MelOptions(16000.0, 512)).unwrap();
+    Tensor output;
+    REQUIRE_THAT(
+        mel.transform(Tensor::zeros(make_shape(4, 256, 2), Dtype::Float32).unwrap(), output),
+        testing::is_error(P10Error::InvalidArgument)
+    );
+    REQUIRE_THAT(
+        mel.transform(Tensor::zeros(make_shape(4, 257, 2), Dtype::Float64).unwrap(), output),
+        testing::is_error(P10Error::InvalidArgument)
+    );
+}
+
+}  // namespace p10::op
@@ -1,4 +1,13 @@
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
@@ -7,6 +16,7 @@
 #include <ptensor/op/resize.hpp>
 #include <ptensor/testing/catch2_assertions.hpp>
 #include <ptensor/testing/compare_tensors.hpp>
+#include <ptensor/testing/simd_tiers.hpp>
 
 #include "testing.hpp"
 
@@ -83,4 +93,451 @@ TEST_CASE("Tensorop: Resize", "[tensorop][resize][integration]") {
     }
 }
 
+TEST_CASE("Tensorop: Resize nearest uint8 on every tier", "[tensorop][resize]") {
+    // Upscaling, up to 2x and past 2x downscaling, and rows narrower than a
+    // 16-byte load.
+    const auto [width, height, new_width, new_height] = GENERATE(
+        std::tuple<int64_t, int64_t, int64_t, int64_t> {61, 37, 200, 90},
+        std::tuple<int64_t, int64_t, int64_t, int64_t> {123, 40, 77, 31},
+        std::tuple<int64_t, int64_t, int64_t, int64_t> {300, 20, 71, 45},
+        std::tuple<int64_t, int64_t, int64_t, int64_t> {9, 5, 35, 11}
+    );
+    CAPTURE(width, height, new_width, new_height);
+
+    const Tensor input = Tensor::from_random(
+                             make_shape(2, height, width),
+                             std::mt19937_64(29),
+                             TensorOptions().dtype(Dtype::Uint8),
+                             0.0,
+                             255.0
+    )
+                             .unwrap();
+    Tensor output;
+    REQUIRE_THAT(
+        resize(input, output, new_width, new_height, ResizeOptions(Interpolation::Nearest)),
+        testing::is_ok()
+    );
+
+    const auto in = input.as_span3d<const uint8_t>().unwrap();
+    const auto out = output.as_span3d<const uint8_t>().unwrap();
+    const float x_scale = static_cast<float>(width) / static_cast<float>(new_width);
+    const float y_scale = static_cast<float>(height) / static_cast<float>(new_height);
+    for (int64_t c = 0; c < 2; ++c) {
+        for (int64_t y = 0; y < new_height; ++y) {
+            const auto src_y = std::min(
+                static_cast<int64_t>(static_cast<float>(y) * y_scale),
+                height - 1
+            );
+            for (int64_t x = 0; x < new_width; ++x) {
+                const auto src_x = std::min(
+                    static_cast<int64_t>(static_cast<float>(x) * x_scale),
+                    width - 1
+                );
+                REQUIRE(out[c][y][x] == in[c][src_y][src_x]);
+            }
+        }
+    }
+
+    REQUIRE_THAT(
+        testing::compare_simd_tiers([&](Tensor& tier_output) {
+            resize(
+                input,
+                tier_output,
+                new_width,
+                new_height,
+                ResizeOptions(Interpolation::Nearest)
+            )
+                .expect("resize failed");
+        }),
+        testing::is_ok()
+    );
+}
+
+namespace {
+    // Source pixels and weights of output coordinate `o` along one axis, taken
+    // straight from the definition of each mode (see Interpolation).
+    std::vector<std::pair<int64_t, double>>
+    reference_taps(int64_t src_size, int64_t dst_size, int64_t o, Interpolation interpolation) {
+        const double scale = static_cast<double>(src_size) / static_cast<double>(dst_size);
+        const auto clamp = [&](int64_t i) { return std::clamp<int64_t>(i, 0, src_size - 1); };
+        std::vector<std::pair<int64_t, double>> taps;
+        if (interpolation == Interpolation::Area) {
+            const double begin = static_cast<double>(o) * scale;
+            const double end = static_cast<double>(o + 1) * scale;
+            for (int64_t i = 0; i < src_size; ++i) {
+                const double covered = std::min(end, static_cast<double>(i + 1))
+                    - std::max(begin, static_cast<double>(i));
+                if (covered > 0.0) {
+                    taps.emplace_back(i, covered / scale);
+                }
+            }
+            return taps;
+        }
+        const double center = ((static_cast<double>(o) + 0.5) * scale) - 0.5;
+        const auto floor = static_cast<int64_t>(std::floor(center));
+        const double t = center - static_cast<double>(floor);
+        if (interpolation == Interpolation::Bilinear) {
+            taps.emplace_back(clamp(floor), 1.0 - t);
+            taps.emplace_back(clamp(floor + 1), t);
+            return taps;
+        }
+        const auto cubic = [](double x) {
+            const double a = -0.75;
+            x = std::abs(x);
+            if (x <= 1.0) {
+                return ((a + 2.0) * x * x * x) - ((a + 3.0) * x * x) + 1.0;
+            }
+            return (a * x * x * x) - (5.0 * a * x * x) + (8.0 * a * x) - (4.0 * a);
+        };
+        for (int64_t k = -1; k <= 2; ++k) {
+            taps.emplace_back(clamp(floor + k), cubic(t - static_cast<double>(k)));
+        }
+        return taps;
+    }
+
+    // Separable resample of every plane in double.
+    template<typename scalar_t>
+    std::vector<double> reference_resize(
+        const Tensor& input,
+        int64_t new_width,
+        int64_t new_height,
+        Interpolation interpolation
+    ) {
+        const auto in = input.as_span3d<const scalar_t>().unwrap();
+        std::vector<double> reference;
+        for (int64_t c = 0; c < in.channels(); ++c) {
+            for (int64_t y = 0; y < new_height; ++y) {
+                const auto row_taps = reference_taps(in.rows(), new_height, y, interpolation);
+                for (int64_t x = 0; x < new_width; ++x) {
+                    const auto col_taps = reference_taps(in.cols(), new_width, x, interpolation);
+                    double sum = 0.0;
+                    for (const auto& [sy, wy] : row_taps) {
+                        for (const auto& [sx, wx] : col_taps) {
+                            sum += wy * wx * static_cast<double>(in[c][sy][sx]);
+                        }
+                    }
+                    reference.push_back(sum);
+                }
+            }
+        }
+        return reference;
+    }
+}  // namespace
+
+TEST_CASE("Tensorop: Resize interpolation", "[tensorop][resize]") {
+    const auto interpolation =
+        GENERATE(Interpolation::Bilinear, Interpolation::Bicubic, Interpolation::Area);
+    // Down and up by non-integer factors, an exact 2x downscale, and a
+    // mixed one; odd widths leave columns past the SIMD registers.
+    const auto [new_width, new_height] = GENERATE(
+        std::pair<int64_t, int64_t> {29, 17},
+        std::pair<int64_t, int64_t> {131, 97},
+        std::pair<int64_t, int64_t> {35, 20},
+        std::pair<int64_t, int64_t> {150, 13}
+    );
+
+    DYNAMIC_SECTION(
+        "float32 mode " << static_cast<int>(interpolation) << " to " << new_width << "x"
+                        << new_height
+    ) {
+        const Tensor input = Tensor::from_random(
+                                 make_shape(2, 40, 70),
+                                 std::mt19937_64(4),
+                                 TensorOptions().dtype(Dtype::Float32)
+        )
+                                 .unwrap();
+        Tensor output;
+        REQUIRE(resize(input, output, new_width, new_height, interpolation).is_ok());
+        REQUIRE(output.shape() == make_shape(2, new_height, new_width));
+
+        const auto reference =
+            reference_resize<float>(input, new_width, new_height, interpolation);
+        const auto out = output.as_span1d<const float>().unwrap();
+        for (size_t i = 0; i < reference.size(); ++i) {
+            CAPTURE(i);
+            REQUIRE(out[i] == Catch::Approx(reference[i]).margin(1e-5));
+        }
+
+        REQUIRE_THAT(
+            testing::compare_simd_tiers(
+                [&](Tensor& tier_output) {
+                    resize(input, tier_output, new_width, new_height, interpolation)
+                        .expect("resize failed");
+                },
+                testing::CompareOptions().tolerance(1e-5)
+            ),
+            testing::is_ok()
+        );
+    }
+
+    DYNAMIC_SECTION(
+        "uint8 mode " << static_cast<int>(interpolation) << " to " << new_width << "x"
+                      << new_height
+    ) {
+        const Tensor input = Tensor::from_random(
+                                 make_shape(3, 40, 70),
+                                 std::mt19937_64(6),
+                                 TensorOptions().dtype(Dtype::Uint8),
+                                 0.0,
+                                 255.0
+        )
+                                 .unwrap();
+        Tensor output;
+        REQUIRE(resize(input, output, new_width, new_height, interpolation).is_ok());
+        REQUIRE(output.dtype() == Dtype::Uint8);
+
+        // Q11 weights land within a step of the exact result.
+        const auto reference =
+            reference_resize<uint8_t>(input, new_width, new_height, interpolation);
+        const auto out = output.as_span1d<const uint8_t>().unwrap();
+        for (size_t i = 0; i < reference.size(); ++i) {
+            CAPTURE(i);
+            const double expected = std::clamp(std::round(reference[i]), 0.0, 255.0);
+            REQUIRE(static_cast<double>(out[i]) == Catch::Approx(expected).margin(1.0));
+        }
+
+        REQUIRE_THAT(
+            testing::compare_simd_tiers([&](Tensor& tier_output) {
+                resize(input, tier_output, new_width, new_height, interpolation)
+                    .expect("resize failed");
+            }),
+            testing::is_ok()
+        );
+    }
+}
+
+TEST_CASE("Tensorop: Resize interpolation edge cases", "[tensorop][resize]") {
+    SECTION("Constant planes stay constant in every mode and dtype") {
+        for (const auto interpolation :
+             {Interpolation::Bilinear, Interpolation::Bicubic, Interpolation::Area}) {
+            for (const auto dtype : {Dtype::Uint8, Dtype::Uint16, Dtype::Float32}) {
+                CAPTURE(static_cast<int>(interpolation), to_string(dtype));
+                const auto constant =
+                    Tensor::full(make_shape(2, 33, 21), 77.0, TensorOptions().dtype(dtype))
+                        .unwrap();
+                const auto expected =
+                    Tensor::full(make_shape(2, 10, 50), 77.0, TensorOptions().dtype(dtype))
+                        .unwrap();
+                Tensor resized;
+                REQUIRE(resize(constant, resized, 50, 10, interpolation).is_ok());
+                REQUIRE_THAT(
+                    testing::compare_tensors(
+                        expected,
+                        resized,
+                        testing::CompareOptions().tolerance(1e-4)
+                    ),
+                    testing::is_ok()
+                );
+            }
+        }
+    }
+
+    SECTION("Halving by area averages 2x2 blocks") {
+        const Tensor input = Tensor::from_random(
+                                 make_shape(1, 16, 24),
+                                 std::mt19937_64(9),
+                                 TensorOptions().dtype(Dtype::Uint8),
+                                 0.0,
+                                 255.0
+        )
+                                 .unwrap();
+        Tensor output;
+        REQUIRE(resize(input, output, 12, 8, Interpolation::Area).is_ok());
+        const auto in = input.as_span3d<const uint8_t>().unwrap();
+        const auto out = output.as_span3d<const uint8_t>().unwrap();
+        for (int64_t y = 0; y < 8; ++y) {
+            for (int64_t x = 0; x < 12; ++x) {
+                const int sum = in[0][2 * y][2 * x] + in[0][2 * y][(2 * x) + 1]
+                    + in[0][(2 * y) + 1][2 * x] + in[0][(2 * y) + 1][(2 * x) + 1];
+                CAPTURE(y, x);
+                REQUIRE(out[0][y][x] == (sum + 2) / 4);
+            }
+        }
+    }
+
+    SECTION("Large multi-channel planes split across the workers") {
+        const Tensor input = Tensor::from_random(
+                                 make_shape(3, 480, 640),
+                                 std::mt19937_64(12),
+                                 TensorOptions().dtype(Dtype::Float32)
+        )
+                                 .unwrap();
+        Tensor output;
+        REQUIRE(resize(input, output, 301, 211, Interpolation::Area).is_ok());
+        const auto reference = reference_resize<float>(input, 301, 211, Interpolation::Area);
+        const auto out = output.as_span1d<const float>().unwrap();
+        for (size_t i = 0; i < reference.size(); ++i) {
+            CAPTURE(i);
+            REQUIRE(out[i] == Catch::Approx(reference[i]).margin(1e-5));
+        }
+    }
+
+    SECTION("Should fail on 2D input") {
+        const auto plane = Tensor::full(make_shape(8, 8), 1.0).unwrap();
+        Tensor output;
+        REQUIRE(resize(plane, output, 4, 4, Interpolation::Bilinear) == P10Error::InvalidArgument);
+    }
+}
+
+namespace {
+    // Planar [C, H, W] copy of an interleaved [H, W, C] image.
+    template<typename scalar_t>
+    Tensor to_planar(const Tensor& image) {
+        const auto pixels = image.as_span3d<const scalar_t>().unwrap();
+        Tensor planar;
+        planar
+            .create(make_shape(pixels.cols(), pixels.channels(), pixels.rows()), image.dtype())
+            .expect("create failed");
+        auto planes = planar.as_span3d<scalar_t>().unwrap();
+        for (int64_t y = 0; y < pixels.channels(); ++y) {
+            for (int64_t x = 0; x < pixels.rows(); ++x) {
+                for (int64_t c = 0; c < pixels.cols(); ++c) {
+                    planes[c][y][x] = pixels[y][x][c];
+                }
+            }
+        }
+        return planar;
+    }
+
+    template<typename scalar_t>
+    Tensor random_image(int64_t height, int64_t width, int64_t channels, uint64_t seed) {
+        constexpr bool IS_UINT8 = std::is_same_v<scalar_t, uint8_t>;
+        return Tensor::from_random(
+                   make_shape(height, width, channels),
+                   std::mt19937_64(seed),
+                   TensorOptions().dtype(IS_UINT8 ? Dtype::Uint8 : Dtype::Float32),
+                   0.0,
+                   IS_UINT8 ? 255.0 : 1.0
+        )
+            .unwrap();
+    }
+}  // namespace
+
+TEST_CASE("Tensorop: ImageResize", "[tensorop][resize]") {
+    const auto interpolation = GENERATE(
+        Interpolation::Nearest,
+        Interpolation::Bilinear,
+        Interpolation::Bicubic,
+        Interpolation::Area
+    );
+    // 2 and 5 channels take the runtime-width nearest copy; 3 and 4 the
+    // shuffle kernels for uint8.
+    const auto channels = GENERATE(1, 2, 3, 4, 5);
+    const auto [new_width, new_height] = GENERATE(
+        std::pair<int64_t, int64_t> {29, 17},
+        std::pair<int64_t, int64_t> {131, 97},
+        std::pair<int64_t, int64_t> {70, 40}
+    );
+
+    DYNAMIC_SECTION(
+        "uint8 mode " << static_cast<int>(interpolation) << " with " << channels
+                      << " channels to " << new_width << "x" << new_height
+    ) {
+        const Tensor image = random_image<uint8_t>(40, 70, channels, 21);
+        auto resizer = ImageResize::create(new_width, new_height, interpolation).unwrap();
+        Tensor output;
+        REQUIRE(resizer.transform(image, output).is_ok());
+        REQUIRE(output.shape() == make_shape(new_height, new_width, channels));
+        REQUIRE(output.dtype() == Dtype::Uint8);
+
+        // Same tables and fixed-point kernels as the planar resize.
+        Tensor expected;
+        REQUIRE(resize(to_planar<uint8_t>(image), expected, new_width, new_height, interpolation)
+                    .is_ok());
+        REQUIRE_THAT(
+            testing::compare_tensors(to_planar<uint8_t>(output), expected),
+            testing::is_ok()
+        );
+
+        REQUIRE_THAT(
+            testing::compare_simd_tiers([&](Tensor& tier_output) {
+                resizer.transform(image, tier_output).expect("transform failed");
+            }),
+            testing::is_ok()
+        );
+    }
+
+    DYNAMIC_SECTION(
+        "float32 mode " << static_cast<int>(interpolation) << " with " << channels
+                        << " channels to " << new_width << "x" << new_height
+    ) {
+        const Tensor image = random_image<float>(40, 70, channels, 22);
+        auto resizer = ImageResize::create(new_width, new_height, interpolation).unwrap();
+        Tensor output;
+        REQUIRE(resizer.transform(image, output).is_ok());
+        REQUIRE(output.shape() == make_shape(new_height, new_width, channels));
+
+        Tensor expected;
+        REQUIRE(resize(to_planar<float>(image), expected, new_width, new_height, interpolation)
+                    .is_ok());
+        REQUIRE_THAT(
+            testing::compare_tensors(
+                to_planar<float>(output),
+                expected,
+                testing::CompareOptions().tolerance(1e-5)
+            ),
+            testing::is_ok()
+        );
+    }
+}
+
+TEST_CASE("Tensorop: ImageResize edge cases", "[tensorop][resize]") {
+    SECTION("Replans when the input shape changes") {
+        auto resizer = ImageResize::create(33, 21, Interpolation::Bilinear).unwrap();
+        for (const auto& [height, width, channels] :
+             {std::tuple<int64_t, int64_t, int64_t> {40, 70, 3},
+              std::tuple<int64_t, int64_t, int64_t> {40, 70, 3},
+              std::tuple<int64_t, int64_t, int64_t> {17, 90, 3},
+              std::tuple<int64_t, int64_t, int64_t> {17, 90, 4}}) {
+            CAPTURE(height, width, channels);
+            const Tensor image = random_image<uint8_t>(height, width, channels, height + width);
+            Tensor output;
+            REQUIRE(resizer.transform(image, output).is_ok());
+            Tensor expected;
+            REQUIRE(resize(to_planar<uint8_t>(image), expected, 33, 21, Interpolation::Bilinear)
+                        .is_ok());
+            REQUIRE_THAT(
+                testing::compare_tensors(to_planar<uint8_t>(output), expected),
+                testing::is_ok()
+            );
+        }
+    }
+
+    SECTION("Large RGB frames split across the workers") {
+        const Tensor image = random_image<uint8_t>(480, 640, 3, 30);
+        for (const auto interpolation : {Interpolation::Nearest, Interpolation::Bilinear}) {
+            CAPTURE(static_cast<int>(interpolation));
+            auto resizer = ImageResize::create(301, 211, interpolation).unwrap();
+            Tensor output;
+            REQUIRE(resizer.transform(image, output).is_ok());
+            Tensor expected;
+            REQUIRE(
+                resize(to_planar<uint8_t>(image), expected, 301, 211, interpolation).is_ok()
+            );
+            REQUIRE_THAT(
+                testing::compare_tensors(to_planar<uint8_t>(output), expected),
+                testing::is_ok()
+            );
+        }
+    }
+
+    SECTION("Should fail on a zero target size") {
+        REQUIRE(ImageResize::create(0, 10).is_error());
+        REQUIRE(ImageResize::create(10, 0).is_error());
+    }
+
+    SECTION("Should fail on unsupported images") {
+        auto resizer = ImageResize::create(8, 8).unwrap();
+        Tensor output;
+        const auto plane = Tensor::full(make_shape(8, 8), 1.0).unwrap();
+        REQUIRE(resizer.transform(plane, output) == P10Error::InvalidArgument);
+        const auto doubles =
+            Tensor::full(make_shape(8, 8, 3), 1.0, TensorOptions().dtype(Dtype::Float64)).unwrap();
+        REQUIRE(resizer.transform(doubles, output) == P10Error::InvalidArgument);
+        const auto empty =
+            Tensor::full(make_shape(8, 8, 0), 1.0, TensorOptions().dtype(Dtype::Uint8)).unwrap();
+        REQUIRE(resizer.transform(empty, output) == P10Error::InvalidArgument);
+    }
+}
+
 }  // namespace p10::op
@@ -0,0 +1,174 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <ptensor/op/fft.hpp>
+#include <ptensor/op/stft.hpp>
+#include <ptensor/op/window_function.hpp>
+#include <ptensor/tensor.hpp>
+#include <ptensor/testing/catch2_assertions.hpp>
+#include <ptensor/testing/compare_tensors.hpp>
+
+namespace p10::op {
+
+namespace {
+    Tensor random_signal(int64_t samples, uint64_t seed) {
+        return Tensor::from_random(
+                   make_shape(samples),
+                   std::mt19937_64(seed),
+                   TensorOptions().dtype(Dtype::Float32),
+                   -1.0,
+                   1.0
+        )
+            .unwrap();
+    }
+
+    // Samples [begin, end) of `signal` as a new 1D tensor.
+    Tensor slice(const Tensor& signal, int64_t begin, int64_t end) {
+        const auto values = signal.as_span1d<const float>().unwrap();
+        Tensor result = Tensor::empty(make_shape(end - begin), Dtype::Float32).unwrap();
+        std::copy(
+            values.begin() + begin,
+            values.begin() + end,
+            result.as_span1d<float>().unwrap().begin()
+        );
+        return result;
+    }
+
+    std::vector<float> to_vector(const Tensor& tensor) {
+        const auto values = tensor.as_span1d<const float>().unwrap();
+        return {values.begin(), values.end()};
+    }
+}  // namespace
+
+TEST_CASE("Op: STFT matches windowed frames through the FFT", "[tensorop][stft]") {
+    const StftOptions options(64, 16);
+    const Tensor signal = random_signal(300, 3);
+
+    auto stft = Stft::create(options).unwrap();
+    Tensor spectrum;
+    REQUIRE_THAT(stft.transform(signal, spectrum), testing::is_ok());
+    // (300 - 64) / 16 + 1 frames.
+    REQUIRE(spectrum.shape() == make_shape(15, 33, 2));
+
+    Tensor window;
+    REQUIRE_THAT(
+        WindowFunction::generate(WindowFunction::Hanning, 64, Dtype::Float32, window),
+        testing::is_ok()
+    );
+    Tensor frames = Tensor::empty(make_shape(15, 64), Dtype::Float32).unwrap();
+    const auto samples = signal.as_span1d<const float>().unwrap();
+    const auto weights = window.as_span1d<const float>().unwrap();
+    auto rows = frames.as_span1d<float>().unwrap();
+    for (int64_t frame = 0; frame < 15; ++frame) {
+        for (int64_t k = 0; k < 64; ++k) {
+            rows[(frame * 64) + k] = samples[(frame * 16) + k] * weights[k];
+        }
+    }
+    Tensor expected;
+    REQUIRE_THAT(Fft(FftOptions(Fft::ForwardReal)).transform(frames, expected), testing::is_ok());
+    REQUIRE_THAT(testing::compare_tensors(spectrum, expected), testing::is_ok());
+}
+
+TEST_CASE("Op: STFT streams chunks like one signal", "[tensorop][stft]") {
+    const StftOptions options(64, 16);
+    const Tensor signal = random_signal(512, 5);
+
+    auto whole = Stft::create(options).unwrap();
+    Tensor expected;
+    REQUIRE_THAT(whole.transform(signal, expected), testing::is_ok());
+
+    // Chunks shorter than a frame, not multiples of the hop.
+    auto streaming = Stft::create(options).unwrap();
+    std::vector<float> streamed;
+    int64_t frames = 0;
+    Tensor spectrum;
+    for (int64_t begin = 0; begin < 512; begin += 40) {
+        const Tensor chunk = slice(signal, begin, std::min<int64_t>(begin + 40, 512));
+        REQUIRE_THAT(streaming.transform(chunk, spectrum), testing::is_ok());
+        frames += spectrum.shape(0).unwrap();
+        const auto values = to_vector(spectrum);
+        streamed.insert(streamed.end(), values.begin(), values.end());
+    }
+    REQUIRE(frames == expected.shape(0).unwrap());
+    REQUIRE(streamed == to_vector(expected));
+}
+
+TEST_CASE("Op: ISTFT reconstructs the STFT input", "[tensorop][stft]") {
+    const auto [length, hop] = GENERATE(
+        std::pair {int64_t {64}, int64_t {16}},
+        std::pair {int64_t {50}, int64_t {25}},
+        std::pair {int64_t {30}, int64_t {7}}
+    );
+    const auto window = GENERATE(WindowFunction::Hanning, WindowFunction::Hamming);
+    CAPTURE(length, hop, window);
+    const auto options = StftOptions(length, hop).window(window);
+    const Tensor signal = random_signal(length + (hop * 20), 7);
+
+    auto stft = Stft::create(options).unwrap();
+    auto istft = Istft::create(options).unwrap();
+    std::vector<float> recovered;
+    Tensor spectrum;
+    Tensor chunk;
+    for (int64_t begin = 0; begin < signal.shape(0).unwrap(); begin += hop * 3) {
+        const int64_t end = std::min(begin + (hop * 3), signal.shape(0).unwrap());
+        REQUIRE_THAT(stft.transform(slice(signal, begin, end), spectrum), testing::is_ok());
+        REQUIRE_THAT(istft.transform(spectrum, chunk), testing::is_ok());
+        const auto values = to_vector(chunk);
+        recovered.insert(recovered.end(), values.begin(), values.end());
+    }
+    REQUIRE_THAT(istft.flush(chunk), testing::is_ok());
+    const auto tail = to_vector(chunk);
+    recovered.insert(recovered.end(), tail.begin(), tail.end());
+
+    const auto original = to_vector(signal);
+    REQUIRE(recovered.size() == original.size());
+    // The first Hanning sample has zero weight and cannot be recovered.
+    for (size_t i = 1; i < original.size() - 1; ++i) {
+        CAPTURE(i);
+        REQUIRE(std::abs(recovered[i] - original[i]) < 1e-5F);
+    }
+}
+
+TEST_CASE("Op: STFT errors", "[tensorop][stft]") {
+    REQUIRE(Stft::create(StftOptions(1, 1)).is_error());
+    REQUIRE(Stft::create(StftOptions(64, 0)).is_error());
+    REQUIRE(Istft::create(StftOptions(64, 65)).is_error());
+    REQUIRE(Stft::create(StftOptions(63, 16)).is_ok());
+    REQUIRE(Istft::create(StftOptions(63, 16)).is_error());
+
+    auto stft = Stft::create(StftOptions(64, 16)).unwrap();
+    auto istft = Istft::create(StftOptions(64, 16)).unwrap();
+    Tensor output;
+    REQUIRE_THAT(
+        stft.transform(Tensor::zeros(make_shape(2, 64), Dtype::Float32).unwrap(), output),
+        testing::is_error(P10Error::InvalidArgument)
+    );
+    REQUIRE_THAT(
+        stft.transform(Tensor::zeros(make_shape(64), Dtype::Float64).unwrap(), output),
+        testing::is_error(P10Error::InvalidArgument)
+    );
+    REQUIRE_THAT(
+        istft.transform(Tensor::zeros(make_shape(3, 32, 2), Dtype::Float32).unwrap(), output),
+        testing::is_error(P10Error::InvalidArgument)
+    );
+
+    // Too short for a frame: an empty spectrum, the samples kept.
+    REQUIRE_THAT(
+        stft.transform(Tensor::zeros(make_shape(63), Dtype::Float32).unwrap(), output),
+        testing::is_ok()
+    );
+    REQUIRE(output.shape() == make_shape(0, 33, 2));
+    REQUIRE_THAT(
+        stft.transform(Tensor::zeros(make_shape(1), Dtype::Float32).unwrap(), output),
+        testing::is_ok()
+    );
+    REQUIRE(output.shape() == make_shape(1, 33, 2));
+}
+
+}  // namespace p10::op
@@ -0,0 +1,45 @@
+#include <cstdint>
+#include <utility>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <ptensor/op/window_function.hpp>
+#include <ptensor/tensor.hpp>
+#include <ptensor/testing/catch2_assertions.hpp>
+#include <ptensor/testing/compare_tensors.hpp>
+
+namespace p10::op {
+
+TEST_CASE("Op: WindowFunction windows each row of [N, T]", "[tensorop][window]") {
+    // Non-square inputs: the window runs along the T samples of each of the N
+    // signals, not along N.
+    const auto [signals, samples] =
+        GENERATE(std::pair {int64_t {3}, int64_t {8}}, std::pair {int64_t {8}, int64_t {3}});
+    CAPTURE(signals, samples);
+    const Tensor input =
+        Tensor::from_range(make_shape(signals, samples), TensorOptions().dtype(Dtype::Float32))
+            .unwrap();
+
+    Tensor window;
+    REQUIRE_THAT(
+        WindowFunction::generate(WindowFunction::Hanning, samples, Dtype::Float32, window),
+        testing::is_ok()
+    );
+    Tensor expected = Tensor::empty(input.shape(), Dtype::Float32).unwrap();
+    const auto values = input.as_span1d<const float>().unwrap();
+    const auto weights = window.as_span1d<const float>().unwrap();
+    auto rows = expected.as_span1d<float>().unwrap();
+    for (int64_t signal = 0; signal < signals; ++signal) {
+        for (int64_t k = 0; k < samples; ++k) {
+            rows[(signal * samples) + k] = values[(signal * samples) + k] * weights[k];
+        }
+    }
+
+    WindowFunction hanning(WindowFunction::Hanning);
+    Tensor output;
+    REQUIRE_THAT(hanning.transform(input, output), testing::is_ok());
+    REQUIRE(output.shape() == input.shape());
+    REQUIRE_THAT(testing::compare_tensors(output, expected), testing::is_ok());
+}
+
+}  // namespace p10::op
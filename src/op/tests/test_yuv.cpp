@@ -0,0 +1,228 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <ptensor/op/image_layout.hpp>
+#include <ptensor/op/yuv.hpp>
+#include <ptensor/tensor.hpp>
+#include <ptensor/testing/catch2_assertions.hpp>
+#include <ptensor/testing/compare_tensors.hpp>
+#include <ptensor/testing/simd_tiers.hpp>
+
+namespace p10::op {
+
+namespace {
+    Shape frame_shape(YuvFormat format, int64_t height, int64_t width) {
+        if (format == YuvFormat::YUYV) {
+            return make_shape(height, width * 2);
+        }
+        return make_shape(height * 3 / 2, width);
+    }
+
+    Tensor random_frame(YuvFormat format, int64_t height, int64_t width, uint64_t seed) {
+        return Tensor::from_random(
+                   frame_shape(format, height, width),
+                   std::mt19937_64(seed),
+                   TensorOptions().dtype(Dtype::Uint8),
+                   0.0,
+                   255.0
+        )
+            .unwrap();
+    }
+
+    // Y, U and V of pixel (row, col).
+    std::array<int, 3> sample(
+        const uint8_t* data,
+        YuvFormat format,
+        int64_t height,
+        int64_t width,
+        int64_t row,
+        int64_t col
+    ) {
+        switch (format) {
+            case YuvFormat::NV12: {
+                const uint8_t* uv = data + (height * width) + ((row / 2) * width) + ((col / 2) * 2);
+                return {data[(row * width) + col], uv[0], uv[1]};
+            }
+            case YuvFormat::I420: {
+                const int64_t chroma = ((row / 2) * (width / 2)) + (col / 2);
+                const uint8_t* u = data + (height * width);
+                const uint8_t* v = u + ((height / 2) * (width / 2));
+                return {data[(row * width) + col], u[chroma], v[chroma]};
+            }
+            case YuvFormat::YUYV: {
+                const uint8_t* pair = data + (row * width * 2) + ((col / 2) * 4);
+                return {pair[(col % 2) * 2], pair[1], pair[3]};
+            }
+        }
+        return {};
+    }
+
+    // The conversion in double precision, rounded and clamped.
+    std::array<int, 3> exact_rgb(std::array<int, 3> yuv, const YuvOptions& options) {
+        const bool bt709 = options.matrix() == YuvMatrix::BT709;
+        const double kr = bt709 ? 0.2126 : 0.299;
+        const double kb = bt709 ? 0.0722 : 0.114;
+        const double kg = 1.0 - kr - kb;
+        const bool limited = options.range() == YuvRange::Limited;
+        const double y = (yuv[0] - (limited ? 16.0 : 0.0)) * (limited ? 255.0 / 219.0 : 1.0);
+        const double cb = (yuv[1] - 128.0) * (limited ? 255.0 / 224.0 : 1.0);
+        const double cr = (yuv[2] - 128.0) * (limited ? 255.0 / 224.0 : 1.0);
+        const std::array<double, 3> rgb {
+            y + (2.0 * (1.0 - kr) * cr),
+            y - (2.0 * kb * (1.0 - kb) / kg * cb) - (2.0 * kr * (1.0 - kr) / kg * cr),
+            y + (2.0 * (1.0 - kb) * cb),
+        };
+        std::array<int, 3> result {};
+        for (size_t c = 0; c < 3; ++c) {
+            result[c] = static_cast<int>(std::clamp(std::round(rgb[c]), 0.0, 255.0));
+        }
+        if (options.bgr()) {
+            std::swap(result[0], result[2]);
+        }
+        return result;
+    }
+}  // namespace
+
+TEST_CASE("Op: YUV to RGB is within 1 of the exact conversion", "[tensorop][yuv]") {
+    const auto format = GENERATE(YuvFormat::NV12, YuvFormat::I420, YuvFormat::YUYV);
+    const auto matrix = GENERATE(YuvMatrix::BT601, YuvMatrix::BT709);
+    const auto range = GENERATE(YuvRange::Limited, YuvRange::Full);
+    const bool bgr = GENERATE(false, true);
+    const int64_t width = GENERATE(2, 34, 70);
+    CAPTURE(format, matrix, range, bgr, width);
+
+    const int64_t height = 6;
+    const Tensor frame = random_frame(format, height, width, 5);
+    const auto options = YuvOptions(format).matrix(matrix).range(range).bgr(bgr);
+
+    Tensor rgb;
+    REQUIRE(yuv_to_rgb(frame, rgb, options) == P10Error::Ok);
+    REQUIRE(rgb.shape() == make_shape(height, width, 3));
+
+    const uint8_t* data = frame.as_span1d<const uint8_t>().unwrap().data();
+    const auto pixels = rgb.as_span1d<const uint8_t>().unwrap();
+    for (int64_t row = 0; row < height; ++row) {
+        for (int64_t col = 0; col < width; ++col) {
+            const auto expected =
+                exact_rgb(sample(data, format, height, width, row, col), options);
+            for (int64_t c = 0; c < 3; ++c) {
+                const int actual = pixels[(((row * width) + col) * 3) + c];
+                REQUIRE(std::abs(actual - expected[c]) <= 1);
+            }
+        }
+    }
+
+    REQUIRE_THAT(
+        testing::compare_simd_tiers([&](Tensor& tier_output) {
+            yuv_to_rgb(frame, tier_output, options).expect("yuv_to_rgb failed");
+        }),
+        testing::is_ok()
+    );
+}
+
+TEST_CASE("Op: YUV to RGB maps the range ends to black and white", "[tensorop][yuv]") {
+    const auto range = GENERATE(YuvRange::Limited, YuvRange::Full);
+    const bool limited = range == YuvRange::Limited;
+    Tensor frame = Tensor::zeros(make_shape(6, 4), Dtype::Uint8).unwrap();
+    auto bytes = frame.as_span1d<uint8_t>().unwrap();
+    std::fill(bytes.begin(), bytes.end(), uint8_t {128});
+    std::fill_n(bytes.begin(), 8, static_cast<uint8_t>(limited ? 16 : 0));
+    std::fill_n(bytes.begin() + 8, 8, static_cast<uint8_t>(limited ? 235 : 255));
+
+    Tensor rgb;
+    REQUIRE(yuv_to_rgb(frame, rgb, YuvOptions(YuvFormat::I420).range(range)) == P10Error::Ok);
+    const auto pixels = rgb.as_span1d<const uint8_t>().unwrap();
+    REQUIRE(std::all_of(pixels.begin(), pixels.begin() + 24, [](uint8_t v) { return v == 0; }));
+    REQUIRE(std::all_of(pixels.begin() + 24, pixels.end(), [](uint8_t v) { return v == 255; }));
+}
+
+TEST_CASE("Op: YUV to model input matches image_to_tensor", "[tensorop][yuv]") {
+    const auto format = GENERATE(YuvFormat::NV12, YuvFormat::I420, YuvFormat::YUYV);
+    const bool bgr = GENERATE(false, true);
+    CAPTURE(format, bgr);
+
+    // Large enough to be split over several workers.
+    const int64_t height = 360;
+    const int64_t width = 642;
+    const Tensor frame = random_frame(format, height, width, 9);
+    const auto yuv_options = YuvOptions(format).matrix(YuvMatrix::BT709).bgr(bgr);
+    const auto options = ImageToTensorOptions()
+                             .normalize(true)
+                             .mean({0.485f, 0.456f, 0.406f})
+                             .std({0.229f, 0.224f, 0.225f})
+                             .unsqueeze(true);
+
+    Tensor input;
+    REQUIRE(yuv_to_model_input(frame, input, yuv_options, options) == P10Error::Ok);
+    REQUIRE(input.shape() == make_shape(1, 3, height, width));
+
+    Tensor rgb;
+    Tensor expected;
+    REQUIRE(yuv_to_rgb(frame, rgb, yuv_options) == P10Error::Ok);
+    REQUIRE(image_to_tensor(rgb, expected, options) == P10Error::Ok);
+    REQUIRE_THAT(testing::compare_tensors(input, expected), testing::is_ok());
+
+    REQUIRE_THAT(
+        testing::compare_simd_tiers([&](Tensor& tier_output) {
+            yuv_to_model_input(frame, tier_output, yuv_options, options)
+                .expect("yuv_to_model_input failed");
+        }),
+        testing::is_ok()
+    );
+}
+
+TEST_CASE("Op: YUV conversion errors", "[tensorop][yuv]") {
+    Tensor output;
+
+    SECTION("Odd 4:2:0 sizes") {
+        const Tensor frame = Tensor::zeros(make_shape(6, 5), Dtype::Uint8).unwrap();
+        REQUIRE(yuv_to_rgb(frame, output) == P10Error::InvalidArgument);
+        const Tensor rows = Tensor::zeros(make_shape(7, 4), Dtype::Uint8).unwrap();
+        REQUIRE(yuv_to_rgb(rows, output) == P10Error::InvalidArgument);
+    }
+
+    SECTION("Odd YUYV rows") {
+        const Tensor frame = Tensor::zeros(make_shape(4, 6), Dtype::Uint8).unwrap();
+        REQUIRE(yuv_to_rgb(frame, output, YuvFormat::YUYV) == P10Error::InvalidArgument);
+    }
+
+    SECTION("Wrong dtype or rank") {
+        const Tensor floats = Tensor::zeros(make_shape(6, 4), Dtype::Float32).unwrap();
+        REQUIRE(yuv_to_rgb(floats, output) == P10Error::InvalidArgument);
+        const Tensor cube = Tensor::zeros(make_shape(6, 4, 1), Dtype::Uint8).unwrap();
+        REQUIRE(yuv_to_rgb(cube, output) == P10Error::InvalidArgument);
+    }
+
+    SECTION("Model input options") {
+        const Tensor frame = Tensor::zeros(make_shape(6, 4), Dtype::Uint8).unwrap();
+        REQUIRE(
+            yuv_to_model_input(
+                frame,
+                output,
+                YuvOptions(),
+                ImageToTensorOptions().target_dtype(Dtype::Float64)
+            )
+            == P10Error::InvalidArgument
+        );
+        REQUIRE(
+            yuv_to_model_input(frame, output, YuvOptions(), ImageToTensorOptions().mean({1.0f}))
+            == P10Error::InvalidArgument
+        );
+        REQUIRE(
+            yuv_to_model_input(
+                frame,
+                output,
+                YuvOptions(),
+                ImageToTensorOptions().std({1.0f, 0.0f, 1.0f})
+            )
+            == P10Error::InvalidArgument
+        );
+    }
+}
+
+}  // namespace p10::op
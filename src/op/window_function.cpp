@@ -7,6 +7,7 @@
 #include <ptensor/tensor.hpp>
 
 #include "elemwise.hpp"
+#include "elemwise.vec.hpp"
 
 namespace p10::op {
 WindowFunction::WindowFunction(Function func) : func_(func) {}
@@ -17,7 +18,7 @@ P10Error WindowFunction::transform(const Tensor& input, Tensor& output) {
     }
     P10_RETURN_IF_ERROR(output.create(input.shape(), input.dtype()));
 
-    P10_RETURN_IF_ERROR(generate_window(input.shape(0).unwrap(), input.dtype()));
+    P10_RETURN_IF_ERROR(generate_window(input.shape(1).unwrap(), input.dtype()));
 
     return input.dtype().match([&](auto scalar) -> P10Error {
         using scalar_t = decltype(scalar)::type;
@@ -32,13 +33,9 @@ P10Error WindowFunction::transform(const Tensor& input, Tensor& output) {
         for (int64_t signal_idx = 0; signal_idx < num_signals; ++signal_idx) {
             auto out_row = output_span[signal_idx].data();
             const auto in_row = input_span[signal_idx].data();
-            std::transform(
-                in_row,
-                in_row + num_samples,
-                window_span.begin(),
-                out_row,
-                std::multiplies<scalar_t>()
-            );
+            binary_elemwise(in_row, window_span.data(), out_row, num_samples, [](auto x, auto w) {
+                return x * w;
+            });
         }
         return P10Error::Ok;
     });
@@ -91,16 +88,21 @@ WindowFunction::transform_borders(const Tensor& input, Tensor& output, size_t bo
 P10Error WindowFunction::generate_window(size_t size, Dtype type) {
     if (!window_) {
         window_ = std::make_unique<Tensor>();
+    } else if (window_->dtype() == type && window_->size() == size && window_->dims() == 1) {
+        return P10Error::Ok;
     }
+    return generate(func_, size, type, *window_);
+}
 
-    P10_RETURN_IF_ERROR(window_->create(make_shape(size), type));
+P10Error WindowFunction::generate(Function func, size_t size, Dtype type, Tensor& output) {
+    P10_RETURN_IF_ERROR(output.create(make_shape(size), type));
 
-    window_->visit([&](auto out_span) {
+    output.visit([&](auto out_span) {
         using scalar_t = decltype(out_span)::value_type;
 
         for (size_t n = 0; n < size; ++n) {
             scalar_t value = scalar_t(1.0);
-            switch (func_) {
+            switch (func) {
                 case Function::Hanning:
                     value = static_cast<scalar_t>(
                         0.5 * (1.0 - std::cos((2.0 * std::numbers::pi * n) / (size - 1)))
@@ -114,6 +116,11 @@ P10Error WindowFunction::generate_window(size_t size, Dtype type) {
                 case Function::Identity:
                     value = static_cast<scalar_t>(1.0);
                     break;
+                case Function::PeriodicHanning:
+                    value = static_cast<scalar_t>(
+                        0.5 * (1.0 - std::cos((2.0 * std::numbers::pi * n) / size))
+                    );
+                    break;
             }
             out_span[n] = value;
         }
@@ -0,0 +1,375 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <p10_internal/simd/compiler.hpp>
+#include <p10_internal/simd/cpuid.hpp>
+#include <p10_internal/simd/parallel_for.hpp>
+#include <p10_internal/simd/vec.hpp>
+#include <ptensor/op/yuv.hpp>
+#include <ptensor/tensor.hpp>
+
+#include "image_layout.lines.hpp"
+
+#if PTENSOR_HAS_INTRINSICS_H
+    #include <immintrin.h>  // SSE4.1 intrinsics
+#endif
+#if PTENSOR_HAS_NEON
+    #include <arm_neon.h>
+#endif
+
+namespace p10::op {
+
+namespace {
+    // Fewest pixels a parallel conversion worker is handed; smaller frames
+    // run on the calling thread.
+    constexpr int64_t YUV_MIN_WORKER_PIXELS = 32 * 1024;
+
+    // Fractional bits of the fixed-point coefficients. The largest sum,
+    // 255 * 1.164 + 127 * 2.112 in Q16, stays far below 2^31.
+    constexpr int YUV_COEFF_BITS = 16;
+
+    // The conversion in fixed point:
+    //   R = ((Y - y_offset) * y_scale + r_v * V') >> 16
+    //   G = ((Y - y_offset) * y_scale + g_u * U' + g_v * V') >> 16
+    //   B = ((Y - y_offset) * y_scale + b_u * U') >> 16
+    // with U' = U - 128 and V' = V - 128; the luma term carries the rounding.
+    struct YuvCoefficients {
+        int32_t y_offset;
+        int32_t y_scale;
+        int32_t r_v;
+        int32_t g_u;
+        int32_t g_v;
+        int32_t b_u;
+    };
+
+    YuvCoefficients yuv_coefficients(YuvMatrix matrix, YuvRange range) {
+        const double kr = matrix == YuvMatrix::BT709 ? 0.2126 : 0.299;
+        const double kb = matrix == YuvMatrix::BT709 ? 0.0722 : 0.114;
+        const double kg = 1.0 - kr - kb;
+        const bool limited = range == YuvRange::Limited;
+        const double y_scale = limited ? 255.0 / 219.0 : 1.0;
+        const double c_scale = limited ? 255.0 / 224.0 : 1.0;
+        const auto fixed = [](double value) {
+            return static_cast<int32_t>(std::lround(value * (1 << YUV_COEFF_BITS)));
+        };
+        return {
+            .y_offset = limited ? 16 : 0,
+            .y_scale = fixed(y_scale),
+            .r_v = fixed(2.0 * (1.0 - kr) * c_scale),
+            .g_u = fixed(-2.0 * kb * (1.0 - kb) / kg * c_scale),
+            .g_v = fixed(-2.0 * kr * (1.0 - kr) / kg * c_scale),
+            .b_u = fixed(2.0 * (1.0 - kb) * c_scale),
+        };
+    }
+
+    // A validated frame: `height` x `width` pixels and where its planes start.
+    struct YuvFrame {
+        const uint8_t* data;
+        int64_t height;
+        int64_t width;
+        YuvFormat format;
+
+        // Luma rows that share one row of chroma samples.
+        int64_t rows_per_chroma() const {
+            return format == YuvFormat::YUYV ? 1 : 2;
+        }
+    };
+
+    P10Error make_frame(const Tensor& yuv, YuvFormat format, YuvFrame& frame) {
+        if (yuv.dtype() != Dtype::Uint8) {
+            return P10Error::InvalidArgument << "YUV frame must be of type UINT8.";
+        }
+        if (yuv.dims() != 2) {
+            return P10Error::InvalidArgument << "YUV frame must be a 2D tensor of bytes.";
+        }
+        if (!yuv.is_contiguous()) {
+            return P10Error::InvalidArgument << "YUV frame must be contiguous in memory.";
+        }
+        const int64_t rows = yuv.shape(0).unwrap();
+        const int64_t cols = yuv.shape(1).unwrap();
+        frame.data = yuv.as_span1d<const uint8_t>().unwrap().data();
+        frame.format = format;
+        if (format == YuvFormat::YUYV) {
+            frame.height = rows;
+            frame.width = cols / 2;
+            if (cols % 4 != 0) {
+                return P10Error::InvalidArgument << "YUYV rows must hold whole pixel pairs.";
+            }
+        } else {
+            frame.height = (rows / 3) * 2;
+            frame.width = cols;
+            if (rows % 3 != 0 || frame.width % 2 != 0) {
+                return P10Error::InvalidArgument
+                    << "4:2:0 frames must be [H * 3 / 2, W] with even H and W.";
+            }
+        }
+        if (frame.height == 0 || frame.width == 0) {
+            return P10Error::InvalidArgument << "YUV frame must not be empty.";
+        }
+        return P10Error::Ok;
+    }
+
+#if PTENSOR_HAS_INTRINSICS_H
+    PTENSOR_SSE41 int64_t duplicate_samples_sse41(const uint8_t* src, int64_t count, uint8_t* dst) {
+        int64_t i = 0;
+        for (; i + 16 <= count; i += 16) {
+            const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            _mm_storeu_si128(
+                reinterpret_cast<__m128i*>(dst + (2 * i)),
+                _mm_unpacklo_epi8(samples, samples)
+            );
+            _mm_storeu_si128(
+                reinterpret_cast<__m128i*>(dst + (2 * i) + 16),
+                _mm_unpackhi_epi8(samples, samples)
+            );
+        }
+        return i;
+    }
+#endif
+
+    // dst[2i] = dst[2i + 1] = src[i]: spreads a row of chroma samples over
+    // the two pixels each covers.
+    void duplicate_samples(const uint8_t* src, int64_t count, uint8_t* dst) {
+        int64_t i = 0;
+#if PTENSOR_HAS_INTRINSICS_H
+        if (simd::is_supported(simd::SimdSet::SSE41)) {
+            i = duplicate_samples_sse41(src, count, dst);
+        }
+#endif
+#if PTENSOR_HAS_NEON
+        if (simd::is_supported(simd::SimdSet::AdvSIMD)) {
+            for (; i + 16 <= count; i += 16) {
+                const uint8x16_t samples = vld1q_u8(src + i);
+                vst2q_u8(dst + (2 * i), uint8x16x2_t {{samples, samples}});
+            }
+        }
+#endif
+        for (; i < count; ++i) {
+            dst[2 * i] = src[i];
+            dst[(2 * i) + 1] = src[i];
+        }
+    }
+
+    // Chroma part of each channel for a row of per-pixel U and V samples.
+    template<simd::SimdSet S>
+    void chroma_terms(
+        const uint8_t* u,
+        const uint8_t* v,
+        int64_t count,
+        const YuvCoefficients& k,
+        int32_t* const* terms
+    ) {
+        using VI = simd::NativeVec<int32_t, S>;
+        constexpr auto LANES = static_cast<int64_t>(VI::LANES);
+        const VI bias = VI::broadcast(128);
+        int64_t x = 0;
+        for (; x + LANES <= count; x += LANES) {
+            const VI cb = VI::load_u8(u + x) - bias;
+            const VI cr = VI::load_u8(v + x) - bias;
+            (cr * VI::broadcast(k.r_v)).store(terms[0] + x);
+            ((cb * VI::broadcast(k.g_u)) + (cr * VI::broadcast(k.g_v))).store(terms[1] + x);
+            (cb * VI::broadcast(k.b_u)).store(terms[2] + x);
+        }
+        for (; x < count; ++x) {
+            const int32_t cb = u[x] - 128;
+            const int32_t cr = v[x] - 128;
+            terms[0][x] = cr * k.r_v;
+            terms[1][x] = (cb * k.g_u) + (cr * k.g_v);
+            terms[2][x] = cb * k.b_u;
+        }
+    }
+
+    // One row of R, G and B bytes from a luma row and its chroma terms.
+    template<simd::SimdSet S>
+    void luma_to_rgb(
+        const uint8_t* y,
+        int64_t count,
+        const YuvCoefficients& k,
+        const int32_t* const* terms,
+        uint8_t* const* rgb
+    ) {
+        using VI = simd::NativeVec<int32_t, S>;
+        constexpr auto LANES = static_cast<int64_t>(VI::LANES);
+        constexpr int32_t ROUND = 1 << (YUV_COEFF_BITS - 1);
+        int64_t x = 0;
+        for (; x + LANES <= count; x += LANES) {
+            const VI luma =
+                ((VI::load_u8(y + x) - VI::broadcast(k.y_offset)) * VI::broadcast(k.y_scale))
+                + VI::broadcast(ROUND);
+            for (int64_t c = 0; c < 3; ++c) {
+                (luma + VI::load(terms[c] + x))
+                    .template shift_right<YUV_COEFF_BITS>()
+                    .store_u8(rgb[c] + x);
+            }
+        }
+        for (; x < count; ++x) {
+            const int32_t luma = ((y[x] - k.y_offset) * k.y_scale) + ROUND;
+            for (int64_t c = 0; c < 3; ++c) {
+                const int32_t value = (luma + terms[c][x]) >> YUV_COEFF_BITS;
+                rgb[c][x] = static_cast<uint8_t>(std::clamp(value, 0, 255));
+            }
+        }
+    }
+
+    // Converts `frame` row by row over the parallel workers. Calls
+    // `emit(tier, row, planes)` with the row's three channel rows, in B, G,
+    // R order when `options.bgr()`.
+    template<typename Emit>
+    void convert_rows(const YuvFrame& frame, const YuvOptions& options, const Emit& emit) {
+        const YuvCoefficients k = yuv_coefficients(options.matrix(), options.range());
+        const int64_t height = frame.height;
+        const int64_t width = frame.width;
+        const int64_t chroma_width = width / 2;
+        const int64_t rows_per_chroma = frame.rows_per_chroma();
+        const int64_t chroma_rows = height / rows_per_chroma;
+        const uint8_t* luma_plane = frame.data;
+        const uint8_t* chroma_plane = frame.data + (height * width);
+
+        const int threads = simd::parallel_workers(height * width, YUV_MIN_WORKER_PIXELS);
+        simd::parallel_for(threads, threads, [&](int64_t job) {
+            const int64_t begin = (job * chroma_rows) / threads;
+            const int64_t end = ((job + 1) * chroma_rows) / threads;
+
+            // Packed luma and interleaved chroma (YUYV, NV12), the split
+            // chroma halves, their per-pixel copies and the channel rows.
+            std::vector<uint8_t> bytes(static_cast<size_t>(8 * width));
+            uint8_t* packed_luma = bytes.data();
+            uint8_t* pairs = bytes.data() + width;
+            std::array<uint8_t*, 2> halves {
+                bytes.data() + (2 * width),
+                bytes.data() + (2 * width) + chroma_width
+            };
+            const std::array<uint8_t*, 2> samples {
+                bytes.data() + (3 * width),
+                bytes.data() + (4 * width)
+            };
+            std::array<uint8_t*, 3> rgb {
+                bytes.data() + (5 * width),
+                bytes.data() + (6 * width),
+                bytes.data() + (7 * width)
+            };
+            std::vector<int32_t> terms_buffer(static_cast<size_t>(3 * width));
+            const std::array<int32_t*, 3> terms {
+                terms_buffer.data(),
+                terms_buffer.data() + width,
+                terms_buffer.data() + (2 * width)
+            };
+            const std::array<const uint8_t*, 3> planes =
+                options.bgr() ? std::array<const uint8_t*, 3> {rgb[2], rgb[1], rgb[0]}
+                              : std::array<const uint8_t*, 3> {rgb[0], rgb[1], rgb[2]};
+
+            simd::call_in_best_tier([&](auto tier) {
+                constexpr auto S = decltype(tier)::value;
+                for (int64_t chroma_row = begin; chroma_row < end; ++chroma_row) {
+                    const uint8_t* luma = nullptr;
+                    std::array<const uint8_t*, 2> chroma {halves[0], halves[1]};
+                    switch (frame.format) {
+                        case YuvFormat::NV12:
+                            deinterleave_row(
+                                chroma_plane + (chroma_row * width),
+                                chroma_width,
+                                2,
+                                halves.data()
+                            );
+                            break;
+                        case YuvFormat::I420: {
+                            const int64_t plane_size = (height / 2) * chroma_width;
+                            chroma[0] = chroma_plane + (chroma_row * chroma_width);
+                            chroma[1] = chroma[0] + plane_size;
+                            break;
+                        }
+                        case YuvFormat::YUYV: {
+                            std::array<uint8_t*, 2> split {packed_luma, pairs};
+                            deinterleave_row(
+                                frame.data + (chroma_row * 2 * width),
+                                width,
+                                2,
+                                split.data()
+                            );
+                            deinterleave_row(pairs, chroma_width, 2, halves.data());
+                            luma = packed_luma;
+                            break;
+                        }
+                    }
+                    duplicate_samples(chroma[0], chroma_width, samples[0]);
+                    duplicate_samples(chroma[1], chroma_width, samples[1]);
+                    chroma_terms<S>(samples[0], samples[1], width, k, terms.data());
+
+                    for (int64_t i = 0; i < rows_per_chroma; ++i) {
+                        const int64_t row = (chroma_row * rows_per_chroma) + i;
+                        luma_to_rgb<S>(
+                            luma != nullptr ? luma : luma_plane + (row * width),
+                            width,
+                            k,
+                            terms.data(),
+                            rgb.data()
+                        );
+                        emit(tier, row, planes.data());
+                    }
+                }
+            });
+        });
+    }
+}  // namespace
+
+P10Error yuv_to_rgb(const Tensor& yuv, Tensor& rgb, const YuvOptions& options) {
+    YuvFrame frame {};
+    P10_RETURN_IF_ERROR(make_frame(yuv, options.format(), frame));
+    P10_RETURN_IF_ERROR(rgb.create(make_shape(frame.height, frame.width, 3), Dtype::Uint8));
+
+    uint8_t* out = rgb.as_span1d<uint8_t>().unwrap().data();
+    const int64_t width = frame.width;
+    convert_rows(frame, options, [&](auto, int64_t row, const uint8_t* const* planes) {
+        interleave_row(planes, width, 3, out + (row * width * 3));
+    });
+    return P10Error::Ok;
+}
+
+P10Error yuv_to_model_input(
+    const Tensor& yuv,
+    Tensor& output,
+    const YuvOptions& yuv_options,
+    const ImageToTensorOptions& options
+) {
+    YuvFrame frame {};
+    P10_RETURN_IF_ERROR(make_frame(yuv, yuv_options.format(), frame));
+    if (options.target_dtype().value_or(Dtype::Float32) != Dtype::Float32) {
+        return P10Error::InvalidArgument << "Model input must be of type FLOAT32.";
+    }
+    ChannelAffine affine;
+    P10_RETURN_IF_ERROR(channel_affine(options.mean(), options.std(), 3, affine));
+    if (std::ranges::find(affine.std, 0.0f) != affine.std.end()) {
+        return P10Error::InvalidArgument << "Std entries must be non-zero.";
+    }
+
+    const int64_t height = frame.height;
+    const int64_t width = frame.width;
+    P10_RETURN_IF_ERROR(output.create(make_shape(3, height, width), Dtype::Float32));
+
+    float* out = output.as_span1d<float>().unwrap().data();
+    const bool normalize = options.normalize();
+    convert_rows(frame, yuv_options, [&](auto tier, int64_t row, const uint8_t* const* planes) {
+        constexpr auto S = decltype(tier)::value;
+        for (int64_t c = 0; c < 3; ++c) {
+            bytes_to_float<S>(
+                planes[c],
+                width,
+                normalize,
+                affine.enabled,
+                affine.mean[c],
+                affine.std[c],
+                out + (((c * height) + row) * width)
+            );
+        }
+    });
+
+    if (options.unsqueeze()) {
+        P10_RETURN_IF_ERROR(output.reshape(make_shape(int64_t {1}, int64_t {3}, height, width)));
+    }
+    return P10Error::Ok;
+}
+
+}  // namespace p10::op
@@ -4,8 +4,8 @@
 // LLDB debugger from VS Code, and when it self-traps at `debug_break()` every
 // tensor below is in scope. Use the "ptensor: View Tensor" command (or the
 // context-menu entry on a variable) to visualize any of them. Internally the
-// extension evaluates `p10::to_json_debug(<expr>)`, so anything reachable from
-// the stopped frame works.
+// extension evaluates `p10::to_json_preview_debug(<expr>, <budget>)`, so
+// anything reachable from the stopped frame works.
 //
 // The set of tensors mirrors `src/ptensor-vscode/src/sampleTensors.ts` so the
 // live path exercises the same panel branches the offline samples do: scalar,
@@ -170,10 +170,10 @@ int main() {
     Tensor large_1d = large_1d_f32();
 
     std::printf("ptensor viewer demo: %d tensors ready.\n", 11);
-    // Using the result of to_json_debug forces the linker to pull tensor_print.o
-    // out of the static ptensor lib, so the symbol exists in the binary and the
-    // debugger's expression evaluator can call p10::to_json_debug(<tensor>).
-    std::printf("scalar as json: %s\n", p10::to_json_debug(scalar));
+    // Using the result of to_json_preview_debug forces the linker to pull
+    // tensor_print.o out of the static ptensor lib, so the symbol exists in the
+    // binary and the debugger's expression evaluator can call it on any tensor.
+    std::printf("scalar as json: %s\n", p10::to_json_preview_debug(scalar, 0));
     std::printf("Stopping for the debugger; view a tensor with 'ptensor: View Tensor'.\n");
 
     // >>> Debugger stops here. All tensors above are live in this frame. <<<
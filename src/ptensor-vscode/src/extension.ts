@@ -1,5 +1,5 @@
 import * as vscode from 'vscode';
-import { readTensor } from './readTensor';
+import { readTensor, readTensorTile, TileRegion } from './readTensor';
 import { TensorPanel } from './tensorPanel';
 import { registerDebugTracker } from './debugTracker';
 
@@ -22,7 +22,12 @@ export function activate(context: vscode.ExtensionContext) {
                 const tensor = await loadTensor(expression);
                 // Re-read from the *current* frame each time (the user may have
                 // stepped since the panel opened).
-                TensorPanel.show(context, tensor, () => loadTensor(expression));
+                TensorPanel.show(
+                    context,
+                    tensor,
+                    () => loadTensor(expression),
+                    (region) => loadTensorTile(expression, region)
+                );
             } catch (err) {
                 const msg = err instanceof Error ? err.message : String(err);
                 vscode.window.showErrorMessage(`ptensor: ${msg}`);
@@ -33,6 +38,17 @@ export function activate(context: vscode.ExtensionContext) {
 
 /** Evaluates `expression` in the active debug session's current frame into a tensor. */
 async function loadTensor(expression: string) {
+    const { session, frameId } = await activeFrame();
+    return readTensor(session, frameId, expression);
+}
+
+/** Reads a full-resolution `region` of `expression` from the current frame. */
+async function loadTensorTile(expression: string, region: TileRegion) {
+    const { session, frameId } = await activeFrame();
+    return readTensorTile(session, frameId, expression, region);
+}
+
+async function activeFrame(): Promise<{ session: vscode.DebugSession; frameId: number }> {
     const session = vscode.debug.activeDebugSession;
     if (!session) {
         throw new Error('no active debug session.');
@@ -41,7 +57,7 @@ async function loadTensor(expression: string) {
     if (frameId === undefined) {
         throw new Error('could not determine the active stack frame.');
     }
-    return readTensor(session, frameId, expression);
+    return { session, frameId };
 }
 
 export function deactivate() {}
@@ -1,7 +1,7 @@
 import * as vscode from 'vscode';
 import { parseTensorJson, type TensorJson } from 'ptensor-ts';
 
-/** Dtype names emitted by `p10::to_json_debug` (mirror of the view DTypeString). */
+/** Dtype names emitted by `p10::to_json_preview_debug` (mirror of the view DTypeString). */
 const KNOWN_DTYPES = new Set([
   'float32', 'float64', 'float16', 'uint8', 'uint16',
   'uint32', 'int8', 'int16', 'int32', 'int64',
@@ -15,10 +15,10 @@ export interface NamedTensorJson {
 }
 
 const MISSING_HELPER_MESSAGE =
-  "the debugger can't find p10::to_json_debug — it isn't linked into the " +
+  "the debugger can't find p10::to_json_preview_debug — it isn't linked into the " +
   'debuggee. Reference it once in your program (e.g. call ' +
-  'p10::to_json_debug(some_tensor) so the linker keeps the symbol, then rebuild ' +
-  'and restart the debug session.';
+  'p10::to_json_preview_debug(some_tensor, 0) so the linker keeps the symbol, then ' +
+  'rebuild and restart the debug session.';
 
 /** Debugger phrasings for a failed name lookup (symbol/identifier not found). */
 function isLookupFailure(m: string): boolean {
@@ -35,14 +35,16 @@ function isLookupFailure(m: string): boolean {
 /**
  * Maps a raw debugger evaluate error into a friendlier explanation, or returns
  * undefined to let the generic message through. Handles three common cases:
- * the `to_json_debug` helper not being linked, the expression not being in
+ * the `to_json_preview_debug` helper not being linked, the expression not being in
  * scope, and a null / invalid dereference during evaluation.
  */
 function explainEvalError(message: string, expression: string): string | undefined {
   const m = message.toLowerCase();
 
-  // Helper symbol absent from the binary (references to_json_debug / p10).
-  if ((m.includes('to_json_debug') || m.includes("'p10'")) && isLookupFailure(m)) {
+  // Helper symbol absent from the binary (references a to_json_*_debug helper / p10).
+  const namesHelper =
+    m.includes('to_json_preview_debug') || m.includes('to_json_tile_debug') || m.includes("'p10'");
+  if (namesHelper && isLookupFailure(m)) {
     return MISSING_HELPER_MESSAGE;
   }
 
@@ -129,18 +131,20 @@ async function readCStringFromMemory(
   }
 }
 
-export async function readTensor(
+/**
+ * Evaluates a `p10::to_json_*_debug` `helper` call and parses the JSON it
+ * returns. `expression` is the user's tensor expression, for error messages.
+ */
+async function evaluateTensorJson(
   session: vscode.DebugSession,
   frameId: number,
-  expression: string
-): Promise<NamedTensorJson> {
-  const config = vscode.workspace.getConfiguration('ptensor');
-  const maxBytes = config.get<number>('maxBytes', 64 * 1024 * 1024);
-
+  expression: string,
+  helper: string
+): Promise<TensorJson> {
   let resp: { result?: unknown };
   try {
     resp = await session.customRequest('evaluate', {
-      expression: `p10::to_json_debug(${expression})`,
+      expression: helper,
       frameId,
       context: 'repl',
     });
@@ -149,7 +153,7 @@ export async function readTensor(
     throw new Error(explainEvalError(msg, expression) ?? `Failed to evaluate ${expression}: ${msg}`);
   }
   if (typeof resp?.result !== 'string') {
-    throw new Error(`evaluate returned no result for p10::to_json_debug(${expression}).`);
+    throw new Error(`evaluate returned no result for ${helper}.`);
   }
   // A null/empty helper result (e.g. the expression is a null pointer) yields no
   // JSON object; parseTensorJson would fail with a cryptic message otherwise.
@@ -171,6 +175,8 @@ export async function readTensor(
     throw new Error(`Unknown dtype '${json.dtype}' in tensor JSON.`);
   }
 
+  const config = vscode.workspace.getConfiguration('ptensor');
+  const maxBytes = config.get<number>('maxBytes', 64 * 1024 * 1024);
   const byteCount = Buffer.byteLength(json.blob, 'base64');
   if (byteCount === 0) {
     throw new Error('Tensor is empty (0 bytes).');
@@ -178,6 +184,44 @@ export async function readTensor(
   if (byteCount > maxBytes) {
     throw new Error(`Tensor is ${byteCount} bytes which exceeds ptensor.maxBytes=${maxBytes}.`);
   }
+  return json;
+}
 
-  return { name: expression, json };
+export async function readTensor(
+  session: vscode.DebugSession,
+  frameId: number,
+  expression: string
+): Promise<NamedTensorJson> {
+  const config = vscode.workspace.getConfiguration('ptensor');
+  const maxBytes = config.get<number>('maxBytes', 64 * 1024 * 1024);
+  // The debuggee downsamples anything over the budget, so large tensors cost a
+  // bounded read instead of stalling the debugger on the full blob.
+  const previewBytes = Math.min(config.get<number>('previewBytes', 4 * 1024 * 1024), maxBytes);
+  const helper = `p10::to_json_preview_debug(${expression}, ${Math.floor(previewBytes)})`;
+  return { name: expression, json: await evaluateTensorJson(session, frameId, expression, helper) };
+}
+
+/** A region of the image plane, in full-resolution rows and columns. */
+export interface TileRegion {
+  row: number;
+  col: number;
+  rows: number;
+  cols: number;
+}
+
+/**
+ * Reads a full-resolution `region` of the tensor's image plane with
+ * `p10::to_json_tile_debug`; the viewer asks for one when the user zooms into
+ * a downsampled preview. The region is clipped to the tensor by the debuggee.
+ */
+export async function readTensorTile(
+  session: vscode.DebugSession,
+  frameId: number,
+  expression: string,
+  region: TileRegion
+): Promise<NamedTensorJson> {
+  const { row, col, rows, cols } = region;
+  const args = [row, col, rows, cols].map((n) => Math.floor(n)).join(', ');
+  const helper = `p10::to_json_tile_debug(${expression}, ${args})`;
+  return { name: expression, json: await evaluateTensorJson(session, frameId, expression, helper) };
 }
@@ -1,7 +1,7 @@
 import * as fs from 'fs';
 import * as path from 'path';
 import * as vscode from 'vscode';
-import { NamedTensorJson } from './readTensor';
+import { NamedTensorJson, TileRegion } from './readTensor';
 
 /**
  * Hosts the tensor-view webview bundle (built from src/ptensor-view) and feeds
@@ -20,14 +20,23 @@ export class TensorPanel {
     private ready = false;
     // Re-reads the tensor from its source; undefined for demo (sample) panels.
     private refresh?: () => Promise<NamedTensorJson>;
+    // Reads a full-resolution region when the user zooms into a preview.
+    private loadTile?: (region: TileRegion) => Promise<NamedTensorJson>;
 
     /** Opens (or reuses) a tab to view a single tensor. */
     static show(
         context: vscode.ExtensionContext,
         tensor: NamedTensorJson,
-        refresh?: () => Promise<NamedTensorJson>
+        refresh?: () => Promise<NamedTensorJson>,
+        loadTile?: (region: TileRegion) => Promise<NamedTensorJson>
     ) {
-        TensorPanel.open(context, `Tensor: ${tensor.name}`, tensorMessage(tensor, !!refresh), refresh);
+        TensorPanel.open(
+            context,
+            `Tensor: ${tensor.name}`,
+            tensorMessage(tensor, !!refresh, !!loadTile),
+            refresh,
+            loadTile
+        );
     }
 
     /** Opens (or reuses) a tab in demo mode: the built-in sample tensors. */
@@ -39,12 +48,14 @@ export class TensorPanel {
         context: vscode.ExtensionContext,
         title: string,
         message: unknown,
-        refresh?: () => Promise<NamedTensorJson>
+        refresh?: () => Promise<NamedTensorJson>,
+        loadTile?: (region: TileRegion) => Promise<NamedTensorJson>
     ) {
         const column = vscode.window.activeTextEditor?.viewColumn ?? vscode.ViewColumn.Beside;
         const existing = TensorPanel.panels.get(title);
         if (existing) {
             existing.refresh = refresh;
+            existing.loadTile = loadTile;
             existing.panel.reveal(column);
             existing.update(title, message);
             return;
@@ -55,7 +66,10 @@ export class TensorPanel {
             column,
             { enableScripts: true, retainContextWhenHidden: true }
         );
-        TensorPanel.panels.set(title, new TensorPanel(context, panel, title, message, refresh));
+        TensorPanel.panels.set(
+            title,
+            new TensorPanel(context, panel, title, message, refresh, loadTile)
+        );
     }
 
     private constructor(
@@ -63,23 +77,27 @@ export class TensorPanel {
         panel: vscode.WebviewPanel,
         title: string,
         message: unknown,
-        refresh?: () => Promise<NamedTensorJson>
+        refresh?: () => Promise<NamedTensorJson>,
+        loadTile?: (region: TileRegion) => Promise<NamedTensorJson>
     ) {
         this.key = title;
         this.panel = panel;
         this.refresh = refresh;
+        this.loadTile = loadTile;
         // First paint is driven by the init message embedded in the HTML below,
         // so no pending message / handshake is needed to render initially.
         this.pending = undefined;
         this.panel.title = title;
         this.panel.onDidDispose(() => this.dispose(), null, this.disposables);
         this.panel.webview.onDidReceiveMessage(
-            (msg: { type?: string }) => {
+            (msg: { type?: string; region?: TileRegion }) => {
                 if (msg?.type === 'ready') {
                     this.ready = true;
                     this.flush();
                 } else if (msg?.type === 'refresh') {
                     void this.doRefresh();
+                } else if (msg?.type === 'tile' && msg.region) {
+                    void this.doLoadTile(msg.region);
                 }
             },
             null,
@@ -95,7 +113,24 @@ export class TensorPanel {
         }
         try {
             const tensor = await this.refresh();
-            this.update(`Tensor: ${tensor.name}`, tensorMessage(tensor, true));
+            this.update(`Tensor: ${tensor.name}`, tensorMessage(tensor, true, !!this.loadTile));
+        } catch (err) {
+            const msg = err instanceof Error ? err.message : String(err);
+            vscode.window.showErrorMessage(`ptensor: ${msg}`);
+        }
+    }
+
+    /**
+     * Reads a full-resolution tile and posts it straight to the webview. Tiles
+     * are only requested by a live webview, so they skip the pending queue.
+     */
+    private async doLoadTile(region: TileRegion) {
+        if (!this.loadTile) {
+            return;
+        }
+        try {
+            const tile = await this.loadTile(region);
+            void this.panel.webview.postMessage({ type: 'tile', tensor: tile.json });
         } catch (err) {
             const msg = err instanceof Error ? err.message : String(err);
             vscode.window.showErrorMessage(`ptensor: ${msg}`);
@@ -127,7 +162,6 @@ export class TensorPanel {
             this.disposables.pop()?.dispose();
         }
     }
-    }
 }
 
 /** Current table threshold setting, spread into outgoing messages. */
@@ -139,8 +173,15 @@ function threshold(): { tableThreshold: number } {
     };
 }
 
-function tensorMessage(tensor: NamedTensorJson, canRefresh: boolean) {
-    return { type: 'tensor', name: tensor.name, tensor: tensor.json, canRefresh, ...threshold() };
+function tensorMessage(tensor: NamedTensorJson, canRefresh: boolean, canZoom: boolean) {
+    return {
+        type: 'tensor',
+        name: tensor.name,
+        tensor: tensor.json,
+        canRefresh,
+        canZoom,
+        ...threshold(),
+    };
 }
 
 /**
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <optional>
+
+#include <ptensor/op/letterbox.hpp>
 #include <ptensor/p10_error.hpp>
 #include <ptensor/tensor.hpp>
 
@@ -12,6 +15,6 @@ class BfPreprocessing {
 
   private:
     size_t target_size_;
-    Tensor resize_buffer_;
+    std::optional<op::LetterboxPreprocess> letterbox_;
 };
 }  // namespace p10::recog
@@ -0,0 +1,317 @@
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+#include <p10_internal/simd/cpu_topology.hpp>
+
+namespace p10::simd {
+
+namespace {
+    // Cores within 10% of the fastest count as the fast class: favoured-core
+    // boost clocks differ by a few percent, efficiency cores by 25% or more.
+    constexpr int FAST_CLASS_PERCENT = 90;
+    constexpr int FULL_CAPACITY = 1024;
+
+    std::string read_line(const std::string& path) {
+        std::ifstream in(path);
+        std::string line;
+        std::getline(in, line);
+        return line;
+    }
+
+    long long read_number(const std::string& path, long long fallback) {
+        const std::string text = read_line(path);
+        long long value = 0;
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+        return error == std::errc() && end != text.data() ? value : fallback;
+    }
+
+    // sysfs cache sizes read "48K", "2048K" or "32M".
+    size_t parse_cache_size(const std::string& text) {
+        size_t value = 0;
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (error != std::errc()) {
+            return 0;
+        }
+        if (end != text.data() + text.size() && *end == 'M') {
+            return value * 1024 * 1024;
+        }
+        return value * 1024;
+    }
+
+    // Maps a sharing key (a sysfs CPU list) to a group index in first-seen
+    // order; finish_cpu_topology renumbers densely afterwards.
+    int group_of(std::map<std::string, int>& groups, const std::string& key) {
+        return groups.try_emplace(key, static_cast<int>(groups.size())).first->second;
+    }
+
+    // Renumbers `field` densely in order of first appearance.
+    template<typename Field>
+    size_t renumber(std::vector<CpuInfo>& cpus, Field field) {
+        std::map<int, int> dense;
+        for (auto& info : cpus) {
+            auto& value = info.*field;
+            value = dense.try_emplace(value, static_cast<int>(dense.size())).first->second;
+        }
+        return dense.size();
+    }
+
+    bool affinity_from_environment() {
+        const char* value = std::getenv("PTENSOR_AFFINITY");
+        if (value == nullptr) {
+            return false;
+        }
+        const std::string_view flag = value;
+        return flag == "1" || flag == "on" || flag == "true";
+    }
+
+    std::atomic<bool>& affinity_flag() {
+        static std::atomic<bool> enabled {affinity_from_environment()};
+        return enabled;
+    }
+}  // namespace
+
+const CpuInfo* CpuTopology::find(int cpu) const {
+    const auto found = std::find_if(cpus.begin(), cpus.end(), [cpu](const CpuInfo& info) {
+        return info.cpu == cpu;
+    });
+    return found == cpus.end() ? nullptr : &*found;
+}
+
+const CpuTopology& cpu_topology() {
+    static const CpuTopology TOPOLOGY = detail::detect_cpu_topology();
+    return TOPOLOGY;
+}
+
+std::vector<int> parse_cpu_list(std::string_view list) {
+    std::vector<int> cpus;
+    while (!list.empty() && (list.back() == '\n' || list.back() == ' ')) {
+        list.remove_suffix(1);
+    }
+    while (!list.empty()) {
+        const size_t comma = list.find(',');
+        const std::string_view range = list.substr(0, comma);
+        list = comma == std::string_view::npos ? std::string_view {} : list.substr(comma + 1);
+
+        int first = 0;
+        const char* end = range.data() + range.size();
+        const auto parsed = std::from_chars(range.data(), end, first);
+        if (parsed.ec != std::errc() || first < 0) {
+            return {};
+        }
+        int last = first;
+        if (parsed.ptr != end) {
+            if (*parsed.ptr != '-') {
+                return {};
+            }
+            const auto upper = std::from_chars(parsed.ptr + 1, end, last);
+            if (upper.ec != std::errc() || upper.ptr != end || last < first) {
+                return {};
+            }
+        }
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+CpuTopology read_sysfs_topology(const std::string& root) {
+    CpuTopology topology;
+    const std::vector<int> online = parse_cpu_list(read_line(root + "/online"));
+
+    std::map<std::string, int> cores;
+    std::map<std::string, int> l2_groups;
+    std::map<std::string, int> llc_groups;
+    std::vector<long long> raw_capacity;
+    long long max_capacity = 0;
+
+    for (const int cpu : online) {
+        const std::string dir = root + "/cpu" + std::to_string(cpu);
+        CpuInfo info;
+        info.cpu = cpu;
+        info.package =
+            static_cast<int>(std::max(0LL, read_number(dir + "/topology/physical_package_id", 0)));
+
+        std::string siblings = read_line(dir + "/topology/thread_siblings_list");
+        const std::vector<int> sibling_cpus = parse_cpu_list(siblings);
+        if (sibling_cpus.empty()) {
+            siblings = std::to_string(cpu);
+        } else {
+            const auto position = std::find(sibling_cpus.begin(), sibling_cpus.end(), cpu);
+            info.smt_index = static_cast<int>(position - sibling_cpus.begin());
+        }
+        info.core = group_of(cores, std::to_string(info.package) + ":" + siblings);
+
+        // Arm exposes a normalised capacity; hybrid x86 only differs in its
+        // maximum frequency, which is proportional enough to rank the cores.
+        long long capacity = read_number(dir + "/cpu_capacity", 0);
+        if (capacity <= 0) {
+            capacity = read_number(dir + "/cpufreq/cpuinfo_max_freq", 0);
+        }
+        raw_capacity.push_back(capacity);
+        max_capacity = std::max(max_capacity, capacity);
+
+        std::string l2_key = "cpu" + std::to_string(cpu);
+        std::string llc_key = l2_key;
+        long long llc_level = 0;
+        for (int index = 0;; ++index) {
+            const std::string cache = dir + "/cache/index" + std::to_string(index);
+            const long long level = read_number(cache + "/level", -1);
+            if (level < 0) {
+                break;
+            }
+            if (read_line(cache + "/type") == "Instruction") {
+                continue;
+            }
+            const size_t bytes = parse_cache_size(read_line(cache + "/size"));
+            std::string shared = read_line(cache + "/shared_cpu_list");
+            if (shared.empty()) {
+                shared = std::to_string(cpu);
+            }
+            if (level == 1) {
+                info.l1_bytes = bytes;
+            } else if (level == 2) {
+                info.l2_bytes = bytes;
+                l2_key = shared;
+            }
+            if (level >= 2 && level >= llc_level) {
+                llc_level = level;
+                info.llc_bytes = bytes;
+                llc_key = shared;
+            }
+        }
+        info.l2_group = group_of(l2_groups, l2_key);
+        info.llc_group = group_of(llc_groups, llc_key);
+        topology.cpus.push_back(info);
+    }
+
+    for (size_t i = 0; i < topology.cpus.size(); ++i) {
+        if (raw_capacity[i] > 0 && max_capacity > 0) {
+            topology.cpus[i].capacity =
+                static_cast<int>((raw_capacity[i] * FULL_CAPACITY) / max_capacity);
+        }
+    }
+    finish_cpu_topology(topology);
+    return topology;
+}
+
+CpuTopology flat_cpu_topology(size_t count) {
+    CpuTopology topology;
+    for (size_t i = 0; i < count; ++i) {
+        const int cpu = static_cast<int>(i);
+        topology.cpus.push_back(CpuInfo {.cpu = cpu, .core = cpu, .l2_group = cpu});
+    }
+    finish_cpu_topology(topology);
+    return topology;
+}
+
+void finish_cpu_topology(CpuTopology& topology) {
+    auto& cpus = topology.cpus;
+    std::sort(cpus.begin(), cpus.end(), [](const CpuInfo& a, const CpuInfo& b) {
+        return a.cpu < b.cpu;
+    });
+    topology.core_count = renumber(cpus, &CpuInfo::core);
+    (void)renumber(cpus, &CpuInfo::l2_group);
+    topology.llc_group_count = renumber(cpus, &CpuInfo::llc_group);
+
+    // One hardware thread per core: SMT siblings share the core's caches and
+    // execution units, so a second worker there only adds contention.
+    std::map<int, const CpuInfo*> first_thread;
+    int max_capacity = 0;
+    for (const auto& info : cpus) {
+        auto& slot = first_thread[info.core];
+        if (slot == nullptr || info.smt_index < slot->smt_index) {
+            slot = &info;
+        }
+        max_capacity = std::max(max_capacity, info.capacity);
+    }
+    std::vector<const CpuInfo*> workers;
+    for (const auto& [core, info] : first_thread) {
+        if (info->capacity * 100 >= max_capacity * FAST_CLASS_PERCENT) {
+            workers.push_back(info);
+        }
+    }
+    if (workers.size() < 2) {
+        // A single prime core would serialize the tiles; use every core.
+        workers.clear();
+        for (const auto& [core, info] : first_thread) {
+            workers.push_back(info);
+        }
+    }
+    // Static scheduling hands worker i the i-th contiguous run of tiles, so
+    // ordering workers by cache group keeps neighbouring tiles (and the halo
+    // rows they share) in one last-level cache.
+    std::stable_sort(workers.begin(), workers.end(), [](const CpuInfo* a, const CpuInfo* b) {
+        return a->llc_group < b->llc_group;
+    });
+    topology.worker_cpus.clear();
+    for (const CpuInfo* info : workers) {
+        topology.worker_cpus.push_back(info->cpu);
+    }
+}
+
+bool is_thread_affinity_enabled() {
+    return affinity_flag().load(std::memory_order_relaxed);
+}
+
+void set_thread_affinity(bool enabled) {
+    affinity_flag().store(enabled, std::memory_order_relaxed);
+}
+
+int parallel_thread_count() {
+#ifdef _OPENMP
+    const auto& workers = cpu_topology().worker_cpus;
+    if (is_thread_affinity_enabled() && !workers.empty()) {
+        // The caller's own thread plus one pinned thread per worker CPU.
+        return static_cast<int>(workers.size()) + 1;
+    }
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+int worker_cpu_for_slot(const std::vector<int>& workers, size_t slot) {
+    if (slot == 0 || slot > workers.size()) {
+        return -1;
+    }
+    return workers[slot - 1];
+}
+
+void pin_parallel_worker() {
+#ifdef _OPENMP
+    thread_local int pinned_cpu = -1;
+    if (!is_thread_affinity_enabled()) {
+        if (pinned_cpu >= 0 && unpin_current_thread()) {
+            pinned_cpu = -1;
+        }
+        return;
+    }
+    // Slot 0 is the caller's own thread: pinning it would leave the
+    // application thread on one CPU after the region, and every application
+    // thread calling ops on that CPU. It floats; slots 1.. take every worker
+    // CPU in order.
+    const int cpu = worker_cpu_for_slot(
+        cpu_topology().worker_cpus,
+        static_cast<size_t>(omp_get_thread_num())
+    );
+    if (cpu < 0 || pinned_cpu == cpu) {
+        return;
+    }
+    if (pin_current_thread(cpu)) {
+        pinned_cpu = cpu;
+    }
+#endif
+}
+
+}  // namespace p10::simd
@@ -0,0 +1,109 @@
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+
+#include <p10_internal/simd/cpuid.hpp>
+
+namespace p10::simd {
+
+namespace {
+    constexpr int NO_CAP = -1;
+
+    int tier(SimdSet set) {
+        switch (set) {
+            case SimdSet::NONE:
+                return 0;
+            case SimdSet::SSE41:
+            case SimdSet::AdvSIMD:
+            case SimdSet::WASM:
+                return 1;
+            case SimdSet::AVX2:
+                return 2;
+        }
+        return 0;
+    }
+
+    int cap_from_environment() {
+        // An unknown name leaves the dispatch uncapped rather than silently
+        // forcing the portable path. There is no logger this low, so say so
+        // on stderr; set_simd_max rejects the same name with an error.
+        const char* value = std::getenv("PTENSOR_SIMD_MAX");
+        if (value == nullptr || std::string_view(value) == "native") {
+            return NO_CAP;
+        }
+        const auto set = simd_set_from_name(value);
+        if (!set) {
+            (void)std::fprintf(
+                stderr,
+                "ptensor: ignoring unknown PTENSOR_SIMD_MAX '%s', expected portable, sse41, "
+                "avx2, neon, wasm or native\n",
+                value
+            );
+            return NO_CAP;
+        }
+        return static_cast<int>(*set);
+    }
+
+    std::atomic<int>& max_simd_value() {
+        static std::atomic<int> value {cap_from_environment()};
+        return value;
+    }
+}  // namespace
+
+bool is_supported(SimdSet set) {
+    const int cap = max_simd_value().load(std::memory_order_relaxed);
+    if (cap != NO_CAP && tier(set) > tier(static_cast<SimdSet>(cap))) {
+        return false;
+    }
+    return is_cpu_supported(set);
+}
+
+void set_max_simd(std::optional<SimdSet> set) {
+    max_simd_value().store(set ? static_cast<int>(*set) : NO_CAP, std::memory_order_relaxed);
+}
+
+std::optional<SimdSet> max_simd() {
+    const int cap = max_simd_value().load(std::memory_order_relaxed);
+    if (cap == NO_CAP) {
+        return std::nullopt;
+    }
+    return static_cast<SimdSet>(cap);
+}
+
+std::optional<SimdSet> simd_set_from_name(std::string_view name) {
+    if (name == "portable" || name == "none") {
+        return SimdSet::NONE;
+    }
+    if (name == "sse41") {
+        return SimdSet::SSE41;
+    }
+    if (name == "avx2") {
+        return SimdSet::AVX2;
+    }
+    if (name == "neon" || name == "advsimd") {
+        return SimdSet::AdvSIMD;
+    }
+    if (name == "wasm") {
+        return SimdSet::WASM;
+    }
+    return std::nullopt;
+}
+
+const char* simd_set_name(SimdSet set) {
+    switch (set) {
+        case SimdSet::NONE:
+            return "portable";
+        case SimdSet::SSE41:
+            return "sse41";
+        case SimdSet::AVX2:
+            return "avx2";
+        case SimdSet::AdvSIMD:
+            return "neon";
+        case SimdSet::WASM:
+            return "wasm";
+    }
+    return "portable";
+}
+
+}  // namespace p10::simd
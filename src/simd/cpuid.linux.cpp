@@ -1,21 +1,33 @@
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
+#include <thread>
+
+#include <pthread.h>
+#include <sched.h>
 
 #if defined(__aarch64__) && defined(__linux__)
     #include <asm/hwcap.h>
     #include <sys/auxv.h>
 #endif
 
+#include <p10_internal/simd/cpu_topology.hpp>
 #include <p10_internal/simd/cpuid.hpp>
 
 namespace p10::simd {
 
-bool is_supported(SimdSet set) {
+bool is_cpu_supported(SimdSet set) {
     static const bool AVX2 =
 #if defined(__x86_64__) || defined(__i386__)
         __builtin_cpu_supports("avx2");
 #else
         false;
+#endif
+    static const bool SSE41 =
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_cpu_supports("sse4.1");
+#else
+        false;
 #endif
     static const bool ADV_SIMD =
 #if defined(__aarch64__) && defined(__linux__)
@@ -26,6 +38,8 @@ bool is_supported(SimdSet set) {
     switch (set) {
         case SimdSet::AVX2:
             return AVX2;
+        case SimdSet::SSE41:
+            return SSE41;
         case SimdSet::WASM:
             return false;
         case SimdSet::AdvSIMD:
@@ -38,11 +52,31 @@ bool is_supported(SimdSet set) {
 
 namespace {
 
+    constexpr const char* SYSFS_CPU_ROOT = "/sys/devices/system/cpu";
+
+    // The thread's mask before pin_current_thread, restored by unpin.
+    thread_local cpu_set_t g_unpinned_mask;
+    thread_local bool g_has_unpinned_mask = false;
+
+    // Cache sizes come from the first worker CPU rather than cpu0: on hybrid
+    // parts cpu0 may be an efficiency core with a different L2.
+    int tile_cpu() {
+        const auto& workers = cpu_topology().worker_cpus;
+        return workers.empty() ? 0 : workers.front();
+    }
+
     size_t read_cache_size(int level) {
+        const int cpu = tile_cpu();
         char path[128];
         for (int i = 0; i < 8; i++) {
-            (void)
-                snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%d/level", i);
+            (void)snprintf(
+                path,
+                sizeof(path),
+                "%s/cpu%d/cache/index%d/level",
+                SYSFS_CPU_ROOT,
+                cpu,
+                i
+            );
             FILE* f = fopen(path, "r");
             if (f == nullptr) {
                 break;
@@ -54,8 +88,14 @@ namespace {
                 continue;
             }
 
-            (void)
-                snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%d/type", i);
+            (void)snprintf(
+                path,
+                sizeof(path),
+                "%s/cpu%d/cache/index%d/type",
+                SYSFS_CPU_ROOT,
+                cpu,
+                i
+            );
             f = fopen(path, "r");
             if (f == nullptr) {
                 continue;
@@ -67,8 +107,14 @@ namespace {
                 continue;
             }  // skip Instruction-only cache
 
-            (void)
-                snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%d/size", i);
+            (void)snprintf(
+                path,
+                sizeof(path),
+                "%s/cpu%d/cache/index%d/size",
+                SYSFS_CPU_ROOT,
+                cpu,
+                i
+            );
             f = fopen(path, "r");
             if (f == nullptr) {
                 continue;
@@ -100,6 +146,50 @@ namespace {
     }
 }  // namespace
 
+namespace detail {
+    CpuTopology detect_cpu_topology() {
+        CpuTopology topology = read_sysfs_topology(SYSFS_CPU_ROOT);
+        if (topology.cpus.empty()) {
+            return flat_cpu_topology(std::max(1U, std::thread::hardware_concurrency()));
+        }
+        // Drop CPUs outside the process mask (taskset, cgroup cpusets): pinning
+        // a worker there would fail.
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0) {
+            std::erase_if(topology.cpus, [&](const CpuInfo& info) {
+                return info.cpu >= CPU_SETSIZE || !CPU_ISSET(info.cpu, &allowed);
+            });
+            finish_cpu_topology(topology);
+        }
+        return topology;
+    }
+}  // namespace detail
+
+bool pin_current_thread(int cpu) {
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+        return false;
+    }
+    if (!g_has_unpinned_mask) {
+        if (pthread_getaffinity_np(pthread_self(), sizeof(g_unpinned_mask), &g_unpinned_mask)
+            != 0) {
+            return false;
+        }
+        g_has_unpinned_mask = true;
+    }
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    CPU_SET(cpu, &mask);
+    return pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask) == 0;
+}
+
+bool unpin_current_thread() {
+    if (!g_has_unpinned_mask) {
+        return true;
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(g_unpinned_mask), &g_unpinned_mask) == 0;
+}
+
 size_t l1_cache_size() {
     static const size_t L1 = detect_l1();
     return L1;
@@ -2,6 +2,10 @@
     #include <cpuid.h>
 #endif
 
+#include <algorithm>
+#include <thread>
+
+#include <p10_internal/simd/cpu_topology.hpp>
 #include <p10_internal/simd/cpuid.hpp>
 #include <sys/sysctl.h>
 
@@ -23,12 +27,18 @@ namespace {
     }
 }  // namespace
 
-bool is_supported(SimdSet set) {
+bool is_cpu_supported(SimdSet set) {
     static const bool AVX2 =
 #if defined(__x86_64__) || defined(__i386__)
         __builtin_cpu_supports("avx2");
 #else
         false;
+#endif
+    static const bool SSE41 =
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_cpu_supports("sse4.1");
+#else
+        false;
 #endif
     static const bool ADV_SIMD =
 #if defined(__aarch64__)
@@ -39,6 +49,8 @@ bool is_supported(SimdSet set) {
     switch (set) {
         case SimdSet::AVX2:
             return AVX2;
+        case SimdSet::SSE41:
+            return SSE41;
         case SimdSet::WASM:
             return false;
         case SimdSet::AdvSIMD:
@@ -64,4 +76,19 @@ size_t l3_cache_size() {
     return L3;
 }
 
+namespace detail {
+    CpuTopology detect_cpu_topology() {
+        return flat_cpu_topology(std::max(1U, std::thread::hardware_concurrency()));
+    }
+}  // namespace detail
+
+// macOS has no way to bind a thread to a core (only scheduling hints).
+bool pin_current_thread(int /*cpu*/) {
+    return false;
+}
+
+bool unpin_current_thread() {
+    return true;
+}
+
 }  // namespace p10::simd
@@ -1,8 +1,12 @@
+#include <algorithm>
+#include <thread>
+
+#include <p10_internal/simd/cpu_topology.hpp>
 #include <p10_internal/simd/cpuid.hpp>
 
 namespace p10::simd {
 
-bool is_supported(SimdSet set) {
+bool is_cpu_supported(SimdSet set) {
 #ifdef __wasm_simd128__
     if (set == SimdSet::WASM) {
         return true;
@@ -25,4 +29,18 @@ size_t l3_cache_size() {
     return 4 * 1024 * 1024;
 }  // 4 MB
 
+namespace detail {
+    CpuTopology detect_cpu_topology() {
+        return flat_cpu_topology(std::max(1U, std::thread::hardware_concurrency()));
+    }
+}  // namespace detail
+
+bool pin_current_thread(int /*cpu*/) {
+    return false;
+}
+
+bool unpin_current_thread() {
+    return true;
+}
+
 }  // namespace p10::simd
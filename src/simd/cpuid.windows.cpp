@@ -1,4 +1,7 @@
+#include <thread>
+
 #include <intrin.h>
+#include <p10_internal/simd/cpu_topology.hpp>
 #include <p10_internal/simd/cpuid.hpp>
 #include <windows.h>
 
@@ -15,6 +18,16 @@ namespace {
         return (cpu_info[1] & (1 << 5)) != 0;  // EBX bit 5 = AVX2
     }
 
+    bool detect_sse41() {
+        int cpu_info[4] = {};
+        __cpuid(cpu_info, 0);
+        if (cpu_info[0] < 1) {
+            return false;
+        }
+        __cpuid(cpu_info, 1);
+        return (cpu_info[2] & (1 << 19)) != 0;  // ECX bit 19 = SSE4.1
+    }
+
     bool detect_adv_simd() {
 #if defined(_M_ARM64)
         return IsProcessorFeaturePresent(PF_ARM_NEON_INSTRUCTIONS_AVAILABLE) != FALSE;
@@ -65,12 +78,15 @@ namespace {
     }
 }  // namespace
 
-bool is_supported(SimdSet set) {
+bool is_cpu_supported(SimdSet set) {
     static const bool AVX2 = detect_avx2();
+    static const bool SSE41 = detect_sse41();
     static const bool ADV_SIMD = detect_adv_simd();
     switch (set) {
         case SimdSet::AVX2:
             return AVX2;
+        case SimdSet::SSE41:
+            return SSE41;
         case SimdSet::WASM:
             return false;
         case SimdSet::AdvSIMD:
@@ -96,4 +112,39 @@ size_t l3_cache_size() {
     return L3;
 }
 
+namespace detail {
+    CpuTopology detect_cpu_topology() {
+        // windows.h defines a max() macro, so no std::max here.
+        const unsigned count = std::thread::hardware_concurrency();
+        return flat_cpu_topology(count == 0 ? 1 : count);
+    }
+}  // namespace detail
+
+namespace {
+    // The thread's mask before pin_current_thread, restored by unpin.
+    thread_local DWORD_PTR g_unpinned_mask = 0;
+}  // namespace
+
+bool pin_current_thread(int cpu) {
+    if (cpu < 0 || cpu >= static_cast<int>(sizeof(DWORD_PTR) * 8)) {
+        return false;  // beyond the first processor group
+    }
+    const DWORD_PTR previous =
+        SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR {1} << static_cast<unsigned>(cpu));
+    if (previous == 0) {
+        return false;
+    }
+    if (g_unpinned_mask == 0) {
+        g_unpinned_mask = previous;
+    }
+    return true;
+}
+
+bool unpin_current_thread() {
+    if (g_unpinned_mask == 0) {
+        return true;
+    }
+    return SetThreadAffinityMask(GetCurrentThread(), g_unpinned_mask) != 0;
+}
+
 }  // namespace p10::simd
@@ -8,6 +8,24 @@
     #define PTENSOR_AVX2
 #endif
 
+#if defined(_MSC_VER) && !defined(__clang__)
+    #define PTENSOR_SSE41
+#elif defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define PTENSOR_SSE41 __attribute__((target("sse4.1")))
+#else
+    #define PTENSOR_SSE41
+#endif
+
+// Inline every call (recursively) into the marked function. Lets a generic
+// kernel run inside a PTENSOR_AVX2/PTENSOR_SSE41 wrapper with all of its Vec
+// operations inlined under that target (see Tiered in vec.hpp). MSVC emits
+// intrinsics without target attributes, so it needs no equivalent.
+#if defined(_MSC_VER) && !defined(__clang__)
+    #define PTENSOR_FLATTEN
+#else
+    #define PTENSOR_FLATTEN __attribute__((flatten))
+#endif
+
 #if defined(_MSC_VER) \
     || ((defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)) \
         && (__has_include(<intrinsics.h>) || __has_include(<immintrin.h>)))
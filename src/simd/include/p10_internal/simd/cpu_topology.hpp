@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace p10::simd {
+
+/// One logical CPU (hardware thread) the process may run on.
+struct CpuInfo {
+    /// OS CPU number, as used by affinity masks.
+    int cpu = 0;
+    /// Physical core index, dense from 0; SMT siblings share it.
+    int core = 0;
+    /// Socket.
+    int package = 0;
+    /// Position among the core's SMT siblings, 0 for the first hardware thread.
+    int smt_index = 0;
+    /// Relative performance, 1024 for the fastest cores. Lower on the
+    /// efficiency cores of hybrid parts; 1024 everywhere when unknown.
+    int capacity = 1024;
+    /// Index of the group of CPUs sharing this CPU's L2, dense from 0.
+    int l2_group = 0;
+    /// Index of the group sharing this CPU's last-level cache (an L3 slice on
+    /// chiplet parts), dense from 0.
+    int llc_group = 0;
+    /// Data cache sizes in bytes, 0 when unknown.
+    size_t l1_bytes = 0;
+    size_t l2_bytes = 0;
+    size_t llc_bytes = 0;
+};
+
+struct CpuTopology {
+    /// Usable CPUs, ascending by `cpu`.
+    std::vector<CpuInfo> cpus;
+    /// CPUs parallel tiles pin their workers to, in worker order: one hardware
+    /// thread per core of the fastest class, grouped by last-level cache so
+    /// neighbouring workers (which get neighbouring tiles) share it.
+    std::vector<int> worker_cpus;
+    size_t core_count = 0;
+    size_t llc_group_count = 0;
+
+    /// The entry for OS CPU `cpu`, nullptr when it is not usable.
+    const CpuInfo* find(int cpu) const;
+};
+
+/// The topology of this machine, detected on first use: sysfs on Linux, one
+/// core per hardware thread (no SMT, hybrid or cache grouping) elsewhere.
+const CpuTopology& cpu_topology();
+
+/// Reads a Linux sysfs CPU tree rooted at `root` (normally
+/// "/sys/devices/system/cpu"). Returns an empty topology when `root` has no
+/// `online` list.
+CpuTopology read_sysfs_topology(const std::string& root);
+
+/// A topology of `count` single-threaded cores with no cache grouping.
+CpuTopology flat_cpu_topology(size_t count);
+
+/// Fills `core_count`, `llc_group_count` and `worker_cpus` from `cpus`.
+void finish_cpu_topology(CpuTopology& topology);
+
+/// Parses a sysfs CPU list such as "0-3,8,10-11". Returns an empty list for
+/// malformed input.
+std::vector<int> parse_cpu_list(std::string_view list);
+
+/// Whether parallel tiles pin their OpenMP workers to `worker_cpus`. Off by
+/// default; the `PTENSOR_AFFINITY` environment variable ("1", "on" or "true")
+/// turns it on. Turning it off releases pinned workers on their next parallel
+/// region.
+bool is_thread_affinity_enabled();
+void set_thread_affinity(bool enabled);
+
+/// Threads a parallel tile region runs on: with affinity on, the calling
+/// thread plus one per `worker_cpus` entry; the OpenMP default otherwise (1
+/// without OpenMP).
+int parallel_thread_count();
+
+/// The CPU OpenMP thread `slot` of a parallel region is pinned to: slot 0 is
+/// the calling thread and is not pinned (-1); slot k takes `workers[k - 1]`,
+/// so every worker CPU gets one thread. -1 past the end of `workers`.
+int worker_cpu_for_slot(const std::vector<int>& workers, size_t slot);
+
+/// Called by each worker at the start of a parallel tile region: pins it to
+/// `worker_cpu_for_slot` when affinity is on, or releases an earlier pin.
+/// Thread 0, the calling thread, keeps its own affinity and may share a CPU
+/// with a pinned worker.
+void pin_parallel_worker();
+
+/// Pins the calling thread to OS CPU `cpu`. False where unsupported (macOS,
+/// WebAssembly) or when the OS refuses.
+bool pin_current_thread(int cpu);
+
+/// Restores the calling thread's affinity from before `pin_current_thread`.
+bool unpin_current_thread();
+
+namespace detail {
+    /// Platform detection behind `cpu_topology`, in cpuid.<platform>.cpp.
+    CpuTopology detect_cpu_topology();
+}  // namespace detail
+
+}  // namespace p10::simd
@@ -2,12 +2,38 @@
 
 #include <cinttypes>
 #include <cstddef>
+#include <optional>
+#include <string_view>
 
 namespace p10::simd {
-enum class SimdSet : uint8_t { NONE = 0, AVX2 = 1, WASM = 2, AdvSIMD = 3 };
+/// Instruction sets a kernel can target. SSE41 is the x86 tier below AVX2
+/// (Atom/Celeron-class parts); values are stable, new sets are appended.
+enum class SimdSet : uint8_t { NONE = 0, AVX2 = 1, WASM = 2, AdvSIMD = 3, SSE41 = 4 };
 
+/// True when the running CPU implements `set`, from cached cpuid results.
+bool is_cpu_supported(SimdSet set);
+
+/// True when kernels may use `set`: the CPU implements it and it is not above
+/// the runtime cap (`set_max_simd`). Every dispatcher goes through this.
 bool is_supported(SimdSet set);
 
+/// Caps the instruction sets dispatchers may pick, so slower tiers can be
+/// tested and benchmarked on a machine that has faster ones. Sets are compared
+/// by tier: NONE < SSE41, AdvSIMD, WASM < AVX2. Defaults to the
+/// `PTENSOR_SIMD_MAX` environment variable (see `simd_set_from_name`), read on
+/// first use; `std::nullopt` removes the cap.
+void set_max_simd(std::optional<SimdSet> set);
+
+/// The current cap, or `std::nullopt` when uncapped.
+std::optional<SimdSet> max_simd();
+
+/// Parses a tier name: "portable" (or "none"), "sse41", "avx2", "neon" (or
+/// "advsimd") and "wasm". Returns `std::nullopt` for anything else.
+std::optional<SimdSet> simd_set_from_name(std::string_view name);
+
+/// Canonical name of `set`, as accepted by `simd_set_from_name`.
+const char* simd_set_name(SimdSet set);
+
 size_t l1_cache_size();
 size_t l2_cache_size();
 size_t l3_cache_size();
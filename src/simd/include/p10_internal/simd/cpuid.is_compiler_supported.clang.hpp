@@ -6,7 +6,7 @@ namespace p10::simd {
 
 constexpr bool is_compiler_supported(SimdSet set) {
 #if defined(__x86_64__) || defined(__i386__)
-    return set == SimdSet::AVX2 || set == SimdSet::NONE;
+    return set == SimdSet::AVX2 || set == SimdSet::SSE41 || set == SimdSet::NONE;
 #endif
 
 #ifdef __wasm_simd128__
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include "cpu_topology.hpp"
+
+namespace p10::simd {
+
+// Workers for `work` units (pixels, elements) when each worker should get at
+// least `min_work` of them: between 1 and parallel_thread_count().
+inline int parallel_workers(int64_t work, int64_t min_work) {
+    return static_cast<int>(std::clamp<int64_t>(work / min_work, 1, parallel_thread_count()));
+}
+
+// Runs fn(job) for every job in [0, jobs) on `threads` workers, pinned like
+// the tile workers. Static scheduling hands worker i the i-th contiguous run
+// of jobs. With one thread the jobs run in order on the caller. For kernels
+// whose work carries a dependency along rows or columns (scans, running sums,
+// recursive filters), which tile2d's independent tiles cannot express; the
+// jobs are then row bands or column strips.
+template<typename Fn>
+void parallel_for(int64_t jobs, int threads, const Fn& fn) {
+    if (threads <= 1) {
+        for (int64_t job = 0; job < jobs; ++job) {
+            fn(job);
+        }
+        return;
+    }
+#pragma omp parallel num_threads(threads)
+    {
+        pin_parallel_worker();
+#pragma omp for schedule(static)
+        for (int64_t job = 0; job < jobs; ++job) {
+            fn(job);
+        }
+    }
+}
+
+}  // namespace p10::simd
@@ -1,13 +1,18 @@
 #pragma once
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <concepts>
 #include <cstdint>
+#include <string_view>
 #include <utility>
 
 #include "bitwise_math.hpp"
+#include "cpu_topology.hpp"
 #include "cpuid.hpp"
+#include "tile_execution.hpp"
+#include "tile_tuning.hpp"
 
 namespace p10::simd {
 
@@ -17,21 +22,54 @@ struct TileRegion1D {
 };
 
 template<typename F>
-concept TileKernel1D = std::invocable<F, TileRegion1D>;
+concept TileKernel1DFn = std::invocable<F, TileRegion1D>;
 
-template<size_t CACHE_SIZE, size_t SIMD_SIZE, TileKernel1D SimdKn, TileKernel1D ScalarKn>
-void tile1d(int64_t size, SimdKn&& simd_impl, ScalarKn&& scalar_impl) {
+// Fewest elements a parallel worker is handed. Below twice this, a PARALLEL
+// tiling runs sequentially: waking the team costs more than a short buffer.
+inline constexpr int64_t TILE1D_MIN_GRAIN = 32 * 1024;
+
+template<
+    size_t CACHE_SIZE,
+    size_t SIMD_SIZE,
+    TileExecution ExecutionMode,
+    TileKernel1DFn SimdKn,
+    TileKernel1DFn ScalarKn>
+void tile1d_blocked(int64_t size, SimdKn&& simd_impl, ScalarKn&& scalar_impl) {
     static_assert(CACHE_SIZE % SIMD_SIZE == 0, "CACHE_SIZE must be a multiple of SIMD_SIZE");
 
     constexpr int64_t CACHE = CACHE_SIZE;
     constexpr int64_t SIMD = SIMD_SIZE;
     const int64_t tile_size = size - bitwise_modulo<SIMD_SIZE>(size);
+    const int64_t blocks = (tile_size + CACHE - 1) / CACHE;
 
     // Main: SIMD_SIZE chunks, grouped into CACHE_SIZE blocks for locality.
-    for (int64_t block = 0; block < tile_size; block += CACHE) {
+    const auto run_block = [&](int64_t block_index) {
+        const int64_t block = block_index * CACHE;
         const int64_t block_end = std::min(block + CACHE, tile_size);
         for (int64_t offset = block; offset < block_end; offset += SIMD) {
-            simd_impl({.offset = offset, .size = SIMD});
+            simd_impl(TileRegion1D {.offset = offset, .size = SIMD});
+        }
+    };
+
+    int threads = 1;
+    if constexpr (ExecutionMode == TileExecution::PARALLEL) {
+        threads = static_cast<int>(
+            std::min<int64_t>(parallel_thread_count(), tile_size / TILE1D_MIN_GRAIN)
+        );
+    }
+    if (threads > 1) {
+        // Static scheduling: worker i gets the i-th contiguous run of blocks.
+#pragma omp parallel num_threads(threads)
+        {
+            pin_parallel_worker();
+#pragma omp for schedule(static)
+            for (int64_t block_index = 0; block_index < blocks; ++block_index) {
+                run_block(block_index);
+            }
+        }
+    } else {
+        for (int64_t block_index = 0; block_index < blocks; ++block_index) {
+            run_block(block_index);
         }
     }
 
@@ -41,36 +79,39 @@ void tile1d(int64_t size, SimdKn&& simd_impl, ScalarKn&& scalar_impl) {
     }
 }
 
-template<size_t SIMD_SIZE, typename scalar_t, TileKernel1D SimdKn, TileKernel1D ScalarKn>
-void dynamic_tile1d(int64_t size, SimdKn&& simd_impl, ScalarKn&& scalar_impl) {
-    // Size the cache block so it stays in L1d (linear in 1D, hence L1 / element).
-    const size_t cache_elems = l1_cache_size() / sizeof(scalar_t);
-
-    if (size < static_cast<int64_t>(SIMD_SIZE)) {
-        std::forward<ScalarKn>(scalar_impl)({.offset = 0, .size = size});
-        return;
-    }
-
+// Run tile1d_blocked with the largest cache block of the ladder (8192 down to
+// 1024 elements) that fits `cache_elems`.
+template<
+    size_t SIMD_SIZE,
+    TileExecution ExecutionMode,
+    TileKernel1DFn SimdKn,
+    TileKernel1DFn ScalarKn>
+void tile1d_with_block(
+    int64_t cache_elems,
+    int64_t size,
+    SimdKn&& simd_impl,
+    ScalarKn&& scalar_impl
+) {
     if (cache_elems >= 8192) {
-        tile1d<8192, SIMD_SIZE>(
+        tile1d_blocked<8192, SIMD_SIZE, ExecutionMode>(
             size,
             std::forward<SimdKn>(simd_impl),
             std::forward<ScalarKn>(scalar_impl)
         );
     } else if (cache_elems >= 4096) {
-        tile1d<4096, SIMD_SIZE>(
+        tile1d_blocked<4096, SIMD_SIZE, ExecutionMode>(
             size,
             std::forward<SimdKn>(simd_impl),
             std::forward<ScalarKn>(scalar_impl)
         );
     } else if (cache_elems >= 2048) {
-        tile1d<2048, SIMD_SIZE>(
+        tile1d_blocked<2048, SIMD_SIZE, ExecutionMode>(
             size,
             std::forward<SimdKn>(simd_impl),
             std::forward<ScalarKn>(scalar_impl)
         );
     } else {
-        tile1d<1024, SIMD_SIZE>(
+        tile1d_blocked<1024, SIMD_SIZE, ExecutionMode>(
             size,
             std::forward<SimdKn>(simd_impl),
             std::forward<ScalarKn>(scalar_impl)
@@ -78,4 +119,281 @@ void dynamic_tile1d(int64_t size, SimdKn&& simd_impl, ScalarKn&& scalar_impl) {
     }
 }
 
+// Run a stored TileChoice (cache block and execution mode picked at runtime).
+template<size_t SIMD_SIZE, TileKernel1DFn SimdKn, TileKernel1DFn ScalarKn>
+void tile1d_with_choice(
+    TileChoice choice,
+    int64_t size,
+    SimdKn& simd_impl,
+    ScalarKn& scalar_impl
+) {
+    if (choice.execution == TileExecution::PARALLEL) {
+        tile1d_with_block<SIMD_SIZE, TileExecution::PARALLEL>(
+            choice.cache_block,
+            size,
+            simd_impl,
+            scalar_impl
+        );
+    } else {
+        tile1d_with_block<SIMD_SIZE, TileExecution::SEQUENTIAL>(
+            choice.cache_block,
+            size,
+            simd_impl,
+            scalar_impl
+        );
+    }
+}
+
+template<
+    size_t SIMD_SIZE,
+    typename scalar_t,
+    TileExecution ExecutionMode = TileExecution::SEQUENTIAL,
+    TileKernel1DFn SimdKn,
+    TileKernel1DFn ScalarKn>
+void dynamic_tile1d(int64_t size, SimdKn&& simd_impl, ScalarKn&& scalar_impl) {
+    // Size the cache block so it stays in L1d (linear in 1D, hence L1 / element).
+    const auto cache_elems = static_cast<int64_t>(l1_cache_size() / sizeof(scalar_t));
+
+    if (size < static_cast<int64_t>(SIMD_SIZE)) {
+        std::forward<ScalarKn>(scalar_impl)(TileRegion1D {.offset = 0, .size = size});
+        return;
+    }
+
+    tile1d_with_block<SIMD_SIZE, ExecutionMode>(
+        cache_elems,
+        size,
+        std::forward<SimdKn>(simd_impl),
+        std::forward<ScalarKn>(scalar_impl)
+    );
+}
+
+// dynamic_tile1d with a tuned cache block: uses the stored choice for `key`;
+// without one and with autotuning enabled, times every ladder size (and
+// parallel execution, when ExecutionMode allows it) once and records the
+// fastest. The kernels must be re-runnable.
+template<
+    size_t SIMD_SIZE,
+    typename scalar_t,
+    TileExecution ExecutionMode = TileExecution::SEQUENTIAL,
+    TileKernel1DFn SimdKn,
+    TileKernel1DFn ScalarKn>
+void tile1d_autotune(
+    const TileTuningKey& key,
+    int64_t size,
+    SimdKn&& simd_impl,
+    ScalarKn&& scalar_impl
+) {
+    if (size < static_cast<int64_t>(SIMD_SIZE)) {
+        scalar_impl(TileRegion1D {.offset = 0, .size = size});
+        return;
+    }
+
+    if (const auto choice = find_tile_choice(key)) {
+        tile1d_with_choice<SIMD_SIZE>(*choice, size, simd_impl, scalar_impl);
+        return;
+    }
+
+    const TileChoice fallback {
+        .cache_block = static_cast<int64_t>(l1_cache_size() / sizeof(scalar_t)),
+        .execution = ExecutionMode,
+    };
+    tile1d_with_choice<SIMD_SIZE>(fallback, size, simd_impl, scalar_impl);
+    if (!is_autotune_enabled()) {
+        return;
+    }
+
+    TileChoice best = fallback;
+    auto best_time = std::chrono::steady_clock::duration::max();
+    for (const int64_t elems : {1024, 2048, 4096, 8192}) {
+        for (const auto execution : {TileExecution::SEQUENTIAL, TileExecution::PARALLEL}) {
+            if (execution == TileExecution::PARALLEL
+                && ExecutionMode != TileExecution::PARALLEL) {
+                continue;
+            }
+            const TileChoice candidate {.cache_block = elems, .execution = execution};
+            const auto start = std::chrono::steady_clock::now();
+            tile1d_with_choice<SIMD_SIZE>(candidate, size, simd_impl, scalar_impl);
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed < best_time) {
+                best_time = elapsed;
+                best = candidate;
+            }
+        }
+    }
+    record_tile_choice(key, best);
+}
+
+// dynamic_tile1d with the cache block taken from the tuning cache under
+// `kernel_name` (see tile2d_tuned), for a single kernel without dispatch.
+// `instructions` is the tier the caller dispatched `simd_impl` to (e.g.
+// call_in_best_tier's), so each tier keeps its own choice.
+template<
+    size_t SIMD_SIZE,
+    typename scalar_t,
+    TileExecution ExecutionMode = TileExecution::SEQUENTIAL,
+    TileKernel1DFn SimdKn,
+    TileKernel1DFn ScalarKn>
+void dynamic_tile1d_tuned(
+    std::string_view kernel_name,
+    SimdSet instructions,
+    int64_t size,
+    SimdKn&& simd_impl,
+    ScalarKn&& scalar_impl
+) {
+    const TileTuningKey key {
+        .kernel = kernel_name,
+        .instructions = instructions,
+        .scalar_bytes = sizeof(scalar_t),
+        .rows_bucket = 0,
+        .cols_bucket = tile_shape_bucket(size),
+    };
+    tile1d_autotune<SIMD_SIZE, scalar_t, ExecutionMode>(
+        key,
+        size,
+        std::forward<SimdKn>(simd_impl),
+        std::forward<ScalarKn>(scalar_impl)
+    );
+}
+
+template<size_t SimdSize, SimdSet TargetInstructions, typename TargetType, TileKernel1DFn KernelFn>
+struct TileKernel1D {
+    static constexpr size_t SIMD_SIZE = SimdSize;
+    static constexpr SimdSet INSTRUCTIONS = TargetInstructions;
+    using TargetScalar = TargetType;
+    KernelFn fn;
+};
+
+template<typename T>
+concept TileKernelSpec1D = requires {
+    { T::SIMD_SIZE } -> std::convertible_to<size_t>;
+    { T::INSTRUCTIONS } -> std::convertible_to<SimdSet>;
+    typename T::TargetScalar;
+} && TileKernel1DFn<decltype(T::fn)>;
+
+namespace detail {
+    template<typename scalar_t, TileExecution ExecutionMode, TileKernel1DFn ScalarKn>
+    void tile1d_select(std::string_view tune_name, int64_t size, ScalarKn&& scalar_impl) {
+        (void)tune_name;
+        scalar_impl(TileRegion1D {.offset = 0, .size = size});
+    }
+
+    template<
+        typename scalar_t,
+        TileExecution ExecutionMode,
+        TileKernel1DFn ScalarKn,
+        TileKernelSpec1D CurrentKernel,
+        typename... Args>
+    void tile1d_select(
+        std::string_view tune_name,
+        int64_t size,
+        ScalarKn&& scalar_impl,
+        const CurrentKernel& current_kernel,
+        const Args&... kernels
+    ) {
+        if constexpr (
+            is_compiler_supported(CurrentKernel::INSTRUCTIONS)
+            && std::is_same_v<scalar_t, typename CurrentKernel::TargetScalar>
+        ) {
+            if (is_supported(CurrentKernel::INSTRUCTIONS)) {
+                if (!tune_name.empty()) {
+                    const TileTuningKey key {
+                        .kernel = tune_name,
+                        .instructions = CurrentKernel::INSTRUCTIONS,
+                        .scalar_bytes = sizeof(scalar_t),
+                        .rows_bucket = 0,
+                        .cols_bucket = tile_shape_bucket(size),
+                    };
+                    return tile1d_autotune<CurrentKernel::SIMD_SIZE, scalar_t, ExecutionMode>(
+                        key,
+                        size,
+                        current_kernel.fn,
+                        std::forward<ScalarKn>(scalar_impl)
+                    );
+                }
+                return dynamic_tile1d<CurrentKernel::SIMD_SIZE, scalar_t, ExecutionMode>(
+                    size,
+                    current_kernel.fn,
+                    std::forward<ScalarKn>(scalar_impl)
+                );
+            }
+        }
+
+        // Current kernel unusable (compiler can't emit it, or CPU lacks it):
+        // drop it and try the remaining kernels with the same scalar fallback.
+        return tile1d_select<scalar_t, ExecutionMode>(
+            tune_name,
+            size,
+            std::forward<ScalarKn>(scalar_impl),
+            kernels...
+        );
+    }
+}  // namespace detail
+
+// Run the first kernel spec the compiler and CPU support over whole
+// SIMD_SIZE chunks, and scalar_impl over the tail (or over everything when
+// none fits). PARALLEL splits the chunks across the workers once there are at
+// least two TILE1D_MIN_GRAIN runs of them.
+template<
+    typename scalar_t,
+    TileExecution ExecutionMode = TileExecution::SEQUENTIAL,
+    TileKernel1DFn ScalarKn,
+    typename... Kernels>
+void tile1d(int64_t size, ScalarKn&& scalar_impl, const Kernels&... kernels) {
+    detail::tile1d_select<scalar_t, ExecutionMode>(
+        {},
+        size,
+        std::forward<ScalarKn>(scalar_impl),
+        kernels...
+    );
+}
+
+// tile1d with the cache block taken from the tuning cache under
+// `kernel_name`; see tile2d_tuned.
+template<
+    typename scalar_t,
+    TileExecution ExecutionMode = TileExecution::SEQUENTIAL,
+    TileKernel1DFn ScalarKn,
+    typename... Kernels>
+void tile1d_tuned(
+    std::string_view kernel_name,
+    int64_t size,
+    ScalarKn&& scalar_impl,
+    const Kernels&... kernels
+) {
+    detail::tile1d_select<scalar_t, ExecutionMode>(
+        kernel_name,
+        size,
+        std::forward<ScalarKn>(scalar_impl),
+        kernels...
+    );
+}
+
+// Spec factories, named apart from the tile2d ones (Avx2, Portable, ...) so a
+// generic lambda never matches both.
+
+template<size_t SimdSize, typename Scalar, TileKernel1DFn Fn>
+constexpr TileKernel1D<SimdSize, SimdSet::AVX2, Scalar, Fn> Avx2_1D(Fn&& fn) {
+    return TileKernel1D<SimdSize, SimdSet::AVX2, Scalar, Fn>(fn);
+}
+
+template<size_t SimdSize, typename Scalar, TileKernel1DFn Fn>
+constexpr TileKernel1D<SimdSize, SimdSet::SSE41, Scalar, Fn> Sse41_1D(Fn&& fn) {
+    return TileKernel1D<SimdSize, SimdSet::SSE41, Scalar, Fn>(fn);
+}
+
+template<size_t SimdSize, typename Scalar, TileKernel1DFn Fn>
+constexpr TileKernel1D<SimdSize, SimdSet::AdvSIMD, Scalar, Fn> Neon_1D(Fn&& fn) {
+    return TileKernel1D<SimdSize, SimdSet::AdvSIMD, Scalar, Fn>(fn);
+}
+
+template<size_t SimdSize, typename Scalar, TileKernel1DFn Fn>
+constexpr TileKernel1D<SimdSize, SimdSet::WASM, Scalar, Fn> Wasm_1D(Fn&& fn) {
+    return TileKernel1D<SimdSize, SimdSet::WASM, Scalar, Fn>(fn);
+}
+
+template<size_t SimdSize, typename Scalar, TileKernel1DFn Fn>
+constexpr TileKernel1D<SimdSize, SimdSet::NONE, Scalar, Fn> Portable_1D(Fn&& fn) {
+    return TileKernel1D<SimdSize, SimdSet::NONE, Scalar, Fn>(fn);
+}
+
 }  // namespace p10::simd
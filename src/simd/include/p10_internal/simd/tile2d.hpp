@@ -1,16 +1,20 @@
 #pragma once
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <concepts>
 #include <cstdint>
+#include <string_view>
 #include <utility>
 
 #include <ptensor/region2d.hpp>
 
 #include "bitwise_math.hpp"
+#include "cpu_topology.hpp"
 #include "cpuid.hpp"
 #include "tile_execution.hpp"
+#include "tile_tuning.hpp"
 
 namespace p10::simd {
 
@@ -64,15 +68,29 @@ void tile2d_blocked(
     const int64_t col_end = col_begin + tiled_cols;  // first col past the SIMD area
 
     // Interior [row_begin, row_end) x [col_begin, col_end), in cache blocks that
-    // are further split into SIMD_BLOCK x SIMD_BLOCK tiles.
-#pragma omp parallel for collapse(2) schedule(static) if (ExecutionMode == TileExecution::PARALLEL)
-    for (int64_t block_row = row_begin; block_row < row_end; block_row += CACHE) {
-        for (int64_t block_col = col_begin; block_col < col_end; block_col += CACHE) {
-            for (int64_t simd_row = block_row; simd_row < block_row + CACHE; simd_row += SIMD) {
-                for (int64_t simd_col = block_col; simd_col < block_col + CACHE; simd_col += SIMD) {
-                    simd_impl(
-                        Region2D {.row = simd_row, .col = simd_col, .height = SIMD, .width = SIMD}
-                    );
+    // are further split into SIMD_BLOCK x SIMD_BLOCK tiles. Static scheduling
+    // gives worker i the i-th run of row-major blocks; with thread affinity on,
+    // worker i > 0 is pinned to cpu_topology().worker_cpus[i - 1], so
+    // neighbouring runs share a last-level cache.
+    constexpr bool IS_PARALLEL = ExecutionMode == TileExecution::PARALLEL;
+#pragma omp parallel num_threads(IS_PARALLEL ? parallel_thread_count() : 1) if (IS_PARALLEL)
+    {
+        if constexpr (IS_PARALLEL) {
+            pin_parallel_worker();
+        }
+#pragma omp for collapse(2) schedule(static)
+        for (int64_t block_row = row_begin; block_row < row_end; block_row += CACHE) {
+            for (int64_t block_col = col_begin; block_col < col_end; block_col += CACHE) {
+                for (int64_t simd_row = block_row; simd_row < block_row + CACHE; simd_row += SIMD) {
+                    for (int64_t simd_col = block_col; simd_col < block_col + CACHE;
+                         simd_col += SIMD) {
+                        simd_impl(Region2D {
+                            .row = simd_row,
+                            .col = simd_col,
+                            .height = SIMD,
+                            .width = SIMD
+                        });
+                    }
                 }
             }
         }
@@ -114,32 +132,23 @@ constexpr size_t floor_to_simd(size_t target) {
     return (blocks == 0 ? size_t {1} : blocks) * SIMD_BLOCK;
 }
 
+// Run tile2d_blocked with the largest cache tile of the ladder (1024 down to
+// 32 elements a side) that fits `cache_side`. The ladder turns the runtime
+// side into the CACHE_BLOCK template argument.
 template<
     size_t SIMD_BLOCK,
-    typename scalar_t,
-    TileExecution ExecutionMode = TileExecution::SEQUENTIAL,
+    TileExecution ExecutionMode,
     TileKernel2DFn SimdFn,
     TileKernel2DFn ScalarFn>
-void tile2d_autoblock(
+void tile2d_with_block(
+    int64_t cache_side,
     int64_t rows,
     int64_t cols,
     TileBorder border,
     SimdFn&& simd_impl,
     ScalarFn&& scalar_impl
 ) {
-    // Side of a square cache tile, in elements: ~sqrt(L1) bytes / element size,
-    // so the working set stays in L1d (the src and dst tiles share L1).
-    const int64_t l1_tile_side =
-        static_cast<int64_t>(std::sqrt(l1_cache_size())) / static_cast<int64_t>(sizeof(scalar_t));
-
-    if (std::max(rows, cols) < l1_tile_side) {
-        std::forward<ScalarFn>(scalar_impl)(
-            Region2D {.row = 0, .col = 0, .height = rows, .width = cols}
-        );
-        return;
-    }
-
-    if (l1_tile_side >= 1024) {
+    if (cache_side >= 1024) {
         tile2d_blocked<floor_to_simd<SIMD_BLOCK>(1024), SIMD_BLOCK, ExecutionMode>(
             rows,
             cols,
@@ -147,7 +156,7 @@ void tile2d_autoblock(
             std::forward<SimdFn>(simd_impl),
             std::forward<ScalarFn>(scalar_impl)
         );
-    } else if (l1_tile_side >= 512) {
+    } else if (cache_side >= 512) {
         tile2d_blocked<floor_to_simd<SIMD_BLOCK>(512), SIMD_BLOCK, ExecutionMode>(
             rows,
             cols,
@@ -155,7 +164,7 @@ void tile2d_autoblock(
             std::forward<SimdFn>(simd_impl),
             std::forward<ScalarFn>(scalar_impl)
         );
-    } else if (l1_tile_side >= 256) {
+    } else if (cache_side >= 256) {
         tile2d_blocked<floor_to_simd<SIMD_BLOCK>(256), SIMD_BLOCK, ExecutionMode>(
             rows,
             cols,
@@ -163,7 +172,7 @@ void tile2d_autoblock(
             std::forward<SimdFn>(simd_impl),
             std::forward<ScalarFn>(scalar_impl)
         );
-    } else if (l1_tile_side >= 128) {
+    } else if (cache_side >= 128) {
         tile2d_blocked<floor_to_simd<SIMD_BLOCK>(128), SIMD_BLOCK, ExecutionMode>(
             rows,
             cols,
@@ -171,7 +180,7 @@ void tile2d_autoblock(
             std::forward<SimdFn>(simd_impl),
             std::forward<ScalarFn>(scalar_impl)
         );
-    } else if (l1_tile_side >= 64) {
+    } else if (cache_side >= 64) {
         tile2d_blocked<floor_to_simd<SIMD_BLOCK>(64), SIMD_BLOCK, ExecutionMode>(
             rows,
             cols,
@@ -190,6 +199,135 @@ void tile2d_autoblock(
     }
 }
 
+// Side of a square cache tile, in elements: ~sqrt(L1) bytes / element size,
+// so the working set stays in L1d (the src and dst tiles share L1).
+template<typename scalar_t>
+int64_t l1_tile_side() {
+    return static_cast<int64_t>(std::sqrt(l1_cache_size()))
+        / static_cast<int64_t>(sizeof(scalar_t));
+}
+
+template<
+    size_t SIMD_BLOCK,
+    typename scalar_t,
+    TileExecution ExecutionMode = TileExecution::SEQUENTIAL,
+    TileKernel2DFn SimdFn,
+    TileKernel2DFn ScalarFn>
+void tile2d_autoblock(
+    int64_t rows,
+    int64_t cols,
+    TileBorder border,
+    SimdFn&& simd_impl,
+    ScalarFn&& scalar_impl
+) {
+    const int64_t cache_side = l1_tile_side<scalar_t>();
+
+    if (std::max(rows, cols) < cache_side) {
+        std::forward<ScalarFn>(scalar_impl)(
+            Region2D {.row = 0, .col = 0, .height = rows, .width = cols}
+        );
+        return;
+    }
+
+    tile2d_with_block<SIMD_BLOCK, ExecutionMode>(
+        cache_side,
+        rows,
+        cols,
+        border,
+        std::forward<SimdFn>(simd_impl),
+        std::forward<ScalarFn>(scalar_impl)
+    );
+}
+
+// Run a stored TileChoice (cache side and execution mode picked at runtime).
+template<size_t SIMD_BLOCK, TileKernel2DFn SimdFn, TileKernel2DFn ScalarFn>
+void tile2d_with_choice(
+    TileChoice choice,
+    int64_t rows,
+    int64_t cols,
+    TileBorder border,
+    SimdFn& simd_impl,
+    ScalarFn& scalar_impl
+) {
+    if (choice.execution == TileExecution::PARALLEL) {
+        tile2d_with_block<SIMD_BLOCK, TileExecution::PARALLEL>(
+            choice.cache_block,
+            rows,
+            cols,
+            border,
+            simd_impl,
+            scalar_impl
+        );
+    } else {
+        tile2d_with_block<SIMD_BLOCK, TileExecution::SEQUENTIAL>(
+            choice.cache_block,
+            rows,
+            cols,
+            border,
+            simd_impl,
+            scalar_impl
+        );
+    }
+}
+
+// tile2d_autoblock with a tuned cache tile: uses the stored choice for `key`;
+// without one and with autotuning enabled, times every ladder size (and
+// parallel execution, when ExecutionMode allows it) once, keeps the fastest
+// and records it. Every timed run is a complete tiling, so the kernels must be
+// re-runnable (outputs computed from inputs only, not updated in place).
+template<
+    size_t SIMD_BLOCK,
+    typename scalar_t,
+    TileExecution ExecutionMode = TileExecution::SEQUENTIAL,
+    TileKernel2DFn SimdFn,
+    TileKernel2DFn ScalarFn>
+void tile2d_autotune(
+    const TileTuningKey& key,
+    int64_t rows,
+    int64_t cols,
+    TileBorder border,
+    SimdFn&& simd_impl,
+    ScalarFn&& scalar_impl
+) {
+    const int64_t default_side = l1_tile_side<scalar_t>();
+    if (std::max(rows, cols) < default_side) {
+        scalar_impl(Region2D {.row = 0, .col = 0, .height = rows, .width = cols});
+        return;
+    }
+
+    if (const auto choice = find_tile_choice(key)) {
+        tile2d_with_choice<SIMD_BLOCK>(*choice, rows, cols, border, simd_impl, scalar_impl);
+        return;
+    }
+
+    const TileChoice fallback {.cache_block = default_side, .execution = ExecutionMode};
+    // Untuned, or the warm-up run of the tuner (first touch of the output).
+    tile2d_with_choice<SIMD_BLOCK>(fallback, rows, cols, border, simd_impl, scalar_impl);
+    if (!is_autotune_enabled()) {
+        return;
+    }
+
+    TileChoice best = fallback;
+    auto best_time = std::chrono::steady_clock::duration::max();
+    for (const int64_t side : {32, 64, 128, 256, 512, 1024}) {
+        for (const auto execution : {TileExecution::SEQUENTIAL, TileExecution::PARALLEL}) {
+            if (execution == TileExecution::PARALLEL
+                && ExecutionMode != TileExecution::PARALLEL) {
+                continue;
+            }
+            const TileChoice candidate {.cache_block = side, .execution = execution};
+            const auto start = std::chrono::steady_clock::now();
+            tile2d_with_choice<SIMD_BLOCK>(candidate, rows, cols, border, simd_impl, scalar_impl);
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed < best_time) {
+                best_time = elapsed;
+                best = candidate;
+            }
+        }
+    }
+    record_tile_choice(key, best);
+}
+
 template<size_t SimdBlock, SimdSet TargetInstructions, typename TargetType, TileKernel2DFn KernelFn>
 struct TileKernel2D {
     static constexpr size_t SIMD_BLOCK = SimdBlock;
@@ -205,47 +343,123 @@ concept TileKernelSpec2D = requires {
     typename T::TargetScalar;
 } && TileKernel2DFn<decltype(T::fn)>;
 
+namespace detail {
+    template<typename scalar_t, TileExecution ExecutionMode, TileKernel2DFn ScalarKn>
+    void tile2d_select(
+        std::string_view tune_name,
+        int64_t rows,
+        int64_t cols,
+        TileBorder border,
+        ScalarKn&& scalar_impl
+    ) {
+        (void)tune_name;
+        (void)border;
+        scalar_impl(Region2D {.row = 0, .col = 0, .height = rows, .width = cols});
+    }
+
+    template<
+        typename scalar_t,
+        TileExecution ExecutionMode,
+        TileKernel2DFn ScalarKn,
+        TileKernelSpec2D CurrentKernel,
+        typename... Args>
+    void tile2d_select(
+        std::string_view tune_name,
+        int64_t rows,
+        int64_t cols,
+        TileBorder border,
+        ScalarKn&& scalar_impl,
+        const CurrentKernel& current_kernel,
+        const Args&... kernels
+    ) {
+        if constexpr (
+            is_compiler_supported(CurrentKernel::INSTRUCTIONS)
+            && std::is_same_v<scalar_t, typename CurrentKernel::TargetScalar>
+        ) {
+            if (is_supported(CurrentKernel::INSTRUCTIONS)) {
+                if (!tune_name.empty()) {
+                    const TileTuningKey key {
+                        .kernel = tune_name,
+                        .instructions = CurrentKernel::INSTRUCTIONS,
+                        .scalar_bytes = sizeof(scalar_t),
+                        .rows_bucket = tile_shape_bucket(rows),
+                        .cols_bucket = tile_shape_bucket(cols),
+                    };
+                    return tile2d_autotune<CurrentKernel::SIMD_BLOCK, scalar_t, ExecutionMode>(
+                        key,
+                        rows,
+                        cols,
+                        border,
+                        current_kernel.fn,
+                        std::forward<ScalarKn>(scalar_impl)
+                    );
+                }
+                return tile2d_autoblock<CurrentKernel::SIMD_BLOCK, scalar_t, ExecutionMode>(
+                    rows,
+                    cols,
+                    border,
+                    current_kernel.fn,
+                    std::forward<ScalarKn>(scalar_impl)
+                );
+            }
+        }
+
+        // Current kernel unusable (compiler can't emit it, or CPU lacks it):
+        // drop it and try the remaining kernels with the same scalar fallback.
+        return tile2d_select<scalar_t, ExecutionMode>(
+            tune_name,
+            rows,
+            cols,
+            border,
+            std::forward<ScalarKn>(scalar_impl),
+            kernels...
+        );
+    }
+}  // namespace detail
+
+// Run the first kernel spec the compiler and CPU support over the interior
+// tiles, and scalar_impl over the edges (or over everything when none fits).
 template<
     typename scalar_t,
     TileExecution ExecutionMode = TileExecution::SEQUENTIAL,
-    TileKernel2DFn ScalarKn>
-void tile2d(int64_t rows, int64_t cols, TileBorder border, ScalarKn&& scalar_impl) {
-    (void)border;
-    scalar_impl(Region2D {.row = 0, .col = 0, .height = rows, .width = cols});
+    TileKernel2DFn ScalarKn,
+    typename... Kernels>
+void tile2d(
+    int64_t rows,
+    int64_t cols,
+    TileBorder border,
+    ScalarKn&& scalar_impl,
+    const Kernels&... kernels
+) {
+    detail::tile2d_select<scalar_t, ExecutionMode>(
+        {},
+        rows,
+        cols,
+        border,
+        std::forward<ScalarKn>(scalar_impl),
+        kernels...
+    );
 }
 
+// tile2d with the cache tile taken from the tuning cache (see tile_tuning.hpp)
+// under `kernel_name`, a stable identifier without spaces. Autotuning, when
+// enabled, runs the kernels several times on the first call per shape bucket,
+// so they must be re-runnable; see tile2d_autotune.
 template<
     typename scalar_t,
     TileExecution ExecutionMode = TileExecution::SEQUENTIAL,
     TileKernel2DFn ScalarKn,
-    TileKernelSpec2D CurrentKernel,
-    typename... Args>
-void tile2d(
+    typename... Kernels>
+void tile2d_tuned(
+    std::string_view kernel_name,
     int64_t rows,
     int64_t cols,
     TileBorder border,
     ScalarKn&& scalar_impl,
-    const CurrentKernel& current_kernel,
-    const Args&... kernels
+    const Kernels&... kernels
 ) {
-    if constexpr (
-        is_compiler_supported(CurrentKernel::INSTRUCTIONS)
-        && std::is_same_v<scalar_t, typename CurrentKernel::TargetScalar>
-    ) {
-        if (is_supported(CurrentKernel::INSTRUCTIONS)) {
-            return tile2d_autoblock<CurrentKernel::SIMD_BLOCK, scalar_t, ExecutionMode>(
-                rows,
-                cols,
-                border,
-                current_kernel.fn,
-                std::forward<ScalarKn>(scalar_impl)
-            );
-        }
-    }
-
-    // Current kernel unusable (compiler can't emit it, or CPU lacks it):
-    // drop it and try the remaining kernels with the same scalar fallback.
-    return tile2d<scalar_t, ExecutionMode>(
+    detail::tile2d_select<scalar_t, ExecutionMode>(
+        kernel_name,
         rows,
         cols,
         border,
@@ -259,6 +473,11 @@ constexpr TileKernel2D<SimdBlock, SimdSet::AVX2, Scalar, Fn> Avx2(Fn&& fn) {
     return TileKernel2D<SimdBlock, SimdSet::AVX2, Scalar, Fn>(fn);
 }
 
+template<size_t SimdBlock, typename Scalar, TileKernel2DFn Fn>
+constexpr TileKernel2D<SimdBlock, SimdSet::SSE41, Scalar, Fn> Sse41(Fn&& fn) {
+    return TileKernel2D<SimdBlock, SimdSet::SSE41, Scalar, Fn>(fn);
+}
+
 template<size_t SimdBlock, typename Scalar, TileKernel2DFn Fn>
 constexpr TileKernel2D<SimdBlock, SimdSet::AdvSIMD, Scalar, Fn> Neon(Fn&& fn) {
     return TileKernel2D<SimdBlock, SimdSet::AdvSIMD, Scalar, Fn>(fn);
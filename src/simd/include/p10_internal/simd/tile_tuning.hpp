@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "cpuid.hpp"
+#include "tile_execution.hpp"
+
+namespace p10::simd {
+
+/// A tuned tiling: the cache block side (elements; 2D tiles are square) and
+/// whether the blocks run sequentially or in parallel.
+struct TileChoice {
+    int64_t cache_block = 0;
+    TileExecution execution = TileExecution::SEQUENTIAL;
+};
+
+/// What a tuned choice is keyed on: the kernel name given to tile2d_tuned /
+/// dynamic_tile1d_tuned, the instruction set of the kernel that won dispatch,
+/// the element size, and the shape as log2 buckets (so 1000x1000 and 1020x990
+/// share a winner). 1D tilings leave `rows_bucket` at 0.
+struct TileTuningKey {
+    std::string_view kernel;
+    SimdSet instructions = SimdSet::NONE;
+    size_t scalar_bytes = 0;
+    int rows_bucket = 0;
+    int cols_bucket = 0;
+};
+
+/// Log2 bucket of a tensor extent: floor(log2(extent)), 0 for extents below 2.
+int tile_shape_bucket(int64_t extent);
+
+/// Whether tile2d_tuned/dynamic_tile1d_tuned time candidate tilings on the
+/// first call for a key without a stored choice. Off by default; the
+/// `PTENSOR_AUTOTUNE` environment variable ("1", "on" or "true") turns it on.
+/// Stored choices are used either way.
+bool is_autotune_enabled();
+void set_autotune(bool enabled);
+
+/// The stored choice for `key`, if any. The first call loads the file named by
+/// `PTENSOR_TUNING_CACHE`, when set and no cache was loaded explicitly.
+std::optional<TileChoice> find_tile_choice(const TileTuningKey& key);
+
+/// Stores a choice. The cache file, if a path is set, is rewritten once for
+/// all new choices: by `flush_tile_tuning`, when the path changes, or at exit.
+void record_tile_choice(const TileTuningKey& key, TileChoice choice);
+
+/// Drops every stored choice, including unwritten ones (the cache file is left
+/// alone).
+void clear_tile_choices();
+
+/// Number of stored choices.
+size_t tile_choice_count();
+
+/// Sets the file `record_tile_choice` persists to and merges its choices in. A
+/// missing file is not an error (the tuner creates it); an empty path keeps
+/// choices in memory only. Returns false when the file exists but is malformed;
+/// the previous path and choices are then kept and the file is left untouched.
+bool load_tile_tuning(const std::string& path);
+
+/// Writes every stored choice to `path`. Returns false on I/O failure.
+bool save_tile_tuning(const std::string& path);
+
+/// Writes choices recorded since the last write to the cache path, if one is
+/// set. Returns false on I/O failure.
+bool flush_tile_tuning();
+
+/// The cache file path in use, empty when choices are kept in memory only.
+std::string tile_tuning_path();
+
+}  // namespace p10::simd
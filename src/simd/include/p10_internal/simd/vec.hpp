@@ -0,0 +1,434 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <ptensor/region2d.hpp>
+
+#include "compiler.hpp"
+#include "cpuid.hpp"
+#include "tile1d.hpp"
+#include "tile2d.hpp"
+
+namespace p10::simd {
+
+// Fixed-width SIMD vector of N lanes of T, compiled for instruction set S.
+//
+// Kernels are written once against this interface and instantiated per tier:
+//
+//   template<SimdSet S>
+//   void scale(const float* src, float* dst, int64_t count, float factor) {
+//       using V = NativeVec<float, S>;
+//       for (int64_t i = 0; i + V::LANES <= count; i += V::LANES) {
+//           (V::load(src + i) * V::broadcast(factor)).store(dst + i);
+//       }
+//   }
+//
+// The primary template is the portable fallback: a plain lane array the
+// compiler may auto-vectorize. vec.x86.hpp and vec.neon.hpp specialize the
+// native widths (float/int32 x 4, double x 2 and uint16 x 8 for SSE4.1 and NEON,
+// float/int32 x 8, double x 4 and uint16 x 16 for AVX2); any other combination
+// falls back to the lane array, so every instantiation
+// compiles on every target and tile2d simply never selects the foreign ones.
+//
+// On GCC/Clang the x86 specializations carry target attributes, so kernel
+// code must run inside `call_in_tier<S>` (or a `Tiered` tile spec) to have
+// them inlined; called from untargeted code they still work, but each
+// operation is an out-of-line call.
+template<typename T, size_t N, SimdSet S>
+struct Vec {
+    static_assert(std::is_arithmetic_v<T>, "Vec lanes must be arithmetic");
+
+    using value_type = T;
+    static constexpr size_t LANES = N;
+    static constexpr SimdSet INSTRUCTIONS = S;
+
+    std::array<T, N> lanes;
+
+    static Vec zero() {
+        return broadcast(T {0});
+    }
+
+    static Vec broadcast(T value) {
+        Vec result;
+        result.lanes.fill(value);
+        return result;
+    }
+
+    // Unaligned load of N consecutive values.
+    static Vec load(const T* src) {
+        Vec result;
+        std::memcpy(result.lanes.data(), src, sizeof(T) * N);
+        return result;
+    }
+
+    // Unaligned store of N consecutive values.
+    void store(T* dst) const {
+        std::memcpy(dst, lanes.data(), sizeof(T) * N);
+    }
+
+    // Lane i = src[index[i]] for N consecutive indices. A native gather for
+    // float on AVX2; the 128-bit sets have none and fill the lanes one at a
+    // time.
+    static Vec gather(const T* src, const int32_t* index)
+        requires std::is_same_v<T, float> || std::is_same_v<T, int32_t>
+    {
+        Vec result;
+        for (size_t i = 0; i < N; ++i) {
+            result.lanes[i] = src[index[i]];
+        }
+        return result;
+    }
+
+    friend Vec operator+(const Vec& a, const Vec& b) {
+        return a.zip(b, [](T x, T y) { return static_cast<T>(x + y); });
+    }
+
+    friend Vec operator-(const Vec& a, const Vec& b) {
+        return a.zip(b, [](T x, T y) { return static_cast<T>(x - y); });
+    }
+
+    friend Vec operator*(const Vec& a, const Vec& b) {
+        return a.zip(b, [](T x, T y) { return static_cast<T>(x * y); });
+    }
+
+    friend Vec operator/(const Vec& a, const Vec& b)
+        requires std::is_floating_point_v<T>
+    {
+        return a.zip(b, [](T x, T y) { return x / y; });
+    }
+
+    // a * b + c. Multiply then add, in that order, so it matches the scalar
+    // `acc += x * w` accumulation bit for bit.
+    static Vec fma(const Vec& a, const Vec& b, const Vec& c) {
+        Vec result;
+        for (size_t i = 0; i < N; ++i) {
+            result.lanes[i] = static_cast<T>((a.lanes[i] * b.lanes[i]) + c.lanes[i]);
+        }
+        return result;
+    }
+
+    static Vec min(const Vec& a, const Vec& b) {
+        return a.zip(b, [](T x, T y) { return std::min(x, y); });
+    }
+
+    static Vec max(const Vec& a, const Vec& b) {
+        return a.zip(b, [](T x, T y) { return std::max(x, y); });
+    }
+
+    // Lane i = a[i] < b[i] ? then[i] : otherwise[i]; false when either is NaN.
+    static Vec select_less(const Vec& a, const Vec& b, const Vec& then, const Vec& otherwise)
+        requires std::is_same_v<T, float>
+    {
+        Vec result;
+        for (size_t i = 0; i < N; ++i) {
+            result.lanes[i] = a.lanes[i] < b.lanes[i] ? then.lanes[i] : otherwise.lanes[i];
+        }
+        return result;
+    }
+
+    // Round to nearest, ties to even (the default floating-point mode).
+    Vec round() const
+        requires std::is_floating_point_v<T>
+    {
+        Vec result;
+        for (size_t i = 0; i < N; ++i) {
+            result.lanes[i] = std::nearbyint(lanes[i]);
+        }
+        return result;
+    }
+
+    // Permute within each group of four lanes: output lane j of a group takes
+    // input lane I<j> of the same group (the _mm_shuffle_ps/_mm256_permute_ps
+    // semantics).
+    template<int I0, int I1, int I2, int I3>
+    Vec shuffle() const
+        requires(N % 4 == 0)
+    {
+        constexpr std::array<int, 4> ORDER {I0, I1, I2, I3};
+        Vec result;
+        for (size_t group = 0; group < N; group += 4) {
+            for (size_t j = 0; j < 4; ++j) {
+                result.lanes[group + j] = lanes[group + ORDER[j]];
+            }
+        }
+        return result;
+    }
+
+    // Lane-wise static_cast from another lane type of the same width; float to
+    // integer truncates toward zero.
+    template<typename U>
+    static Vec convert(const Vec<U, N, S>& other) {
+        alignas(64) std::array<U, N> values;
+        other.store(values.data());
+        Vec result;
+        for (size_t i = 0; i < N; ++i) {
+            result.lanes[i] = static_cast<T>(values[i]);
+        }
+        return result;
+    }
+
+    // The lane bits of another lane type of the same size, unchanged: float to
+    // int32 and back for exponent and mantissa arithmetic.
+    template<typename U>
+    static Vec reinterpret(const Vec<U, N, S>& other)
+        requires(sizeof(U) == sizeof(T))
+    {
+        Vec result;
+        std::memcpy(result.lanes.data(), other.lanes.data(), sizeof(T) * N);
+        return result;
+    }
+
+    // High half of each 32-bit lane product, (a * b) >> 16: the fixed-point
+    // multiply of _mm_mulhi_epu16.
+    static Vec mul_high(const Vec& a, const Vec& b)
+        requires std::is_same_v<T, uint16_t>
+    {
+        return a.zip(b, [](T x, T y) {
+            return static_cast<T>((static_cast<uint32_t>(x) * y) >> 16);
+        });
+    }
+
+    // Lane-wise shifts by a compile-time count. Left shifts wrap in the lane
+    // type; right shifts of signed lanes are arithmetic.
+    template<int BITS>
+    Vec shift_left() const
+        requires std::is_integral_v<T>
+    {
+        Vec result;
+        for (size_t i = 0; i < N; ++i) {
+            result.lanes[i] = static_cast<T>(lanes[i] << BITS);
+        }
+        return result;
+    }
+
+    template<int BITS>
+    Vec shift_right() const
+        requires std::is_integral_v<T>
+    {
+        Vec result;
+        for (size_t i = 0; i < N; ++i) {
+            result.lanes[i] = static_cast<T>(lanes[i] >> BITS);
+        }
+        return result;
+    }
+
+    // Widening load of N bytes.
+    static Vec load_u8(const uint8_t* src)
+        requires std::is_same_v<T, int32_t> || std::is_same_v<T, uint16_t>
+    {
+        Vec result;
+        for (size_t i = 0; i < N; ++i) {
+            result.lanes[i] = src[i];
+        }
+        return result;
+    }
+
+    // Narrowing store to N bytes, saturated to [0, 255].
+    void store_u8(uint8_t* dst) const
+        requires std::is_same_v<T, int32_t> || std::is_same_v<T, uint16_t>
+    {
+        for (size_t i = 0; i < N; ++i) {
+            dst[i] = static_cast<uint8_t>(std::clamp<int32_t>(lanes[i], 0, 255));
+        }
+    }
+
+    // Widening load of N uint16 values.
+    static Vec load_u16(const uint16_t* src)
+        requires std::is_same_v<T, int32_t>
+    {
+        Vec result;
+        for (size_t i = 0; i < N; ++i) {
+            result.lanes[i] = src[i];
+        }
+        return result;
+    }
+
+    // Narrowing store to N uint16 values, saturated to [0, 65535].
+    void store_u16(uint16_t* dst) const
+        requires std::is_same_v<T, int32_t>
+    {
+        for (size_t i = 0; i < N; ++i) {
+            dst[i] = static_cast<uint16_t>(std::clamp<int32_t>(lanes[i], 0, 65535));
+        }
+    }
+
+  private:
+    template<typename Op>
+    Vec zip(const Vec& other, Op op) const {
+        Vec result;
+        for (size_t i = 0; i < N; ++i) {
+            result.lanes[i] = op(lanes[i], other.lanes[i]);
+        }
+        return result;
+    }
+};
+
+// Register width of S in bytes: 32 for AVX2, 16 for the 128-bit sets and the
+// portable fallback.
+constexpr size_t native_vector_bytes(SimdSet set) {
+    return set == SimdSet::AVX2 ? 32 : 16;
+}
+
+// The Vec that fills one native register of S.
+template<typename T, SimdSet S>
+using NativeVec = Vec<T, native_vector_bytes(S) / sizeof(T), S>;
+
+template<typename V>
+concept VecType = std::is_same_v<V, Vec<typename V::value_type, V::LANES, V::INSTRUCTIONS>>;
+
+// Free-function spellings of the Vec statics, so kernels read as math:
+// simd::fma(x, w, acc) instead of V::fma(x, w, acc).
+template<VecType V>
+inline V fma(const V& a, const V& b, const V& c) {
+    return V::fma(a, b, c);
+}
+
+template<VecType V>
+inline V min(const V& a, const V& b) {
+    return V::min(a, b);
+}
+
+template<VecType V>
+inline V max(const V& a, const V& b) {
+    return V::max(a, b);
+}
+
+template<VecType V>
+inline V select_less(const V& a, const V& b, const V& then, const V& otherwise) {
+    return V::select_less(a, b, then, otherwise);
+}
+
+template<VecType V>
+inline V mul_high(const V& a, const V& b) {
+    return V::mul_high(a, b);
+}
+
+template<typename To, typename From, size_t N, SimdSet S>
+inline Vec<To, N, S> convert(const Vec<From, N, S>& value) {
+    return Vec<To, N, S>::convert(value);
+}
+
+template<typename To, typename From, size_t N, SimdSet S>
+inline Vec<To, N, S> reinterpret(const Vec<From, N, S>& value) {
+    return Vec<To, N, S>::reinterpret(value);
+}
+
+// Loads the first `count` (< LANES) values and zero-fills the rest, for row
+// tails. Goes through a stack buffer, so keep it out of the hot loop.
+template<VecType V>
+inline V load_partial(const typename V::value_type* src, size_t count) {
+    alignas(64) std::array<typename V::value_type, V::LANES> buffer {};
+    std::copy_n(src, std::min(count, V::LANES), buffer.data());
+    return V::load(buffer.data());
+}
+
+// Stores the first `count` (< LANES) lanes.
+template<VecType V>
+inline void store_partial(const V& value, typename V::value_type* dst, size_t count) {
+    alignas(64) std::array<typename V::value_type, V::LANES> buffer;
+    value.store(buffer.data());
+    std::copy_n(buffer.data(), std::min(count, V::LANES), dst);
+}
+
+// Sum of all lanes, in lane order.
+template<VecType V>
+inline typename V::value_type reduce_add(const V& value) {
+    alignas(64) std::array<typename V::value_type, V::LANES> buffer;
+    value.store(buffer.data());
+    typename V::value_type sum {0};
+    for (const auto lane : buffer) {
+        sum += lane;
+    }
+    return sum;
+}
+
+}  // namespace p10::simd
+
+#include "vec.neon.hpp"
+#include "vec.x86.hpp"
+
+namespace p10::simd {
+
+namespace detail {
+    template<typename Fn, typename... Args>
+    PTENSOR_AVX2 PTENSOR_FLATTEN inline void call_avx2(const Fn& fn, Args&&... args) {
+        fn(std::forward<Args>(args)...);
+    }
+
+    template<typename Fn, typename... Args>
+    PTENSOR_SSE41 PTENSOR_FLATTEN inline void call_sse41(const Fn& fn, Args&&... args) {
+        fn(std::forward<Args>(args)...);
+    }
+}  // namespace detail
+
+// Calls fn(args...) compiled for tier S: the call is flattened into a function
+// carrying S's target attributes, so the Vec<..., S> operations inside `fn`
+// inline as native instructions. The caller must have checked is_supported(S).
+template<SimdSet S, typename Fn, typename... Args>
+inline void call_in_tier(const Fn& fn, Args&&... args) {
+    if constexpr (S == SimdSet::AVX2) {
+        detail::call_avx2(fn, std::forward<Args>(args)...);
+    } else if constexpr (S == SimdSet::SSE41) {
+        detail::call_sse41(fn, std::forward<Args>(args)...);
+    } else {
+        // NEON is baseline on AArch64, and the portable and WASM tiers need no
+        // target attributes.
+        fn(std::forward<Args>(args)...);
+    }
+}
+
+// Tag naming tier S for kernels templated on it: fn(TierTag<S> {}) recovers S
+// as decltype(tag)::value.
+template<SimdSet S>
+using TierTag = std::integral_constant<SimdSet, S>;
+
+// Calls fn(TierTag<S> {}) through call_in_tier<S> for the best tier the CPU
+// supports (AVX2, SSE4.1, NEON, then portable). For kernels that are not split
+// into tiles but still run one Vec source on every tier.
+template<typename Fn>
+inline void call_in_best_tier(const Fn& fn) {
+    if (is_supported(SimdSet::AVX2)) {
+        call_in_tier<SimdSet::AVX2>(fn, TierTag<SimdSet::AVX2> {});
+    } else if (is_supported(SimdSet::SSE41)) {
+        call_in_tier<SimdSet::SSE41>(fn, TierTag<SimdSet::SSE41> {});
+    } else if (is_supported(SimdSet::AdvSIMD)) {
+        call_in_tier<SimdSet::AdvSIMD>(fn, TierTag<SimdSet::AdvSIMD> {});
+    } else {
+        call_in_tier<SimdSet::NONE>(fn, TierTag<SimdSet::NONE> {});
+    }
+}
+
+// Tile spec for a region kernel written against Vec: runs `fn` through
+// call_in_tier<S>, so one kernel source serves every tier:
+//
+//   tile2d<float>(rows, cols, border, scalar_kernel,
+//                 Tiered<SimdSet::AVX2, 8, float>(make_kernel<SimdSet::AVX2>()),
+//                 Tiered<SimdSet::SSE41, 8, float>(make_kernel<SimdSet::SSE41>()),
+//                 Tiered<SimdSet::AdvSIMD, 8, float>(make_kernel<SimdSet::AdvSIMD>()),
+//                 Portable<8, float>(portable_kernel));
+template<SimdSet S, size_t SimdBlock, typename Scalar, TileKernel2DFn Fn>
+constexpr auto Tiered(Fn&& fn) {
+    auto tiered = [fn = std::forward<Fn>(fn)](const Region2D& region) {
+        call_in_tier<S>(fn, region);
+    };
+    return TileKernel2D<SimdBlock, S, Scalar, decltype(tiered)>(tiered);
+}
+
+// Tiered for tile1d: a TileKernel1D spec running `fn` through call_in_tier<S>.
+template<SimdSet S, size_t SimdSize, typename Scalar, TileKernel1DFn Fn>
+constexpr auto Tiered_1D(Fn&& fn) {
+    auto tiered = [fn = std::forward<Fn>(fn)](const TileRegion1D& region) {
+        call_in_tier<S>(fn, region);
+    };
+    return TileKernel1D<SimdSize, S, Scalar, decltype(tiered)>(tiered);
+}
+
+}  // namespace p10::simd
@@ -0,0 +1,347 @@
+#pragma once
+
+// NEON specializations of Vec. Included by vec.hpp; do not include directly.
+
+#include "compiler.hpp"
+
+#if PTENSOR_HAS_NEON
+    #include <arm_neon.h>
+
+namespace p10::simd {
+
+// NEON is baseline on AArch64, so no target attributes are needed. fma uses
+// vmlaq (multiply then add, not fused) and min/max use compare + select, so
+// results match the portable tier and std::min/std::max bit for bit.
+
+template<>
+struct Vec<float, 4, SimdSet::AdvSIMD> {
+    using value_type = float;
+    static constexpr size_t LANES = 4;
+    static constexpr SimdSet INSTRUCTIONS = SimdSet::AdvSIMD;
+
+    float32x4_t v;
+
+    static Vec zero() {
+        return {vdupq_n_f32(0.0F)};
+    }
+
+    static Vec broadcast(float value) {
+        return {vdupq_n_f32(value)};
+    }
+
+    static Vec load(const float* src) {
+        return {vld1q_f32(src)};
+    }
+
+    void store(float* dst) const {
+        vst1q_f32(dst, v);
+    }
+
+    static Vec gather(const float* src, const int32_t* index) {
+        const std::array<float, 4> lanes {
+            src[index[0]],
+            src[index[1]],
+            src[index[2]],
+            src[index[3]]
+        };
+        return {vld1q_f32(lanes.data())};
+    }
+
+    friend Vec operator+(const Vec& a, const Vec& b) {
+        return {vaddq_f32(a.v, b.v)};
+    }
+
+    friend Vec operator-(const Vec& a, const Vec& b) {
+        return {vsubq_f32(a.v, b.v)};
+    }
+
+    friend Vec operator*(const Vec& a, const Vec& b) {
+        return {vmulq_f32(a.v, b.v)};
+    }
+
+    friend Vec operator/(const Vec& a, const Vec& b) {
+        return {vdivq_f32(a.v, b.v)};
+    }
+
+    static Vec fma(const Vec& a, const Vec& b, const Vec& c) {
+        return {vmlaq_f32(c.v, a.v, b.v)};
+    }
+
+    static Vec min(const Vec& a, const Vec& b) {
+        return {vbslq_f32(vcltq_f32(b.v, a.v), b.v, a.v)};
+    }
+
+    static Vec max(const Vec& a, const Vec& b) {
+        return {vbslq_f32(vcltq_f32(a.v, b.v), b.v, a.v)};
+    }
+
+    static Vec select_less(const Vec& a, const Vec& b, const Vec& then, const Vec& otherwise) {
+        return {vbslq_f32(vcltq_f32(a.v, b.v), then.v, otherwise.v)};
+    }
+
+    Vec round() const {
+        return {vrndnq_f32(v)};
+    }
+
+    template<int I0, int I1, int I2, int I3>
+    Vec shuffle() const {
+        float32x4_t result = vdupq_n_f32(vgetq_lane_f32(v, I0));
+        result = vsetq_lane_f32(vgetq_lane_f32(v, I1), result, 1);
+        result = vsetq_lane_f32(vgetq_lane_f32(v, I2), result, 2);
+        result = vsetq_lane_f32(vgetq_lane_f32(v, I3), result, 3);
+        return {result};
+    }
+
+    static Vec convert(const Vec<int32_t, 4, SimdSet::AdvSIMD>& other);
+
+    static Vec reinterpret(const Vec<int32_t, 4, SimdSet::AdvSIMD>& other);
+};
+
+template<>
+struct Vec<int32_t, 4, SimdSet::AdvSIMD> {
+    using value_type = int32_t;
+    static constexpr size_t LANES = 4;
+    static constexpr SimdSet INSTRUCTIONS = SimdSet::AdvSIMD;
+
+    int32x4_t v;
+
+    static Vec zero() {
+        return {vdupq_n_s32(0)};
+    }
+
+    static Vec broadcast(int32_t value) {
+        return {vdupq_n_s32(value)};
+    }
+
+    static Vec load(const int32_t* src) {
+        return {vld1q_s32(src)};
+    }
+
+    void store(int32_t* dst) const {
+        vst1q_s32(dst, v);
+    }
+
+    static Vec gather(const int32_t* src, const int32_t* index) {
+        const std::array<int32_t, 4> lanes {
+            src[index[0]],
+            src[index[1]],
+            src[index[2]],
+            src[index[3]]
+        };
+        return {vld1q_s32(lanes.data())};
+    }
+
+    friend Vec operator+(const Vec& a, const Vec& b) {
+        return {vaddq_s32(a.v, b.v)};
+    }
+
+    friend Vec operator-(const Vec& a, const Vec& b) {
+        return {vsubq_s32(a.v, b.v)};
+    }
+
+    friend Vec operator*(const Vec& a, const Vec& b) {
+        return {vmulq_s32(a.v, b.v)};
+    }
+
+    static Vec fma(const Vec& a, const Vec& b, const Vec& c) {
+        return {vmlaq_s32(c.v, a.v, b.v)};
+    }
+
+    static Vec min(const Vec& a, const Vec& b) {
+        return {vminq_s32(a.v, b.v)};
+    }
+
+    static Vec max(const Vec& a, const Vec& b) {
+        return {vmaxq_s32(a.v, b.v)};
+    }
+
+    template<int I0, int I1, int I2, int I3>
+    Vec shuffle() const {
+        int32x4_t result = vdupq_n_s32(vgetq_lane_s32(v, I0));
+        result = vsetq_lane_s32(vgetq_lane_s32(v, I1), result, 1);
+        result = vsetq_lane_s32(vgetq_lane_s32(v, I2), result, 2);
+        result = vsetq_lane_s32(vgetq_lane_s32(v, I3), result, 3);
+        return {result};
+    }
+
+    static Vec convert(const Vec<float, 4, SimdSet::AdvSIMD>& other) {
+        return {vcvtq_s32_f32(other.v)};
+    }
+
+    static Vec reinterpret(const Vec<float, 4, SimdSet::AdvSIMD>& other) {
+        return {vreinterpretq_s32_f32(other.v)};
+    }
+
+    static Vec load_u8(const uint8_t* src) {
+        uint32_t bytes = 0;
+        std::memcpy(&bytes, src, sizeof(bytes));
+        const uint16x8_t words = vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(bytes)));
+        return {vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(words)))};
+    }
+
+    void store_u8(uint8_t* dst) const {
+        const uint16x4_t words = vqmovun_s32(v);
+        const uint8x8_t bytes = vqmovn_u16(vcombine_u16(words, words));
+        const uint32_t packed = vget_lane_u32(vreinterpret_u32_u8(bytes), 0);
+        std::memcpy(dst, &packed, sizeof(packed));
+    }
+
+    template<int BITS>
+    Vec shift_left() const {
+        return {vshlq_n_s32(v, BITS)};
+    }
+
+    template<int BITS>
+    Vec shift_right() const {
+        return {vshrq_n_s32(v, BITS)};
+    }
+
+    static Vec load_u16(const uint16_t* src) {
+        return {vreinterpretq_s32_u32(vmovl_u16(vld1_u16(src)))};
+    }
+
+    void store_u16(uint16_t* dst) const {
+        vst1_u16(dst, vqmovun_s32(v));
+    }
+};
+
+inline Vec<float, 4, SimdSet::AdvSIMD>
+Vec<float, 4, SimdSet::AdvSIMD>::convert(const Vec<int32_t, 4, SimdSet::AdvSIMD>& other) {
+    return {vcvtq_f32_s32(other.v)};
+}
+
+inline Vec<float, 4, SimdSet::AdvSIMD>
+Vec<float, 4, SimdSet::AdvSIMD>::reinterpret(const Vec<int32_t, 4, SimdSet::AdvSIMD>& other) {
+    return {vreinterpretq_f32_s32(other.v)};
+}
+
+template<>
+struct Vec<double, 2, SimdSet::AdvSIMD> {
+    using value_type = double;
+    static constexpr size_t LANES = 2;
+    static constexpr SimdSet INSTRUCTIONS = SimdSet::AdvSIMD;
+
+    float64x2_t v;
+
+    static Vec zero() {
+        return {vdupq_n_f64(0.0)};
+    }
+
+    static Vec broadcast(double value) {
+        return {vdupq_n_f64(value)};
+    }
+
+    static Vec load(const double* src) {
+        return {vld1q_f64(src)};
+    }
+
+    void store(double* dst) const {
+        vst1q_f64(dst, v);
+    }
+
+    friend Vec operator+(const Vec& a, const Vec& b) {
+        return {vaddq_f64(a.v, b.v)};
+    }
+
+    friend Vec operator-(const Vec& a, const Vec& b) {
+        return {vsubq_f64(a.v, b.v)};
+    }
+
+    friend Vec operator*(const Vec& a, const Vec& b) {
+        return {vmulq_f64(a.v, b.v)};
+    }
+
+    friend Vec operator/(const Vec& a, const Vec& b) {
+        return {vdivq_f64(a.v, b.v)};
+    }
+
+    static Vec fma(const Vec& a, const Vec& b, const Vec& c) {
+        return {vaddq_f64(vmulq_f64(a.v, b.v), c.v)};
+    }
+
+    static Vec min(const Vec& a, const Vec& b) {
+        return {vbslq_f64(vcltq_f64(b.v, a.v), b.v, a.v)};
+    }
+
+    static Vec max(const Vec& a, const Vec& b) {
+        return {vbslq_f64(vcltq_f64(a.v, b.v), b.v, a.v)};
+    }
+};
+
+template<>
+struct Vec<uint16_t, 8, SimdSet::AdvSIMD> {
+    using value_type = uint16_t;
+    static constexpr size_t LANES = 8;
+    static constexpr SimdSet INSTRUCTIONS = SimdSet::AdvSIMD;
+
+    uint16x8_t v;
+
+    static Vec zero() {
+        return {vdupq_n_u16(0)};
+    }
+
+    static Vec broadcast(uint16_t value) {
+        return {vdupq_n_u16(value)};
+    }
+
+    static Vec load(const uint16_t* src) {
+        return {vld1q_u16(src)};
+    }
+
+    void store(uint16_t* dst) const {
+        vst1q_u16(dst, v);
+    }
+
+    friend Vec operator+(const Vec& a, const Vec& b) {
+        return {vaddq_u16(a.v, b.v)};
+    }
+
+    friend Vec operator-(const Vec& a, const Vec& b) {
+        return {vsubq_u16(a.v, b.v)};
+    }
+
+    friend Vec operator*(const Vec& a, const Vec& b) {
+        return {vmulq_u16(a.v, b.v)};
+    }
+
+    static Vec fma(const Vec& a, const Vec& b, const Vec& c) {
+        return {vmlaq_u16(c.v, a.v, b.v)};
+    }
+
+    static Vec min(const Vec& a, const Vec& b) {
+        return {vminq_u16(a.v, b.v)};
+    }
+
+    static Vec max(const Vec& a, const Vec& b) {
+        return {vmaxq_u16(a.v, b.v)};
+    }
+
+    // Widening vmull per half, then the high words of each 32-bit product.
+    static Vec mul_high(const Vec& a, const Vec& b) {
+        const uint32x4_t low = vmull_u16(vget_low_u16(a.v), vget_low_u16(b.v));
+        const uint32x4_t high = vmull_u16(vget_high_u16(a.v), vget_high_u16(b.v));
+        return {vcombine_u16(vshrn_n_u32(low, 16), vshrn_n_u32(high, 16))};
+    }
+
+    template<int BITS>
+    Vec shift_left() const {
+        return {vshlq_n_u16(v, BITS)};
+    }
+
+    template<int BITS>
+    Vec shift_right() const {
+        return {vshrq_n_u16(v, BITS)};
+    }
+
+    static Vec load_u8(const uint8_t* src) {
+        return {vmovl_u8(vld1_u8(src))};
+    }
+
+    void store_u8(uint8_t* dst) const {
+        vst1_u8(dst, vqmovn_u16(v));
+    }
+};
+
+}  // namespace p10::simd
+
+#endif  // PTENSOR_HAS_NEON
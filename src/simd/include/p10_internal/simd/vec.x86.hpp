@@ -0,0 +1,656 @@
+#pragma once
+
+// SSE4.1 and AVX2 specializations of Vec. Included by vec.hpp; do not include
+// directly.
+
+#include "compiler.hpp"
+
+#if PTENSOR_HAS_INTRINSICS_H
+    #include <immintrin.h>
+
+namespace p10::simd {
+
+// min/max pass their operands swapped so they match std::min/std::max exactly,
+// NaN included: std::min(a, b) is (b < a) ? b : a, and _mm_min_ps(x, y) is
+// (x < y) ? x : y. AVX2 does not imply FMA, so fma is a multiply then an add
+// there as well (which is also what keeps it bit-exact with the portable tier).
+
+template<>
+struct Vec<float, 4, SimdSet::SSE41> {
+    using value_type = float;
+    static constexpr size_t LANES = 4;
+    static constexpr SimdSet INSTRUCTIONS = SimdSet::SSE41;
+
+    __m128 v;
+
+    PTENSOR_SSE41 static Vec zero() {
+        return {_mm_setzero_ps()};
+    }
+
+    PTENSOR_SSE41 static Vec broadcast(float value) {
+        return {_mm_set1_ps(value)};
+    }
+
+    PTENSOR_SSE41 static Vec load(const float* src) {
+        return {_mm_loadu_ps(src)};
+    }
+
+    PTENSOR_SSE41 void store(float* dst) const {
+        _mm_storeu_ps(dst, v);
+    }
+
+    PTENSOR_SSE41 static Vec gather(const float* src, const int32_t* index) {
+        return {_mm_setr_ps(src[index[0]], src[index[1]], src[index[2]], src[index[3]])};
+    }
+
+    PTENSOR_SSE41 friend Vec operator+(const Vec& a, const Vec& b) {
+        return {_mm_add_ps(a.v, b.v)};
+    }
+
+    PTENSOR_SSE41 friend Vec operator-(const Vec& a, const Vec& b) {
+        return {_mm_sub_ps(a.v, b.v)};
+    }
+
+    PTENSOR_SSE41 friend Vec operator*(const Vec& a, const Vec& b) {
+        return {_mm_mul_ps(a.v, b.v)};
+    }
+
+    PTENSOR_SSE41 friend Vec operator/(const Vec& a, const Vec& b) {
+        return {_mm_div_ps(a.v, b.v)};
+    }
+
+    PTENSOR_SSE41 static Vec fma(const Vec& a, const Vec& b, const Vec& c) {
+        return {_mm_add_ps(_mm_mul_ps(a.v, b.v), c.v)};
+    }
+
+    PTENSOR_SSE41 static Vec min(const Vec& a, const Vec& b) {
+        return {_mm_min_ps(b.v, a.v)};
+    }
+
+    PTENSOR_SSE41 static Vec max(const Vec& a, const Vec& b) {
+        return {_mm_max_ps(b.v, a.v)};
+    }
+
+    PTENSOR_SSE41 static Vec
+    select_less(const Vec& a, const Vec& b, const Vec& then, const Vec& otherwise) {
+        return {_mm_blendv_ps(otherwise.v, then.v, _mm_cmplt_ps(a.v, b.v))};
+    }
+
+    PTENSOR_SSE41 Vec round() const {
+        return {_mm_round_ps(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)};
+    }
+
+    template<int I0, int I1, int I2, int I3>
+    PTENSOR_SSE41 Vec shuffle() const {
+        return {_mm_shuffle_ps(v, v, _MM_SHUFFLE(I3, I2, I1, I0))};
+    }
+
+    PTENSOR_SSE41 static Vec convert(const Vec<int32_t, 4, SimdSet::SSE41>& other);
+
+    PTENSOR_SSE41 static Vec reinterpret(const Vec<int32_t, 4, SimdSet::SSE41>& other);
+};
+
+template<>
+struct Vec<int32_t, 4, SimdSet::SSE41> {
+    using value_type = int32_t;
+    static constexpr size_t LANES = 4;
+    static constexpr SimdSet INSTRUCTIONS = SimdSet::SSE41;
+
+    __m128i v;
+
+    PTENSOR_SSE41 static Vec zero() {
+        return {_mm_setzero_si128()};
+    }
+
+    PTENSOR_SSE41 static Vec broadcast(int32_t value) {
+        return {_mm_set1_epi32(value)};
+    }
+
+    PTENSOR_SSE41 static Vec load(const int32_t* src) {
+        return {_mm_loadu_si128(reinterpret_cast<const __m128i*>(src))};
+    }
+
+    PTENSOR_SSE41 void store(int32_t* dst) const {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), v);
+    }
+
+    PTENSOR_SSE41 static Vec gather(const int32_t* src, const int32_t* index) {
+        return {_mm_setr_epi32(src[index[0]], src[index[1]], src[index[2]], src[index[3]])};
+    }
+
+    PTENSOR_SSE41 friend Vec operator+(const Vec& a, const Vec& b) {
+        return {_mm_add_epi32(a.v, b.v)};
+    }
+
+    PTENSOR_SSE41 friend Vec operator-(const Vec& a, const Vec& b) {
+        return {_mm_sub_epi32(a.v, b.v)};
+    }
+
+    PTENSOR_SSE41 friend Vec operator*(const Vec& a, const Vec& b) {
+        return {_mm_mullo_epi32(a.v, b.v)};
+    }
+
+    PTENSOR_SSE41 static Vec fma(const Vec& a, const Vec& b, const Vec& c) {
+        return {_mm_add_epi32(_mm_mullo_epi32(a.v, b.v), c.v)};
+    }
+
+    PTENSOR_SSE41 static Vec min(const Vec& a, const Vec& b) {
+        return {_mm_min_epi32(a.v, b.v)};
+    }
+
+    PTENSOR_SSE41 static Vec max(const Vec& a, const Vec& b) {
+        return {_mm_max_epi32(a.v, b.v)};
+    }
+
+    template<int I0, int I1, int I2, int I3>
+    PTENSOR_SSE41 Vec shuffle() const {
+        return {_mm_shuffle_epi32(v, _MM_SHUFFLE(I3, I2, I1, I0))};
+    }
+
+    PTENSOR_SSE41 static Vec convert(const Vec<float, 4, SimdSet::SSE41>& other) {
+        return {_mm_cvttps_epi32(other.v)};
+    }
+
+    PTENSOR_SSE41 static Vec reinterpret(const Vec<float, 4, SimdSet::SSE41>& other) {
+        return {_mm_castps_si128(other.v)};
+    }
+
+    PTENSOR_SSE41 static Vec load_u8(const uint8_t* src) {
+        int32_t bytes = 0;
+        std::memcpy(&bytes, src, sizeof(bytes));
+        return {_mm_cvtepu8_epi32(_mm_cvtsi32_si128(bytes))};
+    }
+
+    PTENSOR_SSE41 void store_u8(uint8_t* dst) const {
+        // Clamp the top first: packus_epi16 reads its input as signed 16-bit.
+        const __m128i words = _mm_packus_epi32(_mm_min_epi32(v, _mm_set1_epi32(255)), v);
+        const int32_t bytes = _mm_cvtsi128_si32(_mm_packus_epi16(words, words));
+        std::memcpy(dst, &bytes, sizeof(bytes));
+    }
+
+    template<int BITS>
+    PTENSOR_SSE41 Vec shift_left() const {
+        return {_mm_slli_epi32(v, BITS)};
+    }
+
+    template<int BITS>
+    PTENSOR_SSE41 Vec shift_right() const {
+        return {_mm_srai_epi32(v, BITS)};
+    }
+
+    PTENSOR_SSE41 static Vec load_u16(const uint16_t* src) {
+        return {_mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)))};
+    }
+
+    PTENSOR_SSE41 void store_u16(uint16_t* dst) const {
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi32(v, v));
+    }
+};
+
+PTENSOR_SSE41 inline Vec<float, 4, SimdSet::SSE41>
+Vec<float, 4, SimdSet::SSE41>::convert(const Vec<int32_t, 4, SimdSet::SSE41>& other) {
+    return {_mm_cvtepi32_ps(other.v)};
+}
+
+PTENSOR_SSE41 inline Vec<float, 4, SimdSet::SSE41>
+Vec<float, 4, SimdSet::SSE41>::reinterpret(const Vec<int32_t, 4, SimdSet::SSE41>& other) {
+    return {_mm_castsi128_ps(other.v)};
+}
+
+template<>
+struct Vec<double, 2, SimdSet::SSE41> {
+    using value_type = double;
+    static constexpr size_t LANES = 2;
+    static constexpr SimdSet INSTRUCTIONS = SimdSet::SSE41;
+
+    __m128d v;
+
+    PTENSOR_SSE41 static Vec zero() {
+        return {_mm_setzero_pd()};
+    }
+
+    PTENSOR_SSE41 static Vec broadcast(double value) {
+        return {_mm_set1_pd(value)};
+    }
+
+    PTENSOR_SSE41 static Vec load(const double* src) {
+        return {_mm_loadu_pd(src)};
+    }
+
+    PTENSOR_SSE41 void store(double* dst) const {
+        _mm_storeu_pd(dst, v);
+    }
+
+    PTENSOR_SSE41 friend Vec operator+(const Vec& a, const Vec& b) {
+        return {_mm_add_pd(a.v, b.v)};
+    }
+
+    PTENSOR_SSE41 friend Vec operator-(const Vec& a, const Vec& b) {
+        return {_mm_sub_pd(a.v, b.v)};
+    }
+
+    PTENSOR_SSE41 friend Vec operator*(const Vec& a, const Vec& b) {
+        return {_mm_mul_pd(a.v, b.v)};
+    }
+
+    PTENSOR_SSE41 friend Vec operator/(const Vec& a, const Vec& b) {
+        return {_mm_div_pd(a.v, b.v)};
+    }
+
+    PTENSOR_SSE41 static Vec fma(const Vec& a, const Vec& b, const Vec& c) {
+        return {_mm_add_pd(_mm_mul_pd(a.v, b.v), c.v)};
+    }
+
+    PTENSOR_SSE41 static Vec min(const Vec& a, const Vec& b) {
+        return {_mm_min_pd(b.v, a.v)};
+    }
+
+    PTENSOR_SSE41 static Vec max(const Vec& a, const Vec& b) {
+        return {_mm_max_pd(b.v, a.v)};
+    }
+};
+
+template<>
+struct Vec<uint16_t, 8, SimdSet::SSE41> {
+    using value_type = uint16_t;
+    static constexpr size_t LANES = 8;
+    static constexpr SimdSet INSTRUCTIONS = SimdSet::SSE41;
+
+    __m128i v;
+
+    PTENSOR_SSE41 static Vec zero() {
+        return {_mm_setzero_si128()};
+    }
+
+    PTENSOR_SSE41 static Vec broadcast(uint16_t value) {
+        return {_mm_set1_epi16(static_cast<int16_t>(value))};
+    }
+
+    PTENSOR_SSE41 static Vec load(const uint16_t* src) {
+        return {_mm_loadu_si128(reinterpret_cast<const __m128i*>(src))};
+    }
+
+    PTENSOR_SSE41 void store(uint16_t* dst) const {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), v);
+    }
+
+    PTENSOR_SSE41 friend Vec operator+(const Vec& a, const Vec& b) {
+        return {_mm_add_epi16(a.v, b.v)};
+    }
+
+    PTENSOR_SSE41 friend Vec operator-(const Vec& a, const Vec& b) {
+        return {_mm_sub_epi16(a.v, b.v)};
+    }
+
+    PTENSOR_SSE41 friend Vec operator*(const Vec& a, const Vec& b) {
+        return {_mm_mullo_epi16(a.v, b.v)};
+    }
+
+    PTENSOR_SSE41 static Vec fma(const Vec& a, const Vec& b, const Vec& c) {
+        return {_mm_add_epi16(_mm_mullo_epi16(a.v, b.v), c.v)};
+    }
+
+    PTENSOR_SSE41 static Vec min(const Vec& a, const Vec& b) {
+        return {_mm_min_epu16(a.v, b.v)};
+    }
+
+    PTENSOR_SSE41 static Vec max(const Vec& a, const Vec& b) {
+        return {_mm_max_epu16(a.v, b.v)};
+    }
+
+    PTENSOR_SSE41 static Vec mul_high(const Vec& a, const Vec& b) {
+        return {_mm_mulhi_epu16(a.v, b.v)};
+    }
+
+    template<int BITS>
+    PTENSOR_SSE41 Vec shift_left() const {
+        return {_mm_slli_epi16(v, BITS)};
+    }
+
+    template<int BITS>
+    PTENSOR_SSE41 Vec shift_right() const {
+        return {_mm_srli_epi16(v, BITS)};
+    }
+
+    PTENSOR_SSE41 static Vec load_u8(const uint8_t* src) {
+        return {_mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)))};
+    }
+
+    PTENSOR_SSE41 void store_u8(uint8_t* dst) const {
+        // packus_epi16 reads its input as signed, so clamp the top first.
+        const __m128i clamped = _mm_min_epu16(v, _mm_set1_epi16(255));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(clamped, clamped));
+    }
+};
+
+template<>
+struct Vec<float, 8, SimdSet::AVX2> {
+    using value_type = float;
+    static constexpr size_t LANES = 8;
+    static constexpr SimdSet INSTRUCTIONS = SimdSet::AVX2;
+
+    __m256 v;
+
+    PTENSOR_AVX2 static Vec zero() {
+        return {_mm256_setzero_ps()};
+    }
+
+    PTENSOR_AVX2 static Vec broadcast(float value) {
+        return {_mm256_set1_ps(value)};
+    }
+
+    PTENSOR_AVX2 static Vec load(const float* src) {
+        return {_mm256_loadu_ps(src)};
+    }
+
+    PTENSOR_AVX2 void store(float* dst) const {
+        _mm256_storeu_ps(dst, v);
+    }
+
+    PTENSOR_AVX2 static Vec gather(const float* src, const int32_t* index) {
+        const __m256i offsets = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(index));
+        return {_mm256_i32gather_ps(src, offsets, 4)};
+    }
+
+    PTENSOR_AVX2 friend Vec operator+(const Vec& a, const Vec& b) {
+        return {_mm256_add_ps(a.v, b.v)};
+    }
+
+    PTENSOR_AVX2 friend Vec operator-(const Vec& a, const Vec& b) {
+        return {_mm256_sub_ps(a.v, b.v)};
+    }
+
+    PTENSOR_AVX2 friend Vec operator*(const Vec& a, const Vec& b) {
+        return {_mm256_mul_ps(a.v, b.v)};
+    }
+
+    PTENSOR_AVX2 friend Vec operator/(const Vec& a, const Vec& b) {
+        return {_mm256_div_ps(a.v, b.v)};
+    }
+
+    PTENSOR_AVX2 static Vec fma(const Vec& a, const Vec& b, const Vec& c) {
+        return {_mm256_add_ps(_mm256_mul_ps(a.v, b.v), c.v)};
+    }
+
+    PTENSOR_AVX2 static Vec min(const Vec& a, const Vec& b) {
+        return {_mm256_min_ps(b.v, a.v)};
+    }
+
+    PTENSOR_AVX2 static Vec max(const Vec& a, const Vec& b) {
+        return {_mm256_max_ps(b.v, a.v)};
+    }
+
+    PTENSOR_AVX2 static Vec
+    select_less(const Vec& a, const Vec& b, const Vec& then, const Vec& otherwise) {
+        return {_mm256_blendv_ps(otherwise.v, then.v, _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ))};
+    }
+
+    PTENSOR_AVX2 Vec round() const {
+        return {_mm256_round_ps(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)};
+    }
+
+    template<int I0, int I1, int I2, int I3>
+    PTENSOR_AVX2 Vec shuffle() const {
+        return {_mm256_permute_ps(v, _MM_SHUFFLE(I3, I2, I1, I0))};
+    }
+
+    PTENSOR_AVX2 static Vec convert(const Vec<int32_t, 8, SimdSet::AVX2>& other);
+
+    PTENSOR_AVX2 static Vec reinterpret(const Vec<int32_t, 8, SimdSet::AVX2>& other);
+};
+
+template<>
+struct Vec<int32_t, 8, SimdSet::AVX2> {
+    using value_type = int32_t;
+    static constexpr size_t LANES = 8;
+    static constexpr SimdSet INSTRUCTIONS = SimdSet::AVX2;
+
+    __m256i v;
+
+    PTENSOR_AVX2 static Vec zero() {
+        return {_mm256_setzero_si256()};
+    }
+
+    PTENSOR_AVX2 static Vec broadcast(int32_t value) {
+        return {_mm256_set1_epi32(value)};
+    }
+
+    PTENSOR_AVX2 static Vec load(const int32_t* src) {
+        return {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src))};
+    }
+
+    PTENSOR_AVX2 void store(int32_t* dst) const {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), v);
+    }
+
+    // Scalar inserts rather than vpgatherdd: feeding vpmulld, as the
+    // fixed-point resize kernels do, the gather measured about 1.5x slower.
+    PTENSOR_AVX2 static Vec gather(const int32_t* src, const int32_t* index) {
+        return {_mm256_setr_epi32(
+            src[index[0]],
+            src[index[1]],
+            src[index[2]],
+            src[index[3]],
+            src[index[4]],
+            src[index[5]],
+            src[index[6]],
+            src[index[7]]
+        )};
+    }
+
+    PTENSOR_AVX2 friend Vec operator+(const Vec& a, const Vec& b) {
+        return {_mm256_add_epi32(a.v, b.v)};
+    }
+
+    PTENSOR_AVX2 friend Vec operator-(const Vec& a, const Vec& b) {
+        return {_mm256_sub_epi32(a.v, b.v)};
+    }
+
+    PTENSOR_AVX2 friend Vec operator*(const Vec& a, const Vec& b) {
+        return {_mm256_mullo_epi32(a.v, b.v)};
+    }
+
+    PTENSOR_AVX2 static Vec fma(const Vec& a, const Vec& b, const Vec& c) {
+        return {_mm256_add_epi32(_mm256_mullo_epi32(a.v, b.v), c.v)};
+    }
+
+    PTENSOR_AVX2 static Vec min(const Vec& a, const Vec& b) {
+        return {_mm256_min_epi32(a.v, b.v)};
+    }
+
+    PTENSOR_AVX2 static Vec max(const Vec& a, const Vec& b) {
+        return {_mm256_max_epi32(a.v, b.v)};
+    }
+
+    template<int I0, int I1, int I2, int I3>
+    PTENSOR_AVX2 Vec shuffle() const {
+        return {_mm256_shuffle_epi32(v, _MM_SHUFFLE(I3, I2, I1, I0))};
+    }
+
+    PTENSOR_AVX2 static Vec convert(const Vec<float, 8, SimdSet::AVX2>& other) {
+        return {_mm256_cvttps_epi32(other.v)};
+    }
+
+    PTENSOR_AVX2 static Vec reinterpret(const Vec<float, 8, SimdSet::AVX2>& other) {
+        return {_mm256_castps_si256(other.v)};
+    }
+
+    PTENSOR_AVX2 static Vec load_u8(const uint8_t* src) {
+        return {_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)))};
+    }
+
+    PTENSOR_AVX2 void store_u8(uint8_t* dst) const {
+        // packus works per 128-bit half, so narrow the two halves with SSE.
+        const __m256i clamped = _mm256_min_epi32(v, _mm256_set1_epi32(255));
+        const __m128i words = _mm_packus_epi32(
+            _mm256_castsi256_si128(clamped),
+            _mm256_extracti128_si256(clamped, 1)
+        );
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(words, words));
+    }
+
+    template<int BITS>
+    PTENSOR_AVX2 Vec shift_left() const {
+        return {_mm256_slli_epi32(v, BITS)};
+    }
+
+    template<int BITS>
+    PTENSOR_AVX2 Vec shift_right() const {
+        return {_mm256_srai_epi32(v, BITS)};
+    }
+
+    PTENSOR_AVX2 static Vec load_u16(const uint16_t* src) {
+        return {_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)))};
+    }
+
+    PTENSOR_AVX2 void store_u16(uint16_t* dst) const {
+        const __m128i words =
+            _mm_packus_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), words);
+    }
+};
+
+PTENSOR_AVX2 inline Vec<float, 8, SimdSet::AVX2>
+Vec<float, 8, SimdSet::AVX2>::convert(const Vec<int32_t, 8, SimdSet::AVX2>& other) {
+    return {_mm256_cvtepi32_ps(other.v)};
+}
+
+PTENSOR_AVX2 inline Vec<float, 8, SimdSet::AVX2>
+Vec<float, 8, SimdSet::AVX2>::reinterpret(const Vec<int32_t, 8, SimdSet::AVX2>& other) {
+    return {_mm256_castsi256_ps(other.v)};
+}
+
+template<>
+struct Vec<double, 4, SimdSet::AVX2> {
+    using value_type = double;
+    static constexpr size_t LANES = 4;
+    static constexpr SimdSet INSTRUCTIONS = SimdSet::AVX2;
+
+    __m256d v;
+
+    PTENSOR_AVX2 static Vec zero() {
+        return {_mm256_setzero_pd()};
+    }
+
+    PTENSOR_AVX2 static Vec broadcast(double value) {
+        return {_mm256_set1_pd(value)};
+    }
+
+    PTENSOR_AVX2 static Vec load(const double* src) {
+        return {_mm256_loadu_pd(src)};
+    }
+
+    PTENSOR_AVX2 void store(double* dst) const {
+        _mm256_storeu_pd(dst, v);
+    }
+
+    PTENSOR_AVX2 friend Vec operator+(const Vec& a, const Vec& b) {
+        return {_mm256_add_pd(a.v, b.v)};
+    }
+
+    PTENSOR_AVX2 friend Vec operator-(const Vec& a, const Vec& b) {
+        return {_mm256_sub_pd(a.v, b.v)};
+    }
+
+    PTENSOR_AVX2 friend Vec operator*(const Vec& a, const Vec& b) {
+        return {_mm256_mul_pd(a.v, b.v)};
+    }
+
+    PTENSOR_AVX2 friend Vec operator/(const Vec& a, const Vec& b) {
+        return {_mm256_div_pd(a.v, b.v)};
+    }
+
+    PTENSOR_AVX2 static Vec fma(const Vec& a, const Vec& b, const Vec& c) {
+        return {_mm256_add_pd(_mm256_mul_pd(a.v, b.v), c.v)};
+    }
+
+    PTENSOR_AVX2 static Vec min(const Vec& a, const Vec& b) {
+        return {_mm256_min_pd(b.v, a.v)};
+    }
+
+    PTENSOR_AVX2 static Vec max(const Vec& a, const Vec& b) {
+        return {_mm256_max_pd(b.v, a.v)};
+    }
+};
+
+template<>
+struct Vec<uint16_t, 16, SimdSet::AVX2> {
+    using value_type = uint16_t;
+    static constexpr size_t LANES = 16;
+    static constexpr SimdSet INSTRUCTIONS = SimdSet::AVX2;
+
+    __m256i v;
+
+    PTENSOR_AVX2 static Vec zero() {
+        return {_mm256_setzero_si256()};
+    }
+
+    PTENSOR_AVX2 static Vec broadcast(uint16_t value) {
+        return {_mm256_set1_epi16(static_cast<int16_t>(value))};
+    }
+
+    PTENSOR_AVX2 static Vec load(const uint16_t* src) {
+        return {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src))};
+    }
+
+    PTENSOR_AVX2 void store(uint16_t* dst) const {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), v);
+    }
+
+    PTENSOR_AVX2 friend Vec operator+(const Vec& a, const Vec& b) {
+        return {_mm256_add_epi16(a.v, b.v)};
+    }
+
+    PTENSOR_AVX2 friend Vec operator-(const Vec& a, const Vec& b) {
+        return {_mm256_sub_epi16(a.v, b.v)};
+    }
+
+    PTENSOR_AVX2 friend Vec operator*(const Vec& a, const Vec& b) {
+        return {_mm256_mullo_epi16(a.v, b.v)};
+    }
+
+    PTENSOR_AVX2 static Vec fma(const Vec& a, const Vec& b, const Vec& c) {
+        return {_mm256_add_epi16(_mm256_mullo_epi16(a.v, b.v), c.v)};
+    }
+
+    PTENSOR_AVX2 static Vec min(const Vec& a, const Vec& b) {
+        return {_mm256_min_epu16(a.v, b.v)};
+    }
+
+    PTENSOR_AVX2 static Vec max(const Vec& a, const Vec& b) {
+        return {_mm256_max_epu16(a.v, b.v)};
+    }
+
+    PTENSOR_AVX2 static Vec mul_high(const Vec& a, const Vec& b) {
+        return {_mm256_mulhi_epu16(a.v, b.v)};
+    }
+
+    template<int BITS>
+    PTENSOR_AVX2 Vec shift_left() const {
+        return {_mm256_slli_epi16(v, BITS)};
+    }
+
+    template<int BITS>
+    PTENSOR_AVX2 Vec shift_right() const {
+        return {_mm256_srli_epi16(v, BITS)};
+    }
+
+    PTENSOR_AVX2 static Vec load_u8(const uint8_t* src) {
+        return {_mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)))};
+    }
+
+    PTENSOR_AVX2 void store_u8(uint8_t* dst) const {
+        // packus works per 128-bit half and reads signed words: clamp, then
+        // narrow the two halves with SSE.
+        const __m256i clamped = _mm256_min_epu16(v, _mm256_set1_epi16(255));
+        const __m128i bytes = _mm_packus_epi16(
+            _mm256_castsi256_si128(clamped),
+            _mm256_extracti128_si256(clamped, 1)
+        );
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), bytes);
+    }
+};
+
+}  // namespace p10::simd
+
+#endif  // PTENSOR_HAS_INTRINSICS_H
@@ -0,0 +1,297 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "vec.hpp"
+
+namespace p10::simd {
+
+// Float transcendentals over Vec, written once for every tier:
+//
+//   using V = NativeVec<float, S>;
+//   simd::exp(V::load(src + i)).store(dst + i);
+//
+// They use only Vec arithmetic, selects and exponent bit tricks, so each tier
+// (and Vec<float, 1, SimdSet::NONE> for scalar tails) returns the same bits.
+// The polynomials are Cephes' single-precision ones (erf's are fitted the same
+// way). Worst errors against double-precision libm, over dense samples of the
+// stated ranges; NaN inputs give NaN and infinities the function's limits.
+//
+//   exp      2 ulp; 0 below -103.97, infinity above 88.72, denormals kept.
+//   log      1 ulp over the positive floats, denormals included; -inf at 0,
+//            NaN below.
+//   sigmoid  3 ulp.
+//   tanh     2 ulp.
+//   erf      3 ulp.
+//   sin/cos  2 ulp for |x| <= 100, 4 ulp for |x| <= 1000. The three-part
+//            pi / 2 reduction loses accuracy with larger arguments.
+
+template<typename V>
+concept FloatVec = VecType<V> && std::is_same_v<typename V::value_type, float>;
+
+namespace detail {
+    template<FloatVec V>
+    using IntLanes = Vec<int32_t, V::LANES, V::INSTRUCTIONS>;
+
+    template<FloatVec V>
+    inline V splat(float value) {
+        return V::broadcast(value);
+    }
+
+    // c[0] * x^(N-1) + ... + c[N-1], Horner's scheme.
+    template<FloatVec V, size_t N>
+    inline V polynomial(const V& x, const float (&c)[N]) {
+        V result = splat<V>(c[0]);
+        for (size_t i = 1; i < N; ++i) {
+            result = fma(result, x, splat<V>(c[i]));
+        }
+        return result;
+    }
+
+    template<FloatVec V>
+    inline V abs(const V& x) {
+        return select_less(x, V::zero(), V::zero() - x, x);
+    }
+
+    // 2^n for integral n in [-126, 127], built in the exponent bits.
+    template<FloatVec V>
+    inline V exp2_int(const IntLanes<V>& n) {
+        return V::reinterpret((n + IntLanes<V>::broadcast(127)).template shift_left<23>());
+    }
+
+    // NaN where x is NaN, `value` elsewhere: x is neither below nor above
+    // infinity only when it is NaN.
+    template<FloatVec V>
+    inline V keep_nan(const V& x, const V& value) {
+        const V inf = splat<V>(std::numeric_limits<float>::infinity());
+        return select_less(x, inf, value, select_less(V::zero() - inf, x, value, x));
+    }
+
+    // Picks +-sin or +-cos of the reduced argument for quadrant q (0 to 4).
+    template<FloatVec V>
+    inline V quadrant(const V& q, const V& sin, const V& cos) {
+        const V neg_sin = V::zero() - sin;
+        const V neg_cos = V::zero() - cos;
+        return select_less(
+            q,
+            splat<V>(0.5F),
+            sin,
+            select_less(
+                q,
+                splat<V>(1.5F),
+                cos,
+                select_less(
+                    q,
+                    splat<V>(2.5F),
+                    neg_sin,
+                    select_less(q, splat<V>(3.5F), neg_cos, sin)
+                )
+            )
+        );
+    }
+
+    // sin and cos of x on [-pi / 4, pi / 4].
+    template<FloatVec V>
+    inline V sin_kernel(const V& x) {
+        constexpr float SIN[] {-1.9515295891E-4F, 8.3321608736E-3F, -1.6666654611E-1F};
+        const V z = x * x;
+        return fma(polynomial(z, SIN) * z, x, x);
+    }
+
+    template<FloatVec V>
+    inline V cos_kernel(const V& x) {
+        constexpr float COS[] {
+            2.443315711809948E-5F,
+            -1.388731625493765E-3F,
+            4.166664568298827E-2F,
+        };
+        const V z = x * x;
+        return fma(polynomial(z, COS) * z, z, splat<V>(1.0F) - (z * splat<V>(0.5F)));
+    }
+
+    // x - q * pi / 2 for q = round(x * 2 / pi), with the quadrant q mod 4.
+    // pi / 2 is split in three so the first two products are exact.
+    template<FloatVec V>
+    inline V reduce_half_pi(const V& x, V& quadrant) {
+        const V q = (x * splat<V>(0.636619772367581343F)).round();
+        const V r = fma(q, splat<V>(-1.5703125F), x);
+        const V reduced = fma(
+            q,
+            splat<V>(-7.54978995489188216E-8F),
+            fma(q, splat<V>(-4.837512969970703125E-4F), r)
+        );
+        quadrant = q - (splat<V>(4.0F) * fma(q, splat<V>(0.25F), splat<V>(-0.375F)).round());
+        return reduced;
+    }
+}  // namespace detail
+
+template<FloatVec V>
+inline V exp(const V& x) {
+    using I = detail::IntLanes<V>;
+    constexpr float POLY[] {
+        1.9875691500E-4F,
+        1.3981999507E-3F,
+        8.3334519073E-3F,
+        4.1665795894E-2F,
+        1.6666665459E-1F,
+        5.0000001201E-1F,
+    };
+    // Clamped so n fits the exponent; 89 still overflows to infinity and
+    // -104 underflows to 0. NaN is clamped too and restored at the end.
+    const V hi = detail::splat<V>(89.0F);
+    const V lo = detail::splat<V>(-104.0F);
+    V clamped = select_less(x, hi, x, hi);
+    clamped = select_less(clamped, lo, lo, clamped);
+
+    const V n = (clamped * detail::splat<V>(1.44269504088896341F)).round();
+    V r = fma(n, detail::splat<V>(-0.693359375F), clamped);
+    r = fma(n, detail::splat<V>(2.12194440E-4F), r);
+    const V z = r * r;
+    const V p = fma(detail::polynomial(r, POLY), z, r + detail::splat<V>(1.0F));
+
+    // 2^n in two halves, so denormal results and n = 128 stay in range.
+    const I ni = convert<int32_t>(n);
+    const I half = ni.template shift_right<1>();
+    const V result = p * detail::exp2_int<V>(half) * detail::exp2_int<V>(ni - half);
+    return detail::keep_nan(x, result);
+}
+
+template<FloatVec V>
+inline V log(const V& x) {
+    using I = detail::IntLanes<V>;
+    constexpr float POLY[] {
+        7.0376836292E-2F,
+        -1.1514610310E-1F,
+        1.1676998740E-1F,
+        -1.2420140846E-1F,
+        1.4249322787E-1F,
+        -1.6668057665E-1F,
+        2.0000714765E-1F,
+        -2.4999993993E-1F,
+        3.3333331174E-1F,
+    };
+    const V one = detail::splat<V>(1.0F);
+    const V min_normal = detail::splat<V>(std::numeric_limits<float>::min());
+
+    // Non-positive and NaN inputs are replaced by 1 for the bit arithmetic and
+    // fixed up at the end; denormals are scaled into the normal range.
+    V positive = select_less(V::zero(), x, x, one);
+    const V exponent_bias = select_less(positive, min_normal, detail::splat<V>(-23.0F), V::zero());
+    positive = select_less(positive, min_normal, positive * detail::splat<V>(8388608.0F), positive);
+
+    // positive = m * 2^e with m in [0.5, 1).
+    const I bits = I::reinterpret(positive);
+    const I e = bits.template shift_right<23>() - I::broadcast(126);
+    const V m = V::reinterpret(bits - e.template shift_left<23>());
+
+    // Moves m to [sqrt(0.5), sqrt(2)) so the polynomial argument is centred.
+    const V sqrt_half = detail::splat<V>(0.707106781186547524F);
+    const V exponent = convert<float>(e) + exponent_bias;
+    const V ef = select_less(m, sqrt_half, exponent - one, exponent);
+    const V r = select_less(m, sqrt_half, m + m - one, m - one);
+
+    const V z = r * r;
+    V y = detail::polynomial(r, POLY) * r * z;
+    y = fma(ef, detail::splat<V>(-2.12194440E-4F), y);
+    y = fma(z, detail::splat<V>(-0.5F), y);
+    V result = fma(ef, detail::splat<V>(0.693359375F), r + y);
+
+    const V inf = detail::splat<V>(std::numeric_limits<float>::infinity());
+    result = select_less(x, inf, result, x);
+    result = select_less(
+        x,
+        detail::splat<V>(std::numeric_limits<float>::denorm_min()),
+        V::zero() - inf,
+        result
+    );
+    return select_less(
+        x,
+        V::zero(),
+        detail::splat<V>(std::numeric_limits<float>::quiet_NaN()),
+        result
+    );
+}
+
+template<FloatVec V>
+inline V sigmoid(const V& x) {
+    // e^-|x| never overflows, and e / (1 + e) keeps the denormal tail of
+    // large negative inputs.
+    const V one = detail::splat<V>(1.0F);
+    const V e = exp(V::zero() - detail::abs(x));
+    const V inverse = one / (one + e);
+    return select_less(x, V::zero(), e * inverse, inverse);
+}
+
+template<FloatVec V>
+inline V tanh(const V& x) {
+    constexpr float POLY[] {
+        -5.70498872745E-3F,
+        2.06390887954E-2F,
+        -5.37397155531E-2F,
+        1.33314422036E-1F,
+        -3.33332819422E-1F,
+    };
+    const V one = detail::splat<V>(1.0F);
+    const V ax = detail::abs(x);
+    const V z = ax * ax;
+    const V small = fma(detail::polynomial(z, POLY) * z, ax, ax);
+    const V large = one - (detail::splat<V>(2.0F) / (exp(ax + ax) + one));
+    const V magnitude = select_less(ax, detail::splat<V>(0.625F), small, large);
+    return select_less(x, V::zero(), V::zero() - magnitude, magnitude);
+}
+
+template<FloatVec V>
+inline V erf(const V& x) {
+    // erf(x) / x as a polynomial in x^2 below 0.875, and erfc(x) * e^(x^2)
+    // as a polynomial in 1 / x above; erf rounds to 1 from 4 on.
+    constexpr float SMALL[] {
+        8.671110118E-5F,
+        -8.210111409E-4F,
+        5.206660833E-3F,
+        -2.686155029E-2F,
+        1.128373221E-1F,
+        -3.761263490E-1F,
+        1.128379226E+0F,
+    };
+    constexpr float LARGE[] {
+        1.398210134E-2F,
+        -8.617698401E-2F,
+        2.115125060E-1F,
+        -2.247056812E-1F,
+        -3.046648204E-2F,
+        3.801761866E-1F,
+        -4.298165143E-1F,
+        3.263936937E-2F,
+        5.602343678E-1F,
+        2.046988520E-4F,
+    };
+    const V one = detail::splat<V>(1.0F);
+    const V four = detail::splat<V>(4.0F);
+    V ax = detail::abs(x);
+    ax = select_less(four, ax, four, ax);
+
+    const V z = ax * ax;
+    const V small = detail::polynomial(z, SMALL) * ax;
+    const V large = one - (exp(V::zero() - z) * detail::polynomial(one / ax, LARGE));
+    const V magnitude = select_less(ax, detail::splat<V>(0.875F), small, large);
+    return select_less(x, V::zero(), V::zero() - magnitude, magnitude);
+}
+
+template<FloatVec V>
+inline V sin(const V& x) {
+    V q;
+    const V r = detail::reduce_half_pi(x, q);
+    return detail::quadrant(q, detail::sin_kernel(r), detail::cos_kernel(r));
+}
+
+template<FloatVec V>
+inline V cos(const V& x) {
+    V q;
+    const V r = detail::reduce_half_pi(x, q);
+    const V shifted = q + detail::splat<V>(1.0F);
+    return detail::quadrant(shifted, detail::sin_kernel(r), detail::cos_kernel(r));
+}
+
+}  // namespace p10::simd
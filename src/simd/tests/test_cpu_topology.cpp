@@ -0,0 +1,278 @@
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <p10_internal/simd/cpu_topology.hpp>
+#include <p10_internal/simd/parallel_for.hpp>
+#include <p10_internal/simd/tile2d.hpp>
+#include <ptensor/testing/output_path.hpp>
+
+#if defined(__linux__)
+    #include <sched.h>
+#endif
+
+namespace p10::simd {
+
+namespace {
+    void write_file(const std::filesystem::path& path, const std::string& text) {
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream(path) << text << '\n';
+    }
+
+    struct FakeCache {
+        int level;
+        std::string type;
+        std::string size;
+        std::string shared;
+    };
+
+    struct FakeCpu {
+        std::string siblings;
+        std::string capacity_file;  // "cpu_capacity" or "cpufreq/cpuinfo_max_freq"
+        int capacity;
+        std::vector<FakeCache> caches;
+    };
+
+    // Writes a sysfs CPU tree with just the files read_sysfs_topology reads.
+    std::filesystem::path write_sysfs(const std::string& name, const std::vector<FakeCpu>& cpus) {
+        const auto root = testing::get_output_path("simd/sysfs") / name;
+        std::filesystem::remove_all(root);
+        write_file(root / "online", "0-" + std::to_string(cpus.size() - 1));
+        for (size_t cpu = 0; cpu < cpus.size(); ++cpu) {
+            const auto dir = root / ("cpu" + std::to_string(cpu));
+            write_file(dir / "topology/physical_package_id", "0");
+            write_file(dir / "topology/thread_siblings_list", cpus[cpu].siblings);
+            write_file(dir / cpus[cpu].capacity_file, std::to_string(cpus[cpu].capacity));
+            for (size_t index = 0; index < cpus[cpu].caches.size(); ++index) {
+                const auto& cache = cpus[cpu].caches[index];
+                const auto cache_dir = dir / "cache" / ("index" + std::to_string(index));
+                write_file(cache_dir / "level", std::to_string(cache.level));
+                write_file(cache_dir / "type", cache.type);
+                write_file(cache_dir / "size", cache.size);
+                write_file(cache_dir / "shared_cpu_list", cache.shared);
+            }
+        }
+        return root;
+    }
+}  // namespace
+
+TEST_CASE("Simd::parse_cpu_list", "[simd][topology]") {
+    REQUIRE(parse_cpu_list("0-3,8,10-11\n") == std::vector<int> {0, 1, 2, 3, 8, 10, 11});
+    REQUIRE(parse_cpu_list("5") == std::vector<int> {5});
+    REQUIRE(parse_cpu_list("").empty());
+    REQUIRE(parse_cpu_list("3-1").empty());
+    REQUIRE(parse_cpu_list("0,x").empty());
+}
+
+TEST_CASE("Simd::read_sysfs_topology on a hybrid two-cache part", "[simd][topology]") {
+    // Three SMT performance cores and two efficiency cores, split across two
+    // last-level caches: {0,1,4,5} and {2,3,6,7}.
+    const auto p_core = [](const std::string& siblings, const std::string& llc) {
+        return FakeCpu {
+            siblings,
+            "cpufreq/cpuinfo_max_freq",
+            5000000,
+            {{1, "Data", "48K", siblings},
+             {1, "Instruction", "32K", siblings},
+             {2, "Unified", "2048K", siblings},
+             {3, "Unified", "32M", llc}}
+        };
+    };
+    const auto e_core = [](const std::string& cpu) {
+        return FakeCpu {
+            cpu,
+            "cpufreq/cpuinfo_max_freq",
+            3600000,
+            {{1, "Data", "32K", cpu},
+             {2, "Unified", "4096K", "6-7"},
+             {3, "Unified", "32M", "2-3,6-7"}}
+        };
+    };
+    const auto root = write_sysfs(
+        "hybrid",
+        {p_core("0-1", "0-1,4-5"),
+         p_core("0-1", "0-1,4-5"),
+         p_core("2-3", "2-3,6-7"),
+         p_core("2-3", "2-3,6-7"),
+         p_core("4-5", "0-1,4-5"),
+         p_core("4-5", "0-1,4-5"),
+         e_core("6"),
+         e_core("7")}
+    );
+
+    const CpuTopology topology = read_sysfs_topology(root.string());
+    REQUIRE(topology.cpus.size() == 8);
+    REQUIRE(topology.core_count == 5);
+    REQUIRE(topology.llc_group_count == 2);
+
+    const CpuInfo& sibling = *topology.find(1);
+    REQUIRE(sibling.core == topology.find(0)->core);
+    REQUIRE(sibling.smt_index == 1);
+    REQUIRE(sibling.capacity == 1024);
+    REQUIRE(sibling.l1_bytes == 48 * 1024);
+    REQUIRE(sibling.l2_bytes == 2048 * 1024);
+    REQUIRE(sibling.llc_bytes == 32 * 1024 * 1024);
+
+    const CpuInfo& efficient = *topology.find(6);
+    REQUIRE(efficient.capacity == (3600 * 1024) / 5000);
+    REQUIRE(efficient.l2_group == topology.find(7)->l2_group);
+    REQUIRE(efficient.l2_group != topology.find(0)->l2_group);
+    REQUIRE(efficient.llc_group == topology.find(2)->llc_group);
+
+    // One thread per performance core, the two sharing a cache first.
+    REQUIRE(topology.worker_cpus == std::vector<int> {0, 4, 2});
+}
+
+TEST_CASE("Simd::read_sysfs_topology with a single big core", "[simd][topology]") {
+    // big.LITTLE with cpu_capacity: one fast core alone would serialize the
+    // tiles, so every core is a worker.
+    const FakeCache l1 {1, "Data", "64K", ""};
+    const auto root = write_sysfs(
+        "big_little",
+        {{"0", "cpu_capacity", 1024, {l1, {2, "Unified", "1024K", "0"}}},
+         {"1", "cpu_capacity", 446, {l1, {2, "Unified", "512K", "1-3"}}},
+         {"2", "cpu_capacity", 446, {l1, {2, "Unified", "512K", "1-3"}}},
+         {"3", "cpu_capacity", 446, {l1, {2, "Unified", "512K", "1-3"}}}}
+    );
+
+    const CpuTopology topology = read_sysfs_topology(root.string());
+    REQUIRE(topology.core_count == 4);
+    REQUIRE(topology.find(2)->capacity == 446);
+    // Without an L3 the L2 is the last-level cache.
+    REQUIRE(topology.llc_group_count == 2);
+    REQUIRE(topology.worker_cpus == std::vector<int> {0, 1, 2, 3});
+}
+
+TEST_CASE("Simd::read_sysfs_topology without sysfs", "[simd][topology]") {
+    REQUIRE(read_sysfs_topology("/nonexistent/cpu").cpus.empty());
+
+    const CpuTopology flat = flat_cpu_topology(3);
+    REQUIRE(flat.core_count == 3);
+    REQUIRE(flat.worker_cpus == std::vector<int> {0, 1, 2});
+}
+
+TEST_CASE("Simd::cpu_topology describes this machine", "[simd][topology]") {
+    const CpuTopology& topology = cpu_topology();
+    REQUIRE_FALSE(topology.cpus.empty());
+    REQUIRE_FALSE(topology.worker_cpus.empty());
+    for (const int cpu : topology.worker_cpus) {
+        REQUIRE(topology.find(cpu) != nullptr);
+    }
+}
+
+TEST_CASE("Simd::worker_cpu_for_slot", "[simd][topology]") {
+    // The caller floats and every worker CPU, the first included, gets a slot.
+    const std::vector<int> workers {0, 4, 2};
+    REQUIRE(worker_cpu_for_slot(workers, 0) == -1);
+    REQUIRE(worker_cpu_for_slot(workers, 1) == 0);
+    REQUIRE(worker_cpu_for_slot(workers, 2) == 4);
+    REQUIRE(worker_cpu_for_slot(workers, 3) == 2);
+    REQUIRE(worker_cpu_for_slot(workers, 4) == -1);
+    REQUIRE(worker_cpu_for_slot({}, 1) == -1);
+}
+
+TEST_CASE("Simd::pin_current_thread", "[simd][topology]") {
+#if defined(__linux__)
+    // Catch assertions are not thread-safe; check the results after joining.
+    const int cpu = cpu_topology().worker_cpus.back();
+    bool pinned = false;
+    int ran_on = -1;
+    bool unpinned = false;
+    std::thread worker([&]() {
+        pinned = pin_current_thread(cpu);
+        ran_on = sched_getcpu();
+        unpinned = unpin_current_thread();
+    });
+    worker.join();
+    REQUIRE(pinned);
+    REQUIRE(ran_on == cpu);
+    REQUIRE(unpinned);
+#endif
+}
+
+TEST_CASE("Simd::parallel regions leave the caller's affinity alone", "[simd][topology]") {
+#if defined(__linux__)
+    const bool affinity = is_thread_affinity_enabled();
+    set_thread_affinity(true);
+    // Catch assertions are not thread-safe; check the results after joining.
+    bool before_ok = false;
+    bool after_for = false;
+    bool after_tile = false;
+    std::thread caller([&]() {
+        cpu_set_t before;
+        before_ok = sched_getaffinity(0, sizeof(before), &before) == 0;
+
+        std::vector<int64_t> jobs(64, 0);
+        parallel_for(64, 4, [&](int64_t job) { jobs[job] = job; });
+        cpu_set_t mask;
+        after_for = sched_getaffinity(0, sizeof(mask), &mask) == 0 && CPU_EQUAL(&mask, &before);
+
+        std::vector<int32_t> data(512 * 512, 0);
+        const auto kernel = [&](const Region2D& region) {
+            for (int64_t row = region.row; row < region.row + region.height; ++row) {
+                for (int64_t col = region.col; col < region.col + region.width; ++col) {
+                    data[(row * 512) + col] += 1;
+                }
+            }
+        };
+        tile2d<int32_t, TileExecution::PARALLEL>(
+            512,
+            512,
+            TileBorder {},
+            kernel,
+            Portable<8, int32_t>(kernel)
+        );
+        after_tile = sched_getaffinity(0, sizeof(mask), &mask) == 0 && CPU_EQUAL(&mask, &before);
+    });
+    caller.join();
+    set_thread_affinity(affinity);
+
+    REQUIRE(before_ok);
+    REQUIRE(after_for);
+    REQUIRE(after_tile);
+#endif
+}
+
+TEST_CASE("Simd::tile2d runs with pinned workers", "[simd][topology][tile]") {
+    constexpr int64_t ROWS = 1100;
+    constexpr int64_t COLS = 1050;
+    const bool affinity = is_thread_affinity_enabled();
+    set_thread_affinity(true);
+#ifdef _OPENMP
+    REQUIRE(parallel_thread_count() == static_cast<int>(cpu_topology().worker_cpus.size()) + 1);
+#endif
+
+    std::vector<int32_t> data(ROWS * COLS, 0);
+    const auto kernel = [&](const Region2D& region) {
+        for (int64_t row = region.row; row < region.row + region.height; ++row) {
+            for (int64_t col = region.col; col < region.col + region.width; ++col) {
+                data[(row * COLS) + col] += 1;
+            }
+        }
+    };
+    tile2d<int32_t, TileExecution::PARALLEL>(
+        ROWS,
+        COLS,
+        TileBorder {},
+        kernel,
+        Portable<8, int32_t>(kernel)
+    );
+    set_thread_affinity(affinity);
+    // Release the pins before other tests run.
+    tile2d<int32_t, TileExecution::PARALLEL>(
+        ROWS,
+        COLS,
+        TileBorder {},
+        kernel,
+        Portable<8, int32_t>(kernel)
+    );
+
+    for (const int32_t value : data) {
+        REQUIRE(value == 2);
+    }
+}
+
+}  // namespace p10::simd
@@ -1,6 +1,10 @@
+#include <vector>
+
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
 #include <p10_internal/simd/tile1d.hpp>
+#include <p10_internal/simd/vec.hpp>
 #include <ptensor/tensor.hpp>
 #include <ptensor/testing/catch2_assertions.hpp>
 #include <ptensor/testing/compare_tensors.hpp>
@@ -40,4 +44,70 @@ TEST_CASE("Simd::tile1d", "[simd][tile]") {
     }
 }
 
+TEST_CASE("Simd::tile1d dispatches to the first supported kernel", "[simd][tile]") {
+    constexpr int64_t SIZE = 1000;
+    bool avx2_ran = false;
+    bool sse41_ran = false;
+    bool portable_ran = false;
+    int64_t scalar_elements = 0;
+
+    tile1d<int32_t>(
+        SIZE,
+        [&](const TileRegion1D& region) { scalar_elements += region.size; },
+        Avx2_1D<8, int32_t>([&](const TileRegion1D&) { avx2_ran = true; }),
+        Sse41_1D<8, int32_t>([&](const TileRegion1D&) { sse41_ran = true; }),
+        Portable_1D<8, int32_t>([&](const TileRegion1D&) { portable_ran = true; })
+    );
+
+    // Exactly one kernel runs: the first the compiler and CPU support.
+    const bool avx2 = is_compiler_supported(SimdSet::AVX2) && is_supported(SimdSet::AVX2);
+    const bool sse41 = is_compiler_supported(SimdSet::SSE41) && is_supported(SimdSet::SSE41);
+    REQUIRE(avx2_ran == avx2);
+    REQUIRE(sse41_ran == (!avx2 && sse41));
+    REQUIRE(portable_ran == (!avx2 && !sse41));
+    REQUIRE(scalar_elements == SIZE % 8);
+
+    // A kernel for another scalar type is skipped.
+    bool float_ran = false;
+    tile1d<int32_t>(
+        SIZE,
+        [](const TileRegion1D&) {},
+        Portable_1D<8, float>([&](const TileRegion1D&) { float_ran = true; })
+    );
+    REQUIRE_FALSE(float_ran);
+}
+
+TEST_CASE("Simd::tile1d PARALLEL covers every element once", "[simd][tile]") {
+    // Long enough to split across workers, with a scalar tail.
+    const int64_t size = GENERATE(int64_t {100}, (TILE1D_MIN_GRAIN * 9) + 5);
+    std::vector<float> data(static_cast<size_t>(size), 1.5F);
+
+    const auto twice = [&]<SimdSet S>() {
+        return Tiered_1D<S, 16, float>([&data](const TileRegion1D& region) {
+            using V = NativeVec<float, S>;
+            for (int64_t i = region.offset; i < region.offset + region.size; i += V::LANES) {
+                (V::load(&data[i]) * V::broadcast(2.0F)).store(&data[i]);
+            }
+        });
+    };
+    tile1d<float, TileExecution::PARALLEL>(
+        size,
+        [&](const TileRegion1D& region) {
+            for (int64_t i = region.offset; i < region.offset + region.size; ++i) {
+                data[i] += 1.0F;
+            }
+        },
+        twice.template operator()<SimdSet::AVX2>(),
+        twice.template operator()<SimdSet::SSE41>(),
+        twice.template operator()<SimdSet::AdvSIMD>(),
+        twice.template operator()<SimdSet::NONE>()
+    );
+
+    // Doubled (3.0) by the vector kernel, incremented (2.5) in the tail.
+    const int64_t tiled = size - (size % 16);
+    for (int64_t i = 0; i < size; ++i) {
+        REQUIRE(data[i] == (i < tiled ? 3.0F : 2.5F));
+    }
+}
+
 }  // namespace p10::simd
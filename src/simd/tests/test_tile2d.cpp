@@ -105,6 +105,27 @@ TEST_CASE("Simd::tile2d", "[simd][tile]") {
     REQUIRE_THAT(testing::compare_tensors(output_image, expected_image), testing::is_ok());
 }
 
+TEST_CASE("Simd::tile2d dispatches the SSE4.1 tier", "[simd][tile]") {
+    bool sse41_ran = false;
+    bool portable_ran = false;
+
+    tile2d<int32_t>(
+        256,
+        256,
+        TileBorder {},
+        [](auto) {},
+        Sse41<SIMD_BLOCK, int32_t>([&](auto) { sse41_ran = true; }),
+        Portable<SIMD_BLOCK, int32_t>([&](auto) { portable_ran = true; })
+    );
+
+    // SSE4.1 wins whenever the target can emit it and the CPU has it; anything
+    // else (non-x86, pre-SSE4.1 CPUs) falls through to the portable kernel.
+    const bool expect_sse41 =
+        is_compiler_supported(SimdSet::SSE41) && is_supported(SimdSet::SSE41);
+    REQUIRE(sse41_ran == expect_sse41);
+    REQUIRE(portable_ran == !expect_sse41);
+}
+
 TEST_CASE("Simd::tile2d_blocked border", "[simd][tile]") {
     // Paint every cell each kernel visits; the split must cover the domain
     // exactly once, with the SIMD kernel confined to the halo-inset interior.
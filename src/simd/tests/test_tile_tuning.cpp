@@ -0,0 +1,202 @@
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <p10_internal/simd/tile1d.hpp>
+#include <p10_internal/simd/tile2d.hpp>
+#include <p10_internal/simd/tile_tuning.hpp>
+#include <ptensor/tensor.hpp>
+#include <ptensor/testing/catch2_assertions.hpp>
+#include <ptensor/testing/compare_tensors.hpp>
+#include <ptensor/testing/output_path.hpp>
+
+namespace p10::simd {
+
+namespace {
+    // Restores the global tuning state a test changes.
+    struct TuningGuard {
+        bool autotune = is_autotune_enabled();
+        std::string path = tile_tuning_path();
+
+        ~TuningGuard() {
+            set_autotune(autotune);
+            (void)load_tile_tuning(path);
+        }
+    };
+}  // namespace
+
+TEST_CASE("Simd::tile2d_tuned records the fastest tiling", "[simd][tile][tuning]") {
+    constexpr int64_t ROWS = 1360;
+    constexpr int64_t COLS = 1220;
+    const TuningGuard guard;
+    set_autotune(true);
+
+    const auto int32 = TensorOptions().dtype(Dtype::Int32);
+    const Tensor input = Tensor::from_range(make_shape(ROWS, COLS), int32).unwrap();
+    const auto src = input.as_span2d<const int32_t>().unwrap();
+    Tensor output;
+    output.create(make_shape(COLS, ROWS), int32);
+    auto dst = output.as_span2d<int32_t>().unwrap();
+
+    const auto transpose = [&](const Region2D& region) {
+        for (int64_t row = region.row; row < region.row + region.height; ++row) {
+            for (int64_t col = region.col; col < region.col + region.width; ++col) {
+                dst[col][row] = src[row][col];
+            }
+        }
+    };
+
+    const TileTuningKey key {
+        .kernel = "test_tuned_transpose",
+        .instructions = SimdSet::NONE,
+        .scalar_bytes = sizeof(int32_t),
+        .rows_bucket = tile_shape_bucket(ROWS),
+        .cols_bucket = tile_shape_bucket(COLS),
+    };
+    REQUIRE_FALSE(find_tile_choice(key).has_value());
+
+    tile2d_tuned<int32_t, TileExecution::PARALLEL>(
+        key.kernel,
+        ROWS,
+        COLS,
+        TileBorder {},
+        transpose,
+        Portable<8, int32_t>(transpose)
+    );
+
+    // The tuner's repeated runs leave a complete transpose behind.
+    Tensor expected;
+    REQUIRE_THAT(input.transpose(expected), testing::is_ok());
+    REQUIRE_THAT(testing::compare_tensors(output, expected), testing::is_ok());
+
+    const auto choice = find_tile_choice(key);
+    REQUIRE(choice.has_value());
+    REQUIRE(choice->cache_block >= 32);
+    REQUIRE(choice->cache_block <= 1024);
+}
+
+TEST_CASE("Simd::dynamic_tile1d_tuned records the fastest block", "[simd][tile][tuning]") {
+    const TuningGuard guard;
+    set_autotune(true);
+
+    std::vector<float> data(100003, 1.0F);
+    const auto twice = [&](TileRegion1D region) {
+        for (int64_t i = region.offset; i < region.offset + region.size; ++i) {
+            data[i] = 2.0F;
+        }
+    };
+    const auto size = static_cast<int64_t>(data.size());
+    dynamic_tile1d_tuned<8, float>("test_tuned_fill", SimdSet::SSE41, size, twice, twice);
+
+    for (const float value : data) {
+        REQUIRE(value == 2.0F);
+    }
+    const auto choice = find_tile_choice({
+        .kernel = "test_tuned_fill",
+        .instructions = SimdSet::SSE41,
+        .scalar_bytes = sizeof(float),
+        .rows_bucket = 0,
+        .cols_bucket = tile_shape_bucket(size),
+    });
+    REQUIRE(choice.has_value());
+
+    // Each tier keeps its own choice.
+    const TileTuningKey portable_key {
+        .kernel = "test_tuned_fill",
+        .instructions = SimdSet::NONE,
+        .scalar_bytes = sizeof(float),
+        .rows_bucket = 0,
+        .cols_bucket = tile_shape_bucket(size),
+    };
+    REQUIRE_FALSE(find_tile_choice(portable_key).has_value());
+}
+
+TEST_CASE("Simd::tile tuning writes new choices on flush", "[simd][tile][tuning]") {
+    const TuningGuard guard;
+    const auto directory = testing::get_output_path("simd/tuning");
+    const std::string path = (directory / "tile-tuning-flush.txt").string();
+    std::filesystem::remove(path);
+    REQUIRE(load_tile_tuning(path));
+
+    const TileTuningKey key {
+        .kernel = "test_flushed",
+        .instructions = SimdSet::NONE,
+        .scalar_bytes = 1,
+        .rows_bucket = 9,
+        .cols_bucket = 9,
+    };
+    record_tile_choice(key, {.cache_block = 128, .execution = TileExecution::SEQUENTIAL});
+    REQUIRE_FALSE(std::filesystem::exists(path));
+    REQUIRE(flush_tile_tuning());
+
+    clear_tile_choices();
+    REQUIRE(load_tile_tuning(path));
+    const auto choice = find_tile_choice(key);
+    REQUIRE(choice.has_value());
+    REQUIRE(choice->cache_block == 128);
+}
+
+TEST_CASE("Simd::tile tuning cache round trip", "[simd][tile][tuning]") {
+    const TuningGuard guard;
+    const auto directory = testing::get_output_path("simd/tuning");
+    const std::string path = (directory / "tile-tuning.txt").string();
+
+    const TileTuningKey key {
+        .kernel = "test_cached",
+        .instructions = SimdSet::AVX2,
+        .scalar_bytes = 4,
+        .rows_bucket = 10,
+        .cols_bucket = 11,
+    };
+    record_tile_choice(key, {.cache_block = 256, .execution = TileExecution::PARALLEL});
+    REQUIRE(save_tile_tuning(path));
+
+    clear_tile_choices();
+    REQUIRE_FALSE(find_tile_choice(key).has_value());
+
+    REQUIRE(load_tile_tuning(path));
+    const auto choice = find_tile_choice(key);
+    REQUIRE(choice.has_value());
+    REQUIRE(choice->cache_block == 256);
+    REQUIRE(choice->execution == TileExecution::PARALLEL);
+
+    const std::string malformed = (directory / "malformed.txt").string();
+    std::ofstream(malformed) << "test_cached avx2 four 10 11 256 parallel\n";
+    REQUIRE_FALSE(load_tile_tuning(malformed));
+}
+
+TEST_CASE("Simd::tile tuning never overwrites a malformed cache", "[simd][tile][tuning]") {
+    const TuningGuard guard;
+    const auto directory = testing::get_output_path("simd/tuning");
+    const std::string previous = (directory / "tile-tuning-previous.txt").string();
+    const std::string corrupt = (directory / "tile-tuning-corrupt.txt").string();
+    std::filesystem::remove(previous);
+    REQUIRE(load_tile_tuning(previous));
+
+    const std::string contents = "not a tuning cache\n";
+    std::ofstream(corrupt, std::ios::trunc) << contents;
+    REQUIRE_FALSE(load_tile_tuning(corrupt));
+    REQUIRE(tile_tuning_path() == previous);
+
+    record_tile_choice(
+        {
+            .kernel = "test_corrupt",
+            .instructions = SimdSet::NONE,
+            .scalar_bytes = 1,
+            .rows_bucket = 3,
+            .cols_bucket = 3,
+        },
+        {.cache_block = 64, .execution = TileExecution::SEQUENTIAL}
+    );
+    REQUIRE(flush_tile_tuning());
+
+    std::ifstream in(corrupt);
+    const std::string after((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    REQUIRE(after == contents);
+    REQUIRE(std::filesystem::exists(previous));
+}
+
+}  // namespace p10::simd
@@ -0,0 +1,201 @@
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <p10_internal/simd/vec_math.hpp>
+
+namespace p10::simd {
+
+namespace {
+    enum MathFn : uint8_t { EXP, LOG, SIGMOID, TANH, ERF, SIN, COS };
+
+    template<FloatVec V>
+    V apply(MathFn fn, const V& x) {
+        switch (fn) {
+            case EXP:
+                return simd::exp(x);
+            case LOG:
+                return simd::log(x);
+            case SIGMOID:
+                return simd::sigmoid(x);
+            case TANH:
+                return simd::tanh(x);
+            case ERF:
+                return simd::erf(x);
+            case SIN:
+                return simd::sin(x);
+            case COS:
+                return simd::cos(x);
+        }
+        return x;
+    }
+
+    double reference(MathFn fn, double x) {
+        switch (fn) {
+            case EXP:
+                return std::exp(x);
+            case LOG:
+                return std::log(x);
+            case SIGMOID:
+                return 1.0 / (1.0 + std::exp(-x));
+            case TANH:
+                return std::tanh(x);
+            case ERF:
+                return std::erf(x);
+            case SIN:
+                return std::sin(x);
+            case COS:
+                return std::cos(x);
+        }
+        return x;
+    }
+
+    // |actual - expected| in units of the float spacing at expected, with
+    // denormal spacing below the normal range.
+    double ulp_error(float actual, double expected) {
+        const auto rounded = static_cast<float>(expected);
+        if (std::isinf(rounded)) {
+            return actual == rounded ? 0.0 : std::numeric_limits<double>::infinity();
+        }
+        int exponent = 0;
+        std::frexp(rounded, &exponent);
+        const double spacing = std::ldexp(1.0, std::max(exponent - 24, -149));
+        return std::abs(static_cast<double>(actual) - expected) / spacing;
+    }
+
+    // Every `stride`-th float in [lo, hi], both signs, padded to whole
+    // registers.
+    std::vector<float> sample(float lo, float hi, uint32_t stride) {
+        std::vector<float> values;
+        for (const uint32_t sign : {0u, 0x80000000u}) {
+            for (uint32_t bits = 0; bits < 0x7f800000u; bits += stride) {
+                const float x = std::bit_cast<float>(bits | sign);
+                if (x >= lo && x <= hi) {
+                    values.push_back(x);
+                }
+            }
+        }
+        values.resize((values.size() + 15) / 16 * 16, 1.0F);
+        return values;
+    }
+
+    template<SimdSet S>
+    std::vector<float> run_in_tier(MathFn fn, const std::vector<float>& x) {
+        std::vector<float> result(x.size());
+        call_in_tier<S>([&]() {
+            using V = NativeVec<float, S>;
+            for (size_t i = 0; i < x.size(); i += V::LANES) {
+                apply(fn, V::load(&x[i])).store(&result[i]);
+            }
+        });
+        return result;
+    }
+
+    std::vector<float> run_one_lane(MathFn fn, const std::vector<float>& x) {
+        using V = Vec<float, 1, SimdSet::NONE>;
+        std::vector<float> result(x.size());
+        for (size_t i = 0; i < x.size(); ++i) {
+            apply(fn, V::load(&x[i])).store(&result[i]);
+        }
+        return result;
+    }
+
+    // Bit-exact against the one-lane reference on every tier the CPU has.
+    template<SimdSet S>
+    void check_tier(MathFn fn, const std::vector<float>& x, const std::vector<float>& expected) {
+        if (!is_compiler_supported(S) || !is_cpu_supported(S)) {
+            return;
+        }
+        CAPTURE(simd_set_name(S));
+        const auto actual = run_in_tier<S>(fn, x);
+        for (size_t i = 0; i < x.size(); ++i) {
+            CAPTURE(x[i]);
+            REQUIRE(std::bit_cast<uint32_t>(actual[i]) == std::bit_cast<uint32_t>(expected[i]));
+        }
+    }
+
+    struct Accuracy {
+        MathFn fn;
+        float lo;
+        float hi;
+        double max_ulp;
+    };
+}  // namespace
+
+TEST_CASE("Simd::vec_math stays within its documented error", "[simd][vec][math]") {
+    const std::vector<Accuracy> cases {
+        {EXP, -103.0F, 88.7F, 2.0},
+        {LOG, 0.0F, std::numeric_limits<float>::max(), 1.0},
+        {SIGMOID, -100.0F, 100.0F, 3.0},
+        {TANH, -10.0F, 10.0F, 2.0},
+        {ERF, -5.0F, 5.0F, 3.0},
+        {SIN, -100.0F, 100.0F, 2.0},
+        {COS, -100.0F, 100.0F, 2.0},
+        {SIN, -1000.0F, 1000.0F, 4.0},
+        {COS, -1000.0F, 1000.0F, 4.0},
+    };
+    for (const auto& accuracy : cases) {
+        CAPTURE(accuracy.fn, accuracy.lo, accuracy.hi);
+        // A prime stride samples every exponent and many mantissas.
+        const auto x = sample(accuracy.lo, accuracy.hi, 4099);
+        const auto result = run_one_lane(accuracy.fn, x);
+        double worst = 0.0;
+        for (size_t i = 0; i < x.size(); ++i) {
+            const double error = ulp_error(result[i], reference(accuracy.fn, x[i]));
+            worst = std::max(worst, error);
+        }
+        CAPTURE(worst);
+        REQUIRE(worst <= accuracy.max_ulp);
+
+        check_tier<SimdSet::SSE41>(accuracy.fn, x, result);
+        check_tier<SimdSet::AVX2>(accuracy.fn, x, result);
+        check_tier<SimdSet::AdvSIMD>(accuracy.fn, x, result);
+    }
+}
+
+TEST_CASE("Simd::vec_math special values", "[simd][vec][math]") {
+    using V = Vec<float, 1, SimdSet::NONE>;
+    constexpr float INF = std::numeric_limits<float>::infinity();
+    constexpr float NAN_VALUE = std::numeric_limits<float>::quiet_NaN();
+    const auto eval = [](MathFn fn, float x) {
+        float result = 0.0F;
+        apply(fn, V::broadcast(x)).store(&result);
+        return result;
+    };
+
+    for (const MathFn fn : {EXP, LOG, SIGMOID, TANH, ERF, SIN, COS}) {
+        CAPTURE(fn);
+        REQUIRE(std::isnan(eval(fn, NAN_VALUE)));
+    }
+
+    REQUIRE(eval(EXP, INF) == INF);
+    REQUIRE(eval(EXP, -INF) == 0.0F);
+    REQUIRE(eval(EXP, 0.0F) == 1.0F);
+    REQUIRE(eval(EXP, 100.0F) == INF);
+    REQUIRE(eval(EXP, -104.0F) == 0.0F);
+    // The smallest denormal, e^-103.28, survives.
+    REQUIRE(eval(EXP, -103.2F) > 0.0F);
+
+    REQUIRE(eval(LOG, INF) == INF);
+    REQUIRE(eval(LOG, 0.0F) == -INF);
+    REQUIRE(eval(LOG, 1.0F) == 0.0F);
+    REQUIRE(std::isnan(eval(LOG, -1.0F)));
+    REQUIRE(std::isnan(eval(LOG, -INF)));
+
+    REQUIRE(eval(SIGMOID, INF) == 1.0F);
+    REQUIRE(eval(SIGMOID, -INF) == 0.0F);
+    REQUIRE(eval(SIGMOID, 0.0F) == 0.5F);
+    REQUIRE(eval(TANH, INF) == 1.0F);
+    REQUIRE(eval(TANH, -INF) == -1.0F);
+    REQUIRE(eval(ERF, INF) == 1.0F);
+    REQUIRE(eval(ERF, -INF) == -1.0F);
+    REQUIRE(std::isnan(eval(SIN, INF)));
+    REQUIRE(std::isnan(eval(COS, -INF)));
+    REQUIRE(eval(COS, 0.0F) == 1.0F);
+}
+
+}  // namespace p10::simd
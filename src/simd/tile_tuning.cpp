@@ -0,0 +1,276 @@
+#include <atomic>
+#include <bit>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+#include <p10_internal/simd/tile_tuning.hpp>
+
+namespace p10::simd {
+
+namespace {
+    constexpr std::string_view CACHE_HEADER = "# ptensor tile tuning v1";
+
+    // Orders keys field by field, so lookups compare the caller's key in place
+    // instead of formatting it into a string.
+    struct KeyLess {
+        bool operator()(const TileTuningKey& a, const TileTuningKey& b) const {
+            return std::tie(a.kernel, a.instructions, a.scalar_bytes, a.rows_bucket, a.cols_bucket)
+                < std::tie(b.kernel, b.instructions, b.scalar_bytes, b.rows_bucket, b.cols_bucket);
+        }
+    };
+
+    bool write_cache(
+        const std::string& path,
+        const std::map<TileTuningKey, TileChoice, KeyLess>& choices
+    );
+
+    struct TuningTable {
+        std::mutex mutex;
+        // Owns the kernel names the stored keys view; set nodes never move.
+        std::set<std::string, std::less<>> kernel_names;
+        std::map<TileTuningKey, TileChoice, KeyLess> choices;
+        std::string path;
+        // Choices recorded since the cache file was last written.
+        bool dirty = false;
+        // Read without the mutex by find_tile_choice's fast path.
+        std::atomic<bool> loaded_environment {false};
+        std::atomic<bool> empty {true};
+
+        TuningTable() = default;
+        TuningTable(const TuningTable&) = delete;
+        TuningTable& operator=(const TuningTable&) = delete;
+
+        ~TuningTable() {
+            if (dirty && !path.empty()) {
+                (void)write_cache(path, choices);
+            }
+        }
+    };
+
+    TuningTable& table() {
+        static TuningTable instance;
+        return instance;
+    }
+
+    bool autotune_from_environment() {
+        const char* value = std::getenv("PTENSOR_AUTOTUNE");
+        if (value == nullptr) {
+            return false;
+        }
+        const std::string_view flag = value;
+        return flag == "1" || flag == "on" || flag == "true";
+    }
+
+    std::atomic<bool>& autotune_flag() {
+        static std::atomic<bool> enabled {autotune_from_environment()};
+        return enabled;
+    }
+
+    // Stores `choice` under a copy of `key` whose kernel name the table owns.
+    void store_locked(TuningTable& tuning, const TileTuningKey& key, TileChoice choice) {
+        TileTuningKey stored = key;
+        stored.kernel = *tuning.kernel_names.emplace(key.kernel).first;
+        tuning.choices.insert_or_assign(stored, choice);
+        tuning.empty.store(false, std::memory_order_release);
+    }
+
+    // One line of the cache file:
+    //   <kernel> <instructions> <scalar bytes> <rows bucket> <cols bucket>
+    //   <cache block> <execution>
+    struct CacheLine {
+        std::string kernel;
+        TileTuningKey key;
+        TileChoice choice;
+    };
+
+    // Parses the cache file into `lines`; false on a malformed line.
+    bool read_cache(std::istream& in, std::vector<CacheLine>& lines) {
+        std::string line;
+        while (std::getline(in, line)) {
+            if (line.empty() || line.front() == '#') {
+                continue;
+            }
+            std::istringstream fields(line);
+            CacheLine parsed;
+            std::string instructions;
+            std::string execution;
+            fields >> parsed.kernel >> instructions >> parsed.key.scalar_bytes
+                >> parsed.key.rows_bucket >> parsed.key.cols_bucket >> parsed.choice.cache_block
+                >> execution;
+            const auto set = simd_set_from_name(instructions);
+            if (fields.fail() || !set || parsed.choice.cache_block <= 0
+                || (execution != "sequential" && execution != "parallel")) {
+                return false;
+            }
+            parsed.key.instructions = *set;
+            parsed.choice.execution =
+                execution == "parallel" ? TileExecution::PARALLEL : TileExecution::SEQUENTIAL;
+            lines.push_back(std::move(parsed));
+        }
+        return true;
+    }
+
+    bool write_cache(
+        const std::string& path,
+        const std::map<TileTuningKey, TileChoice, KeyLess>& choices
+    ) {
+        std::ofstream out(path, std::ios::trunc);
+        if (!out) {
+            return false;
+        }
+        out << CACHE_HEADER << " (l1 " << l1_cache_size() << " bytes, l2 " << l2_cache_size()
+            << " bytes)\n";
+        out << "# kernel instructions scalar_bytes rows_bucket cols_bucket cache_block execution\n";
+        for (const auto& [key, choice] : choices) {
+            out << key.kernel << ' ' << simd_set_name(key.instructions) << ' ' << key.scalar_bytes
+                << ' ' << key.rows_bucket << ' ' << key.cols_bucket << ' ' << choice.cache_block
+                << ' ' << (choice.execution == TileExecution::PARALLEL ? "parallel" : "sequential")
+                << '\n';
+        }
+        return static_cast<bool>(out);
+    }
+
+    // Writes pending choices to the current cache file, if any.
+    bool flush_locked(TuningTable& tuning) {
+        if (!tuning.dirty || tuning.path.empty()) {
+            return true;
+        }
+        if (!write_cache(tuning.path, tuning.choices)) {
+            return false;
+        }
+        tuning.dirty = false;
+        return true;
+    }
+
+    // Switches to the cache file at `path`. A malformed file is rejected before
+    // anything changes, so the previous path and choices stay in place and the
+    // file is never overwritten by a later flush.
+    bool load_locked(TuningTable& tuning, const std::string& path) {
+        std::vector<CacheLine> loaded;
+        if (!path.empty()) {
+            std::ifstream in(path);
+            // A missing file means nothing was tuned yet.
+            if (in && !read_cache(in, loaded)) {
+                return false;
+            }
+        }
+        if (path != tuning.path) {
+            // Best effort: a read-only cache location only loses persistence.
+            (void)flush_locked(tuning);
+        }
+        tuning.path = path;
+        for (auto& line : loaded) {
+            line.key.kernel = line.kernel;
+            store_locked(tuning, line.key, line.choice);
+        }
+        return true;
+    }
+
+    // Loads PTENSOR_TUNING_CACHE once, unless a cache was loaded explicitly.
+    void load_environment_locked(TuningTable& tuning) {
+        if (tuning.loaded_environment.load(std::memory_order_relaxed)) {
+            return;
+        }
+        const char* path = std::getenv("PTENSOR_TUNING_CACHE");
+        if (path != nullptr && tuning.path.empty()) {
+            (void)load_locked(tuning, path);
+        }
+        tuning.loaded_environment.store(true, std::memory_order_release);
+    }
+}  // namespace
+
+int tile_shape_bucket(int64_t extent) {
+    if (extent < 2) {
+        return 0;
+    }
+    return static_cast<int>(std::bit_width(static_cast<uint64_t>(extent))) - 1;
+}
+
+bool is_autotune_enabled() {
+    return autotune_flag().load(std::memory_order_relaxed);
+}
+
+void set_autotune(bool enabled) {
+    autotune_flag().store(enabled, std::memory_order_relaxed);
+}
+
+std::optional<TileChoice> find_tile_choice(const TileTuningKey& key) {
+    auto& tuning = table();
+    if (!tuning.loaded_environment.load(std::memory_order_acquire)) {
+        const std::lock_guard lock(tuning.mutex);
+        load_environment_locked(tuning);
+    }
+    // Untuned processes, the common case, never touch the mutex.
+    if (tuning.empty.load(std::memory_order_acquire)) {
+        return std::nullopt;
+    }
+    const std::lock_guard lock(tuning.mutex);
+    const auto found = tuning.choices.find(key);
+    if (found == tuning.choices.end()) {
+        return std::nullopt;
+    }
+    return found->second;
+}
+
+void record_tile_choice(const TileTuningKey& key, TileChoice choice) {
+    auto& tuning = table();
+    const std::lock_guard lock(tuning.mutex);
+    load_environment_locked(tuning);
+    store_locked(tuning, key, choice);
+    tuning.dirty = true;
+}
+
+void clear_tile_choices() {
+    auto& tuning = table();
+    const std::lock_guard lock(tuning.mutex);
+    tuning.choices.clear();
+    tuning.kernel_names.clear();
+    tuning.dirty = false;
+    tuning.empty.store(true, std::memory_order_release);
+}
+
+size_t tile_choice_count() {
+    auto& tuning = table();
+    const std::lock_guard lock(tuning.mutex);
+    return tuning.choices.size();
+}
+
+bool load_tile_tuning(const std::string& path) {
+    auto& tuning = table();
+    const std::lock_guard lock(tuning.mutex);
+    // An explicit cache wins over the variable.
+    tuning.loaded_environment.store(true, std::memory_order_release);
+    return load_locked(tuning, path);
+}
+
+bool save_tile_tuning(const std::string& path) {
+    auto& tuning = table();
+    const std::lock_guard lock(tuning.mutex);
+    if (!write_cache(path, tuning.choices)) {
+        return false;
+    }
+    if (path == tuning.path) {
+        tuning.dirty = false;
+    }
+    return true;
+}
+
+bool flush_tile_tuning() {
+    auto& tuning = table();
+    const std::lock_guard lock(tuning.mutex);
+    return flush_locked(tuning);
+}
+
+std::string tile_tuning_path() {
+    auto& tuning = table();
+    const std::lock_guard lock(tuning.mutex);
+    return tuning.path;
+}
+
+}  // namespace p10::simd
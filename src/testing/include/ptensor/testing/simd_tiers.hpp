@@ -0,0 +1,56 @@
+#pragma once
+
+#include <string>
+
+#include <ptensor/initialize.hpp>
+#include <ptensor/tensor.hpp>
+
+#include "compare_tensors.hpp"
+
+namespace p10::testing {
+
+/// Runs `fn(tier)` once per SIMD tier the machine can execute (see
+/// `get_simd_tiers`), with kernel dispatch capped to that tier. The previous
+/// cap is restored afterwards, also when `fn` throws (e.g. a failed REQUIRE).
+template<typename Fn>
+void for_each_simd_tier(Fn&& fn) {
+    struct RestoreCap {
+        std::string previous = get_simd_max();
+
+        ~RestoreCap() {
+            (void)set_simd_max(previous);
+        }
+    } restore;
+
+    for (const auto& tier : get_simd_tiers()) {
+        set_simd_max(tier).expect("Could not cap the SIMD tier");
+        fn(tier);
+    }
+}
+
+/// Runs `op(output)` under every SIMD tier and compares each result against the
+/// portable one.
+///
+/// # Returns
+///
+/// * The first comparison error, naming the tier that disagreed.
+template<typename Op>
+P10Error compare_simd_tiers(Op&& op, const CompareOptions& options = CompareOptions()) {
+    Tensor reference;
+    P10Error result = P10Error::Ok;
+    for_each_simd_tier([&](const std::string& tier) {
+        Tensor output;
+        op(output);
+        if (tier == "portable") {
+            reference = std::move(output);
+            return;
+        }
+        auto error = compare_tensors(output, reference, options);
+        if (error.is_error() && !result.is_error()) {
+            result = P10Error(error.code(), "SIMD tier " + tier + ": " + error.to_string());
+        }
+    });
+    return result;
+}
+
+}  // namespace p10::testing